@@ -31,6 +31,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
 #include <strings.h>
 #include <expat.h>
@@ -45,6 +46,7 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <assert.h>
+#include <pthread.h>
 
 #include <lua.h>
 #include <lauxlib.h>
@@ -76,10 +78,49 @@ typedef struct EdsTableTool_Global
     uint16_t NumMultiple;
 
     char EdsTypeName[64];
+    const char *OutputDir;
+    int ExportStatus;
 
 } EdsTableTool_Global_t;
 
-EdsTableTool_Global_t EdsTableTool_Global;
+/*
+ * A single table job: the set of input files that together produce
+ * one or more table images, plus the job-specific global definitions
+ * (e.g. APPNAME, TABLENAME) that would otherwise be passed via "-e".
+ */
+typedef struct EdsTableTool_Job
+{
+    const char *OutputDir;
+    int NumDefs;
+    int NumInputs;
+    char **Defs;
+    char **Inputs;
+} EdsTableTool_Job_t;
+
+/*
+ * Shared state for the worker pool.  The EDS database itself is
+ * a read-only static object so it is directly shared by all workers;
+ * each job runs in a Lua state of its own.
+ */
+typedef struct EdsTableTool_Batch
+{
+    int NumExpressions;
+    const char **Expressions;
+    size_t NumJobs;
+    size_t NextJob;
+    EdsTableTool_Job_t *JobList;
+    int Status;
+    pthread_mutex_t Lock;
+} EdsTableTool_Batch_t;
+
+/*
+ * Each worker processes one table job at a time, so the per-table state
+ * is thread-local.  The generator functions in the loaded template modules
+ * call back into this via EdsTableTool_GetProcessorId() and EdsTableTool_DoExport().
+ */
+_Thread_local EdsTableTool_Global_t EdsTableTool_Global;
+
+EdsTableTool_Batch_t EdsTableTool_Batch;
 
 
 /*----------------------------------------------------------------
@@ -157,7 +198,8 @@ void EdsTableTool_DoExport(void *arg, const void *filedefptr, const void *objptr
         {
             /* note - error handler already displayed error message */
             fprintf(stderr, "Failed to execute: EdsDB.NewObject(%s)\n", EdsTableTool_Global.EdsTypeName);
-            exit(EXIT_FAILURE);
+            EdsTableTool_Global.ExportStatus = EXIT_FAILURE;
+            break;
         }
 
         /* Fill the Lua object with the data from the C world */
@@ -174,7 +216,15 @@ void EdsTableTool_DoExport(void *arg, const void *filedefptr, const void *objptr
     lua_settop(lua, tbl_pos);
 }
 
-void LoadTemplateFile(lua_State *lua, const char *Filename)
+/*----------------------------------------------------------------
+ *
+ * Load a table template module and add its table to the Applist
+ *
+ * Returns EXIT_FAILURE if the template cannot be used, so that a
+ * bad template only fails its own job rather than the whole batch.
+ *
+ *-----------------------------------------------------------------*/
+int LoadTemplateFile(lua_State *lua, const char *Filename)
 {
     void *dlhandle;
     void *fptr;
@@ -203,7 +253,7 @@ void LoadTemplateFile(lua_State *lua, const char *Filename)
             tmpstr = "[Unknown Error]";
         }
         fprintf(stderr,"Load Error: %s\n", tmpstr);
-        exit(EXIT_FAILURE);
+        return EXIT_FAILURE;
     }
 
     CFE_TBL_FileDefPtr = (CFE_TBL_FileDef_t *)dlsym(dlhandle, "CFE_TBL_FileDef");
@@ -215,7 +265,8 @@ void LoadTemplateFile(lua_State *lua, const char *Filename)
             tmpstr = "[Table object is NULL]";
         }
         fprintf(stderr,"Error looking up CFE_TBL_FileDef: %s\n", tmpstr);
-        exit(EXIT_FAILURE);
+        dlclose(dlhandle);
+        return EXIT_FAILURE;
     }
 
     snprintf(ModuleTempName, sizeof(ModuleTempName), "%s_EDS_TYPEDEF_NAME", CFE_TBL_FileDefPtr->ObjectName);
@@ -228,7 +279,8 @@ void LoadTemplateFile(lua_State *lua, const char *Filename)
             tmpstr = "[Object pointer is NULL]";
         }
         fprintf(stderr,"Lookup Error on '%s': %s\n", ModuleTempName, tmpstr);
-        exit(EXIT_FAILURE);
+        dlclose(dlhandle);
+        return EXIT_FAILURE;
     }
 
     strncpy(EdsTypeName, fptr, sizeof(EdsTypeName) - 1);
@@ -245,7 +297,8 @@ void LoadTemplateFile(lua_State *lua, const char *Filename)
             tmpstr = "[Object pointer is NULL]";
         }
         fprintf(stderr,"Lookup Error on '%s': %s\n", ModuleTempName, tmpstr);
-        exit(EXIT_FAILURE);
+        dlclose(dlhandle);
+        return EXIT_FAILURE;
     }
 
     *((void **)&DynamicGeneratorFuncPtr) = fptr;
@@ -319,7 +372,8 @@ void LoadTemplateFile(lua_State *lua, const char *Filename)
     if (EdsAppName == NULL)
     {
         fprintf(stderr,"Aborting table build, unidentified application: %s\n", CFE_TBL_FileDefPtr->TableName);
-        exit(EXIT_FAILURE);
+        dlclose(dlhandle);
+        return EXIT_FAILURE;
     }
 
     /*
@@ -403,7 +457,8 @@ void LoadTemplateFile(lua_State *lua, const char *Filename)
     if (!EdsLib_Is_Valid(EdsId) || EdsLib_DataTypeDB_GetTypeInfo(&EDS_DATABASE, EdsId, &TypeInfo) != EDSLIB_SUCCESS)
     {
         fprintf(stderr,"Error: Cannot get info for table EDS Type Name \'%s\' (id %x)\n", EdsTypeName, (unsigned int)EdsId);
-        exit(EXIT_FAILURE);
+        dlclose(dlhandle);
+        return EXIT_FAILURE;
     }
 
     printf("--> Using EDS ID 0x%x for \'%s\' data structure, %lu bytes\n",(unsigned int)EdsId,EdsTypeName,(unsigned long)TypeInfo.Size.Bytes);
@@ -412,7 +467,8 @@ void LoadTemplateFile(lua_State *lua, const char *Filename)
     {
         fprintf(stderr,"Error: Data size mismatch for EDS Type \'%s\' (id %x): %lu(file)/%lu(EDS)\n",
             EdsTypeName, (unsigned int)EdsId, (unsigned long)CFE_TBL_FileDefPtr->ObjectSize, (unsigned long)TypeInfo.Size.Bytes);
-        exit(EXIT_FAILURE);
+        dlclose(dlhandle);
+        return EXIT_FAILURE;
     }
 
     EdsTableTool_Global.NumMultiple = CFE_TBL_FileDefPtr->ObjectSize / TypeInfo.Size.Bytes;
@@ -467,6 +523,13 @@ void LoadTemplateFile(lua_State *lua, const char *Filename)
         lua_settop(lua, obj_idx);
     }
 
+    if (EdsTableTool_Global.ExportStatus != EXIT_SUCCESS)
+    {
+        fprintf(stderr, "Failed to export content of table: %s\n", CFE_TBL_FileDefPtr->TableName);
+        dlclose(dlhandle);
+        return EXIT_FAILURE;
+    }
+
     dlclose(dlhandle);
 
     /* Append the Applist table to hold the loaded table template objects */
@@ -476,22 +539,26 @@ void LoadTemplateFile(lua_State *lua, const char *Filename)
 
     lua_setfield(lua, -2, TableName);  /* Set entry in App table */
     lua_pop(lua, 1);
+
+    return EXIT_SUCCESS;
 }
 
-void LoadLuaFile(lua_State *lua, const char *Filename)
+int LoadLuaFile(lua_State *lua, const char *Filename)
 {
     if (luaL_loadfile(lua, Filename) != LUA_OK)
     {
         fprintf(stderr,"Cannot load Lua file: %s: %s\n", Filename, lua_tostring(lua, -1));
-        exit(EXIT_FAILURE);
+        return EXIT_FAILURE;
     }
     printf("Executing LUA: %s\n", Filename);
     if (lua_pcall(lua, 0, 0, 1) != LUA_OK)
     {
         /* note - error handler already displayed error message */
         fprintf(stderr, "Failed to execute: %s\n", Filename);
-        exit(EXIT_FAILURE);
+        return EXIT_FAILURE;
     }
+
+    return EXIT_SUCCESS;
 }
 
 void PushEncodedSingleObject(lua_State *lua)
@@ -528,20 +595,87 @@ void PushEncodedMultiObject(lua_State *lua)
     lua_concat(lua, num_enc);
 }
 
-int Write_GenericFile(lua_State *lua)
+/*----------------------------------------------------------------
+ *
+ * Write an output file, unless it already exists with identical content
+ *
+ * Leaving an unchanged file untouched preserves its timestamp, so that
+ * build steps which depend on the table image are not re-run.  Relative
+ * names are interpreted against the output directory of the current job.
+ *
+ *-----------------------------------------------------------------*/
+void EdsTableTool_WriteOutputFile(lua_State *lua, const char *OutputName, const void *Content, size_t ContentSize)
 {
-    FILE *OutputFile = NULL;
-    const char *OutputName = luaL_checkstring(lua, 1);
+    char PathBuffer[PATH_MAX];
+    uint8_t CompareBuffer[4096];
+    FILE *OutputFile;
+    const uint8_t *CurrPtr;
+    size_t Remain;
+    size_t ChunkSize;
+    struct stat st;
+    bool IsSame;
+
+    if (EdsTableTool_Global.OutputDir != NULL && OutputName[0] != '/')
+    {
+        snprintf(PathBuffer, sizeof(PathBuffer), "%s/%s", EdsTableTool_Global.OutputDir, OutputName);
+        OutputName = PathBuffer;
+    }
+
+    IsSame = false;
+    if (stat(OutputName, &st) == 0 && st.st_size == (off_t)ContentSize)
+    {
+        OutputFile = fopen(OutputName, "r");
+        if (OutputFile != NULL)
+        {
+            IsSame = true;
+            CurrPtr = Content;
+            Remain = ContentSize;
+            while (IsSame && Remain > 0)
+            {
+                ChunkSize = Remain;
+                if (ChunkSize > sizeof(CompareBuffer))
+                {
+                    ChunkSize = sizeof(CompareBuffer);
+                }
+                if (fread(CompareBuffer, ChunkSize, 1, OutputFile) != 1 ||
+                        memcmp(CompareBuffer, CurrPtr, ChunkSize) != 0)
+                {
+                    IsSame = false;
+                }
+                CurrPtr += ChunkSize;
+                Remain -= ChunkSize;
+            }
+            fclose(OutputFile);
+        }
+    }
+
+    if (IsSame)
+    {
+        printf("Unchanged File: %s\n", OutputName);
+        return;
+    }
 
     OutputFile = fopen(OutputName, "w");
     if (OutputFile == NULL)
     {
-        return luaL_error(lua, "%s: %s", OutputName, strerror(errno));
+        luaL_error(lua, "%s: %s", OutputName, strerror(errno));
+        return;
     }
 
-    PushEncodedSingleObject(lua);
-    fwrite(lua_tostring(lua, -1), lua_rawlen(lua, -1), 1, OutputFile);
+    if (ContentSize > 0)
+    {
+        fwrite(Content, ContentSize, 1, OutputFile);
+    }
     fclose(OutputFile);
+    printf("Wrote File: %s\n", OutputName);
+}
+
+int Write_GenericFile(lua_State *lua)
+{
+    const char *OutputName = luaL_checkstring(lua, 1);
+
+    PushEncodedSingleObject(lua);
+    EdsTableTool_WriteOutputFile(lua, OutputName, lua_tostring(lua, -1), lua_rawlen(lua, -1));
     lua_pop(lua, 1);
 
     return 0;
@@ -559,7 +693,6 @@ int Write_CFE_EnacapsulationFile(lua_State *lua)
     uint32_t TblHeaderBlockSize;
     uint32_t FileHeaderBlockSize;
     EdsLib_Id_t PackedEdsId;
-    FILE *OutputFile = NULL;
     const char *OutputName = luaL_checkstring(lua, 1);
     EdsLib_DataTypeDB_TypeInfo_t BlockInfo;
     const void *content_ptr;
@@ -606,27 +739,27 @@ int Write_CFE_EnacapsulationFile(lua_State *lua)
     EdsLib_DataTypeDB_GetTypeInfo(&EDS_DATABASE, PackedEdsId, &BlockInfo);
     FileHeaderBlockSize = (BlockInfo.Size.Bits + 7) / 8;
 
-    OutputFile = fopen(OutputName, "w");
-    if (OutputFile == NULL)
-    {
-        return luaL_error(lua, "%s: %s", OutputName, strerror(errno));
-    }
-
-    fwrite(PackedFileHeader, FileHeaderBlockSize, 1, OutputFile);
-    fwrite(PackedTblHeader, TblHeaderBlockSize, 1, OutputFile);
+    /*
+     * Assemble the complete file image in memory first, so it can be
+     * compared against any existing output before writing.
+     */
     content_ptr = lua_tostring(lua, -1);
     content_sz = lua_rawlen(lua, -1);
+    lua_pushlstring(lua, (const char *)PackedFileHeader, FileHeaderBlockSize);
+    lua_pushlstring(lua, (const char *)PackedTblHeader, TblHeaderBlockSize);
     if (content_ptr != NULL && content_sz > 0)
     {
-        fwrite(content_ptr, content_sz, 1, OutputFile);
+        lua_pushvalue(lua, -3);
+        lua_concat(lua, 3);
     }
     else
     {
         fprintf(stderr, "WARNING: No content produced\n");
+        lua_concat(lua, 2);
     }
-    fclose(OutputFile);
-    printf("Wrote File: %s\n", OutputName);
-    lua_pop(lua, 1);
+
+    EdsTableTool_WriteOutputFile(lua, OutputName, lua_tostring(lua, -1), lua_rawlen(lua, -1));
+    lua_pop(lua, 2);
 
     return 0;
 }
@@ -643,14 +776,19 @@ static int ErrorHandler(lua_State *lua)
     return 0;
 }
 
-int main(int argc, char *argv[])
+/*----------------------------------------------------------------
+ *
+ * Create and set up a Lua state for a job
+ *
+ * Every job starts from a new state, so nothing a previous job changed,
+ * including nested tables such as package.loaded, can affect its output.
+ * Returns NULL if any of the command line expressions fail.
+ *
+ *-----------------------------------------------------------------*/
+lua_State *EdsTableTool_NewState(const EdsTableTool_Batch_t *Batch)
 {
-    int arg;
-    size_t slen;
     lua_State *lua;
-
-    EdsLib_Initialize();
-    memset(&EdsTableTool_Global, 0, sizeof(EdsTableTool_Global));
+    int i;
 
     /* Create a Lua state and register all of our local test functions */
     lua = luaL_newstate();
@@ -659,75 +797,24 @@ int main(int argc, char *argv[])
     /* Stack index 1 will be the error handler function (used for protected calls) */
     lua_pushcfunction(lua, ErrorHandler);
 
-    /* Create an Applist table to hold the loaded table template objects */
-    lua_newtable(lua);
-    lua_rawsetp(lua, LUA_REGISTRYINDEX, &LUA_APPLIST_KEY);
-
-    while ((arg = getopt (argc, argv, "e:")) != -1)
-    {
-       switch (arg)
-       {
-       case 'e':
-          if (luaL_loadstring(lua, optarg) != LUA_OK)
-          {
-              fprintf(stderr,"ERROR: Invalid command line expression: %s\n",
-                      luaL_tolstring(lua,-1, NULL));
-              lua_pop(lua, 2);
-              return EXIT_FAILURE;
-          }
-
-          if (lua_pcall(lua, 0, 0, 1) != LUA_OK)
-          {
-              fprintf(stderr,"ERROR: Cannot evaluate command line expression: %s\n",
-                      luaL_tolstring(lua,-1, NULL));
-              lua_pop(lua, 2);
-              return EXIT_FAILURE;
-          }
-          break;
-
-       case '?':
-          if (isprint (optopt))
-          {
-             fprintf(stderr, "Unknown option `-%c'.\n", optopt);
-          }
-          else
-          {
-             fprintf(stderr, "Unknown option character `\\x%x'.\n", optopt);
-          }
-          return EXIT_FAILURE;
-          break;
-
-       default:
-          return EXIT_FAILURE;
-          break;
-       }
-    }
-
-    /* All additional args are input files.  If none, this should be considered an error */
-    if (optind >= argc)
+    for (i = 0; i < Batch->NumExpressions; ++i)
     {
-        fprintf(stderr, "ERROR: No input files specified on command line.\n");
-        return EXIT_FAILURE;
-    }
+        if (luaL_loadstring(lua, Batch->Expressions[i]) != LUA_OK)
+        {
+            fprintf(stderr,"ERROR: Invalid command line expression: %s\n",
+                    luaL_tolstring(lua,-1, NULL));
+            lua_close(lua);
+            return NULL;
+        }
 
-    /* The CPUNAME and CPUNUMBER variables should both be defined.
-     * If only one was provided then look up the other value in EDS */
-    lua_getglobal(lua, "CPUNAME");
-    lua_getglobal(lua, "CPUNUMBER");
-    if (lua_isstring(lua, -2) && lua_isnil(lua, -1))
-    {
-        lua_pushinteger(lua, CFE_MissionLib_GetInstanceNumber(&CFE_SOFTWAREBUS_INTERFACE,
-                lua_tostring(lua, -2)));
-        lua_setglobal(lua, "CPUNUMBER");
-    }
-    else if (lua_isnumber(lua, -1) && lua_isnil(lua, -2))
-    {
-        char TempBuf[64];
-        lua_pushstring(lua, CFE_MissionLib_GetInstanceName(&CFE_SOFTWAREBUS_INTERFACE,
-                lua_tointeger(lua, -1), TempBuf, sizeof(TempBuf)));
-        lua_setglobal(lua, "CPUNAME");
+        if (lua_pcall(lua, 0, 0, 1) != LUA_OK)
+        {
+            fprintf(stderr,"ERROR: Cannot evaluate command line expression: %s\n",
+                    luaL_tolstring(lua,-1, NULL));
+            lua_close(lua);
+            return NULL;
+        }
     }
-    lua_pop(lua, 2);
 
     /*
      * if the SIMULATION compile-time directive is set, create a global
@@ -755,26 +842,84 @@ int main(int argc, char *argv[])
     CFE_MissionLib_Lua_SoftwareBus_Attach(lua, &CFE_SOFTWAREBUS_INTERFACE);
     lua_setglobal(lua, "EdsDB");
 
+    return lua;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Process a single table job using the given Lua state
+ *
+ *-----------------------------------------------------------------*/
+int EdsTableTool_RunJob(lua_State *lua, const EdsTableTool_Job_t *Job)
+{
+    int i;
+    int Status;
+    size_t slen;
+    const char *Value;
+
+    memset(&EdsTableTool_Global, 0, sizeof(EdsTableTool_Global));
+    EdsTableTool_Global.ExportStatus = EXIT_SUCCESS;
+    EdsTableTool_Global.OutputDir = Job->OutputDir;
+
+    /* Create an Applist table to hold the loaded table template objects */
+    lua_newtable(lua);
+    lua_rawsetp(lua, LUA_REGISTRYINDEX, &LUA_APPLIST_KEY);
+
+    /* Job-specific definitions are in the form NAME=VALUE and set as string globals */
+    for (i = 0; i < Job->NumDefs; ++i)
+    {
+        Value = strchr(Job->Defs[i], '=');
+        lua_pushglobaltable(lua);
+        lua_pushlstring(lua, Job->Defs[i], Value - Job->Defs[i]);
+        lua_pushstring(lua, Value + 1);
+        lua_settable(lua, -3);
+        lua_pop(lua, 1);
+    }
+
+    /* The CPUNAME and CPUNUMBER variables should both be defined.
+     * If only one was provided then look up the other value in EDS */
+    lua_getglobal(lua, "CPUNAME");
+    lua_getglobal(lua, "CPUNUMBER");
+    if (lua_isstring(lua, -2) && lua_isnil(lua, -1))
+    {
+        lua_pushinteger(lua, CFE_MissionLib_GetInstanceNumber(&CFE_SOFTWAREBUS_INTERFACE,
+                lua_tostring(lua, -2)));
+        lua_setglobal(lua, "CPUNUMBER");
+    }
+    else if (lua_isnumber(lua, -1) && lua_isnil(lua, -2))
+    {
+        char TempBuf[64];
+        lua_pushstring(lua, CFE_MissionLib_GetInstanceName(&CFE_SOFTWAREBUS_INTERFACE,
+                lua_tointeger(lua, -1), TempBuf, sizeof(TempBuf)));
+        lua_setglobal(lua, "CPUNAME");
+    }
+    lua_pop(lua, 2);
+
     lua_getglobal(lua, "CPUNUMBER");
     EdsTableTool_Global.ProcessorId = lua_tointeger(lua, -1);
     lua_pop(lua, 1);
 
-    for (arg = optind; arg < argc; arg++)
+    for (i = 0; i < Job->NumInputs; i++)
     {
         /* assume the argument is a file to execute/load */
-        slen = strlen(argv[arg]);
-        if (slen >= 3 && strcmp(argv[arg] + slen - 3, ".so") == 0)
+        slen = strlen(Job->Inputs[i]);
+        if (slen >= 3 && strcmp(Job->Inputs[i] + slen - 3, ".so") == 0)
         {
-            LoadTemplateFile(lua, argv[arg]);
+            Status = LoadTemplateFile(lua, Job->Inputs[i]);
         }
-        else if (slen >= 4 && strcmp(argv[arg] + slen - 4, ".lua") == 0)
+        else if (slen >= 4 && strcmp(Job->Inputs[i] + slen - 4, ".lua") == 0)
         {
-            LoadLuaFile(lua, argv[arg]);
+            Status = LoadLuaFile(lua, Job->Inputs[i]);
         }
         else
         {
-            fprintf(stderr,"WARNING: Unable to handle file argument: %s\n",argv[arg]);
-            return EXIT_FAILURE;
+            fprintf(stderr,"WARNING: Unable to handle file argument: %s\n",Job->Inputs[i]);
+            Status = EXIT_FAILURE;
+        }
+
+        if (Status != EXIT_SUCCESS)
+        {
+            return Status;
         }
     }
 
@@ -807,3 +952,266 @@ int main(int argc, char *argv[])
 
     return EXIT_SUCCESS;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Worker thread entry point
+ *
+ * Each worker takes jobs from the list in order until none remain or
+ * any job has failed.
+ *
+ *-----------------------------------------------------------------*/
+void *EdsTableTool_Worker(void *Arg)
+{
+    EdsTableTool_Batch_t *Batch = Arg;
+    lua_State *lua;
+    size_t JobIdx;
+    int Status;
+
+    Status = EXIT_SUCCESS;
+    while (Status == EXIT_SUCCESS)
+    {
+        pthread_mutex_lock(&Batch->Lock);
+        JobIdx = Batch->NextJob;
+        if (Batch->Status != EXIT_SUCCESS)
+        {
+            JobIdx = Batch->NumJobs;
+        }
+        else if (JobIdx < Batch->NumJobs)
+        {
+            ++Batch->NextJob;
+        }
+        pthread_mutex_unlock(&Batch->Lock);
+
+        if (JobIdx >= Batch->NumJobs)
+        {
+            break;
+        }
+
+        lua = EdsTableTool_NewState(Batch);
+        if (lua == NULL)
+        {
+            Status = EXIT_FAILURE;
+            break;
+        }
+
+        Status = EdsTableTool_RunJob(lua, &Batch->JobList[JobIdx]);
+        lua_close(lua);
+    }
+
+    if (Status != EXIT_SUCCESS)
+    {
+        pthread_mutex_lock(&Batch->Lock);
+        Batch->Status = Status;
+        pthread_mutex_unlock(&Batch->Lock);
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Read a list of table jobs from a file
+ *
+ * Each non-blank line not starting with '#' describes one job, as
+ * whitespace-separated fields:
+ *   - The first field is the directory where output files are written
+ *   - Fields of the form NAME=VALUE are set as string globals for the job
+ *   - All other fields are input files (.so or .lua), processed in order
+ *
+ *-----------------------------------------------------------------*/
+int EdsTableTool_ReadJobList(EdsTableTool_Batch_t *Batch, const char *Filename)
+{
+    FILE *ListFile;
+    char *LineBuffer;
+    size_t LineSize;
+    char *Token;
+    EdsTableTool_Job_t *Job;
+
+    ListFile = fopen(Filename, "r");
+    if (ListFile == NULL)
+    {
+        fprintf(stderr, "%s: %s\n", Filename, strerror(errno));
+        return EXIT_FAILURE;
+    }
+
+    LineBuffer = NULL;
+    LineSize = 0;
+    while (getline(&LineBuffer, &LineSize, ListFile) >= 0)
+    {
+        Token = strtok(LineBuffer, " \t\r\n");
+        if (Token == NULL || Token[0] == '#')
+        {
+            continue;
+        }
+
+        Batch->JobList = realloc(Batch->JobList, (Batch->NumJobs + 1) * sizeof(*Batch->JobList));
+        assert(Batch->JobList != NULL);
+        Job = &Batch->JobList[Batch->NumJobs];
+        ++Batch->NumJobs;
+
+        memset(Job, 0, sizeof(*Job));
+        Job->OutputDir = strdup(Token);
+
+        while ((Token = strtok(NULL, " \t\r\n")) != NULL)
+        {
+            if (strchr(Token, '=') != NULL)
+            {
+                Job->Defs = realloc(Job->Defs, (Job->NumDefs + 1) * sizeof(*Job->Defs));
+                assert(Job->Defs != NULL);
+                Job->Defs[Job->NumDefs] = strdup(Token);
+                ++Job->NumDefs;
+            }
+            else
+            {
+                Job->Inputs = realloc(Job->Inputs, (Job->NumInputs + 1) * sizeof(*Job->Inputs));
+                assert(Job->Inputs != NULL);
+                Job->Inputs[Job->NumInputs] = strdup(Token);
+                ++Job->NumInputs;
+            }
+        }
+
+        if (Job->NumInputs == 0)
+        {
+            fprintf(stderr, "ERROR: %s: No input files specified for output to %s\n", Filename, Job->OutputDir);
+            free(LineBuffer);
+            fclose(ListFile);
+            return EXIT_FAILURE;
+        }
+    }
+
+    free(LineBuffer);
+    fclose(ListFile);
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    int arg;
+    long NumWorkers;
+    long WorkerIdx;
+    pthread_t *WorkerList;
+    const char *JobListFile;
+    EdsTableTool_Job_t SingleJob;
+
+    EdsLib_Initialize();
+    memset(&EdsTableTool_Batch, 0, sizeof(EdsTableTool_Batch));
+    pthread_mutex_init(&EdsTableTool_Batch.Lock, NULL);
+    EdsTableTool_Batch.Status = EXIT_SUCCESS;
+    NumWorkers = 1;
+    JobListFile = NULL;
+
+    while ((arg = getopt (argc, argv, "e:j:l:")) != -1)
+    {
+       switch (arg)
+       {
+       case 'e':
+          /* Expressions are evaluated in order in every worker Lua state */
+          EdsTableTool_Batch.Expressions = realloc(EdsTableTool_Batch.Expressions,
+                  (EdsTableTool_Batch.NumExpressions + 1) * sizeof(*EdsTableTool_Batch.Expressions));
+          assert(EdsTableTool_Batch.Expressions != NULL);
+          EdsTableTool_Batch.Expressions[EdsTableTool_Batch.NumExpressions] = optarg;
+          ++EdsTableTool_Batch.NumExpressions;
+          break;
+
+       case 'j':
+          NumWorkers = strtol(optarg, NULL, 0);
+          if (NumWorkers <= 0)
+          {
+              NumWorkers = sysconf(_SC_NPROCESSORS_ONLN);
+          }
+          break;
+
+       case 'l':
+          JobListFile = optarg;
+          break;
+
+       case '?':
+          if (isprint (optopt))
+          {
+             fprintf(stderr, "Unknown option `-%c'.\n", optopt);
+          }
+          else
+          {
+             fprintf(stderr, "Unknown option character `\\x%x'.\n", optopt);
+          }
+          return EXIT_FAILURE;
+          break;
+
+       default:
+          return EXIT_FAILURE;
+          break;
+       }
+    }
+
+    if (JobListFile != NULL)
+    {
+        if (optind < argc)
+        {
+            fprintf(stderr, "ERROR: Input files cannot be combined with a job list.\n");
+            return EXIT_FAILURE;
+        }
+
+        if (EdsTableTool_ReadJobList(&EdsTableTool_Batch, JobListFile) != EXIT_SUCCESS)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    else if (optind < argc)
+    {
+        /* All additional args are input files for a single job, written to the current dir */
+        memset(&SingleJob, 0, sizeof(SingleJob));
+        SingleJob.NumInputs = argc - optind;
+        SingleJob.Inputs = &argv[optind];
+        EdsTableTool_Batch.JobList = &SingleJob;
+        EdsTableTool_Batch.NumJobs = 1;
+    }
+
+    /* If there are no input files, this should be considered an error */
+    if (EdsTableTool_Batch.NumJobs == 0)
+    {
+        fprintf(stderr, "ERROR: No input files specified on command line.\n");
+        return EXIT_FAILURE;
+    }
+
+    if (NumWorkers > EdsTableTool_Batch.NumJobs)
+    {
+        NumWorkers = EdsTableTool_Batch.NumJobs;
+    }
+
+    if (NumWorkers <= 1)
+    {
+        EdsTableTool_Worker(&EdsTableTool_Batch);
+    }
+    else
+    {
+        /* Keep the log output from the workers readable when interleaved */
+        setvbuf(stdout, NULL, _IOLBF, 0);
+
+        WorkerList = calloc(NumWorkers, sizeof(*WorkerList));
+        assert(WorkerList != NULL);
+        for (WorkerIdx = 0; WorkerIdx < NumWorkers; ++WorkerIdx)
+        {
+            arg = pthread_create(&WorkerList[WorkerIdx], NULL, EdsTableTool_Worker, &EdsTableTool_Batch);
+            if (arg != 0)
+            {
+                fprintf(stderr, "ERROR: Unable to create worker thread: %s\n", strerror(arg));
+                pthread_mutex_lock(&EdsTableTool_Batch.Lock);
+                EdsTableTool_Batch.Status = EXIT_FAILURE;
+                pthread_mutex_unlock(&EdsTableTool_Batch.Lock);
+                break;
+            }
+        }
+
+        while (WorkerIdx > 0)
+        {
+            --WorkerIdx;
+            pthread_join(WorkerList[WorkerIdx], NULL);
+        }
+
+        free(WorkerList);
+    }
+
+    return EdsTableTool_Batch.Status;
+}
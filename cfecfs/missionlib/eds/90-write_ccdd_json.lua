@@ -18,6 +18,11 @@
 -- limitations under the License.
 --
 
+-- -------------------------------------------------------------------------
+-- SEDS_PARALLEL_SAFE: this script only reads the DOM and writes its own
+-- output files, so it may be executed in a separate worker process.
+-- -------------------------------------------------------------------------
+
 
 local function dump_eds_info(params)
   print(string.format("dump_eds_info type=%s", SEDS.edslib.GetMetaData(params).TypeName))
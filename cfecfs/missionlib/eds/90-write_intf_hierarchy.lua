@@ -23,6 +23,9 @@
 -- This generates dot files based on the interface hierarchy which can be
 -- easily turned into graphics using the "dot" tool.
 -- This script should run late in the processing stages
+--
+-- SEDS_PARALLEL_SAFE: this script only reads the DOM and writes its own
+-- output files, so it may be executed in a separate worker process.
 -- ---------------------------------------------
 
 local function add_edges(output,inst)
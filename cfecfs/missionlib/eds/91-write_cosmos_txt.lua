@@ -18,6 +18,11 @@
 -- limitations under the License.
 --
 
+-- -------------------------------------------------------------------------
+-- SEDS_PARALLEL_SAFE: this script only reads the DOM and writes its own
+-- output files, so it may be executed in a separate worker process.
+-- -------------------------------------------------------------------------
+
 
 local write_cosmos_tlm_lineitem
 local write_cosmos_cmd_lineitem
@@ -0,0 +1,116 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     cfe_missionlib_cmdcode.h
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Indexed lookup of command message types by command code.
+ *
+ * The commands on a topic are the types derived from the topic argument
+ * type, each identified by a value constraint on the command code.  Finding
+ * the type for a given code otherwise requires walking the constraints of
+ * every derived type.  The index does this once and then serves each lookup
+ * directly from a table.
+ *
+ * The index does not allocate memory; the caller supplies the index object.
+ */
+
+#ifndef _CFE_MISSIONLIB_CMDCODE_H_
+#define _CFE_MISSIONLIB_CMDCODE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "edslib_datatypedb.h"
+
+/******************************
+ * MACROS
+ ******************************/
+
+/**
+ * The number of distinct command codes that can be indexed.
+ * Command codes are stored in an 8 bit field in the CFE command header.
+ */
+#ifndef CFE_MISSIONLIB_MAX_COMMAND_CODES
+#define CFE_MISSIONLIB_MAX_COMMAND_CODES 256
+#endif
+
+/******************************
+ * TYPEDEFS
+ ******************************/
+
+/**
+ * Command code index object
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+typedef struct CFE_MissionLib_CommandCodeIndex
+{
+    EdsLib_Id_t BaseEdsId;
+    uint16_t    NumCommands;
+    EdsLib_Id_t EdsIdByCode[CFE_MISSIONLIB_MAX_COMMAND_CODES];
+} CFE_MissionLib_CommandCodeIndex_t;
+
+/******************************
+ * API CALLS
+ ******************************/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * Build the command code index for a command argument type
+     *
+     * Each type derived from the base type is entered into the index using
+     * the value of its integer constraint.  For CFE commands the command code
+     * is the only constraint.  Derived types without an integer constraint, or
+     * with a value outside the range of the index, cannot be looked up.
+     *
+     * @param Index the index object to initialize
+     * @param GD the EDS database object
+     * @param BaseEdsId the EDS ID of the command argument type, i.e. from
+     *          CFE_MissionLib_GetArgumentType()
+     * @return CFE_MISSIONLIB_SUCCESS if successful, or an error code
+     */
+    int32_t CFE_MissionLib_CommandCodeIndex_Init(CFE_MissionLib_CommandCodeIndex_t *Index,
+                                                 const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseEdsId);
+
+    /**
+     * Look up the command message type for a command code
+     *
+     * @param Index the index object from CFE_MissionLib_CommandCodeIndex_Init()
+     * @param CommandCode the command code value
+     * @param EdsId buffer to store the EDS ID of the command type
+     * @return CFE_MISSIONLIB_SUCCESS if successful, or CFE_MISSIONLIB_INVALID_SUBCOMMAND
+     *          if there is no command with the given code
+     */
+    int32_t CFE_MissionLib_CommandCodeIndex_Lookup(const CFE_MissionLib_CommandCodeIndex_t *Index,
+                                                   uint32_t CommandCode, EdsLib_Id_t *EdsId);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* _CFE_MISSIONLIB_CMDCODE_H_ */
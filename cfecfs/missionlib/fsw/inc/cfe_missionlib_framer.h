@@ -0,0 +1,246 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     cfe_missionlib_framer.h
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Splits a continuous byte stream of concatenated packets (i.e. from a file,
+ * TCP connection, or serial capture) into individual packets.
+ *
+ * Packet boundaries are found using the length field (LengthEntry) that
+ * the EDS defines in the packet base type, so no packet-format specific
+ * code is required.  Packets are returned as slices that point directly
+ * into the framer buffer; the packet data is not copied.
+ *
+ * The framer does not allocate memory; the caller supplies both the
+ * framer object and the buffer.
+ *
+ * The length field decoding is part of the "full" EdsLib runtime library, so
+ * applications using the framer must link with that rather than edslib_minimal.
+ */
+
+#ifndef _CFE_MISSIONLIB_FRAMER_H_
+#define _CFE_MISSIONLIB_FRAMER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "edslib_datatypedb.h"
+
+/******************************
+ * TYPEDEFS
+ ******************************/
+
+/**
+ * Check applied to every candidate packet header
+ *
+ * This decodes the header (i.e. to get the MsgId) and may also reject
+ * candidates that have a plausible length but are not actually packets.  A
+ * rejected candidate is treated the same as a corrupt length, and the framer
+ * will search for the next valid packet.
+ *
+ * The check is also applied to the header following a candidate packet when
+ * regaining synchronization, so it must only depend on the header content;
+ * only the packet base type is guaranteed to be present at HeaderData.
+ *
+ * @param Arg opaque user argument
+ * @param HeaderData the candidate packet header
+ * @param PacketSize the total size of the candidate packet, in bytes
+ * @param MsgId buffer to store the MsgId value of the packet
+ * @return true if the header is valid, false to reject it
+ */
+typedef bool (*CFE_MissionLib_Framer_HeaderCheck_t)(void *Arg, const void *HeaderData, uint32_t PacketSize,
+                                                    uint32_t *MsgId);
+
+/**
+ * A single packet found by the framer
+ *
+ * The data pointer refers to the framer buffer, and is valid until the
+ * next call to CFE_MissionLib_Framer_GetWriteBuffer().
+ */
+typedef struct CFE_MissionLib_Framer_Slice
+{
+    const uint8_t *Data;
+    uint32_t Length;
+    uint32_t MsgId;
+} CFE_MissionLib_Framer_Slice_t;
+
+typedef struct CFE_MissionLib_Framer_Stats
+{
+    uint32_t PacketCount;   /**< Number of packets returned */
+    uint64_t PacketBytes;   /**< Total size of all packets returned */
+    uint64_t DiscardBytes;  /**< Number of bytes skipped while searching for a valid packet */
+    uint32_t ResyncCount;   /**< Number of times synchronization was lost */
+} CFE_MissionLib_Framer_Stats_t;
+
+/**
+ * Framer state object
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+typedef struct CFE_MissionLib_Framer
+{
+    const EdsLib_DatabaseObject_t *GD;
+    EdsLib_DataTypeDB_LengthFieldInfo_t LengthInfo;
+    uint32_t MinPacketSize;
+    uint32_t MaxPacketSize;
+    CFE_MissionLib_Framer_HeaderCheck_t HeaderCheck;
+    void *HeaderCheckArg;
+
+    uint8_t *Buffer;
+    uint32_t BufferSize;
+    uint32_t ReadPos;
+    uint32_t WritePos;
+    bool InSync;
+    bool EndOfStream;
+
+    CFE_MissionLib_Framer_Stats_t Stats;
+} CFE_MissionLib_Framer_t;
+
+/******************************
+ * API CALLS
+ ******************************/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * Initialize a framer for the given packet base type
+     *
+     * The base type must contain a LengthEntry, either directly or within a base
+     * type or sub-container, which gives the total size of each packet.  For CFE
+     * software bus traffic this would normally be CFE_HDR_Message or CCSDS_SpacePacket.
+     *
+     * The buffer must be able to hold at least two maximum-size packets.
+     *
+     * The MsgId of each packet is decoded using CFE_MissionLib_Framer_DecodeMsgId(),
+     * so the application must also link the missionlib runtime library.  This can
+     * be changed via CFE_MissionLib_Framer_SetHeaderCheck().
+     *
+     * @param Framer the framer object to initialize
+     * @param GD the EDS database object
+     * @param PacketEdsId the EDS ID of the packet base type
+     * @param Buffer memory to use for buffering the stream
+     * @param BufferSize size of the buffer, in bytes
+     * @param MaxPacketSize the largest packet to accept, or 0 to use the
+     *          largest size the length field can represent.
+     * @return CFE_MISSIONLIB_SUCCESS if successful, or an error code
+     */
+    int32_t CFE_MissionLib_Framer_Init(CFE_MissionLib_Framer_t *Framer, const EdsLib_DatabaseObject_t *GD,
+                                       EdsLib_Id_t PacketEdsId, void *Buffer, uint32_t BufferSize,
+                                       uint32_t MaxPacketSize);
+
+    /**
+     * Set a check function to be applied to every candidate packet
+     *
+     * This replaces the default MsgId decoding.  If set NULL, no check
+     * is applied and the MsgId of every packet will be 0.
+     *
+     * @sa CFE_MissionLib_Framer_HeaderCheck_t
+     */
+    void CFE_MissionLib_Framer_SetHeaderCheck(CFE_MissionLib_Framer_t *Framer,
+                                              CFE_MissionLib_Framer_HeaderCheck_t HeaderCheck, void *Arg);
+
+    /**
+     * Get the location where the next stream data should be written
+     *
+     * The caller may write up to the returned number of bytes at this location (i.e.
+     * by passing it directly to read() or recv()), then must call
+     * CFE_MissionLib_Framer_CommitWrite() with the actual amount written.
+     *
+     * This may relocate a trailing partial packet within the buffer, which
+     * invalidates any slices previously returned.
+     *
+     * @param Framer the framer object
+     * @param AvailSize buffer to store the available space, in bytes
+     * @return pointer to the write location
+     */
+    uint8_t *CFE_MissionLib_Framer_GetWriteBuffer(CFE_MissionLib_Framer_t *Framer, uint32_t *AvailSize);
+
+    /**
+     * Indicate that data was written to the location returned by CFE_MissionLib_Framer_GetWriteBuffer()
+     *
+     * @param Framer the framer object
+     * @param Size the number of bytes written
+     */
+    void CFE_MissionLib_Framer_CommitWrite(CFE_MissionLib_Framer_t *Framer, uint32_t Size);
+
+    /**
+     * Indicate that no more data will be written
+     *
+     * This allows the last packets in the stream to be returned without waiting
+     * for the data that follows them, and causes any incomplete data at the
+     * end of the stream to be discarded.
+     *
+     * @param Framer the framer object
+     */
+    void CFE_MissionLib_Framer_SetEndOfStream(CFE_MissionLib_Framer_t *Framer);
+
+    /**
+     * Get the next complete packet from the stream
+     *
+     * Any data that does not form a valid packet is skipped.  When a packet is
+     * found after skipping data, the header of the packet that follows it must
+     * also be valid before synchronization is considered to be regained.
+     *
+     * @param Framer the framer object
+     * @param Slice buffer to store the packet location, size, and MsgId
+     * @return true if a packet was found, false if more data is needed
+     */
+    bool CFE_MissionLib_Framer_Next(CFE_MissionLib_Framer_t *Framer, CFE_MissionLib_Framer_Slice_t *Slice);
+
+    /**
+     * Get the framer statistics
+     *
+     * @param Framer the framer object
+     * @param Stats buffer to store the statistics
+     */
+    void CFE_MissionLib_Framer_GetStats(const CFE_MissionLib_Framer_t *Framer, CFE_MissionLib_Framer_Stats_t *Stats);
+
+    /**
+     * Default header check which decodes the MsgId via the EDS pub/sub mapping
+     *
+     * The CFE_HDR_Message header is unpacked and passed to
+     * CFE_MissionLib_Get_PubSub_Parameters(), so the MsgId is always consistent
+     * with the software bus.  This is implemented as part of the missionlib
+     * runtime library, as it depends on the EDS-generated header definitions.
+     *
+     * If the framer packet base type is smaller than CFE_HDR_Message, the header
+     * is not guaranteed to be complete, and the MsgId is reported as 0.
+     *
+     * @param Arg the framer object
+     * @param HeaderData the candidate packet header
+     * @param PacketSize the total size of the candidate packet, in bytes
+     * @param MsgId buffer to store the MsgId value of the packet
+     * @return true if the header is valid, false if it cannot be decoded
+     */
+    bool CFE_MissionLib_Framer_DecodeMsgId(void *Arg, const void *HeaderData, uint32_t PacketSize, uint32_t *MsgId);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* _CFE_MISSIONLIB_FRAMER_H_ */
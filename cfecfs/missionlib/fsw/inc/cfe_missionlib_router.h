@@ -0,0 +1,367 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     cfe_missionlib_router.h
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Content-based packet router for fanning packets out to many consumers,
+ * i.e. in a ground gateway where each client has different interests.
+ *
+ * Consumers subscribe by topic ID, or by a range of MsgId values.  Either
+ * kind of subscription may also have a filter function which selects
+ * packets based on their content, i.e. a compiled EDS packet filter (see
+ * EdsLib_DisplayDB_CompileFilter()) on the ground.  Subscriptions are
+ * indexed by topic and MsgId so that a single lookup finds every subscription
+ * matching a packet.  Filters are not indexed: they are only run for
+ * subscriptions that already match by topic or MsgId, and subscriptions with
+ * the same filter function and argument share one evaluation per packet.
+ * Subscribers that want the same content should therefore share one filter.
+ *
+ * Packets are delivered by reference: every subscriber receives a pointer
+ * to the same buffer, which is reference counted and returned to its owner
+ * when the last subscriber releases it.
+ *
+ * The router does not allocate memory; the caller supplies both the router
+ * object and the subscription storage.  Changing subscriptions and routing
+ * packets must not happen concurrently, but buffers may be released from
+ * any thread.  Subscriptions may be changed from within a deliver or match
+ * callback; a subscription removed this way receives no further packets,
+ * and its storage is reused only after the lookup is complete.
+ */
+
+#ifndef _CFE_MISSIONLIB_ROUTER_H_
+#define _CFE_MISSIONLIB_ROUTER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/******************************
+ * MACROS
+ ******************************/
+
+/**
+ * The number of hash buckets in the topic index.  Must be a power of two.
+ */
+#ifndef CFE_MISSIONLIB_ROUTER_TOPIC_BUCKETS
+#define CFE_MISSIONLIB_ROUTER_TOPIC_BUCKETS 256
+#endif
+
+/**
+ * Subscription ID value which never refers to a valid subscription
+ */
+#define CFE_MISSIONLIB_ROUTER_INVALID_ID UINT32_MAX
+
+/**
+ * The storage size required for a given number of subscriptions, in bytes
+ */
+#define CFE_MISSIONLIB_ROUTER_STORAGE_SIZE(n) \
+    ((n) * (sizeof(CFE_MissionLib_Router_Subscription_t) + sizeof(CFE_MissionLib_Router_RangeNode_t)))
+
+/******************************
+ * TYPEDEFS
+ ******************************/
+
+typedef struct CFE_MissionLib_Router_Buffer CFE_MissionLib_Router_Buffer_t;
+
+/**
+ * Called when the last reference to a buffer is released
+ *
+ * @param Arg opaque user argument given with the buffer
+ * @param Buffer the buffer, which may now be reused
+ */
+typedef void (*CFE_MissionLib_Router_Release_t)(void *Arg, CFE_MissionLib_Router_Buffer_t *Buffer);
+
+/**
+ * Called to select packets for a subscription based on their content
+ *
+ * This is only called for packets that already match the subscription by
+ * topic or MsgId.
+ *
+ * @param Arg opaque user argument given with the subscription
+ * @param Data the packed packet
+ * @param Size the size of the packet, in bytes
+ * @return true to deliver the packet to the subscriber, false to skip it
+ */
+typedef bool (*CFE_MissionLib_Router_Filter_t)(void *Arg, const void *Data, uint32_t Size);
+
+/**
+ * Called to deliver a packet to a subscriber
+ *
+ * The subscriber holds one reference to the buffer, and must call
+ * CFE_MissionLib_Router_ReleaseBuffer() when it no longer needs the packet.
+ * This may be done immediately within the callback, or later from any thread.
+ *
+ * @param Arg opaque user argument given with the subscription
+ * @param Buffer the packet buffer
+ */
+typedef void (*CFE_MissionLib_Router_Deliver_t)(void *Arg, CFE_MissionLib_Router_Buffer_t *Buffer);
+
+/**
+ * A reference counted packet buffer
+ *
+ * Subscribers must not modify the content, which is shared with all other subscribers.
+ */
+struct CFE_MissionLib_Router_Buffer
+{
+    const uint8_t *Data;        /**< The packed packet */
+    uint32_t Size;              /**< Size of the packet, in bytes */
+    uint32_t MsgId;             /**< MsgId value of the packet, used for routing */
+    uint16_t TopicId;           /**< Topic ID of the packet, used for routing */
+    uint32_t RefCount;          /**< Only modify via the API */
+    CFE_MissionLib_Router_Release_t Release;
+    void *ReleaseArg;
+};
+
+/**
+ * A subscription entry
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ */
+typedef struct CFE_MissionLib_Router_Subscription
+{
+    bool     InUse;
+    bool     IsRange;
+    uint16_t TopicId;
+    uint32_t MsgIdLow;
+    uint32_t MsgIdHigh;
+    bool     FreePending;       /**< Removed during a lookup, and not yet unlinked */
+    bool     FilterResult;      /**< Result of the filter for the current lookup, if FilterEpoch matches */
+    uint32_t NextIdx;           /**< Next entry in the same topic bucket, or the next free entry */
+    uint32_t FilterLeader;      /**< The entry that holds the filter result for all entries with the same filter */
+    uint32_t FilterEpoch;       /**< Lookup in which FilterResult was computed */
+    CFE_MissionLib_Router_Filter_t Filter;
+    void *FilterArg;
+    CFE_MissionLib_Router_Deliver_t Deliver;
+    void *DeliverArg;
+} CFE_MissionLib_Router_Subscription_t;
+
+/**
+ * A node of the MsgId range index
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ */
+typedef struct CFE_MissionLib_Router_RangeNode
+{
+    uint32_t MsgIdLow;
+    uint32_t MsgIdHigh;
+    uint32_t MaxHigh;           /**< Highest MsgIdHigh within the subtree of this node */
+    uint32_t SubscriptionIdx;
+} CFE_MissionLib_Router_RangeNode_t;
+
+typedef struct CFE_MissionLib_Router_Stats
+{
+    uint32_t NumSubscriptions;  /**< Number of active subscriptions */
+    uint32_t PacketCount;       /**< Number of packets looked up, via either Match or Deliver */
+    uint32_t UnmatchedCount;    /**< Number of packets looked up that matched no subscriptions */
+    uint64_t DeliveryCount;     /**< Total number of deliveries to subscribers */
+    uint64_t FilterRejectCount; /**< Number of times a subscription filter rejected a packet */
+} CFE_MissionLib_Router_Stats_t;
+
+/**
+ * Router state object
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+typedef struct CFE_MissionLib_Router
+{
+    CFE_MissionLib_Router_Subscription_t *SubTable;
+    CFE_MissionLib_Router_RangeNode_t *RangeTable;
+    uint32_t TableSize;
+    uint32_t HighWaterMark;
+    uint32_t FreeHead;
+    uint32_t TopicBuckets[CFE_MISSIONLIB_ROUTER_TOPIC_BUCKETS];
+
+    uint32_t NumRanges;
+    uint32_t RangeTreeLevel;
+    bool     RangeIndexValid;
+
+    uint32_t EpochCounter;
+    uint32_t LookupEpoch;
+    uint32_t LookupDepth;
+    uint32_t NumFreePending;
+
+    CFE_MissionLib_Router_Stats_t Stats;
+} CFE_MissionLib_Router_t;
+
+/**
+ * Called for each subscription that matches a packet
+ *
+ * @param Arg opaque user argument given to CFE_MissionLib_Router_Match()
+ * @param SubscriptionId the ID of the matching subscription
+ * @param DeliverArg the user argument given with the subscription
+ */
+typedef void (*CFE_MissionLib_Router_Match_Callback_t)(void *Arg, uint32_t SubscriptionId, void *DeliverArg);
+
+/******************************
+ * API CALLS
+ ******************************/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * Initialize a router
+     *
+     * The storage must be suitably aligned for any type (i.e. from malloc() or a
+     * static array of the subscription type), and its size determines the number
+     * of subscriptions that can be active at once.
+     *
+     * @sa CFE_MISSIONLIB_ROUTER_STORAGE_SIZE
+     *
+     * @param Router the router object to initialize
+     * @param Storage memory to use for the subscription tables
+     * @param StorageSize size of the storage, in bytes
+     * @return CFE_MISSIONLIB_SUCCESS if successful, or an error code
+     */
+    int32_t CFE_MissionLib_Router_Init(CFE_MissionLib_Router_t *Router, void *Storage, uint32_t StorageSize);
+
+    /**
+     * Subscribe to all packets with the given topic ID
+     *
+     * If a filter is given, its argument must remain valid for as long as the
+     * subscription exists.
+     *
+     * @param Router the router object
+     * @param TopicId the topic ID
+     * @param Filter optional packet filter function, or NULL to receive all packets on the topic
+     * @param FilterArg opaque argument for the filter function
+     * @param Deliver the function to call with each packet
+     * @param DeliverArg opaque argument for the deliver function
+     * @param SubscriptionId buffer to store the ID of the new subscription
+     * @return CFE_MISSIONLIB_SUCCESS if successful, or an error code
+     */
+    int32_t CFE_MissionLib_Router_SubscribeTopic(CFE_MissionLib_Router_t *Router, uint16_t TopicId,
+                                                 CFE_MissionLib_Router_Filter_t Filter, void *FilterArg,
+                                                 CFE_MissionLib_Router_Deliver_t Deliver, void *DeliverArg,
+                                                 uint32_t *SubscriptionId);
+
+    /**
+     * Subscribe to all packets with a MsgId value in the given range
+     *
+     * If a filter is given, it must accept any packet in the range (i.e. an EDS
+     * filter compiled using the packet base type as EdsId), and its argument must
+     * remain valid for as long as the subscription exists.
+     *
+     * @param Router the router object
+     * @param MsgIdLow the lowest MsgId value to receive
+     * @param MsgIdHigh the highest MsgId value to receive
+     * @param Filter optional packet filter function, or NULL to receive all packets in the range
+     * @param FilterArg opaque argument for the filter function
+     * @param Deliver the function to call with each packet
+     * @param DeliverArg opaque argument for the deliver function
+     * @param SubscriptionId buffer to store the ID of the new subscription
+     * @return CFE_MISSIONLIB_SUCCESS if successful, or an error code
+     */
+    int32_t CFE_MissionLib_Router_SubscribeMsgIdRange(CFE_MissionLib_Router_t *Router, uint32_t MsgIdLow,
+                                                      uint32_t MsgIdHigh, CFE_MissionLib_Router_Filter_t Filter,
+                                                      void *FilterArg, CFE_MissionLib_Router_Deliver_t Deliver,
+                                                      void *DeliverArg, uint32_t *SubscriptionId);
+
+    /**
+     * Remove a subscription
+     *
+     * This may be called from within a deliver or match callback, including for
+     * the subscription being delivered to.
+     *
+     * @param Router the router object
+     * @param SubscriptionId the ID of the subscription
+     * @return CFE_MISSIONLIB_SUCCESS if successful, or an error code
+     */
+    int32_t CFE_MissionLib_Router_Unsubscribe(CFE_MissionLib_Router_t *Router, uint32_t SubscriptionId);
+
+    /**
+     * Find all subscriptions that match a packet
+     *
+     * Topic subscriptions are reported first, followed by MsgId range subscriptions.
+     * The order within each group is not specified.
+     *
+     * @param Router the router object
+     * @param Buffer the packet
+     * @param Callback function to call for each matching subscription
+     * @param Arg opaque argument for the callback function
+     * @return the number of matching subscriptions
+     */
+    uint32_t CFE_MissionLib_Router_Match(CFE_MissionLib_Router_t *Router, const CFE_MissionLib_Router_Buffer_t *Buffer,
+                                         CFE_MissionLib_Router_Match_Callback_t Callback, void *Arg);
+
+    /**
+     * Deliver a packet to all matching subscriptions
+     *
+     * Each delivery adds a reference to the buffer.  The reference held by the
+     * caller is not affected, so the caller must still release it afterwards.
+     *
+     * @param Router the router object
+     * @param Buffer the packet
+     * @return the number of deliveries
+     */
+    uint32_t CFE_MissionLib_Router_Deliver(CFE_MissionLib_Router_t *Router, CFE_MissionLib_Router_Buffer_t *Buffer);
+
+    /**
+     * Initialize a packet buffer for routing
+     *
+     * The buffer starts with one reference, which is held by the caller.
+     *
+     * @param Buffer the buffer object to initialize
+     * @param Data the packed packet
+     * @param Size the size of the packet, in bytes
+     * @param MsgId the MsgId value of the packet
+     * @param TopicId the topic ID of the packet
+     * @param Release optional function to call when the last reference is released
+     * @param ReleaseArg opaque argument for the release function
+     */
+    void CFE_MissionLib_Router_InitBuffer(CFE_MissionLib_Router_Buffer_t *Buffer, const void *Data, uint32_t Size,
+                                          uint32_t MsgId, uint16_t TopicId, CFE_MissionLib_Router_Release_t Release,
+                                          void *ReleaseArg);
+
+    /**
+     * Add a reference to a packet buffer
+     *
+     * @param Buffer the packet buffer
+     */
+    void CFE_MissionLib_Router_RetainBuffer(CFE_MissionLib_Router_Buffer_t *Buffer);
+
+    /**
+     * Release a reference to a packet buffer
+     *
+     * The release function of the buffer is called when the last reference is released.
+     *
+     * @param Buffer the packet buffer
+     */
+    void CFE_MissionLib_Router_ReleaseBuffer(CFE_MissionLib_Router_Buffer_t *Buffer);
+
+    /**
+     * Get the router statistics
+     *
+     * @param Router the router object
+     * @param Stats buffer to store the statistics
+     */
+    void CFE_MissionLib_Router_GetStats(const CFE_MissionLib_Router_t *Router, CFE_MissionLib_Router_Stats_t *Stats);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* _CFE_MISSIONLIB_ROUTER_H_ */
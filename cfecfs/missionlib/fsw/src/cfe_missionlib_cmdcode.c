@@ -0,0 +1,122 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     cfe_missionlib_cmdcode.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Implements the command code index, which maps command code values to
+ * the derived command types of a topic.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cfe_missionlib_api.h"
+#include "cfe_missionlib_cmdcode.h"
+
+typedef struct
+{
+    bool     IsValid;
+    uint32_t CommandCode;
+} CFE_MissionLib_CommandCodeIndex_CbArg_t;
+
+static void CFE_MissionLib_CommandCodeIndex_ConstraintCallback(const EdsLib_DatabaseObject_t *       GD,
+                                                               const EdsLib_DataTypeDB_EntityInfo_t *MemberInfo,
+                                                               EdsLib_GenericValueBuffer_t *ConstraintValue, void *Arg)
+{
+    CFE_MissionLib_CommandCodeIndex_CbArg_t *CbArg = Arg;
+
+    (void)GD;
+    (void)MemberInfo;
+
+    /* Only the first integer constraint is used */
+    if (CbArg->IsValid)
+    {
+        return;
+    }
+
+    if (ConstraintValue->ValueType == EDSLIB_BASICTYPE_UNSIGNED_INT &&
+        ConstraintValue->Value.UnsignedInteger < CFE_MISSIONLIB_MAX_COMMAND_CODES)
+    {
+        CbArg->CommandCode = ConstraintValue->Value.UnsignedInteger;
+        CbArg->IsValid     = true;
+    }
+    else if (ConstraintValue->ValueType == EDSLIB_BASICTYPE_SIGNED_INT && ConstraintValue->Value.SignedInteger >= 0 &&
+             ConstraintValue->Value.SignedInteger < CFE_MISSIONLIB_MAX_COMMAND_CODES)
+    {
+        CbArg->CommandCode = ConstraintValue->Value.SignedInteger;
+        CbArg->IsValid     = true;
+    }
+}
+
+int32_t CFE_MissionLib_CommandCodeIndex_Init(CFE_MissionLib_CommandCodeIndex_t *Index,
+                                             const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseEdsId)
+{
+    CFE_MissionLib_CommandCodeIndex_CbArg_t CbArg;
+    EdsLib_DataTypeDB_DerivedTypeInfo_t     DerivInfo;
+    EdsLib_Id_t                             DerivedEdsId;
+    uint16_t                                DerivIdx;
+
+    memset(Index, 0, sizeof(*Index));
+    Index->BaseEdsId = BaseEdsId;
+
+    if (EdsLib_DataTypeDB_GetDerivedInfo(GD, BaseEdsId, &DerivInfo) != EDSLIB_SUCCESS)
+    {
+        return CFE_MISSIONLIB_INVALID_ARGUMENT;
+    }
+
+    for (DerivIdx = 0; DerivIdx < DerivInfo.NumDerivatives; ++DerivIdx)
+    {
+        if (EdsLib_DataTypeDB_GetDerivedTypeById(GD, BaseEdsId, DerivIdx, &DerivedEdsId) != EDSLIB_SUCCESS)
+        {
+            continue;
+        }
+
+        memset(&CbArg, 0, sizeof(CbArg));
+        EdsLib_DataTypeDB_ConstraintIterator(GD, BaseEdsId, DerivedEdsId,
+                                             CFE_MissionLib_CommandCodeIndex_ConstraintCallback, &CbArg);
+
+        /* If two types have the same code, the first one is kept */
+        if (CbArg.IsValid && !EdsLib_Is_Valid(Index->EdsIdByCode[CbArg.CommandCode]))
+        {
+            Index->EdsIdByCode[CbArg.CommandCode] = DerivedEdsId;
+            ++Index->NumCommands;
+        }
+    }
+
+    return CFE_MISSIONLIB_SUCCESS;
+}
+
+int32_t CFE_MissionLib_CommandCodeIndex_Lookup(const CFE_MissionLib_CommandCodeIndex_t *Index, uint32_t CommandCode,
+                                               EdsLib_Id_t *EdsId)
+{
+    if (CommandCode >= CFE_MISSIONLIB_MAX_COMMAND_CODES || !EdsLib_Is_Valid(Index->EdsIdByCode[CommandCode]))
+    {
+        *EdsId = EDSLIB_ID_INVALID;
+        return CFE_MISSIONLIB_INVALID_SUBCOMMAND;
+    }
+
+    *EdsId = Index->EdsIdByCode[CommandCode];
+
+    return CFE_MISSIONLIB_SUCCESS;
+}
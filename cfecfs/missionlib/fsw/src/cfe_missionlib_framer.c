@@ -0,0 +1,266 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     cfe_missionlib_framer.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Implements a packet stream framer based on the EDS-defined length field
+ * of the packet base type.
+ *
+ * The buffer is used as a ring which is "unrolled" at the wrap point: data is
+ * always appended linearly, and when the space at the end runs low the unread
+ * data (normally just a partial packet) is moved back to the start.  This keeps
+ * every packet contiguous so it can be returned in place, at the cost of an
+ * occasional copy of less than one packet.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "cfe_missionlib_api.h"
+#include "cfe_missionlib_framer.h"
+
+/*
+ * Check if the data at the given location begins with a plausible packet header.
+ * The caller must ensure that at least MinPacketSize bytes are valid.
+ */
+static bool CFE_MissionLib_Framer_CheckHeader(const CFE_MissionLib_Framer_t *Framer, const uint8_t *Ptr,
+                                              uint32_t *PacketSize, uint32_t *MsgId)
+{
+    if (EdsLib_DataTypeDB_DecodeLengthField(&Framer->LengthInfo, Ptr, PacketSize) != EDSLIB_SUCCESS)
+    {
+        return false;
+    }
+
+    if (*PacketSize < Framer->MinPacketSize || *PacketSize > Framer->MaxPacketSize)
+    {
+        return false;
+    }
+
+    return (Framer->HeaderCheck == NULL || Framer->HeaderCheck(Framer->HeaderCheckArg, Ptr, *PacketSize, MsgId));
+}
+
+int32_t CFE_MissionLib_Framer_Init(CFE_MissionLib_Framer_t *Framer, const EdsLib_DatabaseObject_t *GD,
+                                   EdsLib_Id_t PacketEdsId, void *Buffer, uint32_t BufferSize,
+                                   uint32_t MaxPacketSize)
+{
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    intmax_t LengthLimit;
+
+    memset(Framer, 0, sizeof(*Framer));
+
+    if (EdsLib_DataTypeDB_GetTypeInfo(GD, PacketEdsId, &TypeInfo) != EDSLIB_SUCCESS ||
+        EdsLib_DataTypeDB_GetLengthFieldInfo(GD, PacketEdsId, &Framer->LengthInfo) != EDSLIB_SUCCESS)
+    {
+        return CFE_MISSIONLIB_INVALID_MESSAGE;
+    }
+
+    /*
+     * The smallest possible packet is the base type itself, which
+     * must always include the complete length field.
+     */
+    Framer->MinPacketSize = (TypeInfo.Size.Bits + 7) / 8;
+    if (Framer->MinPacketSize < Framer->LengthInfo.MinPackedBytes)
+    {
+        Framer->MinPacketSize = Framer->LengthInfo.MinPackedBytes;
+    }
+
+    /* The largest packet the length field can represent */
+    LengthLimit = (((intmax_t)1) << Framer->LengthInfo.BitSize) - 1;
+    if (Framer->LengthInfo.Calibrator != NULL)
+    {
+        LengthLimit = Framer->LengthInfo.Calibrator(LengthLimit);
+    }
+    if (LengthLimit > UINT32_MAX / 2)
+    {
+        LengthLimit = UINT32_MAX / 2;
+    }
+
+    if (MaxPacketSize == 0 || MaxPacketSize > LengthLimit)
+    {
+        MaxPacketSize = LengthLimit;
+    }
+
+    if (MaxPacketSize < Framer->MinPacketSize || Buffer == NULL || BufferSize < (2 * MaxPacketSize))
+    {
+        return CFE_MISSIONLIB_INVALID_ARGUMENT;
+    }
+
+    Framer->GD             = GD;
+    Framer->MaxPacketSize  = MaxPacketSize;
+    Framer->Buffer         = Buffer;
+    Framer->BufferSize     = BufferSize;
+    Framer->HeaderCheck    = CFE_MissionLib_Framer_DecodeMsgId;
+    Framer->HeaderCheckArg = Framer;
+
+    return CFE_MISSIONLIB_SUCCESS;
+}
+
+void CFE_MissionLib_Framer_SetHeaderCheck(CFE_MissionLib_Framer_t *Framer,
+                                          CFE_MissionLib_Framer_HeaderCheck_t HeaderCheck, void *Arg)
+{
+    Framer->HeaderCheck    = HeaderCheck;
+    Framer->HeaderCheckArg = Arg;
+}
+
+uint8_t *CFE_MissionLib_Framer_GetWriteBuffer(CFE_MissionLib_Framer_t *Framer, uint32_t *AvailSize)
+{
+    uint32_t Pending;
+
+    Pending = Framer->WritePos - Framer->ReadPos;
+    if (Pending == 0)
+    {
+        /* all data consumed, so it is free to start over at the beginning */
+        Framer->ReadPos  = 0;
+        Framer->WritePos = 0;
+    }
+    else if (Framer->ReadPos > 0 && (Framer->BufferSize - Framer->WritePos) < Framer->MaxPacketSize)
+    {
+        /*
+         * Not enough space remains to guarantee that the next packet fits,
+         * so wrap around by moving the unread data to the start.
+         */
+        memmove(Framer->Buffer, &Framer->Buffer[Framer->ReadPos], Pending);
+        Framer->ReadPos  = 0;
+        Framer->WritePos = Pending;
+    }
+
+    *AvailSize = Framer->BufferSize - Framer->WritePos;
+    return &Framer->Buffer[Framer->WritePos];
+}
+
+void CFE_MissionLib_Framer_CommitWrite(CFE_MissionLib_Framer_t *Framer, uint32_t Size)
+{
+    if (Size > (Framer->BufferSize - Framer->WritePos))
+    {
+        Size = Framer->BufferSize - Framer->WritePos;
+    }
+
+    Framer->WritePos += Size;
+}
+
+void CFE_MissionLib_Framer_SetEndOfStream(CFE_MissionLib_Framer_t *Framer)
+{
+    Framer->EndOfStream = true;
+}
+
+bool CFE_MissionLib_Framer_Next(CFE_MissionLib_Framer_t *Framer, CFE_MissionLib_Framer_Slice_t *Slice)
+{
+    const uint8_t *Ptr;
+    uint32_t Pending;
+    uint32_t PacketSize;
+    uint32_t NextPending;
+    uint32_t NextSize;
+    uint32_t NextMsgId;
+    uint32_t MsgId;
+
+    while (true)
+    {
+        Pending = Framer->WritePos - Framer->ReadPos;
+        Ptr     = &Framer->Buffer[Framer->ReadPos];
+
+        if (Pending < Framer->MinPacketSize)
+        {
+            if (Framer->EndOfStream && Pending > 0)
+            {
+                /* trailing data that can never become a complete packet */
+                Framer->Stats.DiscardBytes += Pending;
+                Framer->ReadPos = Framer->WritePos;
+            }
+            return false;
+        }
+
+        MsgId = 0;
+        if (CFE_MissionLib_Framer_CheckHeader(Framer, Ptr, &PacketSize, &MsgId))
+        {
+            if (PacketSize > Pending && !Framer->EndOfStream)
+            {
+                /* packet is not complete yet */
+                return false;
+            }
+
+            if (PacketSize <= Pending)
+            {
+                NextPending = Pending - PacketSize;
+
+                /*
+                 * If currently out of sync then a good header alone is not enough to
+                 * trust this candidate, as it may be part of the data that was skipped.
+                 * Require that the next header is also plausible, if there is one.
+                 */
+                if (Framer->InSync)
+                {
+                    break;
+                }
+
+                if (NextPending >= Framer->MinPacketSize)
+                {
+                    if (CFE_MissionLib_Framer_CheckHeader(Framer, Ptr + PacketSize, &NextSize, &NextMsgId))
+                    {
+                        break;
+                    }
+                }
+                else if (!Framer->EndOfStream)
+                {
+                    /* wait for the next header to arrive */
+                    return false;
+                }
+                else
+                {
+                    /* nothing follows this packet, so it can only be accepted as-is */
+                    break;
+                }
+            }
+        }
+
+        /*
+         * Not a valid packet at this position -
+         * skip one byte and try again.
+         */
+        if (Framer->InSync)
+        {
+            Framer->InSync = false;
+            ++Framer->Stats.ResyncCount;
+        }
+
+        ++Framer->Stats.DiscardBytes;
+        ++Framer->ReadPos;
+    }
+
+    Framer->InSync = true;
+    Framer->ReadPos += PacketSize;
+    ++Framer->Stats.PacketCount;
+    Framer->Stats.PacketBytes += PacketSize;
+
+    Slice->Data   = Ptr;
+    Slice->Length = PacketSize;
+    Slice->MsgId  = MsgId;
+
+    return true;
+}
+
+void CFE_MissionLib_Framer_GetStats(const CFE_MissionLib_Framer_t *Framer, CFE_MissionLib_Framer_Stats_t *Stats)
+{
+    *Stats = Framer->Stats;
+}
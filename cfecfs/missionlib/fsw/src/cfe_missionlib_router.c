@@ -0,0 +1,709 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     cfe_missionlib_router.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Implements the content-based packet router.
+ *
+ * Topic subscriptions are kept in a chained hash table indexed by topic ID.
+ *
+ * MsgId range subscriptions are kept in an implicit interval tree: the
+ * ranges are sorted by their low value, and the sorted array is treated
+ * as a complete binary search tree where the node at index i has a level
+ * equal to the number of trailing 1 bits in i.  Each node records the
+ * highest MsgId covered by its subtree, so subtrees that cannot contain
+ * the MsgId are skipped.  This finds all K ranges containing a MsgId in
+ * O(log N + K) time, using no memory beyond the sorted array itself.
+ * The tree is rebuilt on the next lookup after any change to the ranges.
+ *
+ * Filters are not indexed, but subscriptions with the same filter function
+ * and argument are linked to one "leader" entry, which holds the result of
+ * the filter for the current lookup.  Each distinct filter is therefore run
+ * at most once per packet, however many subscriptions share it.
+ *
+ * Subscriptions removed while a lookup is in progress (i.e. from a deliver
+ * callback) are only marked as not in use, and stay linked into the index
+ * until the outermost lookup is complete, so the walk never enters a freed
+ * or reused entry.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "cfe_missionlib_api.h"
+#include "cfe_missionlib_router.h"
+
+/*
+ * Subtrees at or below this level are scanned linearly, which is
+ * faster than descending through the last few levels of the tree.
+ */
+#define CFE_MISSIONLIB_ROUTER_SCAN_LEVEL 3
+
+/*
+ * Buffers may be released from any thread, so the reference
+ * count is updated atomically where the compiler supports it.
+ */
+#if defined(__GNUC__)
+#define CFE_MISSIONLIB_ROUTER_REFCOUNT_ADD(ptr, val) __atomic_add_fetch((ptr), (val), __ATOMIC_ACQ_REL)
+#define CFE_MISSIONLIB_ROUTER_REFCOUNT_SUB(ptr, val) __atomic_sub_fetch((ptr), (val), __ATOMIC_ACQ_REL)
+#else
+#define CFE_MISSIONLIB_ROUTER_REFCOUNT_ADD(ptr, val) (*(ptr) += (val))
+#define CFE_MISSIONLIB_ROUTER_REFCOUNT_SUB(ptr, val) (*(ptr) -= (val))
+#endif
+
+typedef bool (*CFE_MissionLib_Router_Visitor_t)(CFE_MissionLib_Router_t *Router, void *Arg, uint32_t SubIdx);
+
+typedef struct
+{
+    uint32_t NodeIdx;
+    uint32_t Level;
+    bool     LeftDone;
+} CFE_MissionLib_Router_TreeStack_t;
+
+typedef struct
+{
+    const CFE_MissionLib_Router_Buffer_t *Buffer;
+    CFE_MissionLib_Router_Match_Callback_t Callback;
+    void *Arg;
+} CFE_MissionLib_Router_MatchState_t;
+
+static int CFE_MissionLib_Router_CompareRange(const void *p1, const void *p2)
+{
+    const CFE_MissionLib_Router_RangeNode_t *Node1 = p1;
+    const CFE_MissionLib_Router_RangeNode_t *Node2 = p2;
+
+    if (Node1->MsgIdLow != Node2->MsgIdLow)
+    {
+        return (Node1->MsgIdLow < Node2->MsgIdLow) ? -1 : 1;
+    }
+
+    /* not needed for correctness, but makes the order repeatable */
+    if (Node1->SubscriptionIdx != Node2->SubscriptionIdx)
+    {
+        return (Node1->SubscriptionIdx < Node2->SubscriptionIdx) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/*
+ * Sort the ranges and compute the MaxHigh value of every node in the implicit tree
+ */
+static void CFE_MissionLib_Router_BuildRangeIndex(CFE_MissionLib_Router_t *Router)
+{
+    CFE_MissionLib_Router_RangeNode_t *Nodes = Router->RangeTable;
+    uint32_t NumNodes;
+    uint32_t SubIdx;
+    uint32_t NodeIdx;
+    uint32_t LastIdx;
+    uint32_t LastMax;
+    uint32_t Level;
+    uint32_t Half;
+    uint32_t ChildMax;
+
+    NumNodes = 0;
+    for (SubIdx = 0; SubIdx < Router->HighWaterMark; ++SubIdx)
+    {
+        if (Router->SubTable[SubIdx].InUse && Router->SubTable[SubIdx].IsRange)
+        {
+            Nodes[NumNodes].MsgIdLow        = Router->SubTable[SubIdx].MsgIdLow;
+            Nodes[NumNodes].MsgIdHigh       = Router->SubTable[SubIdx].MsgIdHigh;
+            Nodes[NumNodes].SubscriptionIdx = SubIdx;
+            ++NumNodes;
+        }
+    }
+
+    qsort(Nodes, NumNodes, sizeof(*Nodes), CFE_MissionLib_Router_CompareRange);
+
+    Router->NumRanges       = NumNodes;
+    Router->RangeTreeLevel  = 0;
+    Router->RangeIndexValid = true;
+
+    if (NumNodes == 0)
+    {
+        return;
+    }
+
+    /* leaves, at even indices */
+    LastIdx = 0;
+    LastMax = 0;
+    for (NodeIdx = 0; NodeIdx < NumNodes; NodeIdx += 2)
+    {
+        LastIdx = NodeIdx;
+        LastMax = Nodes[NodeIdx].MsgIdHigh;
+        Nodes[NodeIdx].MaxHigh = LastMax;
+    }
+
+    /*
+     * Each higher level has nodes at every 2^(Level+1) indices, starting at 2^Level - 1.
+     * The tree is complete, so a right child may be beyond the end of the array; in
+     * that case the highest value from the last real node at that level is used.
+     */
+    for (Level = 1; (((uint64_t)1) << Level) <= NumNodes; ++Level)
+    {
+        Half = 1U << (Level - 1);
+        for (NodeIdx = (Half << 1) - 1; NodeIdx < NumNodes; NodeIdx += Half << 2)
+        {
+            Nodes[NodeIdx].MaxHigh = Nodes[NodeIdx].MsgIdHigh;
+
+            ChildMax = Nodes[NodeIdx - Half].MaxHigh;
+            if (ChildMax > Nodes[NodeIdx].MaxHigh)
+            {
+                Nodes[NodeIdx].MaxHigh = ChildMax;
+            }
+
+            ChildMax = (NodeIdx + Half < NumNodes) ? Nodes[NodeIdx + Half].MaxHigh : LastMax;
+            if (ChildMax > Nodes[NodeIdx].MaxHigh)
+            {
+                Nodes[NodeIdx].MaxHigh = ChildMax;
+            }
+        }
+
+        /* the ancestor of the last node at this level */
+        if (((LastIdx >> Level) & 1) != 0)
+        {
+            LastIdx -= Half;
+        }
+        else
+        {
+            LastIdx += Half;
+        }
+        if (LastIdx < NumNodes && Nodes[LastIdx].MaxHigh > LastMax)
+        {
+            LastMax = Nodes[LastIdx].MaxHigh;
+        }
+    }
+
+    Router->RangeTreeLevel = Level - 1;
+}
+
+/*
+ * Visit every range subscription that contains the MsgId, returns the number of matches
+ */
+static uint32_t CFE_MissionLib_Router_SearchRanges(CFE_MissionLib_Router_t *Router, uint32_t MsgId,
+                                                   CFE_MissionLib_Router_Visitor_t Visitor, void *Arg)
+{
+    const CFE_MissionLib_Router_RangeNode_t *Nodes = Router->RangeTable;
+    CFE_MissionLib_Router_TreeStack_t Stack[64];
+    CFE_MissionLib_Router_TreeStack_t Current;
+    uint32_t NumNodes;
+    uint32_t Depth;
+    uint32_t NodeIdx;
+    uint32_t EndIdx;
+    uint32_t MatchCount;
+
+    MatchCount = 0;
+    NumNodes   = Router->NumRanges;
+    if (NumNodes == 0)
+    {
+        return MatchCount;
+    }
+
+    Depth                = 0;
+    Stack[Depth].NodeIdx = (1U << Router->RangeTreeLevel) - 1;
+    Stack[Depth].Level   = Router->RangeTreeLevel;
+    Stack[Depth].LeftDone = false;
+    ++Depth;
+
+    while (Depth > 0)
+    {
+        --Depth;
+        Current = Stack[Depth];
+
+        if (Current.Level <= CFE_MISSIONLIB_ROUTER_SCAN_LEVEL)
+        {
+            /* scan the whole subtree in order, stopping at the first range that starts above the MsgId */
+            NodeIdx = (Current.NodeIdx >> Current.Level) << Current.Level;
+            EndIdx  = NodeIdx + (1U << (Current.Level + 1)) - 1;
+            if (EndIdx > NumNodes)
+            {
+                EndIdx = NumNodes;
+            }
+            while (NodeIdx < EndIdx && Nodes[NodeIdx].MsgIdLow <= MsgId)
+            {
+                if (MsgId <= Nodes[NodeIdx].MsgIdHigh && Visitor(Router, Arg, Nodes[NodeIdx].SubscriptionIdx))
+                {
+                    ++MatchCount;
+                }
+                ++NodeIdx;
+            }
+        }
+        else if (!Current.LeftDone)
+        {
+            /* come back to this node after the left subtree */
+            Stack[Depth]          = Current;
+            Stack[Depth].LeftDone = true;
+            ++Depth;
+
+            NodeIdx = Current.NodeIdx - (1U << (Current.Level - 1));
+            if (NodeIdx >= NumNodes || Nodes[NodeIdx].MaxHigh >= MsgId)
+            {
+                Stack[Depth].NodeIdx  = NodeIdx;
+                Stack[Depth].Level    = Current.Level - 1;
+                Stack[Depth].LeftDone = false;
+                ++Depth;
+            }
+        }
+        else if (Current.NodeIdx < NumNodes && Nodes[Current.NodeIdx].MsgIdLow <= MsgId)
+        {
+            if (MsgId <= Nodes[Current.NodeIdx].MsgIdHigh &&
+                Visitor(Router, Arg, Nodes[Current.NodeIdx].SubscriptionIdx))
+            {
+                ++MatchCount;
+            }
+
+            Stack[Depth].NodeIdx  = Current.NodeIdx + (1U << (Current.Level - 1));
+            Stack[Depth].Level    = Current.Level - 1;
+            Stack[Depth].LeftDone = false;
+            ++Depth;
+        }
+    }
+
+    return MatchCount;
+}
+
+/*
+ * Unlink a subscription from the index and return it to the free list
+ */
+static void CFE_MissionLib_Router_Remove(CFE_MissionLib_Router_t *Router, uint32_t SubIdx)
+{
+    CFE_MissionLib_Router_Subscription_t *Sub = &Router->SubTable[SubIdx];
+    uint32_t *LinkPtr;
+
+    if (Sub->IsRange)
+    {
+        Router->RangeIndexValid = false;
+    }
+    else
+    {
+        LinkPtr = &Router->TopicBuckets[Sub->TopicId & (CFE_MISSIONLIB_ROUTER_TOPIC_BUCKETS - 1)];
+        while (*LinkPtr != SubIdx)
+        {
+            LinkPtr = &Router->SubTable[*LinkPtr].NextIdx;
+        }
+        *LinkPtr = Sub->NextIdx;
+    }
+
+    Sub->FreePending = false;
+    Sub->NextIdx     = Router->FreeHead;
+    Router->FreeHead = SubIdx;
+}
+
+/*
+ * Find the leader entry for a filter, i.e. the entry that holds the filter result
+ * for all subscriptions with the same filter.  Returns SubIdx itself if there is none.
+ */
+static uint32_t CFE_MissionLib_Router_FindFilterLeader(CFE_MissionLib_Router_t *Router, uint32_t SubIdx)
+{
+    const CFE_MissionLib_Router_Subscription_t *Sub = &Router->SubTable[SubIdx];
+    const CFE_MissionLib_Router_Subscription_t *Other;
+    uint32_t Idx;
+
+    for (Idx = 0; Idx < Router->HighWaterMark; ++Idx)
+    {
+        Other = &Router->SubTable[Idx];
+        if (Idx != SubIdx && Other->InUse && Other->FilterLeader == Idx && Other->Filter == Sub->Filter &&
+            Other->FilterArg == Sub->FilterArg)
+        {
+            return Idx;
+        }
+    }
+
+    return SubIdx;
+}
+
+/*
+ * Visit every subscription that matches the packet, including the subscription filter
+ */
+static uint32_t CFE_MissionLib_Router_Lookup(CFE_MissionLib_Router_t *Router,
+                                             const CFE_MissionLib_Router_Buffer_t *Buffer,
+                                             CFE_MissionLib_Router_Visitor_t Visitor, void *Arg)
+{
+    const CFE_MissionLib_Router_Subscription_t *Sub;
+    uint32_t MatchCount;
+    uint32_t SubIdx;
+    uint32_t NextIdx;
+    uint32_t SavedEpoch;
+
+    MatchCount = 0;
+    ++Router->Stats.PacketCount;
+
+    /*
+     * Each lookup gets a new epoch, so filter results from earlier packets are not used.
+     * A lookup may be nested within a deliver callback, so the outer epoch is restored after.
+     */
+    SavedEpoch = Router->LookupEpoch;
+    ++Router->EpochCounter;
+    if (Router->EpochCounter == 0)
+    {
+        for (SubIdx = 0; SubIdx < Router->HighWaterMark; ++SubIdx)
+        {
+            Router->SubTable[SubIdx].FilterEpoch = 0;
+        }
+        Router->EpochCounter = 1;
+    }
+    Router->LookupEpoch = Router->EpochCounter;
+
+    /* the range tree cannot be rebuilt while an outer lookup may be walking it */
+    if (!Router->RangeIndexValid && Router->LookupDepth == 0)
+    {
+        CFE_MissionLib_Router_BuildRangeIndex(Router);
+    }
+    ++Router->LookupDepth;
+
+    SubIdx = Router->TopicBuckets[Buffer->TopicId & (CFE_MISSIONLIB_ROUTER_TOPIC_BUCKETS - 1)];
+    while (SubIdx != CFE_MISSIONLIB_ROUTER_INVALID_ID)
+    {
+        Sub     = &Router->SubTable[SubIdx];
+        NextIdx = Sub->NextIdx;
+        if (Sub->TopicId == Buffer->TopicId && Visitor(Router, Arg, SubIdx))
+        {
+            ++MatchCount;
+        }
+        SubIdx = NextIdx;
+    }
+
+    MatchCount += CFE_MissionLib_Router_SearchRanges(Router, Buffer->MsgId, Visitor, Arg);
+
+    --Router->LookupDepth;
+    Router->LookupEpoch = SavedEpoch;
+
+    /* complete any removals from within the callbacks */
+    if (Router->LookupDepth == 0 && Router->NumFreePending > 0)
+    {
+        for (SubIdx = 0; SubIdx < Router->HighWaterMark && Router->NumFreePending > 0; ++SubIdx)
+        {
+            if (Router->SubTable[SubIdx].FreePending)
+            {
+                CFE_MissionLib_Router_Remove(Router, SubIdx);
+                --Router->NumFreePending;
+            }
+        }
+    }
+
+    if (MatchCount == 0)
+    {
+        ++Router->Stats.UnmatchedCount;
+    }
+
+    return MatchCount;
+}
+
+/*
+ * Check the subscription is still active and apply its filter, if any.  Both of the
+ * visitors below are only called for subscriptions that match by topic or MsgId.
+ */
+static bool CFE_MissionLib_Router_CheckFilter(CFE_MissionLib_Router_t *Router,
+                                              const CFE_MissionLib_Router_Subscription_t *Sub,
+                                              const CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    CFE_MissionLib_Router_Subscription_t *Leader;
+
+    if (!Sub->InUse)
+    {
+        return false;
+    }
+
+    if (Sub->Filter == NULL)
+    {
+        return true;
+    }
+
+    Leader = &Router->SubTable[Sub->FilterLeader];
+    if (Leader->FilterEpoch != Router->LookupEpoch)
+    {
+        Leader->FilterResult = Sub->Filter(Sub->FilterArg, Buffer->Data, Buffer->Size);
+        Leader->FilterEpoch  = Router->LookupEpoch;
+    }
+
+    if (!Leader->FilterResult)
+    {
+        ++Router->Stats.FilterRejectCount;
+        return false;
+    }
+
+    return true;
+}
+
+static bool CFE_MissionLib_Router_DeliverVisitor(CFE_MissionLib_Router_t *Router, void *Arg, uint32_t SubIdx)
+{
+    CFE_MissionLib_Router_Buffer_t *Buffer = Arg;
+    const CFE_MissionLib_Router_Subscription_t *Sub = &Router->SubTable[SubIdx];
+
+    if (!CFE_MissionLib_Router_CheckFilter(Router, Sub, Buffer))
+    {
+        return false;
+    }
+
+    /* the caller still holds its reference, so the count cannot reach zero during delivery */
+    CFE_MISSIONLIB_ROUTER_REFCOUNT_ADD(&Buffer->RefCount, 1);
+    ++Router->Stats.DeliveryCount;
+    Sub->Deliver(Sub->DeliverArg, Buffer);
+
+    return true;
+}
+
+static bool CFE_MissionLib_Router_MatchVisitor(CFE_MissionLib_Router_t *Router, void *Arg, uint32_t SubIdx)
+{
+    CFE_MissionLib_Router_MatchState_t *State = Arg;
+    const CFE_MissionLib_Router_Subscription_t *Sub = &Router->SubTable[SubIdx];
+
+    if (!CFE_MissionLib_Router_CheckFilter(Router, Sub, State->Buffer))
+    {
+        return false;
+    }
+
+    if (State->Callback != NULL)
+    {
+        State->Callback(State->Arg, SubIdx, Sub->DeliverArg);
+    }
+
+    return true;
+}
+
+static int32_t CFE_MissionLib_Router_Allocate(CFE_MissionLib_Router_t *Router, CFE_MissionLib_Router_Deliver_t Deliver,
+                                              void *DeliverArg, uint32_t *SubscriptionId)
+{
+    CFE_MissionLib_Router_Subscription_t *Sub;
+    uint32_t SubIdx;
+
+    if (Deliver == NULL || SubscriptionId == NULL)
+    {
+        return CFE_MISSIONLIB_INVALID_ARGUMENT;
+    }
+
+    if (Router->FreeHead != CFE_MISSIONLIB_ROUTER_INVALID_ID)
+    {
+        SubIdx           = Router->FreeHead;
+        Router->FreeHead = Router->SubTable[SubIdx].NextIdx;
+    }
+    else if (Router->HighWaterMark < Router->TableSize)
+    {
+        SubIdx = Router->HighWaterMark;
+        ++Router->HighWaterMark;
+    }
+    else
+    {
+        return CFE_MISSIONLIB_FAILURE;
+    }
+
+    Sub = &Router->SubTable[SubIdx];
+    memset(Sub, 0, sizeof(*Sub));
+    Sub->InUse        = true;
+    Sub->NextIdx      = CFE_MISSIONLIB_ROUTER_INVALID_ID;
+    Sub->FilterLeader = SubIdx;
+    Sub->Deliver      = Deliver;
+    Sub->DeliverArg   = DeliverArg;
+
+    ++Router->Stats.NumSubscriptions;
+    *SubscriptionId = SubIdx;
+
+    return CFE_MISSIONLIB_SUCCESS;
+}
+
+int32_t CFE_MissionLib_Router_Init(CFE_MissionLib_Router_t *Router, void *Storage, uint32_t StorageSize)
+{
+    uint32_t Idx;
+
+    memset(Router, 0, sizeof(*Router));
+
+    Router->TableSize = StorageSize / CFE_MISSIONLIB_ROUTER_STORAGE_SIZE(1);
+    if (Storage == NULL || Router->TableSize == 0)
+    {
+        return CFE_MISSIONLIB_INVALID_ARGUMENT;
+    }
+
+    /* the subscription table is first, as it has the strictest alignment */
+    Router->SubTable   = Storage;
+    Router->RangeTable = (CFE_MissionLib_Router_RangeNode_t *)&Router->SubTable[Router->TableSize];
+    Router->FreeHead   = CFE_MISSIONLIB_ROUTER_INVALID_ID;
+
+    for (Idx = 0; Idx < CFE_MISSIONLIB_ROUTER_TOPIC_BUCKETS; ++Idx)
+    {
+        Router->TopicBuckets[Idx] = CFE_MISSIONLIB_ROUTER_INVALID_ID;
+    }
+
+    Router->RangeIndexValid = true;
+
+    return CFE_MISSIONLIB_SUCCESS;
+}
+
+int32_t CFE_MissionLib_Router_SubscribeTopic(CFE_MissionLib_Router_t *Router, uint16_t TopicId,
+                                             CFE_MissionLib_Router_Filter_t Filter, void *FilterArg,
+                                             CFE_MissionLib_Router_Deliver_t Deliver, void *DeliverArg,
+                                             uint32_t *SubscriptionId)
+{
+    CFE_MissionLib_Router_Subscription_t *Sub;
+    uint32_t *BucketPtr;
+    int32_t Status;
+
+    Status = CFE_MissionLib_Router_Allocate(Router, Deliver, DeliverArg, SubscriptionId);
+    if (Status != CFE_MISSIONLIB_SUCCESS)
+    {
+        return Status;
+    }
+
+    Sub          = &Router->SubTable[*SubscriptionId];
+    Sub->TopicId   = TopicId;
+    Sub->Filter    = Filter;
+    Sub->FilterArg = FilterArg;
+    if (Filter != NULL)
+    {
+        Sub->FilterLeader = CFE_MissionLib_Router_FindFilterLeader(Router, *SubscriptionId);
+    }
+
+    BucketPtr    = &Router->TopicBuckets[TopicId & (CFE_MISSIONLIB_ROUTER_TOPIC_BUCKETS - 1)];
+    Sub->NextIdx = *BucketPtr;
+    *BucketPtr   = *SubscriptionId;
+
+    return CFE_MISSIONLIB_SUCCESS;
+}
+
+int32_t CFE_MissionLib_Router_SubscribeMsgIdRange(CFE_MissionLib_Router_t *Router, uint32_t MsgIdLow,
+                                                  uint32_t MsgIdHigh, CFE_MissionLib_Router_Filter_t Filter,
+                                                  void *FilterArg, CFE_MissionLib_Router_Deliver_t Deliver,
+                                                  void *DeliverArg, uint32_t *SubscriptionId)
+{
+    CFE_MissionLib_Router_Subscription_t *Sub;
+    int32_t Status;
+
+    if (MsgIdLow > MsgIdHigh)
+    {
+        return CFE_MISSIONLIB_INVALID_ARGUMENT;
+    }
+
+    Status = CFE_MissionLib_Router_Allocate(Router, Deliver, DeliverArg, SubscriptionId);
+    if (Status != CFE_MISSIONLIB_SUCCESS)
+    {
+        return Status;
+    }
+
+    Sub            = &Router->SubTable[*SubscriptionId];
+    Sub->IsRange   = true;
+    Sub->MsgIdLow  = MsgIdLow;
+    Sub->MsgIdHigh = MsgIdHigh;
+    Sub->Filter    = Filter;
+    Sub->FilterArg = FilterArg;
+    if (Filter != NULL)
+    {
+        Sub->FilterLeader = CFE_MissionLib_Router_FindFilterLeader(Router, *SubscriptionId);
+    }
+
+    Router->RangeIndexValid = false;
+
+    return CFE_MISSIONLIB_SUCCESS;
+}
+
+int32_t CFE_MissionLib_Router_Unsubscribe(CFE_MissionLib_Router_t *Router, uint32_t SubscriptionId)
+{
+    CFE_MissionLib_Router_Subscription_t *Sub;
+    uint32_t NewLeader;
+    uint32_t Idx;
+
+    if (SubscriptionId >= Router->HighWaterMark || !Router->SubTable[SubscriptionId].InUse)
+    {
+        return CFE_MISSIONLIB_INVALID_ARGUMENT;
+    }
+
+    Sub        = &Router->SubTable[SubscriptionId];
+    Sub->InUse = false;
+    --Router->Stats.NumSubscriptions;
+
+    /* hand the filter over to another subscription with the same filter, if any */
+    if (Sub->Filter != NULL && Sub->FilterLeader == SubscriptionId)
+    {
+        NewLeader = CFE_MISSIONLIB_ROUTER_INVALID_ID;
+        for (Idx = 0; Idx < Router->HighWaterMark; ++Idx)
+        {
+            if (Router->SubTable[Idx].InUse && Router->SubTable[Idx].FilterLeader == SubscriptionId)
+            {
+                if (NewLeader == CFE_MISSIONLIB_ROUTER_INVALID_ID)
+                {
+                    NewLeader = Idx;
+                }
+                Router->SubTable[Idx].FilterLeader = NewLeader;
+            }
+        }
+    }
+
+    if (Router->LookupDepth > 0)
+    {
+        Sub->FreePending = true;
+        ++Router->NumFreePending;
+    }
+    else
+    {
+        CFE_MissionLib_Router_Remove(Router, SubscriptionId);
+    }
+
+    return CFE_MISSIONLIB_SUCCESS;
+}
+
+uint32_t CFE_MissionLib_Router_Match(CFE_MissionLib_Router_t *Router, const CFE_MissionLib_Router_Buffer_t *Buffer,
+                                     CFE_MissionLib_Router_Match_Callback_t Callback, void *Arg)
+{
+    CFE_MissionLib_Router_MatchState_t State;
+
+    State.Buffer   = Buffer;
+    State.Callback = Callback;
+    State.Arg      = Arg;
+
+    return CFE_MissionLib_Router_Lookup(Router, Buffer, CFE_MissionLib_Router_MatchVisitor, &State);
+}
+
+uint32_t CFE_MissionLib_Router_Deliver(CFE_MissionLib_Router_t *Router, CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    return CFE_MissionLib_Router_Lookup(Router, Buffer, CFE_MissionLib_Router_DeliverVisitor, Buffer);
+}
+
+void CFE_MissionLib_Router_InitBuffer(CFE_MissionLib_Router_Buffer_t *Buffer, const void *Data, uint32_t Size,
+                                      uint32_t MsgId, uint16_t TopicId, CFE_MissionLib_Router_Release_t Release,
+                                      void *ReleaseArg)
+{
+    Buffer->Data       = Data;
+    Buffer->Size       = Size;
+    Buffer->MsgId      = MsgId;
+    Buffer->TopicId    = TopicId;
+    Buffer->RefCount   = 1;
+    Buffer->Release    = Release;
+    Buffer->ReleaseArg = ReleaseArg;
+}
+
+void CFE_MissionLib_Router_RetainBuffer(CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    CFE_MISSIONLIB_ROUTER_REFCOUNT_ADD(&Buffer->RefCount, 1);
+}
+
+void CFE_MissionLib_Router_ReleaseBuffer(CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    if (CFE_MISSIONLIB_ROUTER_REFCOUNT_SUB(&Buffer->RefCount, 1) == 0 && Buffer->Release != NULL)
+    {
+        Buffer->Release(Buffer->ReleaseArg, Buffer);
+    }
+}
+
+void CFE_MissionLib_Router_GetStats(const CFE_MissionLib_Router_t *Router, CFE_MissionLib_Router_Stats_t *Stats)
+{
+    *Stats = Router->Stats;
+}
@@ -0,0 +1,97 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     cfe_missionlib_runtime_framer.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Default MsgId decoding for the packet stream framer.
+ *
+ * This is part of the runtime library rather than the generic missionlib,
+ * because it uses the EDS-generated header definitions and the (possibly
+ * mission-specific) pub/sub parameter mapping.  It is kept separate from the
+ * runtime mapping source so that missions overriding that file need not
+ * reimplement it.
+ */
+
+#include <string.h>
+#include <stdint.h>
+
+#include "edslib_datatypedb.h"
+#include "cfe_missionlib_runtime.h"
+#include "cfe_missionlib_framer.h"
+
+bool CFE_MissionLib_Framer_DecodeMsgId(void *Arg, const void *HeaderData, uint32_t PacketSize, uint32_t *MsgId)
+{
+    const CFE_MissionLib_Framer_t *Framer = Arg;
+    EdsLib_Id_t EdsId;
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    EdsNativeBuffer_CFE_HDR_Message_t NativeHeader;
+    EdsInterface_CFE_SB_SoftwareBus_PubSub_t PubSubParams;
+    uint32_t HeaderSize;
+    uint32_t AvailSize;
+    int32_t Status;
+
+    *MsgId = 0;
+
+    /*
+     * The generated buffer types are sized for the largest derivative, so the
+     * size of the header itself must come from the DB.
+     */
+    EdsId = EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_Message_DATADICTIONARY);
+    if (EdsLib_DataTypeDB_GetTypeInfo(Framer->GD, EdsId, &TypeInfo) != EDSLIB_SUCCESS)
+    {
+        return false;
+    }
+    HeaderSize = (TypeInfo.Size.Bits + 7) / 8;
+
+    /*
+     * Only the framer base type is guaranteed to be present, so if that
+     * does not include the complete CFE header then it cannot be decoded.
+     * The packet itself may also be incomplete when this is called.
+     */
+    AvailSize = Framer->MinPacketSize;
+    if (AvailSize > PacketSize)
+    {
+        AvailSize = PacketSize;
+    }
+    if (AvailSize < HeaderSize)
+    {
+        return true;
+    }
+
+    /*
+     * This also tries to identify a derived header (i.e. command or telemetry),
+     * which may not be within the available data.  In that case the size error
+     * only concerns the derived part; the base header was already unpacked.
+     */
+    Status = EdsLib_DataTypeDB_UnpackPartialObject(Framer->GD, &EdsId, NativeHeader.Byte, HeaderData,
+                                                   sizeof(NativeHeader), 8 * AvailSize, 0);
+    if (Status != EDSLIB_SUCCESS && Status != EDSLIB_BUFFER_SIZE_ERROR)
+    {
+        return false;
+    }
+
+    CFE_MissionLib_Get_PubSub_Parameters(&PubSubParams, &NativeHeader.BaseObject);
+    *MsgId = PubSubParams.MsgId.Value;
+
+    return true;
+}
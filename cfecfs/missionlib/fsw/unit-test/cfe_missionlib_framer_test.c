@@ -0,0 +1,197 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     cfe_missionlib_framer_test.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Unit test of the packet stream framer, using telemetry packets encoded
+ * with the mission EDS database.
+ */
+
+#include <string.h>
+
+#include "utassert.h"
+#include "uttest.h"
+
+#include <cfe_mission_cfg.h>
+#include "cfe_sb_eds_datatypes.h"
+#include "cfe_hdr_eds_datatypes.h"
+#include "cfe_mission_eds_parameters.h"
+#include "cfe_mission_eds_interface_parameters.h"
+#include "edslib_datatypedb.h"
+#include "cfe_missionlib_runtime.h"
+#include "cfe_missionlib_api.h"
+#include "cfe_missionlib_framer.h"
+
+#define UT_FRAMER_MAX_PACKET 64
+
+static uint8_t UT_FramerBuffer[4 * UT_FRAMER_MAX_PACKET];
+static uint8_t UT_Stream[4 * UT_FRAMER_MAX_PACKET];
+
+/*
+ * Encode a telemetry header for the given topic, as it would be sent on the
+ * software bus.  The MsgId which the software bus would use is returned.
+ */
+static uint32_t UT_Framer_EncodeTlm(uint8_t *Dest, uint16_t TopicId, uint32_t *PacketSize)
+{
+    EdsNativeBuffer_CFE_HDR_TelemetryHeader_t NativeBuffer;
+    EdsComponent_CFE_SB_Publisher_t PublisherParams;
+    EdsInterface_CFE_SB_SoftwareBus_PubSub_t PubSubParams;
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    EdsLib_Id_t EdsId;
+
+    EdsId = EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_TelemetryHeader_DATADICTIONARY);
+
+    memset(&NativeBuffer, 0, sizeof(NativeBuffer));
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitializeNativeObject(&EDS_DATABASE, EdsId, NativeBuffer.Byte),
+                      EDSLIB_SUCCESS);
+
+    memset(&PublisherParams, 0, sizeof(PublisherParams));
+    PublisherParams.Telemetry.TopicId = TopicId;
+    CFE_MissionLib_MapPublisherComponent(&PubSubParams, &PublisherParams);
+    CFE_MissionLib_Set_PubSub_Parameters(&NativeBuffer.BaseObject.Message, &PubSubParams);
+
+    /* this also computes the length field */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_PackCompleteObject(&EDS_DATABASE, &EdsId, Dest, NativeBuffer.Byte,
+                                                           8 * UT_FRAMER_MAX_PACKET, sizeof(NativeBuffer)),
+                      EDSLIB_SUCCESS);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetTypeInfo(&EDS_DATABASE, EdsId, &TypeInfo), EDSLIB_SUCCESS);
+
+    *PacketSize = (TypeInfo.Size.Bits + 7) / 8;
+
+    return PubSubParams.MsgId.Value;
+}
+
+static void UT_Framer_Init(CFE_MissionLib_Framer_t *Framer)
+{
+    UtAssert_INT32_EQ(CFE_MissionLib_Framer_Init(Framer, &EDS_DATABASE,
+                                                 EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_Message_DATADICTIONARY),
+                                                 UT_FramerBuffer, sizeof(UT_FramerBuffer), UT_FRAMER_MAX_PACKET),
+                      CFE_MISSIONLIB_SUCCESS);
+}
+
+static void UT_Framer_Write(CFE_MissionLib_Framer_t *Framer, const uint8_t *Data, uint32_t Size)
+{
+    uint8_t *WritePtr;
+    uint32_t Avail;
+
+    WritePtr = CFE_MissionLib_Framer_GetWriteBuffer(Framer, &Avail);
+    UtAssert_True(Avail >= Size, "Framer write space (%lu) >= %lu", (unsigned long)Avail, (unsigned long)Size);
+    memcpy(WritePtr, Data, Size);
+    CFE_MissionLib_Framer_CommitWrite(Framer, Size);
+}
+
+/*
+ * Two telemetry packets for different topics, framed from one write
+ */
+void Test_CFE_MissionLib_Framer_TlmMsgId(void)
+{
+    CFE_MissionLib_Framer_t Framer;
+    CFE_MissionLib_Framer_Slice_t Slice;
+    uint32_t MsgId1;
+    uint32_t MsgId2;
+    uint32_t Size1;
+    uint32_t Size2;
+
+    MsgId1 = UT_Framer_EncodeTlm(UT_Stream, 1, &Size1);
+    MsgId2 = UT_Framer_EncodeTlm(&UT_Stream[Size1], 2, &Size2);
+    UtAssert_True(MsgId1 != 0 && MsgId1 != MsgId2, "Encoded MsgIds (0x%lx, 0x%lx) are distinct",
+                  (unsigned long)MsgId1, (unsigned long)MsgId2);
+
+    UT_Framer_Init(&Framer);
+    UT_Framer_Write(&Framer, UT_Stream, Size1 + Size2);
+    CFE_MissionLib_Framer_SetEndOfStream(&Framer);
+
+    UtAssert_True(CFE_MissionLib_Framer_Next(&Framer, &Slice), "First packet found");
+    UtAssert_UINT32_EQ(Slice.Length, Size1);
+    UtAssert_UINT32_EQ(Slice.MsgId, MsgId1);
+    UtAssert_True(Slice.Data == &UT_FramerBuffer[0], "First packet is at the start of the buffer");
+
+    UtAssert_True(CFE_MissionLib_Framer_Next(&Framer, &Slice), "Second packet found");
+    UtAssert_UINT32_EQ(Slice.Length, Size2);
+    UtAssert_UINT32_EQ(Slice.MsgId, MsgId2);
+
+    UtAssert_True(!CFE_MissionLib_Framer_Next(&Framer, &Slice), "No more packets");
+}
+
+/*
+ * The header check is applied before the packet is complete, so the
+ * MsgId must be decoded from the data that is guaranteed to be present.
+ */
+void Test_CFE_MissionLib_Framer_PartialPacket(void)
+{
+    CFE_MissionLib_Framer_t Framer;
+    CFE_MissionLib_Framer_Slice_t Slice;
+    CFE_MissionLib_Framer_Stats_t Stats;
+    uint32_t MsgId;
+    uint32_t Size;
+    uint32_t FirstPart;
+
+    MsgId = UT_Framer_EncodeTlm(UT_Stream, 3, &Size);
+
+    UT_Framer_Init(&Framer);
+    FirstPart = Framer.MinPacketSize;
+    UtAssert_True(FirstPart < Size, "Header (%lu) is smaller than the packet (%lu)", (unsigned long)FirstPart,
+                  (unsigned long)Size);
+
+    UT_Framer_Write(&Framer, UT_Stream, FirstPart);
+    UtAssert_True(!CFE_MissionLib_Framer_Next(&Framer, &Slice), "Incomplete packet is not returned");
+
+    UT_Framer_Write(&Framer, &UT_Stream[FirstPart], Size - FirstPart);
+    UtAssert_True(CFE_MissionLib_Framer_Next(&Framer, &Slice), "Complete packet found");
+    UtAssert_UINT32_EQ(Slice.Length, Size);
+    UtAssert_UINT32_EQ(Slice.MsgId, MsgId);
+
+    CFE_MissionLib_Framer_GetStats(&Framer, &Stats);
+    UtAssert_UINT32_EQ(Stats.PacketCount, 1);
+    UtAssert_UINT32_EQ(Stats.DiscardBytes, 0);
+}
+
+/*
+ * Direct calls to the default header check
+ */
+void Test_CFE_MissionLib_Framer_DecodeMsgId(void)
+{
+    CFE_MissionLib_Framer_t Framer;
+    uint32_t ExpectedMsgId;
+    uint32_t MsgId;
+    uint32_t Size;
+
+    ExpectedMsgId = UT_Framer_EncodeTlm(UT_Stream, 4, &Size);
+    UT_Framer_Init(&Framer);
+
+    MsgId = 0;
+    UtAssert_True(CFE_MissionLib_Framer_DecodeMsgId(&Framer, UT_Stream, Size, &MsgId), "Header accepted");
+    UtAssert_UINT32_EQ(MsgId, ExpectedMsgId);
+
+    /* a packet too short to hold the CFE header is accepted, but without a MsgId */
+    MsgId = 1;
+    UtAssert_True(CFE_MissionLib_Framer_DecodeMsgId(&Framer, UT_Stream, 2, &MsgId), "Short packet accepted");
+    UtAssert_UINT32_EQ(MsgId, 0);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_CFE_MissionLib_Framer_TlmMsgId, NULL, NULL, "Framer Telemetry MsgId");
+    UtTest_Add(Test_CFE_MissionLib_Framer_PartialPacket, NULL, NULL, "Framer Partial Packet");
+    UtTest_Add(Test_CFE_MissionLib_Framer_DecodeMsgId, NULL, NULL, "Framer DecodeMsgId");
+}
@@ -0,0 +1,427 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     cfe_missionlib_router_test.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Unit test of the content-based packet router.
+ *
+ * The matching is checked against a brute force search over a plain list
+ * of the same subscriptions, while subscriptions are added and removed.
+ */
+
+#include <string.h>
+
+#include "utassert.h"
+#include "uttest.h"
+
+#include "cfe_missionlib_api.h"
+#include "cfe_missionlib_router.h"
+
+#define UT_ROUTER_MAX_SUBS    1000
+#define UT_ROUTER_NUM_TOPICS  100
+#define UT_ROUTER_MSGID_SPAN  800
+#define UT_ROUTER_NUM_FILTERS 4
+
+typedef struct
+{
+    bool     InUse;
+    bool     IsRange;
+    uint16_t TopicId;
+    uint32_t MsgIdLow;
+    uint32_t MsgIdHigh;
+    uint32_t FilterIdx;
+    uint32_t SubscriptionId;
+} UT_Router_RefSub_t;
+
+static uint64_t UT_RouterStorage[(CFE_MISSIONLIB_ROUTER_STORAGE_SIZE(UT_ROUTER_MAX_SUBS) + 7) / 8];
+static UT_Router_RefSub_t UT_RefSubs[UT_ROUTER_MAX_SUBS];
+static uint32_t UT_NumRefSubs;
+static uint8_t UT_MatchCount[UT_ROUTER_MAX_SUBS];
+
+/* filters select on the first byte of the packet, the argument is the value to select */
+static uint8_t UT_FilterValue[UT_ROUTER_NUM_FILTERS] = { 1, 2, 3, 1 };
+static uint32_t UT_FilterCalls;
+
+static uint32_t UT_Random;
+
+static uint32_t UT_Router_Rand(uint32_t Limit)
+{
+    /* simple LCG, so the sequence is the same on every platform */
+    UT_Random = UT_Random * 1103515245 + 12345;
+    return (UT_Random >> 8) % Limit;
+}
+
+static bool UT_Router_Filter(void *Arg, const void *Data, uint32_t Size)
+{
+    const uint8_t *Value = Arg;
+
+    ++UT_FilterCalls;
+    return (Size > 0 && *((const uint8_t *)Data) == *Value);
+}
+
+static void UT_Router_MatchCallback(void *Arg, uint32_t SubscriptionId, void *DeliverArg)
+{
+    UT_Router_RefSub_t *Ref = DeliverArg;
+
+    (void)Arg;
+    UtAssert_True(Ref->SubscriptionId == SubscriptionId, "Match ID %lu == %lu", (unsigned long)SubscriptionId,
+                  (unsigned long)Ref->SubscriptionId);
+    ++UT_MatchCount[Ref - UT_RefSubs];
+}
+
+static void UT_Router_Release(void *Arg, CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    (void)Buffer;
+    ++(*((uint32_t *)Arg));
+}
+
+static void UT_Router_DeliverCount(void *Arg, CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    ++(*((uint32_t *)Arg));
+    CFE_MissionLib_Router_ReleaseBuffer(Buffer);
+}
+
+static bool UT_Router_RefMatch(const UT_Router_RefSub_t *Ref, uint32_t MsgId, uint16_t TopicId, uint8_t Content)
+{
+    if (!Ref->InUse)
+    {
+        return false;
+    }
+    if (Ref->IsRange)
+    {
+        if (MsgId < Ref->MsgIdLow || MsgId > Ref->MsgIdHigh)
+        {
+            return false;
+        }
+    }
+    else if (Ref->TopicId != TopicId)
+    {
+        return false;
+    }
+
+    return (Ref->FilterIdx >= UT_ROUTER_NUM_FILTERS || UT_FilterValue[Ref->FilterIdx] == Content);
+}
+
+static void UT_Router_AddRandom(CFE_MissionLib_Router_t *Router)
+{
+    UT_Router_RefSub_t *Ref;
+    CFE_MissionLib_Router_Filter_t Filter;
+    void *FilterArg;
+    int32_t Status;
+
+    Ref = &UT_RefSubs[UT_NumRefSubs];
+    memset(Ref, 0, sizeof(*Ref));
+
+    /* half of the subscriptions have no filter */
+    Ref->FilterIdx = UT_Router_Rand(2 * UT_ROUTER_NUM_FILTERS);
+    if (Ref->FilterIdx < UT_ROUTER_NUM_FILTERS)
+    {
+        Filter    = UT_Router_Filter;
+        FilterArg = &UT_FilterValue[Ref->FilterIdx];
+    }
+    else
+    {
+        Filter    = NULL;
+        FilterArg = NULL;
+    }
+
+    Ref->IsRange = UT_Router_Rand(2);
+    if (Ref->IsRange)
+    {
+        Ref->MsgIdLow  = UT_Router_Rand(UT_ROUTER_MSGID_SPAN);
+        Ref->MsgIdHigh = Ref->MsgIdLow + UT_Router_Rand(UT_Router_Rand(4) == 0 ? 400 : 10);
+        Status = CFE_MissionLib_Router_SubscribeMsgIdRange(Router, Ref->MsgIdLow, Ref->MsgIdHigh, Filter, FilterArg,
+                                                           UT_Router_DeliverCount, Ref, &Ref->SubscriptionId);
+    }
+    else
+    {
+        Ref->TopicId = UT_Router_Rand(UT_ROUTER_NUM_TOPICS);
+        Status = CFE_MissionLib_Router_SubscribeTopic(Router, Ref->TopicId, Filter, FilterArg, UT_Router_DeliverCount,
+                                                      Ref, &Ref->SubscriptionId);
+    }
+
+    UtAssert_INT32_EQ(Status, CFE_MISSIONLIB_SUCCESS);
+    Ref->InUse = true;
+    ++UT_NumRefSubs;
+}
+
+/*
+ * Random subscription churn, comparing every lookup against a brute force search
+ */
+void Test_CFE_MissionLib_Router_Churn(void)
+{
+    CFE_MissionLib_Router_t Router;
+    CFE_MissionLib_Router_Buffer_t Buffer;
+    CFE_MissionLib_Router_Stats_t Stats;
+    uint8_t Packet[4];
+    uint32_t Round;
+    uint32_t Count;
+    uint32_t Idx;
+    uint32_t Expected;
+    uint32_t Matched;
+    uint32_t Mismatches;
+    uint32_t NumActive;
+    uint32_t MsgId;
+    uint16_t TopicId;
+
+    UT_Random     = 1;
+    UT_NumRefSubs = 0;
+    Mismatches    = 0;
+    NumActive     = 0;
+
+    UtAssert_INT32_EQ(CFE_MissionLib_Router_Init(&Router, UT_RouterStorage, sizeof(UT_RouterStorage)),
+                      CFE_MISSIONLIB_SUCCESS);
+
+    for (Round = 0; Round < 20; ++Round)
+    {
+        for (Count = 0; Count < 40 && UT_NumRefSubs < UT_ROUTER_MAX_SUBS; ++Count)
+        {
+            UT_Router_AddRandom(&Router);
+            ++NumActive;
+        }
+
+        for (Count = 0; Count < 25; ++Count)
+        {
+            Idx = UT_Router_Rand(UT_NumRefSubs);
+            if (UT_RefSubs[Idx].InUse)
+            {
+                UtAssert_INT32_EQ(CFE_MissionLib_Router_Unsubscribe(&Router, UT_RefSubs[Idx].SubscriptionId),
+                                  CFE_MISSIONLIB_SUCCESS);
+                UT_RefSubs[Idx].InUse = false;
+                --NumActive;
+            }
+        }
+
+        for (Count = 0; Count < 200; ++Count)
+        {
+            MsgId     = UT_Router_Rand(UT_ROUTER_MSGID_SPAN + 400);
+            TopicId   = UT_Router_Rand(UT_ROUTER_NUM_TOPICS);
+            Packet[0] = UT_Router_Rand(4);
+            CFE_MissionLib_Router_InitBuffer(&Buffer, Packet, sizeof(Packet), MsgId, TopicId, NULL, NULL);
+
+            memset(UT_MatchCount, 0, sizeof(UT_MatchCount));
+            Matched = CFE_MissionLib_Router_Match(&Router, &Buffer, UT_Router_MatchCallback, NULL);
+
+            Expected = 0;
+            for (Idx = 0; Idx < UT_NumRefSubs; ++Idx)
+            {
+                if (UT_Router_RefMatch(&UT_RefSubs[Idx], MsgId, TopicId, Packet[0]))
+                {
+                    ++Expected;
+                    if (UT_MatchCount[Idx] != 1)
+                    {
+                        ++Mismatches;
+                    }
+                }
+                else if (UT_MatchCount[Idx] != 0)
+                {
+                    ++Mismatches;
+                }
+            }
+
+            if (Matched != Expected)
+            {
+                ++Mismatches;
+            }
+        }
+    }
+
+    UtAssert_UINT32_EQ(Mismatches, 0);
+
+    CFE_MissionLib_Router_GetStats(&Router, &Stats);
+    UtAssert_UINT32_EQ(Stats.NumSubscriptions, NumActive);
+    UtAssert_INT32_EQ(CFE_MissionLib_Router_Unsubscribe(&Router, UT_ROUTER_MAX_SUBS), CFE_MISSIONLIB_INVALID_ARGUMENT);
+}
+
+/*
+ * Subscriptions with the same filter share one evaluation per packet
+ */
+void Test_CFE_MissionLib_Router_SharedFilter(void)
+{
+    CFE_MissionLib_Router_t Router;
+    CFE_MissionLib_Router_Buffer_t Buffer;
+    uint8_t Packet[4];
+    uint32_t SubIds[10];
+    uint32_t Delivered;
+    uint32_t Released;
+    uint32_t Idx;
+
+    UtAssert_INT32_EQ(CFE_MissionLib_Router_Init(&Router, UT_RouterStorage, sizeof(UT_RouterStorage)),
+                      CFE_MISSIONLIB_SUCCESS);
+
+    Delivered = 0;
+    for (Idx = 0; Idx < 10; ++Idx)
+    {
+        /* the same filter on both topic and range subscriptions */
+        if (Idx < 5)
+        {
+            UtAssert_INT32_EQ(CFE_MissionLib_Router_SubscribeTopic(&Router, 7, UT_Router_Filter, &UT_FilterValue[0],
+                                                                   UT_Router_DeliverCount, &Delivered, &SubIds[Idx]),
+                              CFE_MISSIONLIB_SUCCESS);
+        }
+        else
+        {
+            UtAssert_INT32_EQ(CFE_MissionLib_Router_SubscribeMsgIdRange(&Router, 0x100, 0x1FF, UT_Router_Filter,
+                                                                        &UT_FilterValue[0], UT_Router_DeliverCount,
+                                                                        &Delivered, &SubIds[Idx]),
+                              CFE_MISSIONLIB_SUCCESS);
+        }
+    }
+
+    /* same function with a different argument is a different filter */
+    UtAssert_INT32_EQ(CFE_MissionLib_Router_SubscribeTopic(&Router, 7, UT_Router_Filter, &UT_FilterValue[1],
+                                                           UT_Router_DeliverCount, &Delivered, &Idx),
+                      CFE_MISSIONLIB_SUCCESS);
+
+    Released  = 0;
+    Packet[0] = 1;
+    CFE_MissionLib_Router_InitBuffer(&Buffer, Packet, sizeof(Packet), 0x123, 7, UT_Router_Release, &Released);
+    UT_FilterCalls = 0;
+    UtAssert_UINT32_EQ(CFE_MissionLib_Router_Deliver(&Router, &Buffer), 10);
+    UtAssert_UINT32_EQ(UT_FilterCalls, 2);
+    UtAssert_UINT32_EQ(Delivered, 10);
+    UtAssert_UINT32_EQ(Released, 0);
+    CFE_MissionLib_Router_ReleaseBuffer(&Buffer);
+    UtAssert_UINT32_EQ(Released, 1);
+
+    /* removing the subscriptions in turn must hand the shared result over to the others */
+    for (Idx = 0; Idx < 9; ++Idx)
+    {
+        UtAssert_INT32_EQ(CFE_MissionLib_Router_Unsubscribe(&Router, SubIds[Idx]), CFE_MISSIONLIB_SUCCESS);
+
+        Packet[0] = 1 + (Idx & 1);
+        CFE_MissionLib_Router_InitBuffer(&Buffer, Packet, sizeof(Packet), 0x123, 7, NULL, NULL);
+        UT_FilterCalls = 0;
+        UtAssert_UINT32_EQ(CFE_MissionLib_Router_Match(&Router, &Buffer, NULL, NULL),
+                           (Idx & 1) ? 1 : (9 - Idx));
+        UtAssert_True(UT_FilterCalls <= 2, "Filter calls (%lu) <= 2", (unsigned long)UT_FilterCalls);
+    }
+}
+
+typedef struct
+{
+    CFE_MissionLib_Router_t *Router;
+    uint32_t *SubIds;
+    uint32_t NumSubIds;
+    uint32_t Delivered;
+} UT_Router_UnsubState_t;
+
+/* remove all the subscriptions on the first delivery, including the current one */
+static void UT_Router_DeliverUnsubscribe(void *Arg, CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    UT_Router_UnsubState_t *State = Arg;
+    uint32_t Idx;
+
+    if (State->Delivered == 0)
+    {
+        for (Idx = 0; Idx < State->NumSubIds; ++Idx)
+        {
+            UtAssert_INT32_EQ(CFE_MissionLib_Router_Unsubscribe(State->Router, State->SubIds[Idx]),
+                              CFE_MISSIONLIB_SUCCESS);
+        }
+    }
+
+    ++State->Delivered;
+    CFE_MissionLib_Router_ReleaseBuffer(Buffer);
+}
+
+/*
+ * Unsubscribe from within a deliver callback
+ */
+void Test_CFE_MissionLib_Router_UnsubscribeInDeliver(void)
+{
+    CFE_MissionLib_Router_t Router;
+    CFE_MissionLib_Router_Buffer_t Buffer;
+    CFE_MissionLib_Router_Stats_t Stats;
+    UT_Router_UnsubState_t State;
+    uint8_t Packet[4];
+    uint32_t SubIds[8];
+    uint32_t Other;
+    uint32_t Delivered;
+    uint32_t Idx;
+
+    UtAssert_INT32_EQ(CFE_MissionLib_Router_Init(&Router, UT_RouterStorage, sizeof(UT_RouterStorage)),
+                      CFE_MISSIONLIB_SUCCESS);
+
+    memset(&State, 0, sizeof(State));
+    State.Router    = &Router;
+    State.SubIds    = SubIds;
+    State.NumSubIds = 8;
+
+    /* topic subscriptions share a bucket chain, range subscriptions share the tree */
+    for (Idx = 0; Idx < 8; ++Idx)
+    {
+        if (Idx & 1)
+        {
+            UtAssert_INT32_EQ(CFE_MissionLib_Router_SubscribeMsgIdRange(&Router, 0x10, 0x20 + Idx, NULL, NULL,
+                                                                        UT_Router_DeliverUnsubscribe, &State,
+                                                                        &SubIds[Idx]),
+                              CFE_MISSIONLIB_SUCCESS);
+        }
+        else
+        {
+            UtAssert_INT32_EQ(CFE_MissionLib_Router_SubscribeTopic(&Router, 3, NULL, NULL,
+                                                                   UT_Router_DeliverUnsubscribe, &State, &SubIds[Idx]),
+                              CFE_MISSIONLIB_SUCCESS);
+        }
+    }
+
+    /* this one stays, and is in the same topic bucket */
+    Delivered = 0;
+    UtAssert_INT32_EQ(CFE_MissionLib_Router_SubscribeTopic(&Router, 3 + CFE_MISSIONLIB_ROUTER_TOPIC_BUCKETS, NULL,
+                                                           NULL, UT_Router_DeliverCount, &Delivered, &Other),
+                      CFE_MISSIONLIB_SUCCESS);
+
+    Packet[0] = 0;
+    CFE_MissionLib_Router_InitBuffer(&Buffer, Packet, sizeof(Packet), 0x18, 3, NULL, NULL);
+    UtAssert_UINT32_EQ(CFE_MissionLib_Router_Deliver(&Router, &Buffer), 1);
+    UtAssert_UINT32_EQ(State.Delivered, 1);
+
+    CFE_MissionLib_Router_GetStats(&Router, &Stats);
+    UtAssert_UINT32_EQ(Stats.NumSubscriptions, 1);
+
+    /* the entries are reused once the lookup is done */
+    State.Delivered = 0;
+    for (Idx = 0; Idx < 8; ++Idx)
+    {
+        UtAssert_INT32_EQ(CFE_MissionLib_Router_SubscribeTopic(&Router, 3, NULL, NULL, UT_Router_DeliverUnsubscribe,
+                                                               &State, &SubIds[Idx]),
+                          CFE_MISSIONLIB_SUCCESS);
+        UtAssert_True(SubIds[Idx] < 8, "Subscription ID %lu reused", (unsigned long)SubIds[Idx]);
+    }
+
+    UtAssert_UINT32_EQ(CFE_MissionLib_Router_Deliver(&Router, &Buffer), 1);
+    UtAssert_UINT32_EQ(CFE_MissionLib_Router_Deliver(&Router, &Buffer), 0);
+
+    CFE_MissionLib_Router_InitBuffer(&Buffer, Packet, sizeof(Packet), 0x18, 3 + CFE_MISSIONLIB_ROUTER_TOPIC_BUCKETS,
+                                     NULL, NULL);
+    UtAssert_UINT32_EQ(CFE_MissionLib_Router_Deliver(&Router, &Buffer), 1);
+    UtAssert_UINT32_EQ(Delivered, 1);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_CFE_MissionLib_Router_Churn, NULL, NULL, "Router Churn");
+    UtTest_Add(Test_CFE_MissionLib_Router_SharedFilter, NULL, NULL, "Router Shared Filter");
+    UtTest_Add(Test_CFE_MissionLib_Router_UnsubscribeInDeliver, NULL, NULL, "Router Unsubscribe In Deliver");
+}
@@ -0,0 +1,66 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in cfe_missionlib_cmdcode header
+ */
+
+#include "cfe_missionlib_cmdcode.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_CommandCodeIndex_Init()
+ * ----------------------------------------------------
+ */
+int32_t CFE_MissionLib_CommandCodeIndex_Init(CFE_MissionLib_CommandCodeIndex_t *Index,
+                                             const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseEdsId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_CommandCodeIndex_Init, int32_t);
+
+    UT_GenStub_AddParam(CFE_MissionLib_CommandCodeIndex_Init, CFE_MissionLib_CommandCodeIndex_t *, Index);
+    UT_GenStub_AddParam(CFE_MissionLib_CommandCodeIndex_Init, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(CFE_MissionLib_CommandCodeIndex_Init, EdsLib_Id_t, BaseEdsId);
+
+    UT_GenStub_Execute(CFE_MissionLib_CommandCodeIndex_Init, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_CommandCodeIndex_Init, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_CommandCodeIndex_Lookup()
+ * ----------------------------------------------------
+ */
+int32_t CFE_MissionLib_CommandCodeIndex_Lookup(const CFE_MissionLib_CommandCodeIndex_t *Index, uint32_t CommandCode,
+                                               EdsLib_Id_t *EdsId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_CommandCodeIndex_Lookup, int32_t);
+
+    UT_GenStub_AddParam(CFE_MissionLib_CommandCodeIndex_Lookup, const CFE_MissionLib_CommandCodeIndex_t *, Index);
+    UT_GenStub_AddParam(CFE_MissionLib_CommandCodeIndex_Lookup, uint32_t, CommandCode);
+    UT_GenStub_AddParam(CFE_MissionLib_CommandCodeIndex_Lookup, EdsLib_Id_t *, EdsId);
+
+    UT_GenStub_Execute(CFE_MissionLib_CommandCodeIndex_Lookup, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_CommandCodeIndex_Lookup, int32_t);
+}
@@ -0,0 +1,156 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in cfe_missionlib_framer header
+ */
+
+#include "cfe_missionlib_framer.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Framer_CommitWrite()
+ * ----------------------------------------------------
+ */
+void CFE_MissionLib_Framer_CommitWrite(CFE_MissionLib_Framer_t *Framer, uint32_t Size)
+{
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_CommitWrite, CFE_MissionLib_Framer_t *, Framer);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_CommitWrite, uint32_t, Size);
+
+    UT_GenStub_Execute(CFE_MissionLib_Framer_CommitWrite, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Framer_DecodeMsgId()
+ * ----------------------------------------------------
+ */
+bool CFE_MissionLib_Framer_DecodeMsgId(void *Arg, const void *HeaderData, uint32_t PacketSize, uint32_t *MsgId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_Framer_DecodeMsgId, bool);
+
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_DecodeMsgId, void *, Arg);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_DecodeMsgId, const void *, HeaderData);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_DecodeMsgId, uint32_t, PacketSize);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_DecodeMsgId, uint32_t *, MsgId);
+
+    UT_GenStub_Execute(CFE_MissionLib_Framer_DecodeMsgId, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_Framer_DecodeMsgId, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Framer_GetStats()
+ * ----------------------------------------------------
+ */
+void CFE_MissionLib_Framer_GetStats(const CFE_MissionLib_Framer_t *Framer, CFE_MissionLib_Framer_Stats_t *Stats)
+{
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_GetStats, const CFE_MissionLib_Framer_t *, Framer);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_GetStats, CFE_MissionLib_Framer_Stats_t *, Stats);
+
+    UT_GenStub_Execute(CFE_MissionLib_Framer_GetStats, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Framer_GetWriteBuffer()
+ * ----------------------------------------------------
+ */
+uint8_t *CFE_MissionLib_Framer_GetWriteBuffer(CFE_MissionLib_Framer_t *Framer, uint32_t *AvailSize)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_Framer_GetWriteBuffer, uint8_t *);
+
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_GetWriteBuffer, CFE_MissionLib_Framer_t *, Framer);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_GetWriteBuffer, uint32_t *, AvailSize);
+
+    UT_GenStub_Execute(CFE_MissionLib_Framer_GetWriteBuffer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_Framer_GetWriteBuffer, uint8_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Framer_Init()
+ * ----------------------------------------------------
+ */
+int32_t CFE_MissionLib_Framer_Init(CFE_MissionLib_Framer_t *Framer, const EdsLib_DatabaseObject_t *GD,
+                                   EdsLib_Id_t PacketEdsId, void *Buffer, uint32_t BufferSize, uint32_t MaxPacketSize)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_Framer_Init, int32_t);
+
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_Init, CFE_MissionLib_Framer_t *, Framer);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_Init, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_Init, EdsLib_Id_t, PacketEdsId);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_Init, void *, Buffer);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_Init, uint32_t, BufferSize);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_Init, uint32_t, MaxPacketSize);
+
+    UT_GenStub_Execute(CFE_MissionLib_Framer_Init, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_Framer_Init, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Framer_Next()
+ * ----------------------------------------------------
+ */
+bool CFE_MissionLib_Framer_Next(CFE_MissionLib_Framer_t *Framer, CFE_MissionLib_Framer_Slice_t *Slice)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_Framer_Next, bool);
+
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_Next, CFE_MissionLib_Framer_t *, Framer);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_Next, CFE_MissionLib_Framer_Slice_t *, Slice);
+
+    UT_GenStub_Execute(CFE_MissionLib_Framer_Next, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_Framer_Next, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Framer_SetEndOfStream()
+ * ----------------------------------------------------
+ */
+void CFE_MissionLib_Framer_SetEndOfStream(CFE_MissionLib_Framer_t *Framer)
+{
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_SetEndOfStream, CFE_MissionLib_Framer_t *, Framer);
+
+    UT_GenStub_Execute(CFE_MissionLib_Framer_SetEndOfStream, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Framer_SetHeaderCheck()
+ * ----------------------------------------------------
+ */
+void CFE_MissionLib_Framer_SetHeaderCheck(CFE_MissionLib_Framer_t *Framer,
+                                          CFE_MissionLib_Framer_HeaderCheck_t HeaderCheck, void *Arg)
+{
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_SetHeaderCheck, CFE_MissionLib_Framer_t *, Framer);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_SetHeaderCheck, CFE_MissionLib_Framer_HeaderCheck_t, HeaderCheck);
+    UT_GenStub_AddParam(CFE_MissionLib_Framer_SetHeaderCheck, void *, Arg);
+
+    UT_GenStub_Execute(CFE_MissionLib_Framer_SetHeaderCheck, Basic, NULL);
+}
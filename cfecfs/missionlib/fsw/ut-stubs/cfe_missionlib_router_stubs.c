@@ -0,0 +1,208 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in cfe_missionlib_router header
+ */
+
+#include "cfe_missionlib_router.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Router_Deliver()
+ * ----------------------------------------------------
+ */
+uint32_t CFE_MissionLib_Router_Deliver(CFE_MissionLib_Router_t *Router, CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_Router_Deliver, uint32_t);
+
+    UT_GenStub_AddParam(CFE_MissionLib_Router_Deliver, CFE_MissionLib_Router_t *, Router);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_Deliver, CFE_MissionLib_Router_Buffer_t *, Buffer);
+
+    UT_GenStub_Execute(CFE_MissionLib_Router_Deliver, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_Router_Deliver, uint32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Router_GetStats()
+ * ----------------------------------------------------
+ */
+void CFE_MissionLib_Router_GetStats(const CFE_MissionLib_Router_t *Router, CFE_MissionLib_Router_Stats_t *Stats)
+{
+    UT_GenStub_AddParam(CFE_MissionLib_Router_GetStats, const CFE_MissionLib_Router_t *, Router);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_GetStats, CFE_MissionLib_Router_Stats_t *, Stats);
+
+    UT_GenStub_Execute(CFE_MissionLib_Router_GetStats, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Router_Init()
+ * ----------------------------------------------------
+ */
+int32_t CFE_MissionLib_Router_Init(CFE_MissionLib_Router_t *Router, void *Storage, uint32_t StorageSize)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_Router_Init, int32_t);
+
+    UT_GenStub_AddParam(CFE_MissionLib_Router_Init, CFE_MissionLib_Router_t *, Router);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_Init, void *, Storage);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_Init, uint32_t, StorageSize);
+
+    UT_GenStub_Execute(CFE_MissionLib_Router_Init, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_Router_Init, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Router_InitBuffer()
+ * ----------------------------------------------------
+ */
+void CFE_MissionLib_Router_InitBuffer(CFE_MissionLib_Router_Buffer_t *Buffer, const void *Data, uint32_t Size,
+                                      uint32_t MsgId, uint16_t TopicId, CFE_MissionLib_Router_Release_t Release,
+                                      void *ReleaseArg)
+{
+    UT_GenStub_AddParam(CFE_MissionLib_Router_InitBuffer, CFE_MissionLib_Router_Buffer_t *, Buffer);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_InitBuffer, const void *, Data);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_InitBuffer, uint32_t, Size);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_InitBuffer, uint32_t, MsgId);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_InitBuffer, uint16_t, TopicId);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_InitBuffer, CFE_MissionLib_Router_Release_t, Release);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_InitBuffer, void *, ReleaseArg);
+
+    UT_GenStub_Execute(CFE_MissionLib_Router_InitBuffer, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Router_Match()
+ * ----------------------------------------------------
+ */
+uint32_t CFE_MissionLib_Router_Match(CFE_MissionLib_Router_t *Router, const CFE_MissionLib_Router_Buffer_t *Buffer,
+                                     CFE_MissionLib_Router_Match_Callback_t Callback, void *Arg)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_Router_Match, uint32_t);
+
+    UT_GenStub_AddParam(CFE_MissionLib_Router_Match, CFE_MissionLib_Router_t *, Router);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_Match, const CFE_MissionLib_Router_Buffer_t *, Buffer);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_Match, CFE_MissionLib_Router_Match_Callback_t, Callback);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_Match, void *, Arg);
+
+    UT_GenStub_Execute(CFE_MissionLib_Router_Match, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_Router_Match, uint32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Router_ReleaseBuffer()
+ * ----------------------------------------------------
+ */
+void CFE_MissionLib_Router_ReleaseBuffer(CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    UT_GenStub_AddParam(CFE_MissionLib_Router_ReleaseBuffer, CFE_MissionLib_Router_Buffer_t *, Buffer);
+
+    UT_GenStub_Execute(CFE_MissionLib_Router_ReleaseBuffer, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Router_RetainBuffer()
+ * ----------------------------------------------------
+ */
+void CFE_MissionLib_Router_RetainBuffer(CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    UT_GenStub_AddParam(CFE_MissionLib_Router_RetainBuffer, CFE_MissionLib_Router_Buffer_t *, Buffer);
+
+    UT_GenStub_Execute(CFE_MissionLib_Router_RetainBuffer, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Router_SubscribeMsgIdRange()
+ * ----------------------------------------------------
+ */
+int32_t CFE_MissionLib_Router_SubscribeMsgIdRange(CFE_MissionLib_Router_t *Router, uint32_t MsgIdLow,
+                                                  uint32_t MsgIdHigh, CFE_MissionLib_Router_Filter_t Filter,
+                                                  void *FilterArg, CFE_MissionLib_Router_Deliver_t Deliver,
+                                                  void *DeliverArg, uint32_t *SubscriptionId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_Router_SubscribeMsgIdRange, int32_t);
+
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeMsgIdRange, CFE_MissionLib_Router_t *, Router);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeMsgIdRange, uint32_t, MsgIdLow);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeMsgIdRange, uint32_t, MsgIdHigh);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeMsgIdRange, CFE_MissionLib_Router_Filter_t, Filter);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeMsgIdRange, void *, FilterArg);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeMsgIdRange, CFE_MissionLib_Router_Deliver_t, Deliver);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeMsgIdRange, void *, DeliverArg);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeMsgIdRange, uint32_t *, SubscriptionId);
+
+    UT_GenStub_Execute(CFE_MissionLib_Router_SubscribeMsgIdRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_Router_SubscribeMsgIdRange, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Router_SubscribeTopic()
+ * ----------------------------------------------------
+ */
+int32_t CFE_MissionLib_Router_SubscribeTopic(CFE_MissionLib_Router_t *Router, uint16_t TopicId,
+                                             CFE_MissionLib_Router_Filter_t Filter, void *FilterArg,
+                                             CFE_MissionLib_Router_Deliver_t Deliver, void *DeliverArg,
+                                             uint32_t *SubscriptionId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_Router_SubscribeTopic, int32_t);
+
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeTopic, CFE_MissionLib_Router_t *, Router);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeTopic, uint16_t, TopicId);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeTopic, CFE_MissionLib_Router_Filter_t, Filter);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeTopic, void *, FilterArg);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeTopic, CFE_MissionLib_Router_Deliver_t, Deliver);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeTopic, void *, DeliverArg);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_SubscribeTopic, uint32_t *, SubscriptionId);
+
+    UT_GenStub_Execute(CFE_MissionLib_Router_SubscribeTopic, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_Router_SubscribeTopic, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_MissionLib_Router_Unsubscribe()
+ * ----------------------------------------------------
+ */
+int32_t CFE_MissionLib_Router_Unsubscribe(CFE_MissionLib_Router_t *Router, uint32_t SubscriptionId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_MissionLib_Router_Unsubscribe, int32_t);
+
+    UT_GenStub_AddParam(CFE_MissionLib_Router_Unsubscribe, CFE_MissionLib_Router_t *, Router);
+    UT_GenStub_AddParam(CFE_MissionLib_Router_Unsubscribe, uint32_t, SubscriptionId);
+
+    UT_GenStub_Execute(CFE_MissionLib_Router_Unsubscribe, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_MissionLib_Router_Unsubscribe, int32_t);
+}
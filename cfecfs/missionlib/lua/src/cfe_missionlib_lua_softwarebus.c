@@ -47,11 +47,13 @@
 #include "edslib_binding_objects.h"
 #include "edslib_lua_objects.h"
 #include "cfe_missionlib_lua_softwarebus.h"
+#include "cfe_missionlib_cmdcode.h"
 #include "cfe_missionlib_runtime.h"
 #include "cfe_mission_eds_parameters.h"
 #include "cfe_mission_eds_interface_parameters.h"
 
 static const char CFE_MISSIONLIB_INTFDB_KEY;
+static const char CFE_MISSIONLIB_CMDCODE_INDEX_KEY;
 
 void CFE_MissionLib_Lua_MapPubSubParams(EdsInterface_CFE_SB_SoftwareBus_PubSub_t *PubSub, const CFE_MissionLib_Lua_Interface_Userdata_t *IntfObj)
 {
@@ -369,11 +371,50 @@ static int CFE_MissionLib_Lua_InterfaceObjectToString(lua_State *lua)
 }
 
 
+/*
+ * Get the command code index for a command argument type.  The index is built
+ * on first use and kept in a table within the database object, keyed by EdsId,
+ * so it is only built once for each topic.
+ */
+static const CFE_MissionLib_CommandCodeIndex_t *CFE_MissionLib_Lua_GetCommandCodeIndex(lua_State *lua, int dbobj_idx,
+        EdsLib_Id_t BaseEdsId)
+{
+    const EdsLib_Lua_Database_Userdata_t *DbObj = lua_touserdata(lua, dbobj_idx);
+    CFE_MissionLib_CommandCodeIndex_t *Index;
+
+    lua_getuservalue(lua, dbobj_idx);
+    lua_rawgetp(lua, -1, &CFE_MISSIONLIB_CMDCODE_INDEX_KEY);
+    if (lua_type(lua, -1) != LUA_TTABLE)
+    {
+        lua_pop(lua, 1);
+        lua_newtable(lua);
+        lua_pushvalue(lua, -1);
+        lua_rawsetp(lua, -3, &CFE_MISSIONLIB_CMDCODE_INDEX_KEY);
+    }
+
+    lua_rawgeti(lua, -1, BaseEdsId);
+    Index = lua_touserdata(lua, -1);
+    lua_pop(lua, 1);
+
+    if (Index == NULL)
+    {
+        Index = lua_newuserdata(lua, sizeof(*Index));
+        CFE_MissionLib_CommandCodeIndex_Init(Index, DbObj->GD, BaseEdsId);
+        lua_rawseti(lua, -2, BaseEdsId);
+    }
+
+    /* The index remains referenced from the table in the database object */
+    lua_pop(lua, 2);
+
+    return Index;
+}
+
 static int CFE_MissionLib_Lua_NewMessage(lua_State *lua)
 {
     const EdsLib_Lua_Database_Userdata_t *DbObj = lua_touserdata(lua, lua_upvalueindex(1));
     const CFE_MissionLib_Lua_Interface_Userdata_t *IntfObj = luaL_checkudata(lua, 1, "CFE_MissionLib_Lua_Interface");
-    const char *CommandName = luaL_optstring(lua, 2, NULL);
+    const CFE_MissionLib_CommandCodeIndex_t *CmdCodeIndex = NULL;
+    const char *CommandName = NULL;
     EdsLib_DataTypeDB_DerivedTypeInfo_t DerivInfo;
     EdsLib_LuaBinding_DescriptorObject_t *ObjectUserData;
     EdsInterface_CFE_SB_SoftwareBus_PubSub_t PubSub;
@@ -381,6 +422,16 @@ static int CFE_MissionLib_Lua_NewMessage(lua_State *lua)
     uint16_t DerivIdx;
     int32_t Status;
 
+    /* The command may be given either by name or by command code */
+    if (lua_type(lua, 2) == LUA_TNUMBER)
+    {
+        CmdCodeIndex = CFE_MissionLib_Lua_GetCommandCodeIndex(lua, lua_upvalueindex(1), IntfObj->IndicationBaseArg);
+    }
+    else
+    {
+        CommandName = luaL_optstring(lua, 2, NULL);
+    }
+
     Status = EdsLib_DataTypeDB_GetDerivedInfo(DbObj->GD, IntfObj->IndicationBaseArg, &DerivInfo);
     if (Status != EDSLIB_SUCCESS)
     {
@@ -397,7 +448,14 @@ static int CFE_MissionLib_Lua_NewMessage(lua_State *lua)
      * It may have a command code as well, which would be a similarly-named type that is
      * derived from the interface command argument type.
      */
-    if (Status == EDSLIB_SUCCESS && CommandName != NULL)
+    if (CmdCodeIndex != NULL)
+    {
+        if (CFE_MissionLib_CommandCodeIndex_Lookup(CmdCodeIndex, lua_tointeger(lua, 2), &PossibleId) == CFE_MISSIONLIB_SUCCESS)
+        {
+            ObjectUserData->EdsId = PossibleId;
+        }
+    }
+    else if (Status == EDSLIB_SUCCESS && CommandName != NULL)
     {
         DerivIdx = 0;
         while (1)
@@ -44,6 +44,7 @@
 
 #include "cfe_missionlib_python.h"
 #include "cfe_missionlib_database_types.h"
+#include "cfe_missionlib_cmdcode.h"
 #include "edslib_binding_objects.h"
 #include "edslib_python_internal.h"
 
@@ -87,6 +88,9 @@ typedef struct
     EdsLib_Id_t EdsId;
     CFE_MissionLib_IndicationInfo_t IndInfo;
 
+    /* Command code lookup table, built on the first call to GetCmdEdsId */
+    CFE_MissionLib_CommandCodeIndex_t *CmdCodeIndex;
+
     /* TypeCache contains weak references to Topics in the db, such that they
      * will not be re-created each time they are required.  This also gives persistence,
      * i.e. repeated calls to lookup the same type give the same object, instead of a
@@ -55,18 +55,6 @@ static int          CFE_MissionLib_Python_TopicIterator_traverse(PyObject *obj,
 static int          CFE_MissionLib_Python_TopicIterator_clear(PyObject *obj);
 static PyObject *   CFE_MissionLib_Python_TopicIterator_iternext(PyObject *obj);
 
-struct CbArg
-{
-    uint8_t CommandCode;
-    EdsLib_Id_t PossibleId;
-    EdsLib_Id_t EdsId;
-};
-
-typedef struct CbArg CbArg_t;
-
-void SubcommandCallback(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_EntityInfo_t *MemberInfo,
-        EdsLib_GenericValueBuffer_t *ConstraintValue, void *Arg);
-
 static PyMethodDef CFE_MissionLib_Python_Topic_methods[] =
 {
         {"GetCmdEdsId", CFE_MissionLib_Python_Topic_GetCmdEdsIdFromCode, METH_VARARGS, "Get a CFE command message EDS Object from a Topic"},
@@ -142,6 +130,12 @@ static void CFE_MissionLib_Python_Topic_dealloc(PyObject * obj)
     Py_CLEAR(self->TypeCache);
     Py_CLEAR(self->TopicName);
 
+    if (self->CmdCodeIndex != NULL)
+    {
+        PyMem_Free(self->CmdCodeIndex);
+        self->CmdCodeIndex = NULL;
+    }
+
     if (self->WeakRefList != NULL)
     {
         PyObject_ClearWeakRefs(obj);
@@ -527,27 +521,13 @@ static PyObject *CFE_MissionLib_Python_TopicIterator_iternext(PyObject *obj)
     return result;
 }
 
-void SubcommandCallback(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_EntityInfo_t *MemberInfo,
-        EdsLib_GenericValueBuffer_t *ConstraintValue, void *Arg)
-{
-    CbArg_t *Argument = (CbArg_t *) Arg;
-
-    if (ConstraintValue->Value.u8 == Argument->CommandCode )
-    {
-        Argument->EdsId = Argument->PossibleId;
-    }
-}
-
 static PyObject *CFE_MissionLib_Python_Topic_GetCmdEdsIdFromCode(PyObject *obj, PyObject *args)
 {
     CFE_MissionLib_Python_Topic_t *self = (CFE_MissionLib_Python_Topic_t*) obj;
     EdsLib_Python_Database_t *EdsDb;
     PyObject *arg1;
-    uint8_t CommandCode;
-    int32_t idx;
-    EdsLib_Id_t PossibleId;
-    EdsLib_ConstraintCallback_t Callback = SubcommandCallback;
-    CbArg_t Argument;
+    unsigned long CommandCode;
+    EdsLib_Id_t EdsId;
     PyObject *result = NULL;
 
     do
@@ -561,6 +541,15 @@ static PyObject *CFE_MissionLib_Python_Topic_GetCmdEdsIdFromCode(PyObject *obj,
         if (PyLong_Check(arg1))
         {
             CommandCode = PyLong_AsUnsignedLong(arg1);
+            if (PyErr_Occurred())
+            {
+                break;
+            }
+            if (CommandCode > UINT32_MAX)
+            {
+                PyErr_SetString(PyExc_OverflowError, "Command Code argument: value exceeds 32 bits");
+                break;
+            }
         }
         else
         {
@@ -568,17 +557,26 @@ static PyObject *CFE_MissionLib_Python_Topic_GetCmdEdsIdFromCode(PyObject *obj,
             break;
         }
 
-        EdsDb = self->IntfObj->DbObj->EdsDbObj;
-        Argument.CommandCode = CommandCode;
-
-        for (idx = 0; idx < self->IndInfo.NumSubcommands; idx++)
+        /*
+         * The subcommands of a topic never change, so the command codes
+         * are indexed on first use and all later lookups use the table
+         */
+        if (self->CmdCodeIndex == NULL)
         {
-            EdsLib_DataTypeDB_GetDerivedTypeById(EdsDb->GD, self->EdsId, idx, &PossibleId);
-            Argument.PossibleId = PossibleId;
-            EdsLib_DataTypeDB_ConstraintIterator(EdsDb->GD, self->EdsId, PossibleId, Callback, (void *)&Argument);
+            self->CmdCodeIndex = PyMem_Malloc(sizeof(*self->CmdCodeIndex));
+            if (self->CmdCodeIndex == NULL)
+            {
+                PyErr_NoMemory();
+                break;
+            }
+
+            EdsDb = self->IntfObj->DbObj->EdsDbObj;
+            CFE_MissionLib_CommandCodeIndex_Init(self->CmdCodeIndex, EdsDb->GD, self->EdsId);
         }
 
-        result = PyLong_FromLong((long int) Argument.EdsId);
+        CFE_MissionLib_CommandCodeIndex_Lookup(self->CmdCodeIndex, CommandCode, &EdsId);
+
+        result = PyLong_FromLong((long int) EdsId);
     } while(0);
 
     return result;
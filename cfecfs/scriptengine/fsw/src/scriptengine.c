@@ -48,11 +48,37 @@
 
 SCRIPTENGINE_Global_t SCRIPTENGINE_Global;
 
+/*
+ * Registry key for the table of persistent subscriptions, indexed by pipe object.
+ * Keys and values are both weak, so this does not keep either object alive.
+ */
+static const char SCRIPTENGINE_PIPE_SUBSCRIPTIONS_KEY = 0;
+
 typedef struct SCRIPTENGINE_PipeWrapper
 {
     CFE_SB_PipeId_t PipeId;
 } SCRIPTENGINE_PipeWrapper_t;
 
+/*
+ * A persistent subscription of a pipe to a single MsgId
+ *
+ * The subscription remains active until it is explicitly unsubscribed or the
+ * Lua object is garbage collected.  The Lua uservalue of the object holds a
+ * reference to the pipe (so the pipe outlives the subscription) and the pool
+ * of reusable EDS objects, indexed by EdsId.
+ */
+typedef struct SCRIPTENGINE_Subscription
+{
+    CFE_SB_PipeId_t PipeId;
+    CFE_SB_MsgId_t  MsgId;
+    bool            IsSubscribed;
+    bool            ReuseObjects;
+    bool            IdentCached;
+    EdsLib_Id_t     IndicationBaseArg;
+    EdsLib_Id_t     CachedEdsId;
+    size_t          MaxSize;
+} SCRIPTENGINE_Subscription_t;
+
 static int SCRIPTENGINE_ErrorHandler(lua_State *lua)
 {
     lua_getglobal(lua, "debug");
@@ -158,11 +184,239 @@ static int SCRIPTENGINE_DeletePipe(lua_State *lua)
 }
 
 
-static int SCRIPTENGINE_WaitFor(lua_State *lua)
+/*
+ * Get the active persistent subscription of the pipe object at the given stack index, if any
+ */
+static SCRIPTENGINE_Subscription_t *SCRIPTENGINE_GetPipeSubscription(lua_State *lua, int PipeIdx)
+{
+    SCRIPTENGINE_Subscription_t *SubObj;
+
+    lua_rawgetp(lua, LUA_REGISTRYINDEX, &SCRIPTENGINE_PIPE_SUBSCRIPTIONS_KEY);
+    lua_pushvalue(lua, PipeIdx);
+    lua_rawget(lua, -2);
+    SubObj = luaL_testudata(lua, -1, "SCRIPTENGINE_Subscription");
+    lua_pop(lua, 2);
+
+    if (SubObj != NULL && !SubObj->IsSubscribed)
+    {
+        SubObj = NULL;
+    }
+
+    return SubObj;
+}
+
+/*
+ * Create a persistent subscription of a pipe to the MsgId of an interface
+ *
+ * A pipe can only have one persistent subscription at a time, so every
+ * message received on it belongs to that subscription.
+ */
+static int SCRIPTENGINE_Subscribe(lua_State *lua)
 {
     CFE_MissionLib_Lua_Interface_Userdata_t *IntfObj = luaL_checkudata(lua, 1, "CFE_MissionLib_Lua_Interface");
     CFE_SB_PipeId_t *PipeObj = luaL_checkudata(lua, 2, "CFE_SB_PipeId");
-    lua_Integer timeout = luaL_optinteger(lua, 3, 1000);
+    EdsInterface_CFE_SB_SoftwareBus_PubSub_t PubSub;
+    EdsLib_DataTypeDB_DerivedTypeInfo_t DerivInfo;
+    SCRIPTENGINE_Subscription_t *SubObj;
+
+    if (SCRIPTENGINE_GetPipeSubscription(lua, 2) != NULL)
+    {
+        return luaL_error(lua, "Pipe already has a subscription");
+    }
+
+    SubObj = lua_newuserdata(lua, sizeof(*SubObj));
+    memset(SubObj, 0, sizeof(*SubObj));
+    luaL_getmetatable(lua, "SCRIPTENGINE_Subscription");
+    lua_setmetatable(lua, -2);
+
+    lua_newtable(lua);
+    lua_pushvalue(lua, 2);
+    lua_setfield(lua, -2, "Pipe");
+    lua_setuservalue(lua, -2);
+
+    /* Map the Intf to a MsgID */
+    CFE_MissionLib_Lua_MapPubSubParams(&PubSub, IntfObj);
+
+    SubObj->PipeId = *PipeObj;
+    SubObj->MsgId = PubSub.MsgId;
+    SubObj->ReuseObjects = lua_toboolean(lua, 3);
+    SubObj->IndicationBaseArg = IntfObj->IndicationBaseArg;
+
+    /*
+     * If the indication type has no derivatives, then every message on this
+     * MsgId is the same type, and identification can be done once, here.
+     */
+    if (EdsLib_DataTypeDB_GetDerivedInfo(&EDS_DATABASE, SubObj->IndicationBaseArg, &DerivInfo) == EDSLIB_SUCCESS)
+    {
+        SubObj->MaxSize = DerivInfo.MaxSize.Bytes;
+        if (DerivInfo.NumDerivatives == 0)
+        {
+            SubObj->CachedEdsId = SubObj->IndicationBaseArg;
+            SubObj->IdentCached = true;
+        }
+    }
+
+    if (CFE_SB_Subscribe(SubObj->MsgId, SubObj->PipeId) != CFE_SUCCESS)
+    {
+        return 0;
+    }
+
+    SubObj->IsSubscribed = true;
+
+    lua_rawgetp(lua, LUA_REGISTRYINDEX, &SCRIPTENGINE_PIPE_SUBSCRIPTIONS_KEY);
+    lua_pushvalue(lua, 2);
+    lua_pushvalue(lua, -3);
+    lua_rawset(lua, -3);
+    lua_pop(lua, 1);
+
+    return 1;
+}
+
+static int SCRIPTENGINE_Unsubscribe(lua_State *lua)
+{
+    SCRIPTENGINE_Subscription_t *SubObj = luaL_checkudata(lua, 1, "SCRIPTENGINE_Subscription");
+
+    if (SubObj->IsSubscribed)
+    {
+        CFE_SB_Unsubscribe(SubObj->MsgId, SubObj->PipeId);
+        SubObj->IsSubscribed = false;
+    }
+
+    return 0;
+}
+
+static int SCRIPTENGINE_SubscriptionToString(lua_State *lua)
+{
+    SCRIPTENGINE_Subscription_t *SubObj = luaL_checkudata(lua, 1, "SCRIPTENGINE_Subscription");
+
+    lua_pushfstring(lua, "SCRIPTENGINE_Subscription: MsgId=0x%x PipeId=%d%s",
+            (unsigned int)CFE_SB_MsgIdToValue(SubObj->MsgId),
+            (int)CFE_RESOURCEID_TO_ULONG(SubObj->PipeId),
+            SubObj->IsSubscribed ? "" : " (inactive)");
+
+    return 1;
+}
+
+/*
+ * Receive the next message on a persistent subscription
+ *
+ * Unlike the one-shot form of WaitFor, the pipe stays subscribed between
+ * calls and does not need to be drained afterward; the SB buffer from the
+ * previous receive is released by the next call to CFE_SB_ReceiveBuffer().
+ *
+ * If the subscription was created with object reuse enabled, the same EDS
+ * object is returned for every message of a given type, and it is overwritten
+ * by each new message.  Scripts which need to keep a message beyond the next
+ * WaitFor should not enable reuse.
+ *
+ * Messages with a different MsgId, i.e. left in the pipe from an earlier
+ * subscription, are discarded.
+ */
+static int SCRIPTENGINE_WaitForSubscription(lua_State *lua)
+{
+    SCRIPTENGINE_Subscription_t *SubObj = luaL_checkudata(lua, 1, "SCRIPTENGINE_Subscription");
+    lua_Integer timeout = luaL_optinteger(lua, 2, 1000);
+    EdsLib_Binding_DescriptorObject_t *ObjectUserData;
+    EdsLib_DataTypeDB_DerivativeObjectInfo_t DerivObjInfo;
+    CFE_SB_Buffer_t *BufPtr;
+    CFE_SB_MsgId_t MsgId;
+    CFE_MSG_Size_t MsgSize;
+    size_t BufferSize;
+    uint8 *LuaObj;
+
+    if (!SubObj->IsSubscribed)
+    {
+        return 0;
+    }
+
+    BufPtr = NULL;
+    while (true)
+    {
+        if (CFE_SB_ReceiveBuffer(&BufPtr, SubObj->PipeId, timeout) != CFE_SUCCESS)
+        {
+            return 0;
+        }
+
+        if (CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId) == CFE_SUCCESS && CFE_SB_MsgId_Equal(MsgId, SubObj->MsgId))
+        {
+            break;
+        }
+    }
+
+    CFE_MSG_GetSize(&BufPtr->Msg, &MsgSize);
+
+    if (SubObj->IdentCached)
+    {
+        DerivObjInfo.EdsId = SubObj->CachedEdsId;
+    }
+    else if (EdsLib_DataTypeDB_IdentifyBuffer(&EDS_DATABASE, SubObj->IndicationBaseArg, BufPtr, &DerivObjInfo) != EDSLIB_SUCCESS)
+    {
+        /* This is OK and may mean that the object simply isn't derived; use the original type */
+        DerivObjInfo.EdsId = SubObj->IndicationBaseArg;
+    }
+
+    ObjectUserData = NULL;
+    if (SubObj->ReuseObjects)
+    {
+        lua_getuservalue(lua, 1);
+        lua_rawgeti(lua, -1, DerivObjInfo.EdsId);
+        lua_remove(lua, -2);
+        if (lua_isuserdata(lua, -1))
+        {
+            ObjectUserData = luaL_checkudata(lua, -1, "EdsLib_Object");
+            if (EdsLib_Binding_GetBufferMaxSize(ObjectUserData) < MsgSize)
+            {
+                ObjectUserData = NULL;
+            }
+        }
+        if (ObjectUserData == NULL)
+        {
+            lua_pop(lua, 1);
+        }
+    }
+
+    if (ObjectUserData == NULL)
+    {
+        /* Size new objects for the largest message, so they can be reused for any of them */
+        BufferSize = MsgSize;
+        if (BufferSize < SubObj->MaxSize)
+        {
+            BufferSize = SubObj->MaxSize;
+        }
+
+        ObjectUserData = SCRIPTENGINE_NewEdsObjectWithContent(lua, DerivObjInfo.EdsId, BufferSize);
+        if (SubObj->ReuseObjects)
+        {
+            lua_getuservalue(lua, 1);
+            lua_pushvalue(lua, -2);
+            lua_rawseti(lua, -2, DerivObjInfo.EdsId);
+            lua_pop(lua, 1);
+        }
+    }
+
+    LuaObj = EdsLib_Binding_GetNativeObject(ObjectUserData);
+    if (LuaObj == NULL)
+    {
+        lua_pop(lua, 1);
+        return 0;
+    }
+
+    /* Populate the object with the same data, clearing anything left from a previous message */
+    BufferSize = EdsLib_Binding_GetBufferMaxSize(ObjectUserData);
+    memcpy(LuaObj, &BufPtr->Msg, MsgSize);
+    if (BufferSize > MsgSize)
+    {
+        memset(LuaObj + MsgSize, 0, BufferSize - MsgSize);
+    }
+
+    return 1;
+}
+
+static int SCRIPTENGINE_WaitFor(lua_State *lua)
+{
+    CFE_MissionLib_Lua_Interface_Userdata_t *IntfObj;
+    CFE_SB_PipeId_t *PipeObj;
+    lua_Integer timeout;
     EdsInterface_CFE_SB_SoftwareBus_PubSub_t PubSub;
     CFE_SB_Buffer_t *BufPtr;
     CFE_MSG_Size_t MsgSize;
@@ -172,9 +426,27 @@ static int SCRIPTENGINE_WaitFor(lua_State *lua)
     void *LuaObj;
     int nret;
 
+    /* If passed a persistent subscription, then receive on that */
+    if (luaL_testudata(lua, 1, "SCRIPTENGINE_Subscription") != NULL)
+    {
+        return SCRIPTENGINE_WaitForSubscription(lua);
+    }
+
+    IntfObj = luaL_checkudata(lua, 1, "CFE_MissionLib_Lua_Interface");
+    PipeObj = luaL_checkudata(lua, 2, "CFE_SB_PipeId");
+    timeout = luaL_optinteger(lua, 3, 1000);
     nret = 0;
     BufPtr = NULL;
 
+    /*
+     * The one-shot form drains the pipe afterward, which would discard
+     * messages that belong to a persistent subscription on the same pipe.
+     */
+    if (SCRIPTENGINE_GetPipeSubscription(lua, 2) != NULL)
+    {
+        return luaL_error(lua, "Pipe has a persistent subscription, use its WaitFor instead");
+    }
+
     /* Map the Intf to a MsgID */
     CFE_MissionLib_Lua_MapPubSubParams(&PubSub, IntfObj);
 
@@ -263,7 +535,38 @@ static void SCRIPTENGINE_Setup(lua_State *lua)
     }
     lua_pop(lua, 1);
 
+    /*
+     * Metatable for persistent subscriptions
+     * These are unsubscribed when the object is collected
+     */
+    if (luaL_newmetatable(lua, "SCRIPTENGINE_Subscription"))
+    {
+        lua_pushstring(lua, "__tostring");
+        lua_pushcfunction(lua, SCRIPTENGINE_SubscriptionToString);
+        lua_rawset(lua, -3);
+        lua_pushstring(lua, "__gc");
+        lua_pushcfunction(lua, SCRIPTENGINE_Unsubscribe);
+        lua_rawset(lua, -3);
+
+        lua_pushstring(lua, "__index");
+        lua_newtable(lua);
+        lua_pushstring(lua, "WaitFor");
+        lua_pushcfunction(lua, SCRIPTENGINE_WaitForSubscription);
+        lua_rawset(lua, -3);
+        lua_pushstring(lua, "Unsubscribe");
+        lua_pushcfunction(lua, SCRIPTENGINE_Unsubscribe);
+        lua_rawset(lua, -3);
+        lua_rawset(lua, -3);
+    }
+    lua_pop(lua, 1);
 
+    lua_newtable(lua);
+    lua_newtable(lua);
+    lua_pushstring(lua, "__mode");
+    lua_pushstring(lua, "kv");
+    lua_rawset(lua, -3);
+    lua_setmetatable(lua, -2);
+    lua_rawsetp(lua, LUA_REGISTRYINDEX, &SCRIPTENGINE_PIPE_SUBSCRIPTIONS_KEY);
 
     lua_newtable(lua);
     lua_pushstring(lua, "SendMsg");
@@ -278,6 +581,10 @@ static void SCRIPTENGINE_Setup(lua_State *lua)
     lua_pushcfunction(lua, SCRIPTENGINE_WaitFor);
     lua_settable(lua, -3);
 
+    lua_pushstring(lua, "Subscribe");
+    lua_pushcfunction(lua, SCRIPTENGINE_Subscribe);
+    lua_settable(lua, -3);
+
 
     lua_setglobal(lua, "CFE");
 
@@ -11,4 +11,22 @@ function TestFunc()
     CFE.SendMsg(testobj)
 end
 
+function WatchHousekeeping(count)
+    tlm = EdsDB.GetInterface("CFE_ES/Application/HK_TLM")
+    pipe = CFE.CreatePipe(4, "SCRIPT_HK")
+
+    -- The subscription stays active until unsubscribed or collected,
+    -- and with reuse enabled each message is decoded into the same object
+    sub = CFE.Subscribe(tlm, pipe, true)
+
+    for i = 1, count do
+        msg = sub:WaitFor(5000)
+        if (msg) then
+            print("hk=" .. EdsDB.ToHexString(msg))
+        end
+    end
+
+    sub:Unsubscribe()
+end
+
 print "Completed Lua engine startup."
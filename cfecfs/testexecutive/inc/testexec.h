@@ -30,10 +30,33 @@
 #ifndef _TESTEXEC_H_
 #define _TESTEXEC_H_
 
+#include <stdint.h>
+#include <stdbool.h>
+#include <lua.h>
+
+/*
+ * Suspending a wait inside a C function requires continuations,
+ * which are available in Lua 5.3 and later.  With older versions
+ * scheduled scenarios still run, but each wait blocks the process.
+ */
+#if (LUA_VERSION_NUM >= 503)
+#define TESTEXEC_CAN_YIELD
+typedef lua_KContext TestExec_KContext_t;
+#else
+typedef intptr_t TestExec_KContext_t;
+#endif
+
+typedef int (*TestExec_KFunction_t)(struct lua_State *lua, int status, TestExec_KContext_t ctx);
 
 int TestIntf_Udp_Create(struct lua_State *lua);
 int TestIntf_Remote_Create(struct lua_State *lua);
 int TestIntf_GetFactory(struct lua_State *lua);
+void TestIntf_WaitOnApi(struct lua_State *lua, int ApiIdx, int32_t Timeout);
+
+int TestSched_Create(struct lua_State *lua);
+bool TestSched_IsScheduled(struct lua_State *lua);
+int TestSched_WaitYield(struct lua_State *lua, int ApiIdx, int32_t Timeout, TestExec_KFunction_t Continuation);
+void TestSched_NotifyActivity(void);
 
 #endif  /* _TESTEXEC_H_ */
 
@@ -28,6 +28,7 @@
  */
 
 #include <stdlib.h>
+#include <stdbool.h>
 #include <string.h> /* memset() */
 #include <time.h>
 #include <errno.h>
@@ -152,250 +153,351 @@ static int TestIntf_Filter_Message(lua_State *lua)
     return 0;
 }
 
-static int TestIntf_WaitAction(lua_State *lua)
+/*
+ * Stack layout used by the wait action and its continuation
+ *  idx@1 - expected event table (criteria)
+ *  idx@2 - timeout in ms
+ *  idx@3 - low level intf object (API)
+ *  idx@4 - expiration time (userdata holding struct timespec)
+ */
+#define TESTINTF_WAIT_IDX_CRITERIA      1
+#define TESTINTF_WAIT_IDX_API           3
+#define TESTINTF_WAIT_IDX_EXPIRE        4
+#define TESTINTF_WAIT_IDX_TOP           4
+
+/*
+ * Poll the low level interface once and check the result against the criteria
+ *
+ * Returns 1 if all conditions have been met, 0 if an event was received but
+ * conditions are still outstanding, or -1 if the poll returned nothing.
+ */
+static int TestIntf_WaitPollOnce(lua_State *lua)
 {
-    int32_t Timeout = luaL_optinteger(lua, 2, -1);
-    struct timespec expire;
-    struct timespec current;
-    int nret;
     uint32_t conditions_req;
     uint32_t conditions_met;
-    enum
-    {
-        WAIT_STATE_NORMAL = 0,
-        WAIT_STATE_SLEEP
-    } waitstate;
 
-    printf("%s(): Start\n", __func__);
-    nret = 0;
-    luaL_checktype(lua, 1, LUA_TTABLE);
-    lua_settop(lua, 2);
-    lua_getfield(lua, lua_upvalueindex(1), "API");   /* @3 (userdata object = low level intf) */
-    waitstate = WAIT_STATE_NORMAL;
+    lua_settop(lua, TESTINTF_WAIT_IDX_TOP);
 
-    clock_gettime(CLOCK_MONOTONIC, &expire);
-    if (Timeout >= 0)
+    printf("%s(): Poll\n", __func__);
+    lua_getfield(lua, TESTINTF_WAIT_IDX_API, "Poll"); /* idx 5 = poll function */
+    lua_pushvalue(lua, TESTINTF_WAIT_IDX_API);
+    lua_call(lua, 1, 3);
+
+    /*
+     * After call:
+     *  idx@5 = type of event ("Message", etc)
+     *  idx@6 = event data object
+     *  idx@7 = additional event attributes
+     */
+    printf("%s(): Stack= %s %s %s\n", __func__,
+            lua_typename(lua, lua_type(lua, 5)),
+            lua_typename(lua, lua_type(lua, 6)),
+            lua_typename(lua, lua_type(lua, 7)));
+    if (lua_isnil(lua, 5))
     {
-        expire.tv_sec += Timeout / 1000;
-        expire.tv_nsec += (Timeout % 1000) * 1000000;
+        lua_settop(lua, TESTINTF_WAIT_IDX_TOP);
+        return -1;
     }
-    if (expire.tv_nsec > 1000000000)
+
+    TestSched_NotifyActivity();
+
+    /*
+     * Preprocess returned data
+     */
+    if (!lua_isnil(lua, 6))
     {
-        ++expire.tv_sec;
-        expire.tv_nsec -= 1000000000;
+        lua_getfield(lua, lua_upvalueindex(1), "RecvProcessor");/* idx@8 - preprocessor table */
+        lua_pushvalue(lua, 5);                                  /* idx@9 - event type */
+        lua_gettable(lua, -2);                                  /* idx@9 - preprocessor func */
+        if (lua_isfunction(lua, -1))
+        {
+            lua_pushvalue(lua, 6);                              /* idx@10 - event data object */
+            lua_call(lua, 1, 1);                                /* idx@9 - preprocessed event data obj */
+            lua_replace(lua, 6);                                /* replace original event data obj */
+        }
+        lua_settop(lua, 7);
     }
 
-    while(1)
+    /*
+     * check if the matches have been satisfied
+     */
+    conditions_req = 0;
+    conditions_met = 0;
+    lua_pushnil(lua);                           /* idx @8 - expected event table index */
+    while(lua_next(lua, TESTINTF_WAIT_IDX_CRITERIA))  /* idx @9 - expected event table value */
     {
-        lua_settop(lua, 3);
-
-        printf("%s(): Poll\n", __func__);
-        lua_getfield(lua, 3, "Poll"); /* idx 4 = poll function */
-        lua_pushvalue(lua, 3);
-        lua_call(lua, 1, 3);
-
-        /*
-         * After call:
-         *  idx@4 = type of event ("Message", etc)
-         *  idx@5 = event data object
-         *  idx@6 = additional event attributes
-         */
-        printf("%s(): Stack= %s %s %s\n", __func__,
-                lua_typename(lua, lua_type(lua, 4)),
-                lua_typename(lua, lua_type(lua, 5)),
-                lua_typename(lua, lua_type(lua, 6)));
-        if (!lua_isnil(lua, 4))
+        ++conditions_req;
+        if (lua_type(lua, 9) == LUA_TTABLE)
         {
-            /*
-             * Preprocess returned data
-             */
-            if (!lua_isnil(lua, 5))
+            lua_getfield(lua, 9, "Matched");    /* idx @10 - already matched? */
+            if (lua_toboolean(lua, -1))
             {
-                lua_getfield(lua, lua_upvalueindex(1), "RecvProcessor");/* idx@7 - preprocessor table */
-                lua_pushvalue(lua, 4);                                  /* idx@8 - event type */
-                lua_gettable(lua, -2);                                  /* idx@8 - preprocessor func */
-                if (lua_isfunction(lua, -1))
-                {
-                    lua_pushvalue(lua, 5);                              /* idx@9 - event data object */
-                    lua_call(lua, 1, 1);                                /* idx@8 - preprocessed event data obj */
-                    lua_replace(lua, 5);                                /* replace original event data obj */
-                }
-                lua_settop(lua, 6);
+                ++conditions_met;
             }
-
-            /*
-             * check if the matches have been satisfied
-             */
-            conditions_req = 0;
-            conditions_met = 0;
-            lua_pushnil(lua);                           /* idx @7 - expected event table index */
-            while(lua_next(lua, 1))                     /* idx @8 - expected event table value */
+            else
             {
-                ++conditions_req;
-                if (lua_type(lua, 8) == LUA_TTABLE)
+                lua_getfield(lua, lua_upvalueindex(1), "RecvFilter");   /* idx@11 - filter table */
+                lua_pushvalue(lua, 5);                                  /* idx@12 - event type */
+                lua_gettable(lua, -2);                                  /* idx@12 - filter func */
+                if (lua_isfunction(lua, -1))
                 {
-                    lua_getfield(lua, 8, "Matched");    /* idx @9 - already matched? */
+                    lua_pushvalue(lua, 9);                              /* idx@13 - filter criteria table */
+                    lua_pushvalue(lua, 6);                              /* idx@14 - preprocessed event data */
+                    lua_call(lua, 2, 1);                                /* idx@12 - object (match) or nil (no match) */
                     if (lua_toboolean(lua, -1))
                     {
-                        ++conditions_met;
-                    }
-                    else
-                    {
-                        lua_getfield(lua, lua_upvalueindex(1), "RecvFilter");   /* idx@10 - filter table */
-                        lua_pushvalue(lua, 4);                                  /* idx@11 - event type */
-                        lua_gettable(lua, -2);                                  /* idx@11 - filter func */
+                        /* if the user specified a callback,
+                         * call it now and use its return value.
+                         * It may return nil or false to drop/reject the event.
+                         */
+                        lua_getfield(lua, 9, "Callback");
                         if (lua_isfunction(lua, -1))
                         {
-                            lua_pushvalue(lua, 8);                              /* idx@12 - filter criteria table */
-                            lua_pushvalue(lua, 5);                              /* idx@13 - preprocessed event data */
-                            lua_call(lua, 2, 1);                                /* idx@11 - object (match) or nil (no match) */
-                            if (lua_toboolean(lua, -1))
-                            {
-                                /* if the user specified a callback,
-                                 * call it now and use its return value.
-                                 * It may return nil or false to drop/reject the event.
-                                 */
-                                lua_getfield(lua, 8, "Callback");
-                                if (lua_isfunction(lua, -1))
-                                {
-                                    lua_pushvalue(lua, -2);
-                                    lua_call(lua, 1, 1);
-                                }
-                                else
-                                {
-                                    lua_pop(lua, 1);
-                                }
-
-                                if (lua_toboolean(lua, -1))
-                                {
-                                    lua_setfield(lua, 8, "Matched");
-                                    lua_pushvalue(lua, 6);
-                                    lua_setfield(lua, 8, "Attribs");
-                                    ++conditions_met;
-                                }
-                            }
+                            lua_pushvalue(lua, -2);
+                            lua_call(lua, 1, 1);
+                        }
+                        else
+                        {
+                            lua_pop(lua, 1);
+                        }
+
+                        if (lua_toboolean(lua, -1))
+                        {
+                            lua_setfield(lua, 9, "Matched");
+                            lua_pushvalue(lua, 7);
+                            lua_setfield(lua, 9, "Attribs");
+                            ++conditions_met;
                         }
                     }
                 }
-                lua_settop(lua, 7); /* remove everything above event table index */
             }
+        }
+        lua_settop(lua, 8); /* remove everything above event table index */
+    }
 
-            if (conditions_met >= conditions_req)
-            {
-                lua_pushboolean(lua, 1);
-                nret = 1;
-                break;
-            }
+    lua_settop(lua, TESTINTF_WAIT_IDX_TOP);
+
+    return (conditions_met >= conditions_req);
+}
+
+/*
+ * Compute the time remaining until the wait expires
+ *
+ * Returns false if the timeout has already occurred.  If no timeout
+ * was specified, the remaining time is reported as 1 second.
+ */
+static bool TestIntf_WaitGetRemaining(lua_State *lua, struct timespec *current)
+{
+    const struct timespec *expire = lua_touserdata(lua, TESTINTF_WAIT_IDX_EXPIRE);
+
+    if (lua_tointeger(lua, 2) < 0)
+    {
+        current->tv_sec = 1;
+        current->tv_nsec = 0;
+        return true;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, current);
+    current->tv_sec = expire->tv_sec - current->tv_sec;
+    current->tv_nsec = expire->tv_nsec - current->tv_nsec;
+    if (current->tv_nsec < 0)
+    {
+        --current->tv_sec;
+        current->tv_nsec += 1000000000;
+    }
+
+    if (current->tv_sec < 0)
+    {
+        /* timeout occurred */
+        return false;
+    }
 
-            /* not all conditions met so poll again for more data */
+    if (current->tv_sec == 0)
+    {
+        if (current->tv_nsec == 0)
+        {
+            /* timeout occurred */
+            return false;
+        }
+
+        if (current->tv_nsec < 1000000)
+        {
+            /* wait a minimum of 1ms -
+             * this may exceed original timeout,
+             * but that may be less bad than returning prior to the requested timeout.
+             */
+            current->tv_nsec = 1000000;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Block until there is activity on the low level interface, or the given time elapses
+ */
+static void TestIntf_WaitBlocking(lua_State *lua, int ApiIdx, struct timespec *current)
+{
+    bool use_sleep;
+
+    /*
+     * If the low level interface has a wait routine, then use it.
+     * The wait routine should exit and return true if there is any activity
+     * that makes it worthwhile to re-poll.
+     */
+    use_sleep = false;
+    lua_getfield(lua, ApiIdx, "Wait");
+    if (!lua_isfunction(lua, -1))
+    {
+        use_sleep = true;
+        lua_pop(lua, 1);
+    }
+    else
+    {
+        lua_pushvalue(lua, ApiIdx);
+
+        /*
+         * The wait task should return if any relevant activity occurs, so
+         * it is OK to pass in a bigger timeout here.  However to be friendly
+         * to implementations that may have limitations on their timeouts, we
+         * will not ask for anything more than 30 seconds in one shot.
+         */
+        if (current->tv_sec < 30)
+        {
+            lua_pushinteger(lua, (current->tv_sec * 1000) + (current->tv_nsec / 1000000));
         }
         else
         {
-            /* Poll function returned nothing, so need to wait */
+            lua_pushinteger(lua, 30000);
+        }
 
-            /*
-             * If a timeout was specified, check if we have exceeded the timeout yet.
-             * If timeout was not passed yet then call a low level wait routine
-             */
-            if (Timeout >= 0)
-            {
-                clock_gettime(CLOCK_MONOTONIC, &current);
-                current.tv_sec = expire.tv_sec - current.tv_sec;
-                current.tv_nsec = expire.tv_nsec - current.tv_nsec;
-                if (current.tv_nsec < 0)
-                {
-                    --current.tv_sec;
-                    current.tv_nsec += 1000000000;
-                }
+        lua_call(lua, 2, 1);
+        if (!lua_toboolean(lua, -1))
+        {
+            use_sleep = true;
+        }
+        lua_pop(lua, 1);
+    }
 
-                if (current.tv_sec < 0)
-                {
-                    /* timeout occurred */
-                    break;
-                }
+    if (use_sleep)
+    {
+        /*
+         * Fall back to using sleep-based polling
+         * since this will not automatically wake up early, limit the
+         * sleep time to ~250ms and re-poll.
+         */
+        if (current->tv_sec > 0 || current->tv_nsec > 250000000)
+        {
+            current->tv_sec = 0;
+            current->tv_nsec = 250000000;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, 0, current, NULL);
+    }
+}
 
-                if (current.tv_sec == 0)
-                {
-                    if (current.tv_nsec == 0)
-                    {
-                        /* timeout occurred */
-                        break;
-                    }
+/*
+ * Block on a single low level interface on behalf of the scheduler
+ */
+void TestIntf_WaitOnApi(lua_State *lua, int ApiIdx, int32_t Timeout)
+{
+    struct timespec current;
 
-                    if (current.tv_nsec < 1000000)
-                    {
-                        /* wait a minimum of 1ms -
-                         * this may exceed original timeout,
-                         * but that may be less bad than returning prior to the requested timeout.
-                         */
-                        current.tv_nsec = 1000000;
-                    }
-                }
-            }
-            else
-            {
-                current.tv_sec = 1;
-                current.tv_nsec = 0;
-            }
+    current.tv_sec = Timeout / 1000;
+    current.tv_nsec = (Timeout % 1000) * 1000000;
 
-            /*
-             * If the low level interface has a wait routine, then use it.
-             * The wait routine should exit and return true if there is any activity
-             * that makes it worthwhile to re-poll.
-             */
-            lua_getfield(lua, 3, "Wait");
-            if (!lua_isfunction(lua, -1))
-            {
-                waitstate = WAIT_STATE_SLEEP;
-                lua_pop(lua, 1);
-            }
-            else
-            {
-                lua_pushvalue(lua, 3);
+    TestIntf_WaitBlocking(lua, lua_absindex(lua, ApiIdx), &current);
+}
 
-                /*
-                 * The wait task should return if any relevant activity occurs, so
-                 * it is OK to pass in a bigger timeout here.  However to be friendly
-                 * to implementations that may have limitations on their timeouts, we
-                 * will not ask for anything more than 30 seconds in one shot.
-                 */
-                if (current.tv_sec < 30)
-                {
-                    lua_pushinteger(lua, (current.tv_sec * 1000) + (current.tv_nsec / 1000000));
-                }
-                else
-                {
-                    lua_pushinteger(lua, 30000);
-                }
+static int TestIntf_WaitContinue(lua_State *lua, int status, TestExec_KContext_t ctx)
+{
+    struct timespec current;
+    int pollstate;
 
-                lua_call(lua, 2, 1);
-                if (!lua_toboolean(lua, -1))
-                {
-                    waitstate = WAIT_STATE_SLEEP;
-                }
-                lua_pop(lua, 1);
+    (void)status;
+    (void)ctx;
+
+    while(1)
+    {
+        pollstate = TestIntf_WaitPollOnce(lua);
+        if (pollstate > 0)
+        {
+            lua_pushboolean(lua, 1);
+            return 1;
+        }
+
+        if (pollstate < 0)
+        {
+            /* Poll function returned nothing, so need to wait */
+            if (!TestIntf_WaitGetRemaining(lua, &current))
+            {
+                break;
             }
 
-            if (waitstate == WAIT_STATE_SLEEP)
+            if (TestSched_IsScheduled(lua))
             {
                 /*
-                 * Fall back to using sleep-based polling
-                 * since this will not automatically wake up early, limit the
-                 * sleep time to ~250ms and re-poll.
+                 * Running as a scheduled coroutine: rather than blocking the whole
+                 * process, suspend this coroutine and let the scheduler resume it
+                 * once it has waited on all interfaces.  The low level interface and
+                 * remaining time are passed back so the scheduler can decide how long
+                 * it may block.
                  */
-                if (current.tv_sec > 0 || current.tv_nsec > 250000000)
+                if (lua_tointeger(lua, 2) < 0)
                 {
-                    current.tv_sec = 0;
-                    current.tv_nsec = 250000000;
+                    return TestSched_WaitYield(lua, TESTINTF_WAIT_IDX_API, -1, TestIntf_WaitContinue);
                 }
-                clock_nanosleep(CLOCK_MONOTONIC, 0, &current, NULL);
-                waitstate = WAIT_STATE_NORMAL;
+
+                return TestSched_WaitYield(lua, TESTINTF_WAIT_IDX_API,
+                        (current.tv_sec * 1000) + (current.tv_nsec / 1000000), TestIntf_WaitContinue);
             }
+
+            TestIntf_WaitBlocking(lua, TESTINTF_WAIT_IDX_API, &current);
         }
+
+        /* not all conditions met so poll again for more data */
     }
 
-    return nret;
+    return 0;
+}
+
+static int TestIntf_WaitAction(lua_State *lua)
+{
+    int32_t Timeout = luaL_optinteger(lua, 2, -1);
+    struct timespec *expire;
+
+    printf("%s(): Start\n", __func__);
+    luaL_checktype(lua, 1, LUA_TTABLE);
+    lua_settop(lua, 2);
+    lua_pushinteger(lua, Timeout);
+    lua_replace(lua, 2);
+    lua_getfield(lua, lua_upvalueindex(1), "API");   /* @3 (userdata object = low level intf) */
+    expire = lua_newuserdata(lua, sizeof(*expire));  /* @4 */
+
+    clock_gettime(CLOCK_MONOTONIC, expire);
+    if (Timeout >= 0)
+    {
+        expire->tv_sec += Timeout / 1000;
+        expire->tv_nsec += (Timeout % 1000) * 1000000;
+    }
+    if (expire->tv_nsec > 1000000000)
+    {
+        ++expire->tv_sec;
+        expire->tv_nsec -= 1000000000;
+    }
+
+    return TestIntf_WaitContinue(lua, LUA_OK, 0);
+}
+
+#ifdef TESTEXEC_CAN_YIELD
+static int TestIntf_DoActionFinish(lua_State *lua, int status, TestExec_KContext_t ctx)
+{
+    /* nothing further to do after the wait completes */
+    (void)lua;
+    (void)status;
+    (void)ctx;
+    return 0;
 }
+#endif
 
 static int TestIntf_DoAction(lua_State *lua)
 {
@@ -473,7 +575,12 @@ static int TestIntf_DoAction(lua_State *lua)
         lua_pushvalue(lua, lua_upvalueindex(1));
         lua_pushcclosure(lua, TestIntf_WaitAction, 1);
         lua_insert(lua, 3);
+#ifdef TESTEXEC_CAN_YIELD
+        /* the wait may suspend if running as a scheduled scenario */
+        lua_callk(lua, 2, 0, 0, TestIntf_DoActionFinish);
+#else
         lua_call(lua, 2, 0);
+#endif
     }
 
     return 0;
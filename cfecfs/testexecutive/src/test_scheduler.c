@@ -0,0 +1,327 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     test_scheduler.c
+ * \ingroup  testexecutive
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Cooperative scheduler for running concurrent test scenarios
+ *
+ * Each scenario is a Lua coroutine.  When a scenario waits on an interface
+ * and nothing is available yet, the wait suspends the coroutine instead of
+ * blocking.  A single event loop then resumes each waiting scenario in turn,
+ * so one test executive process can drive many scenarios at once.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <lua.h>
+#include <lualib.h>
+#include <lauxlib.h>
+
+#include "testexec.h"
+
+/*
+ * When more than one scenario is waiting, the scheduler cannot block on any
+ * single interface, so it sleeps for this slice between polling rounds.
+ */
+#define TESTSCHED_MULTIWAIT_SLICE_MS    10
+
+/* Registry keys: list of active scenario threads, and set of threads managed here */
+static const char TESTSCHED_RUNLIST_KEY = 0;
+static const char TESTSCHED_THREADS_KEY = 0;
+
+/* Marker value which identifies a yield that came from an interface wait */
+static const char TESTSCHED_WAIT_MARKER = 0;
+
+/* Incremented whenever an interface poll returns an event */
+static uint32_t TestSched_ActivityCount;
+
+void TestSched_NotifyActivity(void)
+{
+    ++TestSched_ActivityCount;
+}
+
+bool TestSched_IsScheduled(lua_State *lua)
+{
+#ifdef TESTEXEC_CAN_YIELD
+    bool result;
+
+    if (!lua_isyieldable(lua))
+    {
+        return false;
+    }
+
+    lua_rawgetp(lua, LUA_REGISTRYINDEX, &TESTSCHED_THREADS_KEY);
+    if (!lua_istable(lua, -1))
+    {
+        lua_pop(lua, 1);
+        return false;
+    }
+
+    lua_pushthread(lua);
+    lua_rawget(lua, -2);
+    result = lua_toboolean(lua, -1);
+    lua_pop(lua, 2);
+
+    return result;
+#else
+    return false;
+#endif
+}
+
+int TestSched_WaitYield(lua_State *lua, int ApiIdx, int32_t Timeout, TestExec_KFunction_t Continuation)
+{
+#ifdef TESTEXEC_CAN_YIELD
+    ApiIdx = lua_absindex(lua, ApiIdx);
+    lua_pushlightuserdata(lua, (void *)&TESTSCHED_WAIT_MARKER);
+    lua_pushvalue(lua, ApiIdx);
+    lua_pushinteger(lua, Timeout);
+    return lua_yieldk(lua, 3, 0, Continuation);
+#else
+    return luaL_error(lua, "Scenario wait cannot be suspended with this Lua version");
+#endif
+}
+
+static void TestSched_Sleep(int32_t Timeout)
+{
+    struct timespec delay;
+
+    delay.tv_sec = Timeout / 1000;
+    delay.tv_nsec = (Timeout % 1000) * 1000000;
+    clock_nanosleep(CLOCK_MONOTONIC, 0, &delay, NULL);
+}
+
+static int TestSched_Spawn(lua_State *lua)
+{
+    lua_State *co;
+    int nargs;
+
+    /*
+     * Expected arguments:
+     *  idx@1 - scenario function
+     *  idx@2.. - arguments passed to the function when first run
+     */
+    luaL_checktype(lua, 1, LUA_TFUNCTION);
+    nargs = lua_gettop(lua);
+
+    co = lua_newthread(lua);
+    lua_insert(lua, 1);             /* idx@1 - new thread */
+    lua_xmove(lua, co, nargs);      /* move function and args to the new thread */
+
+    lua_rawgetp(lua, LUA_REGISTRYINDEX, &TESTSCHED_THREADS_KEY);
+    lua_pushvalue(lua, 1);
+    lua_pushboolean(lua, 1);
+    lua_rawset(lua, -3);
+    lua_pop(lua, 1);
+
+    lua_rawgetp(lua, LUA_REGISTRYINDEX, &TESTSCHED_RUNLIST_KEY);
+    lua_pushvalue(lua, 1);
+    lua_rawseti(lua, -2, 1 + lua_rawlen(lua, -2));
+    lua_pop(lua, 1);
+
+    return 1;
+}
+
+static int TestSched_Run(lua_State *lua)
+{
+    lua_State *co;
+    int status;
+    int nargs;
+    int nres;
+    int idx;
+    int pos;
+    int listlen;
+    int numwaiting;
+    int numfailed;
+    int32_t mintime;
+    int32_t remaining;
+    uint32_t activity;
+    bool progress;
+
+    if (TestSched_IsScheduled(lua))
+    {
+        return luaL_error(lua, "Scheduler cannot be run from within a scenario");
+    }
+
+    lua_settop(lua, 0);
+    lua_rawgetp(lua, LUA_REGISTRYINDEX, &TESTSCHED_RUNLIST_KEY);  /* idx@1 - run list */
+    lua_rawgetp(lua, LUA_REGISTRYINDEX, &TESTSCHED_THREADS_KEY);  /* idx@2 - thread set */
+    lua_pushnil(lua);                                             /* idx@3 - first failure message */
+    numfailed = 0;
+
+    while (lua_rawlen(lua, 1) > 0)
+    {
+        activity = TestSched_ActivityCount;
+        progress = false;
+        numwaiting = 0;
+        mintime = -1;
+
+        lua_settop(lua, 3);
+        lua_pushnil(lua);                                         /* idx@4 - interface of last waiter */
+
+        /*
+         * Resume every scenario once, in the order they were spawned.
+         * A scenario that is waiting will poll its interface and either
+         * continue (if the wait is satisfied) or yield again.
+         */
+        idx = 1;
+        while (idx <= (int)lua_rawlen(lua, 1))
+        {
+            lua_rawgeti(lua, 1, idx);                             /* idx@5 - scenario thread */
+            co = lua_tothread(lua, 5);
+
+            if (lua_status(co) == LUA_OK)
+            {
+                /* not yet started; the function and its arguments are on the stack */
+                nargs = lua_gettop(co) - 1;
+            }
+            else
+            {
+                nargs = 0;
+            }
+
+#if (LUA_VERSION_NUM >= 504)
+            status = lua_resume(co, lua, nargs, &nres);
+#else
+            status = lua_resume(co, lua, nargs);
+            nres = lua_gettop(co);
+#endif
+
+            if (status == LUA_YIELD)
+            {
+                if (nres == 3 && lua_touserdata(co, -3) == &TESTSCHED_WAIT_MARKER)
+                {
+                    ++numwaiting;
+                    remaining = lua_tointeger(co, -1);
+                    if (remaining >= 0 && (mintime < 0 || remaining < mintime))
+                    {
+                        mintime = remaining;
+                    }
+                    lua_pushvalue(co, -2);
+                    lua_xmove(co, lua, 1);
+                    lua_replace(lua, 4);
+                }
+                else
+                {
+                    /* an explicit coroutine.yield() just gives the others a turn */
+                    progress = true;
+                }
+                lua_pop(co, nres);
+                ++idx;
+            }
+            else
+            {
+                progress = true;
+                if (status != LUA_OK)
+                {
+                    ++numfailed;
+                    luaL_traceback(lua, co, lua_tostring(co, -1), 0);
+                    fprintf(stderr, "%s(): Scenario failed: %s\n", __func__, lua_tostring(lua, -1));
+                    if (lua_isnil(lua, 3))
+                    {
+                        lua_pushstring(lua, lua_tostring(co, -1));
+                        lua_replace(lua, 3);
+                    }
+                    lua_pop(lua, 1);
+                }
+
+                /* scenario is finished, remove it from the run list */
+                lua_pushvalue(lua, 5);
+                lua_pushnil(lua);
+                lua_rawset(lua, 2);
+
+                /*
+                 * Shift the remaining entries down; the entry that moves into
+                 * this slot is the next one to resume, so idx stays the same.
+                 */
+                listlen = lua_rawlen(lua, 1);
+                for (pos = idx; pos < listlen; ++pos)
+                {
+                    lua_rawgeti(lua, 1, pos + 1);
+                    lua_rawseti(lua, 1, pos);
+                }
+                lua_pushnil(lua);
+                lua_rawseti(lua, 1, listlen);
+            }
+
+            lua_settop(lua, 4);
+        }
+
+        if (TestSched_ActivityCount != activity)
+        {
+            progress = true;
+        }
+
+        /*
+         * If every scenario is waiting and nothing happened in this round, then
+         * block until something might change.  With a single waiter this can use
+         * the interface wait routine directly, which wakes up as soon as data arrives.
+         */
+        if (!progress && numwaiting > 0)
+        {
+            if (numwaiting == 1)
+            {
+                TestIntf_WaitOnApi(lua, 4, (mintime < 0) ? 1000 : mintime);
+            }
+            else if (mintime >= 0 && mintime < TESTSCHED_MULTIWAIT_SLICE_MS)
+            {
+                TestSched_Sleep(mintime);
+            }
+            else
+            {
+                TestSched_Sleep(TESTSCHED_MULTIWAIT_SLICE_MS);
+            }
+        }
+    }
+
+    if (numfailed > 0)
+    {
+        return luaL_error(lua, "%d scenario(s) failed, first failure: %s", numfailed, lua_tostring(lua, 3));
+    }
+
+    return 0;
+}
+
+int TestSched_Create(lua_State *lua)
+{
+    /* The set of managed threads has weak keys, so finished scenarios can be collected */
+    lua_newtable(lua);
+    lua_newtable(lua);
+    lua_pushstring(lua, "k");
+    lua_setfield(lua, -2, "__mode");
+    lua_setmetatable(lua, -2);
+    lua_rawsetp(lua, LUA_REGISTRYINDEX, &TESTSCHED_THREADS_KEY);
+
+    lua_newtable(lua);
+    lua_rawsetp(lua, LUA_REGISTRYINDEX, &TESTSCHED_RUNLIST_KEY);
+
+    lua_newtable(lua);
+    lua_pushcfunction(lua, TestSched_Spawn);
+    lua_setfield(lua, -2, "Spawn");
+    lua_pushcfunction(lua, TestSched_Run);
+    lua_setfield(lua, -2, "Run");
+
+    return 1;
+}
@@ -241,6 +241,10 @@ void OS_Application_Startup(void)
     lua_call(BaseState, 0, 1);
     lua_setglobal(BaseState, "NewConnection");
 
+    lua_pushcfunction(BaseState, TestSched_Create);
+    lua_call(BaseState, 0, 1);
+    lua_setglobal(BaseState, "Scheduler");
+
     lua_pushinteger(BaseState, UTASSERT_CASETYPE_FAILURE);
     lua_pushcclosure(BaseState, TestExec_Lua_DoAssert, 1);
     lua_setglobal(BaseState, "Assert");
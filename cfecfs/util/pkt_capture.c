@@ -0,0 +1,820 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     pkt_capture.c
+ * \ingroup  cfecfs
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Record, replay, and decode raw UDP telemetry packets
+ *
+ * Packets are stored exactly as received (packed format) in an append-only
+ * capture file.  A sidecar index file holds one fixed-size record per packet
+ * with the receive time, MsgId, EdsId and location of the packet within the
+ * capture file.  Both files are plain arrays and can be mapped directly, so
+ * the replay and decode modes can locate any packet from the index alone
+ * without scanning the capture data.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <getopt.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h> /* close() */
+#include <string.h> /* memset() */
+
+#include <cfe_mission_cfg.h>
+#include "cfe_sb_eds_datatypes.h"
+#include "cfe_hdr_eds_datatypes.h"
+#include "cfe_mission_eds_parameters.h"
+#include "cfe_mission_eds_interface_parameters.h"
+#include "edslib_displaydb.h"
+#include "cfe_missionlib_runtime.h"
+#include "cfe_missionlib_api.h"
+
+
+#define BASE_SERVER_PORT     1235
+#define DEFAULT_REPLAY_PORT  1235
+#define DEFAULT_HOSTNAME     "127.0.0.1"
+#define OPTARG_SIZE          256
+
+#define PKTCAPTURE_INDEX_MAGIC    0x45445349    /* "EDSI" */
+#define PKTCAPTURE_INDEX_VERSION  1
+#define PKTCAPTURE_DATA_SUFFIX    ".dat"
+#define PKTCAPTURE_INDEX_SUFFIX   ".idx"
+
+/*
+ * Packets are stored starting on this boundary in the capture file so
+ * that the mapped data is suitably aligned for direct access.
+ */
+#define PKTCAPTURE_DATA_ALIGN     8
+
+/**
+ * Header at the start of the index file
+ *
+ * Values are stored in host byte order; the capture files are intended
+ * for use on the same ground system that recorded them.
+ */
+typedef struct
+{
+    uint32_t Magic;
+    uint16_t Version;
+    uint16_t EntrySize;
+    uint32_t Reserved[2];
+} PktCapture_IndexHeader_t;
+
+/**
+ * Per-packet index record
+ *
+ * Fixed size so that record N is located at a computed offset.
+ */
+typedef struct
+{
+    uint64_t TimeStamp;     /**< Receive time, nanoseconds since the epoch */
+    uint64_t DataOffset;    /**< Offset of the packet within the capture file */
+    uint32_t Length;        /**< Length of the packet in bytes */
+    uint32_t MsgId;         /**< Software bus MsgId value from the packet header */
+    EdsLib_Id_t EdsId;      /**< Identified EDS type, or EDSLIB_ID_INVALID if unknown */
+    uint32_t Reserved;
+} PktCapture_IndexEntry_t;
+
+typedef enum
+{
+    PKTCAPTURE_MODE_NONE,
+    PKTCAPTURE_MODE_RECORD,
+    PKTCAPTURE_MODE_REPLAY,
+    PKTCAPTURE_MODE_DECODE
+} PktCapture_Mode_t;
+
+typedef struct
+{
+    PktCapture_Mode_t Mode;
+    char BaseName[OPTARG_SIZE];
+    char HostName[OPTARG_SIZE];
+    uint16_t PortNum;
+    double RateFactor;
+    unsigned long FirstIndex;
+    unsigned long LastIndex;
+    unsigned long MsgIdFilter;
+    int HaveMsgIdFilter;
+    int GotUsageReq;
+} PktCapture_Options_t;
+
+/**
+ * A capture file pair mapped into memory for reading
+ */
+typedef struct
+{
+    const uint8_t *DataPtr;
+    size_t DataSize;
+    const PktCapture_IndexHeader_t *IndexPtr;
+    size_t IndexSize;
+    const PktCapture_IndexEntry_t *Entries;
+    unsigned long NumEntries;
+} PktCapture_Mapping_t;
+
+EdsNativeBuffer_CFE_HDR_TelemetryHeader_t LocalBuffer;
+EdsPackedBuffer_CFE_HDR_TelemetryHeader_t NetworkBuffer;
+EdsLib_DisplayDB_NameCache_t NameCache;
+
+/*
+** Storage for the name tables of the packet types that are decoded.  There is
+** one slot for each type in the database; the pools only need to hold the names
+** of the types that are actually received.
+*/
+#define NAMECACHE_ENTITY_POOL_SIZE   65536
+#define NAMECACHE_STRING_POOL_SIZE   (4 * 1024 * 1024)
+
+static void NameCache_Init(void)
+{
+    uint32_t NumSlots;
+
+    /* If an allocation fails the cache is left empty, and names are generated for each packet */
+    NumSlots = EdsLib_DisplayDB_GetNameCacheSlots(&EDS_DATABASE);
+    EdsLib_DisplayDB_InitNameCache(&NameCache,
+        calloc(NumSlots, sizeof(EdsLib_DisplayDB_NameTable_t)), NumSlots,
+        calloc(NAMECACHE_ENTITY_POOL_SIZE, sizeof(EdsLib_DisplayDB_NameTableEntry_t)), NAMECACHE_ENTITY_POOL_SIZE,
+        malloc(NAMECACHE_STRING_POOL_SIZE), NAMECACHE_STRING_POOL_SIZE);
+}
+
+static volatile sig_atomic_t StopRequested = 0;
+
+static const char *optString = "m:f:c:H:P:r:s:e:i:?";
+
+/*
+** getopts_long long form argument table
+*/
+static struct option longOpts[] = {
+    { "mode",      required_argument, NULL, 'm' },
+    { "file",      required_argument, NULL, 'f' },
+    { "cpu",       required_argument, NULL, 'c' },
+    { "host",      required_argument, NULL, 'H' },
+    { "port",      required_argument, NULL, 'P' },
+    { "rate",      required_argument, NULL, 'r' },
+    { "start",     required_argument, NULL, 's' },
+    { "end",       required_argument, NULL, 'e' },
+    { "msgid",     required_argument, NULL, 'i' },
+    { "help",      no_argument,       NULL, '?' },
+    { NULL,        no_argument,       NULL, 0   }
+};
+
+/*
+** Display program usage
+*/
+void DisplayUsage(const char *Name)
+{
+    printf("%s -- EDS telemetry capture, replay, and decode utility.\n", Name);
+    printf("      The parameters are:\n");
+    printf("      --mode / -m  : One of \"record\", \"replay\", or \"decode\"\n");
+    printf("      --file / -f  : Base name of the capture; \"%s\" and \"%s\" are appended\n",
+            PKTCAPTURE_DATA_SUFFIX, PKTCAPTURE_INDEX_SUFFIX);
+    printf("      --cpu / -c   : (record) CPU number, selects the UDP port to listen on ( default = 1 )\n");
+    printf("      --host / -H  : (replay) The hostname or IP address to send packets to ( default = %s )\n", DEFAULT_HOSTNAME);
+    printf("      --port / -P  : (record/replay) UDP port, overrides --cpu ( default = %d )\n", DEFAULT_REPLAY_PORT);
+    printf("      --rate / -r  : (replay) Speedup factor; 1 = original rate, 0 = as fast as possible ( default = 1 )\n");
+    printf("      --start / -s : (replay/decode) First index entry to process ( default = 0 )\n");
+    printf("      --end / -e   : (replay/decode) Last index entry to process ( default = end of capture )\n");
+    printf("      --msgid / -i : (replay/decode) Only process packets with this MsgId value\n");
+    printf(" \n");
+    printf("       An example of using this is:\n");
+    printf(" \n");
+    printf("  %s -m record -f pass1\n", Name);
+    printf("  %s -m decode -f pass1 --msgid=0x0801 --start=100 --end=200\n", Name);
+    printf(" \n");
+}
+
+static void PktCapture_SignalHandler(int Signal)
+{
+    StopRequested = 1;
+}
+
+static uint64_t PktCapture_GetTime(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_REALTIME, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000) + (uint64_t)Now.tv_nsec;
+}
+
+/*
+ * Determine the MsgId and EDS type of a packed telemetry packet
+ *
+ * The identified type is unpacked into LocalBuffer.  Returns EDSLIB_SUCCESS
+ * if the full packet type was identified; otherwise EdsId is left as
+ * EDSLIB_ID_INVALID, but the MsgId may still be valid if the header decoded.
+ */
+static int32_t PktCapture_IdentifyPacket(const uint8_t *PackedData, uint32_t Length, uint32_t *MsgId, EdsLib_Id_t *EdsId)
+{
+    EdsLib_Id_t LocalEdsId;
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    EdsInterface_CFE_SB_SoftwareBus_PubSub_t PubSubParams;
+    EdsComponent_CFE_SB_Publisher_t PublisherParams;
+    int32_t Status;
+
+    *MsgId = 0;
+    *EdsId = EDSLIB_ID_INVALID;
+
+    if (Length > sizeof(NetworkBuffer))
+    {
+        return EDSLIB_BUFFER_SIZE_ERROR;
+    }
+
+    LocalEdsId = EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_TelemetryHeader_DATADICTIONARY);
+    Status = EdsLib_DataTypeDB_GetTypeInfo(&EDS_DATABASE, LocalEdsId, &TypeInfo);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return Status;
+    }
+
+    Status = EdsLib_DataTypeDB_UnpackPartialObject(&EDS_DATABASE, &LocalEdsId,
+            LocalBuffer.Byte, PackedData, sizeof(LocalBuffer), 8 * Length, 0);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return Status;
+    }
+
+    CFE_MissionLib_Get_PubSub_Parameters(&PubSubParams, &LocalBuffer.BaseObject.Message);
+    CFE_MissionLib_UnmapPublisherComponent(&PublisherParams, &PubSubParams);
+    *MsgId = PubSubParams.MsgId.Value;
+
+    Status = CFE_MissionLib_GetArgumentType(&CFE_SOFTWAREBUS_INTERFACE, EDS_INTERFACE_ID(CFE_SB_Telemetry),
+            PublisherParams.Telemetry.TopicId, 1, 1, &LocalEdsId);
+    if (Status != CFE_MISSIONLIB_SUCCESS)
+    {
+        return EDSLIB_NAME_NOT_FOUND;
+    }
+
+    Status = EdsLib_DataTypeDB_UnpackPartialObject(&EDS_DATABASE, &LocalEdsId, LocalBuffer.Byte, PackedData,
+            sizeof(LocalBuffer), 8 * Length, TypeInfo.Size.Bytes);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return Status;
+    }
+
+    *EdsId = LocalEdsId;
+    return EDSLIB_SUCCESS;
+}
+
+static FILE *PktCapture_OpenFile(const PktCapture_Options_t *Opts, const char *Suffix, const char *Mode)
+{
+    char FileName[OPTARG_SIZE + 8];
+    FILE *fp;
+
+    snprintf(FileName, sizeof(FileName), "%s%s", Opts->BaseName, Suffix);
+    fp = fopen(FileName, Mode);
+    if (fp == NULL)
+    {
+        fprintf(stderr, "%s: %s\n", FileName, strerror(errno));
+    }
+
+    return fp;
+}
+
+static int PktCapture_Record(const PktCapture_Options_t *Opts)
+{
+    static const uint8_t ZeroPad[PKTCAPTURE_DATA_ALIGN] = { 0 };
+    int sd, rc, n;
+    socklen_t cliLen;
+    struct sockaddr_in cliAddr, servAddr;
+    FILE *DataFile;
+    FILE *IndexFile;
+    PktCapture_IndexHeader_t IndexHdr;
+    PktCapture_IndexEntry_t Entry;
+    uint64_t DataOffset;
+    unsigned long PacketCount;
+    size_t PadSize;
+
+    DataFile = PktCapture_OpenFile(Opts, PKTCAPTURE_DATA_SUFFIX, "ab");
+    IndexFile = PktCapture_OpenFile(Opts, PKTCAPTURE_INDEX_SUFFIX, "ab");
+    if (DataFile == NULL || IndexFile == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    /*
+     * Files are append-only; new packets are added to an existing capture.
+     * An empty index file gets a fresh header.
+     */
+    fseek(DataFile, 0, SEEK_END);
+    fseek(IndexFile, 0, SEEK_END);
+    DataOffset = ftell(DataFile);
+    if (ftell(IndexFile) == 0)
+    {
+        memset(&IndexHdr, 0, sizeof(IndexHdr));
+        IndexHdr.Magic = PKTCAPTURE_INDEX_MAGIC;
+        IndexHdr.Version = PKTCAPTURE_INDEX_VERSION;
+        IndexHdr.EntrySize = sizeof(PktCapture_IndexEntry_t);
+        fwrite(&IndexHdr, sizeof(IndexHdr), 1, IndexFile);
+    }
+
+    /*
+    ** socket creation
+    */
+    sd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sd < 0)
+    {
+        fprintf(stderr, "cannot open socket\n");
+        return EXIT_FAILURE;
+    }
+
+    /*
+    ** bind local server port
+    */
+    memset(&servAddr, 0, sizeof(servAddr));
+    servAddr.sin_family = AF_INET;
+    servAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+    servAddr.sin_port = htons(Opts->PortNum);
+    rc = bind(sd, (struct sockaddr *) &servAddr, sizeof(servAddr));
+    if (rc < 0)
+    {
+        fprintf(stderr, "cannot bind port number %u\n", (unsigned int)Opts->PortNum);
+        close(sd);
+        return EXIT_FAILURE;
+    }
+
+    printf("Recording to %s%s: waiting for data on port UDP %u\n",
+            Opts->BaseName, PKTCAPTURE_DATA_SUFFIX, (unsigned int)Opts->PortNum);
+
+    PacketCount = 0;
+    while (!StopRequested)
+    {
+        cliLen = sizeof(cliAddr);
+        n = recvfrom(sd, NetworkBuffer, sizeof(NetworkBuffer), 0,
+                (struct sockaddr *) &cliAddr, &cliLen);
+        if (n <= 0)
+        {
+            /* recvfrom() is interrupted by SIGINT, which ends the recording */
+            continue;
+        }
+
+        memset(&Entry, 0, sizeof(Entry));
+        Entry.TimeStamp = PktCapture_GetTime();
+        Entry.DataOffset = DataOffset;
+        Entry.Length = n;
+        PktCapture_IdentifyPacket(NetworkBuffer, n, &Entry.MsgId, &Entry.EdsId);
+
+        /*
+         * The two files are buffered separately, so the data is flushed
+         * before the index entry is written.  This way the index never
+         * refers to data which is not yet in the capture file.
+         */
+        PadSize = (PKTCAPTURE_DATA_ALIGN - (n % PKTCAPTURE_DATA_ALIGN)) % PKTCAPTURE_DATA_ALIGN;
+        fwrite(NetworkBuffer, n, 1, DataFile);
+        fwrite(ZeroPad, PadSize, 1, DataFile);
+        fflush(DataFile);
+        fwrite(&Entry, sizeof(Entry), 1, IndexFile);
+        DataOffset += n + PadSize;
+        ++PacketCount;
+    }
+
+    close(sd);
+    fclose(DataFile);
+    fclose(IndexFile);
+
+    printf("\nRecorded %lu packets\n", PacketCount);
+
+    return EXIT_SUCCESS;
+}
+
+static const void *PktCapture_MapFile(const PktCapture_Options_t *Opts, const char *Suffix, size_t *SizeOut)
+{
+    char FileName[OPTARG_SIZE + 8];
+    struct stat st;
+    void *Ptr;
+    int fd;
+
+    *SizeOut = 0;
+    snprintf(FileName, sizeof(FileName), "%s%s", Opts->BaseName, Suffix);
+    fd = open(FileName, O_RDONLY);
+    if (fd < 0)
+    {
+        fprintf(stderr, "%s: %s\n", FileName, strerror(errno));
+        return NULL;
+    }
+
+    if (fstat(fd, &st) < 0 || st.st_size == 0)
+    {
+        fprintf(stderr, "%s: empty or unreadable\n", FileName);
+        close(fd);
+        return NULL;
+    }
+
+    Ptr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (Ptr == MAP_FAILED)
+    {
+        fprintf(stderr, "%s: mmap: %s\n", FileName, strerror(errno));
+        return NULL;
+    }
+
+    *SizeOut = st.st_size;
+    return Ptr;
+}
+
+static int PktCapture_OpenMapping(const PktCapture_Options_t *Opts, PktCapture_Mapping_t *Map)
+{
+    memset(Map, 0, sizeof(*Map));
+
+    Map->IndexPtr = PktCapture_MapFile(Opts, PKTCAPTURE_INDEX_SUFFIX, &Map->IndexSize);
+    if (Map->IndexPtr == NULL)
+    {
+        return -1;
+    }
+
+    if (Map->IndexSize < sizeof(PktCapture_IndexHeader_t) ||
+            Map->IndexPtr->Magic != PKTCAPTURE_INDEX_MAGIC ||
+            Map->IndexPtr->Version != PKTCAPTURE_INDEX_VERSION ||
+            Map->IndexPtr->EntrySize != sizeof(PktCapture_IndexEntry_t))
+    {
+        fprintf(stderr, "%s%s: not a valid capture index\n", Opts->BaseName, PKTCAPTURE_INDEX_SUFFIX);
+        return -1;
+    }
+
+    Map->Entries = (const PktCapture_IndexEntry_t *)(Map->IndexPtr + 1);
+    Map->NumEntries = (Map->IndexSize - sizeof(PktCapture_IndexHeader_t)) / sizeof(PktCapture_IndexEntry_t);
+
+    Map->DataPtr = PktCapture_MapFile(Opts, PKTCAPTURE_DATA_SUFFIX, &Map->DataSize);
+    if (Map->DataPtr == NULL)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+static void PktCapture_CloseMapping(PktCapture_Mapping_t *Map)
+{
+    if (Map->DataPtr != NULL)
+    {
+        munmap((void *)Map->DataPtr, Map->DataSize);
+    }
+    if (Map->IndexPtr != NULL)
+    {
+        munmap((void *)Map->IndexPtr, Map->IndexSize);
+    }
+    memset(Map, 0, sizeof(*Map));
+}
+
+/*
+ * Get the next index entry within the selected range, applying the MsgId filter
+ * Only the index is consulted; the capture data is not touched.
+ */
+static const PktCapture_IndexEntry_t *PktCapture_NextEntry(const PktCapture_Options_t *Opts,
+        const PktCapture_Mapping_t *Map, unsigned long *Position)
+{
+    const PktCapture_IndexEntry_t *Entry;
+
+    while (*Position <= Opts->LastIndex && *Position < Map->NumEntries)
+    {
+        Entry = &Map->Entries[*Position];
+        ++(*Position);
+
+        if (Opts->HaveMsgIdFilter && Entry->MsgId != Opts->MsgIdFilter)
+        {
+            continue;
+        }
+
+        if (Entry->DataOffset > Map->DataSize || Entry->Length > (Map->DataSize - Entry->DataOffset))
+        {
+            fprintf(stderr, "Index entry %lu refers beyond end of capture data\n", *Position - 1);
+            break;
+        }
+
+        return Entry;
+    }
+
+    return NULL;
+}
+
+static int PktCapture_Replay(const PktCapture_Options_t *Opts)
+{
+    PktCapture_Mapping_t Map;
+    const PktCapture_IndexEntry_t *Entry;
+    struct sockaddr_in RemoteAddr;
+    struct hostent *hostID;
+    struct timespec Target;
+    uint64_t FirstStamp;
+    uint64_t StartTime;
+    uint64_t Delay;
+    unsigned long Position;
+    unsigned long PacketCount;
+    int sd;
+    int Result;
+
+    hostID = gethostbyname(Opts->HostName);
+    if (hostID == NULL)
+    {
+        fprintf(stderr, "cannot resolve host '%s'\n", Opts->HostName);
+        return EXIT_FAILURE;
+    }
+
+    memset(&RemoteAddr, 0, sizeof(RemoteAddr));
+    RemoteAddr.sin_family = hostID->h_addrtype;
+    memcpy(&RemoteAddr.sin_addr.s_addr, hostID->h_addr_list[0], hostID->h_length);
+    RemoteAddr.sin_port = htons(Opts->PortNum);
+
+    if (PktCapture_OpenMapping(Opts, &Map) < 0)
+    {
+        PktCapture_CloseMapping(&Map);
+        return EXIT_FAILURE;
+    }
+
+    NameCache_Init();
+
+    sd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sd < 0)
+    {
+        fprintf(stderr, "cannot open socket\n");
+        PktCapture_CloseMapping(&Map);
+        return EXIT_FAILURE;
+    }
+
+    printf("Replaying %s%s to %s:UDP%u\n", Opts->BaseName, PKTCAPTURE_DATA_SUFFIX,
+            Opts->HostName, (unsigned int)Opts->PortNum);
+
+    Result = EXIT_SUCCESS;
+    Position = Opts->FirstIndex;
+    PacketCount = 0;
+    FirstStamp = 0;
+    StartTime = 0;
+    while (!StopRequested)
+    {
+        Entry = PktCapture_NextEntry(Opts, &Map, &Position);
+        if (Entry == NULL)
+        {
+            break;
+        }
+
+        /*
+         * Pace against absolute deadlines computed from the first packet,
+         * so that per-packet scheduling jitter does not accumulate.
+         */
+        if (PacketCount == 0)
+        {
+            FirstStamp = Entry->TimeStamp;
+            StartTime = PktCapture_GetTime();
+        }
+        else if (Opts->RateFactor > 0 && Entry->TimeStamp > FirstStamp)
+        {
+            Delay = (uint64_t)((double)(Entry->TimeStamp - FirstStamp) / Opts->RateFactor);
+            Target.tv_sec = (StartTime + Delay) / 1000000000;
+            Target.tv_nsec = (StartTime + Delay) % 1000000000;
+            while (clock_nanosleep(CLOCK_REALTIME, TIMER_ABSTIME, &Target, NULL) == EINTR &&
+                    !StopRequested)
+            {
+            }
+        }
+
+        if (sendto(sd, Map.DataPtr + Entry->DataOffset, Entry->Length, 0,
+                (struct sockaddr *)&RemoteAddr, sizeof(RemoteAddr)) < 0)
+        {
+            fprintf(stderr, "sendto: %s\n", strerror(errno));
+            Result = EXIT_FAILURE;
+            break;
+        }
+
+        ++PacketCount;
+    }
+
+    close(sd);
+    PktCapture_CloseMapping(&Map);
+
+    printf("Replayed %lu packets\n", PacketCount);
+
+    return Result;
+}
+
+void PktCaptureDisplay(void *Arg, const EdsLib_EntityDescriptor_t *Param)
+{
+   uint8_t *BasePtr;
+   char OutputBuffer[256];
+
+   BasePtr = (uint8_t *)Arg;
+   BasePtr += Param->EntityInfo.Offset.Bytes;
+   EdsLib_Scalar_ToString(&EDS_DATABASE, Param->EntityInfo.EdsId, OutputBuffer, sizeof(OutputBuffer), BasePtr);
+   printf("   Bit=%-4d %35s = %s\n", Param->EntityInfo.Offset.Bits, Param->FullName, OutputBuffer);
+}
+
+static int PktCapture_Decode(const PktCapture_Options_t *Opts)
+{
+    PktCapture_Mapping_t Map;
+    const PktCapture_IndexEntry_t *Entry;
+    const EdsLib_DisplayDB_NameTable_t *NameTable;
+    EdsLib_Id_t EdsId;
+    uint32_t MsgId;
+    unsigned long Position;
+    char TempBuffer[64];
+    int32_t Status;
+
+    if (PktCapture_OpenMapping(Opts, &Map) < 0)
+    {
+        PktCapture_CloseMapping(&Map);
+        return EXIT_FAILURE;
+    }
+
+    Position = Opts->FirstIndex;
+    while (!StopRequested)
+    {
+        Entry = PktCapture_NextEntry(Opts, &Map, &Position);
+        if (Entry == NULL)
+        {
+            break;
+        }
+
+        printf("Packet %lu: Time=%llu.%09llu MsgId=0x%04lx, %lu bytes\n", Position - 1,
+                (unsigned long long)(Entry->TimeStamp / 1000000000),
+                (unsigned long long)(Entry->TimeStamp % 1000000000),
+                (unsigned long)Entry->MsgId, (unsigned long)Entry->Length);
+
+        EdsLib_Generate_Hexdump(stdout, Map.DataPtr + Entry->DataOffset, 0, Entry->Length);
+
+        /*
+         * Re-identify against the current database rather than trusting
+         * the recorded EdsId, which may have come from a different build.
+         */
+        Status = PktCapture_IdentifyPacket(Map.DataPtr + Entry->DataOffset, Entry->Length, &MsgId, &EdsId);
+        if (Status != EDSLIB_SUCCESS)
+        {
+            printf("NOTE - Unable to identify packet: code=%d\n\n", (int)Status);
+            continue;
+        }
+
+        if (EdsId != Entry->EdsId)
+        {
+            printf("NOTE - Recorded EdsId %08lx differs from current database\n", (unsigned long)Entry->EdsId);
+        }
+
+        NameTable = EdsLib_DisplayDB_GetCachedNameTable(&EDS_DATABASE, &NameCache, EdsId);
+        if (NameTable != NULL)
+        {
+            printf("Formatcode=%08lx / %s\n", (unsigned long)EdsId, EdsLib_DisplayDB_GetNameTableTypeName(NameTable));
+        }
+        else
+        {
+            printf("Formatcode=%08lx / %s\n", (unsigned long)EdsId,
+                    EdsLib_DisplayDB_GetTypeName(&EDS_DATABASE, EdsId, TempBuffer, sizeof(TempBuffer)));
+        }
+
+        Status = EdsLib_DataTypeDB_VerifyUnpackedObject(&EDS_DATABASE, EdsId, LocalBuffer.Byte,
+                Map.DataPtr + Entry->DataOffset, EDSLIB_DATATYPEDB_RECOMPUTE_NONE);
+        if (Status != EDSLIB_SUCCESS)
+        {
+            printf("NOTE - EDS VERIFICATION FAILED: code=%d\n", (int)Status);
+        }
+
+        if (NameTable != NULL)
+        {
+            EdsLib_DisplayDB_IterateNameTable(NameTable, PktCaptureDisplay, LocalBuffer.Byte);
+        }
+        else
+        {
+            EdsLib_DisplayDB_IterateAllEntities(&EDS_DATABASE, EdsId, PktCaptureDisplay, LocalBuffer.Byte);
+        }
+        printf("\n");
+    }
+
+    PktCapture_CloseMapping(&Map);
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    int   opt = 0;
+    int   longIndex = 0;
+    PktCapture_Options_t Opts;
+    struct sigaction sa;
+
+    memset(&Opts, 0, sizeof(Opts));
+    strncpy(Opts.HostName, DEFAULT_HOSTNAME, OPTARG_SIZE - 1);
+    Opts.PortNum = BASE_SERVER_PORT;
+    Opts.RateFactor = 1.0;
+    Opts.LastIndex = (unsigned long)-1;
+
+    opt = getopt_long( argc, argv, optString, longOpts, &longIndex );
+    while( opt != -1 )
+    {
+        switch( opt )
+        {
+        case 'm':
+            if (strcmp(optarg, "record") == 0)
+            {
+                Opts.Mode = PKTCAPTURE_MODE_RECORD;
+            }
+            else if (strcmp(optarg, "replay") == 0)
+            {
+                Opts.Mode = PKTCAPTURE_MODE_REPLAY;
+            }
+            else if (strcmp(optarg, "decode") == 0)
+            {
+                Opts.Mode = PKTCAPTURE_MODE_DECODE;
+            }
+            else
+            {
+                fprintf(stderr, "Mode '%s' not known\n", optarg);
+                Opts.GotUsageReq = 1;
+            }
+            break;
+
+        case 'f':
+            strncpy(Opts.BaseName, optarg, OPTARG_SIZE - 1);
+            break;
+
+        case 'c':
+            Opts.PortNum = BASE_SERVER_PORT + atoi(optarg) - 1;
+            break;
+
+        case 'H':
+            strncpy(Opts.HostName, optarg, OPTARG_SIZE - 1);
+            break;
+
+        case 'P':
+            Opts.PortNum = atoi(optarg);
+            break;
+
+        case 'r':
+            Opts.RateFactor = strtod(optarg, NULL);
+            break;
+
+        case 's':
+            Opts.FirstIndex = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'e':
+            Opts.LastIndex = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'i':
+            Opts.MsgIdFilter = strtoul(optarg, NULL, 0);
+            Opts.HaveMsgIdFilter = 1;
+            break;
+
+        case '?':
+            Opts.GotUsageReq = 1;
+            break;
+
+        default:
+            break;
+        }
+
+        opt = getopt_long( argc, argv, optString, longOpts, &longIndex );
+    }
+
+    if (Opts.GotUsageReq || Opts.Mode == PKTCAPTURE_MODE_NONE || Opts.BaseName[0] == 0)
+    {
+        DisplayUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /*
+     * SIGINT ends recording/replay cleanly so the files are flushed.
+     * SA_RESTART is deliberately not set, so blocking calls return.
+     */
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = PktCapture_SignalHandler;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    switch(Opts.Mode)
+    {
+    case PKTCAPTURE_MODE_RECORD:
+        return PktCapture_Record(&Opts);
+    case PKTCAPTURE_MODE_REPLAY:
+        return PktCapture_Replay(&Opts);
+    case PKTCAPTURE_MODE_DECODE:
+        return PktCapture_Decode(&Opts);
+    default:
+        break;
+    }
+
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,430 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     pkt_framer_bench.c
+ * \ingroup  cfecfs
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Measure the throughput of the EDS packet stream framer
+ *
+ * By default a synthetic stream of telemetry packets is generated in memory,
+ * optionally with random garbage inserted between packets, and then fed to
+ * the framer in randomly sized chunks to mimic reads from a socket or file.
+ * Alternatively an existing file of concatenated packets (i.e. a raw capture)
+ * can be framed instead.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <getopt.h>
+#include <time.h>
+#include <errno.h>
+#include <string.h> /* memset() */
+
+#include <cfe_mission_cfg.h>
+#include "cfe_sb_eds_datatypes.h"
+#include "cfe_hdr_eds_datatypes.h"
+#include "cfe_mission_eds_parameters.h"
+#include "cfe_mission_eds_interface_parameters.h"
+#include "edslib_displaydb.h"
+#include "cfe_missionlib_runtime.h"
+#include "cfe_missionlib_api.h"
+#include "cfe_missionlib_framer.h"
+
+#define OPTARG_SIZE             256
+#define DEFAULT_PACKET_COUNT    1000000
+#define DEFAULT_MAX_PACKET_SIZE 1024
+#define DEFAULT_CHUNK_SIZE      4096
+#define DEFAULT_NUM_TOPICS      16
+
+typedef struct
+{
+    char FileName[OPTARG_SIZE];
+    unsigned long PacketCount;
+    unsigned long MaxPacketSize;
+    unsigned long ChunkSize;
+    double CorruptRate;
+    unsigned int Seed;
+    int CheckHeader;
+    int GotUsageReq;
+} FramerBench_Options_t;
+
+typedef struct
+{
+    uint8_t *Data;
+    size_t Size;
+    unsigned long ExpectedPackets;
+} FramerBench_Stream_t;
+
+EdsNativeBuffer_CFE_HDR_TelemetryHeader_t LocalBuffer;
+EdsPackedBuffer_CFE_HDR_TelemetryHeader_t NetworkBuffer;
+
+static const char *optString = "f:n:x:k:c:s:i?";
+
+/*
+** getopts_long long form argument table
+*/
+static struct option longOpts[] = {
+    { "file",      required_argument, NULL, 'f' },
+    { "count",     required_argument, NULL, 'n' },
+    { "maxsize",   required_argument, NULL, 'x' },
+    { "chunk",     required_argument, NULL, 'k' },
+    { "corrupt",   required_argument, NULL, 'c' },
+    { "seed",      required_argument, NULL, 's' },
+    { "msgid",     no_argument,       NULL, 'i' },
+    { "help",      no_argument,       NULL, '?' },
+    { NULL,        no_argument,       NULL, 0   }
+};
+
+/*
+** Display program usage
+*/
+void DisplayUsage(const char *Name)
+{
+    printf("%s -- EDS packet stream framer benchmark.\n", Name);
+    printf("      The parameters are:\n");
+    printf("      --file / -f    : Frame the packets in this file instead of a generated stream\n");
+    printf("      --count / -n   : Number of packets to generate ( default = %d )\n", DEFAULT_PACKET_COUNT);
+    printf("      --maxsize / -x : Largest packet size, in bytes ( default = %d )\n", DEFAULT_MAX_PACKET_SIZE);
+    printf("      --chunk / -k   : Largest amount of data supplied to the framer at once ( default = %d )\n", DEFAULT_CHUNK_SIZE);
+    printf("      --corrupt / -c : Fraction of packets followed by random garbage, 0.0 - 1.0 ( default = 0 )\n");
+    printf("      --seed / -s    : Random number seed ( default = 1 )\n");
+    printf("      --msgid / -i   : Decode the MsgId of each packet header via EDS\n");
+    printf(" \n");
+    printf("       An example of using this is:\n");
+    printf(" \n");
+    printf("  %s --count=100000 --corrupt=0.01 --msgid\n", Name);
+    printf("  %s -f pass1.dat -x 2048\n", Name);
+    printf(" \n");
+}
+
+static double FramerBench_GetTime(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (double)Now.tv_sec + ((double)Now.tv_nsec / 1000000000.0);
+}
+
+static int FramerBench_LoadFile(const FramerBench_Options_t *Opts, FramerBench_Stream_t *Stream)
+{
+    FILE *fp;
+    long FileSize;
+
+    fp = fopen(Opts->FileName, "rb");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "%s: %s\n", Opts->FileName, strerror(errno));
+        return -1;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    FileSize = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    Stream->Data = malloc(FileSize + 1);
+    if (Stream->Data == NULL || fread(Stream->Data, 1, FileSize, fp) != (size_t)FileSize)
+    {
+        fprintf(stderr, "%s: read failed\n", Opts->FileName);
+        fclose(fp);
+        return -1;
+    }
+
+    fclose(fp);
+    Stream->Size = FileSize;
+    Stream->ExpectedPackets = 0;
+
+    return 0;
+}
+
+/*
+ * Generate a stream of telemetry packets with random sizes and MsgIds.
+ *
+ * The header of each packet is encoded via EDS so that it is valid for the
+ * configured mission.  The payload content is not a real EDS type, so the
+ * CCSDS length field (octets 4-5, total size minus 7) is written directly.
+ */
+static int FramerBench_Generate(const FramerBench_Options_t *Opts, FramerBench_Stream_t *Stream)
+{
+    EdsLib_Id_t EdsId;
+    EdsInterface_CFE_SB_SoftwareBus_PubSub_t PubSubParams;
+    EdsComponent_CFE_SB_Publisher_t PublisherParams;
+    size_t AllocSize;
+    size_t Pos;
+    uint32_t HeaderSize;
+    uint32_t PacketSize;
+    uint32_t GarbageSize;
+    uint32_t i;
+    unsigned long Count;
+
+    HeaderSize = sizeof(NetworkBuffer);
+    if (Opts->MaxPacketSize < HeaderSize)
+    {
+        fprintf(stderr, "Max packet size must be at least %u\n", (unsigned int)HeaderSize);
+        return -1;
+    }
+
+    /* garbage is never longer than a packet, so the worst case is double */
+    AllocSize = 2 * Opts->PacketCount * Opts->MaxPacketSize;
+    Stream->Data = malloc(AllocSize);
+    if (Stream->Data == NULL)
+    {
+        fprintf(stderr, "Cannot allocate %lu bytes for stream\n", (unsigned long)AllocSize);
+        return -1;
+    }
+
+    EdsId = EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_TelemetryHeader_DATADICTIONARY);
+    Pos = 0;
+
+    for (Count = 0; Count < Opts->PacketCount; ++Count)
+    {
+        PacketSize = HeaderSize + (rand() % (Opts->MaxPacketSize - HeaderSize + 1));
+
+        memset(&LocalBuffer, 0, sizeof(LocalBuffer));
+        memset(&PublisherParams, 0, sizeof(PublisherParams));
+        PublisherParams.Telemetry.TopicId = 1 + (Count % DEFAULT_NUM_TOPICS);
+        CFE_MissionLib_MapPublisherComponent(&PubSubParams, &PublisherParams);
+        CFE_MissionLib_Set_PubSub_Parameters(&LocalBuffer.BaseObject.Message, &PubSubParams);
+
+        EdsLib_DataTypeDB_PackPartialObject(&EDS_DATABASE, &EdsId, NetworkBuffer, LocalBuffer.Byte,
+                8 * sizeof(NetworkBuffer), sizeof(LocalBuffer), 0);
+
+        memcpy(&Stream->Data[Pos], NetworkBuffer, HeaderSize);
+        Stream->Data[Pos + 4] = ((PacketSize - 7) >> 8) & 0xFF;
+        Stream->Data[Pos + 5] = (PacketSize - 7) & 0xFF;
+        for (i = HeaderSize; i < PacketSize; ++i)
+        {
+            Stream->Data[Pos + i] = rand() & 0xFF;
+        }
+        Pos += PacketSize;
+
+        if (Opts->CorruptRate > 0.0 && ((double)rand() / RAND_MAX) < Opts->CorruptRate)
+        {
+            GarbageSize = 1 + (rand() % Opts->MaxPacketSize);
+            for (i = 0; i < GarbageSize; ++i)
+            {
+                Stream->Data[Pos + i] = rand() & 0xFF;
+            }
+            Pos += GarbageSize;
+        }
+    }
+
+    Stream->Size = Pos;
+    Stream->ExpectedPackets = Opts->PacketCount;
+
+    return 0;
+}
+
+static int FramerBench_Run(const FramerBench_Options_t *Opts, const FramerBench_Stream_t *Stream)
+{
+    CFE_MissionLib_Framer_t Framer;
+    CFE_MissionLib_Framer_Slice_t Slice;
+    CFE_MissionLib_Framer_Stats_t Stats;
+    uint8_t *Buffer;
+    uint8_t *WritePtr;
+    uint32_t BufferSize;
+    uint32_t Avail;
+    uint32_t ChunkSize;
+    size_t Pos;
+    uint32_t MsgIdSum;
+    double StartTime;
+    double ElapsedTime;
+    int32_t Status;
+
+    BufferSize = 2 * (Opts->MaxPacketSize + Opts->ChunkSize);
+    Buffer = malloc(BufferSize);
+    if (Buffer == NULL)
+    {
+        fprintf(stderr, "Cannot allocate framer buffer\n");
+        return EXIT_FAILURE;
+    }
+
+    Status = CFE_MissionLib_Framer_Init(&Framer, &EDS_DATABASE,
+            EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_Message_DATADICTIONARY),
+            Buffer, BufferSize, Opts->MaxPacketSize);
+    if (Status != CFE_MISSIONLIB_SUCCESS)
+    {
+        fprintf(stderr, "CFE_MissionLib_Framer_Init() failed: %d\n", (int)Status);
+        free(Buffer);
+        return EXIT_FAILURE;
+    }
+
+    if (!Opts->CheckHeader)
+    {
+        /* measure the framing alone, without the default MsgId decoding */
+        CFE_MissionLib_Framer_SetHeaderCheck(&Framer, NULL, NULL);
+    }
+
+    Pos = 0;
+    MsgIdSum = 0;
+    StartTime = FramerBench_GetTime();
+
+    while (Pos < Stream->Size)
+    {
+        WritePtr = CFE_MissionLib_Framer_GetWriteBuffer(&Framer, &Avail);
+        ChunkSize = 1 + (rand() % Opts->ChunkSize);
+        if (ChunkSize > Avail)
+        {
+            ChunkSize = Avail;
+        }
+        if (ChunkSize > (Stream->Size - Pos))
+        {
+            ChunkSize = Stream->Size - Pos;
+        }
+
+        memcpy(WritePtr, &Stream->Data[Pos], ChunkSize);
+        CFE_MissionLib_Framer_CommitWrite(&Framer, ChunkSize);
+        Pos += ChunkSize;
+
+        if (Pos >= Stream->Size)
+        {
+            CFE_MissionLib_Framer_SetEndOfStream(&Framer);
+        }
+
+        while (CFE_MissionLib_Framer_Next(&Framer, &Slice))
+        {
+            MsgIdSum += Slice.MsgId;
+        }
+    }
+
+    ElapsedTime = FramerBench_GetTime() - StartTime;
+    CFE_MissionLib_Framer_GetStats(&Framer, &Stats);
+
+    printf("Stream size:     %lu bytes\n", (unsigned long)Stream->Size);
+    if (Stream->ExpectedPackets != 0)
+    {
+        printf("Packets found:   %lu of %lu\n", (unsigned long)Stats.PacketCount, Stream->ExpectedPackets);
+    }
+    else
+    {
+        printf("Packets found:   %lu\n", (unsigned long)Stats.PacketCount);
+    }
+    printf("Packet bytes:    %llu\n", (unsigned long long)Stats.PacketBytes);
+    printf("Discarded bytes: %llu\n", (unsigned long long)Stats.DiscardBytes);
+    printf("Resync count:    %lu\n", (unsigned long)Stats.ResyncCount);
+    if (Opts->CheckHeader)
+    {
+        printf("MsgId checksum:  0x%08lx\n", (unsigned long)MsgIdSum);
+    }
+    printf("Elapsed time:    %.6f sec\n", ElapsedTime);
+    if (ElapsedTime > 0.0)
+    {
+        printf("Throughput:      %.1f MB/s, %.0f packets/s\n",
+                (double)Stream->Size / (ElapsedTime * 1000000.0),
+                (double)Stats.PacketCount / ElapsedTime);
+    }
+
+    free(Buffer);
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    int   opt = 0;
+    int   longIndex = 0;
+    int   Result;
+    FramerBench_Options_t Opts;
+    FramerBench_Stream_t Stream;
+
+    memset(&Opts, 0, sizeof(Opts));
+    memset(&Stream, 0, sizeof(Stream));
+    Opts.PacketCount = DEFAULT_PACKET_COUNT;
+    Opts.MaxPacketSize = DEFAULT_MAX_PACKET_SIZE;
+    Opts.ChunkSize = DEFAULT_CHUNK_SIZE;
+    Opts.Seed = 1;
+
+    opt = getopt_long( argc, argv, optString, longOpts, &longIndex );
+    while( opt != -1 )
+    {
+        switch( opt )
+        {
+        case 'f':
+            strncpy(Opts.FileName, optarg, OPTARG_SIZE - 1);
+            break;
+
+        case 'n':
+            Opts.PacketCount = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'x':
+            Opts.MaxPacketSize = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'k':
+            Opts.ChunkSize = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'c':
+            Opts.CorruptRate = strtod(optarg, NULL);
+            break;
+
+        case 's':
+            Opts.Seed = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'i':
+            Opts.CheckHeader = 1;
+            break;
+
+        case '?':
+            Opts.GotUsageReq = 1;
+            break;
+
+        default:
+            break;
+        }
+
+        opt = getopt_long( argc, argv, optString, longOpts, &longIndex );
+    }
+
+    if (Opts.GotUsageReq || Opts.PacketCount == 0 || Opts.ChunkSize == 0 || Opts.MaxPacketSize == 0)
+    {
+        DisplayUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    srand(Opts.Seed);
+
+    if (Opts.FileName[0] != 0)
+    {
+        Result = FramerBench_LoadFile(&Opts, &Stream);
+    }
+    else
+    {
+        Result = FramerBench_Generate(&Opts, &Stream);
+    }
+
+    if (Result == 0)
+    {
+        Result = FramerBench_Run(&Opts, &Stream);
+    }
+    else
+    {
+        Result = EXIT_FAILURE;
+    }
+
+    free(Stream.Data);
+
+    return Result;
+}
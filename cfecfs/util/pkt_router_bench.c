@@ -0,0 +1,404 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     pkt_router_bench.c
+ * \ingroup  cfecfs
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Measure the throughput of the content-based packet router
+ *
+ * A set of telemetry packets is generated in memory, one or more per topic,
+ * each with a valid EDS-encoded header and a random time stamp.  The router
+ * is then loaded with a large number of random subscriptions: by topic, by
+ * MsgId range, and optionally with a packet filter on the time stamp.  Every
+ * packet is routed many times and the deliveries are counted.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <getopt.h>
+#include <time.h>
+#include <string.h> /* memset() */
+
+#include <cfe_mission_cfg.h>
+#include "cfe_sb_eds_datatypes.h"
+#include "cfe_hdr_eds_datatypes.h"
+#include "cfe_mission_eds_parameters.h"
+#include "cfe_mission_eds_interface_parameters.h"
+#include "edslib_displaydb.h"
+#include "cfe_missionlib_runtime.h"
+#include "cfe_missionlib_api.h"
+#include "cfe_missionlib_router.h"
+
+#define DEFAULT_SUBSCRIPTION_COUNT 5000
+#define DEFAULT_PACKET_COUNT       1000000
+#define DEFAULT_NUM_TOPICS         64
+#define DEFAULT_RANGE_RATE         0.25
+#define DEFAULT_FILTER_RATE        0.1
+#define PACKETS_PER_TOPIC          16
+#define FILTER_TEXT                "Sec.Seconds < 500"
+
+typedef struct
+{
+    unsigned long SubscriptionCount;
+    unsigned long PacketCount;
+    unsigned long NumTopics;
+    double RangeRate;
+    double FilterRate;
+    unsigned int Seed;
+    int GotUsageReq;
+} RouterBench_Options_t;
+
+typedef struct
+{
+    EdsPackedBuffer_CFE_HDR_TelemetryHeader_t Data;
+    uint32_t MsgId;
+    uint16_t TopicId;
+} RouterBench_Packet_t;
+
+typedef struct
+{
+    unsigned long DeliveryCount;
+    unsigned long ReleaseCount;
+    unsigned long long ByteCount;
+} RouterBench_Counters_t;
+
+EdsNativeBuffer_CFE_HDR_TelemetryHeader_t LocalBuffer;
+
+static const char *optString = "n:p:t:r:f:s:?";
+
+/*
+** getopts_long long form argument table
+*/
+static struct option longOpts[] = {
+    { "subs",      required_argument, NULL, 'n' },
+    { "packets",   required_argument, NULL, 'p' },
+    { "topics",    required_argument, NULL, 't' },
+    { "ranges",    required_argument, NULL, 'r' },
+    { "filters",   required_argument, NULL, 'f' },
+    { "seed",      required_argument, NULL, 's' },
+    { "help",      no_argument,       NULL, '?' },
+    { NULL,        no_argument,       NULL, 0   }
+};
+
+/*
+** Display program usage
+*/
+void DisplayUsage(const char *Name)
+{
+    printf("%s -- EDS content-based packet router benchmark.\n", Name);
+    printf("      The parameters are:\n");
+    printf("      --subs / -n    : Number of subscriptions ( default = %d )\n", DEFAULT_SUBSCRIPTION_COUNT);
+    printf("      --packets / -p : Number of packets to route ( default = %d )\n", DEFAULT_PACKET_COUNT);
+    printf("      --topics / -t  : Number of telemetry topics ( default = %d )\n", DEFAULT_NUM_TOPICS);
+    printf("      --ranges / -r  : Fraction of subscriptions by MsgId range, 0.0 - 1.0 ( default = %.2f )\n", DEFAULT_RANGE_RATE);
+    printf("      --filters / -f : Fraction of subscriptions with a packet filter, 0.0 - 1.0 ( default = %.2f )\n", DEFAULT_FILTER_RATE);
+    printf("      --seed / -s    : Random number seed ( default = 1 )\n");
+    printf(" \n");
+    printf("       An example of using this is:\n");
+    printf(" \n");
+    printf("  %s --subs=20000 --topics=200 --filters=0.5\n", Name);
+    printf(" \n");
+}
+
+static double RouterBench_GetTime(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (double)Now.tv_sec + ((double)Now.tv_nsec / 1000000000.0);
+}
+
+static bool RouterBench_Filter(void *Arg, const void *Data, uint32_t Size)
+{
+    return EdsLib_DisplayDB_FilterMatch(Arg, Data, Size);
+}
+
+static void RouterBench_Deliver(void *Arg, CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    RouterBench_Counters_t *Counters = Arg;
+
+    ++Counters->DeliveryCount;
+    Counters->ByteCount += Buffer->Size;
+
+    CFE_MissionLib_Router_ReleaseBuffer(Buffer);
+}
+
+static void RouterBench_Release(void *Arg, CFE_MissionLib_Router_Buffer_t *Buffer)
+{
+    RouterBench_Counters_t *Counters = Arg;
+
+    (void)Buffer;
+
+    ++Counters->ReleaseCount;
+}
+
+/*
+ * Generate telemetry packets for each topic.  Only the header is
+ * generated, which is all that the router and the filters look at.
+ */
+static int RouterBench_Generate(const RouterBench_Options_t *Opts, RouterBench_Packet_t *Packets)
+{
+    EdsLib_Id_t EdsId;
+    EdsInterface_CFE_SB_SoftwareBus_PubSub_t PubSubParams;
+    EdsComponent_CFE_SB_Publisher_t PublisherParams;
+    RouterBench_Packet_t *Packet;
+    unsigned long Count;
+
+    Packet = Packets;
+
+    for (Count = 0; Count < (Opts->NumTopics * PACKETS_PER_TOPIC); ++Count)
+    {
+        /* packing the complete object also sets the length and the header type constraint */
+        EdsId = EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_TelemetryHeader_DATADICTIONARY);
+        memset(&LocalBuffer, 0, sizeof(LocalBuffer));
+        memset(&PublisherParams, 0, sizeof(PublisherParams));
+        PublisherParams.Telemetry.TopicId = 1 + (Count % Opts->NumTopics);
+        CFE_MissionLib_MapPublisherComponent(&PubSubParams, &PublisherParams);
+        CFE_MissionLib_Set_PubSub_Parameters(&LocalBuffer.BaseObject.Message, &PubSubParams);
+        LocalBuffer.BaseObject.Sec.Seconds = rand() % 1000;
+
+        if (EdsLib_DataTypeDB_PackCompleteObject(&EDS_DATABASE, &EdsId, Packet->Data, LocalBuffer.Byte,
+                8 * sizeof(Packet->Data), sizeof(LocalBuffer)) != EDSLIB_SUCCESS)
+        {
+            fprintf(stderr, "Cannot encode telemetry header for topic %u\n",
+                    (unsigned int)PublisherParams.Telemetry.TopicId);
+            return -1;
+        }
+
+        Packet->MsgId   = PubSubParams.MsgId.Value;
+        Packet->TopicId = PublisherParams.Telemetry.TopicId;
+        ++Packet;
+    }
+
+    return 0;
+}
+
+static int RouterBench_Subscribe(const RouterBench_Options_t *Opts, CFE_MissionLib_Router_t *Router,
+                                 const RouterBench_Packet_t *Packets, EdsLib_DisplayDB_Filter_t *Filter,
+                                 RouterBench_Counters_t *Counters)
+{
+    const RouterBench_Packet_t *Packet;
+    CFE_MissionLib_Router_Filter_t SubFilter;
+    unsigned long Count;
+    unsigned long NumRanges;
+    uint32_t SubscriptionId;
+    int32_t Status;
+
+    NumRanges = 0;
+    for (Count = 0; Count < Opts->SubscriptionCount; ++Count)
+    {
+        SubFilter = NULL;
+        if (((double)rand() / RAND_MAX) < Opts->FilterRate)
+        {
+            SubFilter = RouterBench_Filter;
+        }
+
+        Packet = &Packets[rand() % (Opts->NumTopics * PACKETS_PER_TOPIC)];
+        if (((double)rand() / RAND_MAX) < Opts->RangeRate)
+        {
+            /* mostly narrow ranges around a real MsgId, with the occasional wide one */
+            Status = CFE_MissionLib_Router_SubscribeMsgIdRange(Router, Packet->MsgId,
+                    Packet->MsgId + ((rand() % 8) == 0 ? (rand() % 256) : (rand() % 4)),
+                    SubFilter, Filter, RouterBench_Deliver, Counters, &SubscriptionId);
+            ++NumRanges;
+        }
+        else
+        {
+            Status = CFE_MissionLib_Router_SubscribeTopic(Router, Packet->TopicId, SubFilter, Filter,
+                    RouterBench_Deliver, Counters, &SubscriptionId);
+        }
+
+        if (Status != CFE_MISSIONLIB_SUCCESS)
+        {
+            fprintf(stderr, "Subscription %lu failed: %d\n", Count, (int)Status);
+            return -1;
+        }
+    }
+
+    printf("Subscriptions:   %lu (%lu by topic, %lu by MsgId range)\n", Opts->SubscriptionCount,
+            Opts->SubscriptionCount - NumRanges, NumRanges);
+
+    return 0;
+}
+
+static int RouterBench_Run(const RouterBench_Options_t *Opts)
+{
+    CFE_MissionLib_Router_t Router;
+    CFE_MissionLib_Router_Buffer_t Buffer;
+    CFE_MissionLib_Router_Stats_t Stats;
+    EdsLib_DisplayDB_Filter_t Filter;
+    RouterBench_Counters_t Counters;
+    RouterBench_Packet_t *Packets;
+    const RouterBench_Packet_t *Packet;
+    void *Storage;
+    uint32_t StorageSize;
+    unsigned long NumPackets;
+    unsigned long Count;
+    double StartTime;
+    double ElapsedTime;
+    int32_t Status;
+    int Result;
+
+    memset(&Counters, 0, sizeof(Counters));
+    NumPackets  = Opts->NumTopics * PACKETS_PER_TOPIC;
+    StorageSize = CFE_MISSIONLIB_ROUTER_STORAGE_SIZE(Opts->SubscriptionCount);
+    Packets     = malloc(NumPackets * sizeof(*Packets));
+    Storage     = malloc(StorageSize);
+    if (Packets == NULL || Storage == NULL)
+    {
+        fprintf(stderr, "Cannot allocate memory\n");
+        free(Packets);
+        free(Storage);
+        return EXIT_FAILURE;
+    }
+
+    Result = EXIT_FAILURE;
+
+    Status = EdsLib_DisplayDB_CompileFilter(&EDS_DATABASE,
+            EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_Message_DATADICTIONARY),
+            EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_TelemetryHeader_DATADICTIONARY),
+            FILTER_TEXT, &Filter);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        fprintf(stderr, "EdsLib_DisplayDB_CompileFilter() failed: %d at %u\n", (int)Status,
+                (unsigned int)Filter.ErrorPos);
+    }
+    else if (CFE_MissionLib_Router_Init(&Router, Storage, StorageSize) != CFE_MISSIONLIB_SUCCESS)
+    {
+        fprintf(stderr, "CFE_MissionLib_Router_Init() failed\n");
+    }
+    else if (RouterBench_Generate(Opts, Packets) == 0)
+    {
+        StartTime = RouterBench_GetTime();
+        if (RouterBench_Subscribe(Opts, &Router, Packets, &Filter, &Counters) == 0)
+        {
+            /* the first lookup builds the range index */
+            CFE_MissionLib_Router_InitBuffer(&Buffer, Packets[0].Data, sizeof(Packets[0].Data), Packets[0].MsgId,
+                                             Packets[0].TopicId, NULL, NULL);
+            CFE_MissionLib_Router_Match(&Router, &Buffer, NULL, NULL);
+            ElapsedTime = RouterBench_GetTime() - StartTime;
+            printf("Setup time:      %.6f sec\n", ElapsedTime);
+
+            StartTime = RouterBench_GetTime();
+            for (Count = 0; Count < Opts->PacketCount; ++Count)
+            {
+                Packet = &Packets[rand() % NumPackets];
+                CFE_MissionLib_Router_InitBuffer(&Buffer, Packet->Data, sizeof(Packet->Data), Packet->MsgId,
+                                                 Packet->TopicId, RouterBench_Release, &Counters);
+                CFE_MissionLib_Router_Deliver(&Router, &Buffer);
+                CFE_MissionLib_Router_ReleaseBuffer(&Buffer);
+            }
+            ElapsedTime = RouterBench_GetTime() - StartTime;
+
+            CFE_MissionLib_Router_GetStats(&Router, &Stats);
+
+            printf("Packets routed:  %lu\n", Opts->PacketCount);
+            printf("Unmatched:       %lu\n", (unsigned long)Stats.UnmatchedCount);
+            printf("Deliveries:      %lu (%.1f per packet)\n", Counters.DeliveryCount,
+                    (double)Counters.DeliveryCount / Opts->PacketCount);
+            printf("Filter rejects:  %llu\n", (unsigned long long)Stats.FilterRejectCount);
+            printf("Buffers freed:   %lu\n", Counters.ReleaseCount);
+            printf("Elapsed time:    %.6f sec\n", ElapsedTime);
+            if (ElapsedTime > 0.0)
+            {
+                printf("Throughput:      %.0f packets/s, %.0f deliveries/s, %.1f ns/packet\n",
+                        (double)Opts->PacketCount / ElapsedTime,
+                        (double)Counters.DeliveryCount / ElapsedTime,
+                        (ElapsedTime * 1000000000.0) / Opts->PacketCount);
+            }
+
+            Result = EXIT_SUCCESS;
+        }
+    }
+
+    free(Packets);
+    free(Storage);
+
+    return Result;
+}
+
+int main(int argc, char *argv[])
+{
+    int   opt = 0;
+    int   longIndex = 0;
+    RouterBench_Options_t Opts;
+
+    memset(&Opts, 0, sizeof(Opts));
+    Opts.SubscriptionCount = DEFAULT_SUBSCRIPTION_COUNT;
+    Opts.PacketCount = DEFAULT_PACKET_COUNT;
+    Opts.NumTopics = DEFAULT_NUM_TOPICS;
+    Opts.RangeRate = DEFAULT_RANGE_RATE;
+    Opts.FilterRate = DEFAULT_FILTER_RATE;
+    Opts.Seed = 1;
+
+    opt = getopt_long( argc, argv, optString, longOpts, &longIndex );
+    while( opt != -1 )
+    {
+        switch( opt )
+        {
+        case 'n':
+            Opts.SubscriptionCount = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'p':
+            Opts.PacketCount = strtoul(optarg, NULL, 0);
+            break;
+
+        case 't':
+            Opts.NumTopics = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'r':
+            Opts.RangeRate = strtod(optarg, NULL);
+            break;
+
+        case 'f':
+            Opts.FilterRate = strtod(optarg, NULL);
+            break;
+
+        case 's':
+            Opts.Seed = strtoul(optarg, NULL, 0);
+            break;
+
+        case '?':
+            Opts.GotUsageReq = 1;
+            break;
+
+        default:
+            break;
+        }
+
+        opt = getopt_long( argc, argv, optString, longOpts, &longIndex );
+    }
+
+    if (Opts.GotUsageReq || Opts.SubscriptionCount == 0 || Opts.PacketCount == 0 || Opts.NumTopics == 0)
+    {
+        DisplayUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    srand(Opts.Seed);
+
+    return RouterBench_Run(&Opts);
+}
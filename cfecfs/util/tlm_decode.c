@@ -52,6 +52,27 @@
 
 EdsNativeBuffer_CFE_HDR_TelemetryHeader_t       LocalBuffer;
 EdsPackedBuffer_CFE_HDR_TelemetryHeader_t NetworkBuffer;
+EdsLib_DisplayDB_NameCache_t NameCache;
+
+/*
+** Storage for the name tables of the packet types that are decoded.  There is
+** one slot for each type in the database; the pools only need to hold the names
+** of the types that are actually received.
+*/
+#define NAMECACHE_ENTITY_POOL_SIZE   65536
+#define NAMECACHE_STRING_POOL_SIZE   (4 * 1024 * 1024)
+
+static void NameCache_Init(void)
+{
+  uint32_t NumSlots;
+
+  /* If an allocation fails the cache is left empty, and names are generated for each packet */
+  NumSlots = EdsLib_DisplayDB_GetNameCacheSlots(&EDS_DATABASE);
+  EdsLib_DisplayDB_InitNameCache(&NameCache,
+    calloc(NumSlots, sizeof(EdsLib_DisplayDB_NameTable_t)), NumSlots,
+    calloc(NAMECACHE_ENTITY_POOL_SIZE, sizeof(EdsLib_DisplayDB_NameTableEntry_t)), NAMECACHE_ENTITY_POOL_SIZE,
+    malloc(NAMECACHE_STRING_POOL_SIZE), NAMECACHE_STRING_POOL_SIZE);
+}
 
 static const char *optString = "c:?";
 
@@ -86,6 +107,7 @@ int main(int argc, char *argv[])
   struct sockaddr_in  cliAddr, servAddr;
   unsigned short      Port;
   EdsLib_Id_t      EdsId;
+  const EdsLib_DisplayDB_NameTable_t *NameTable;
   EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
   EdsInterface_CFE_SB_SoftwareBus_PubSub_t PubSubParams;
   EdsComponent_CFE_SB_Publisher_t PublisherParams;
@@ -113,6 +135,8 @@ int main(int argc, char *argv[])
   }
 
 
+  NameCache_Init();
+
   /*
   ** socket creation
   */
@@ -202,8 +226,18 @@ int main(int argc, char *argv[])
         return Status;
     }
 
-    printf("Formatcode=%08lx / %s\n",(unsigned long)EdsId,
-            EdsLib_DisplayDB_GetTypeName(&EDS_DATABASE, EdsId, TempBuffer, sizeof(TempBuffer)));
+    /* the same few packet types repeat, so their names are only generated once */
+    NameTable = EdsLib_DisplayDB_GetCachedNameTable(&EDS_DATABASE, &NameCache, EdsId);
+
+    if (NameTable != NULL)
+    {
+        printf("Formatcode=%08lx / %s\n",(unsigned long)EdsId, EdsLib_DisplayDB_GetNameTableTypeName(NameTable));
+    }
+    else
+    {
+        printf("Formatcode=%08lx / %s\n",(unsigned long)EdsId,
+                EdsLib_DisplayDB_GetTypeName(&EDS_DATABASE, EdsId, TempBuffer, sizeof(TempBuffer)));
+    }
 
     Status = EdsLib_DataTypeDB_VerifyUnpackedObject(&EDS_DATABASE, EdsId, LocalBuffer.Byte,
             NetworkBuffer, EDSLIB_DATATYPEDB_RECOMPUTE_NONE);
@@ -212,7 +246,14 @@ int main(int argc, char *argv[])
         printf("NOTE - EDS VERIFICATION FAILED: code=%d\n", (int)Status);
     }
 
-    EdsLib_DisplayDB_IterateAllEntities(&EDS_DATABASE, EdsId, TlmUtilDisplay, LocalBuffer.Byte);
+    if (NameTable != NULL)
+    {
+        EdsLib_DisplayDB_IterateNameTable(NameTable, TlmUtilDisplay, LocalBuffer.Byte);
+    }
+    else
+    {
+        EdsLib_DisplayDB_IterateAllEntities(&EDS_DATABASE, EdsId, TlmUtilDisplay, LocalBuffer.Byte);
+    }
     printf("\n");
 
   }/* end of server infinite loop */
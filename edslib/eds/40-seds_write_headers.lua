@@ -268,6 +268,151 @@ local function write_c_alias_typedef(output,node)
   return { ctype = SEDS.to_ctype_typedef(node.type) }
 end
 
+-- -------------------------------------------------
+-- Helper function to get the packed access style of a scalar type
+-- -------------------------------------------------
+-- Returns the names of the primitive get/set routines in edslib_packed_access.h
+-- along with the conversions for the native type, or nil if the encoding is not
+-- one that can be read directly (e.g. BCD or MIL-STD-1750A).
+local function get_packed_access_style(node)
+  local style = {}
+  local encnode
+
+  -- The encoding is defined on the underlying type
+  while (node and (node.entity_type == "ALIAS_DATATYPE" or node.entity_type == "SUBRANGE_DATATYPE")) do
+    node = node.type or node.basetype
+  end
+
+  if (not node or not node.resolved_size or node.resolved_size.bits == 0 or node.resolved_size.bits > 64) then
+    return nil
+  end
+
+  style.bits = node.resolved_size.bits
+
+  if (node.entity_type == "INTEGER_DATATYPE" or node.entity_type == "ENUMERATION_DATATYPE") then
+    encnode = node:find_first("INTEGER_DATA_ENCODING")
+    if (encnode and encnode.encoding and encnode.encoding ~= "unsigned" and encnode.encoding ~= "twoscomplement") then
+      return nil
+    end
+    if (node.is_signed) then
+      style.to_native = string.format("EdsLib_PackedAccess_SignExtend(%%s, %d)", style.bits)
+    end
+  elseif (node.entity_type == "BOOLEAN_DATATYPE") then
+    encnode = node:find_first("BOOLEAN_DATA_ENCODING")
+    if (encnode and encnode.falsevalue == "nonzeroisfalse") then
+      return nil
+    end
+    style.to_native = "(%s != 0)"
+    style.from_native = "(%s ? 1 : 0)"
+  elseif (node.entity_type == "FLOAT_DATATYPE") then
+    encnode = node:find_first("FLOAT_DATA_ENCODING")
+    local encoding = encnode and (encnode.encoding or encnode.encodingandprecision)
+    if (encoding and string.sub(encoding, 1, 10) ~= "ieee754_20") then
+      return nil
+    elseif (style.bits == 32) then
+      style.to_native = "EdsLib_PackedAccess_ToFloat(%s)"
+      style.from_native = "EdsLib_PackedAccess_FromFloat(%s)"
+    elseif (style.bits == 64) then
+      style.to_native = "EdsLib_PackedAccess_ToDouble(%s)"
+      style.from_native = "EdsLib_PackedAccess_FromDouble(%s)"
+    else
+      return nil
+    end
+  else
+    return nil
+  end
+
+  if (encnode and encnode.byteorder == "littleendian") then
+    style.suffix = "LE"
+    style.aligned = true
+  else
+    style.suffix = "BE"
+  end
+
+  if (style.aligned and (style.bits % 8) ~= 0) then
+    return nil
+  end
+
+  return style
+end
+
+-- -------------------------------------------------
+-- Helper function to write the packed accessors for one field
+-- -------------------------------------------------
+-- For array fields an index argument is added, and the offset of the
+-- element is computed from the fixed stride of the element type.
+local function write_c_packed_accessor(output,prefix,packed_typedef,path,bit,ref_type,array_elements)
+  local style = get_packed_access_style(ref_type)
+  local ctype = SEDS.to_ctype_typedef(ref_type)
+  local offset_expr = tostring(bit)
+  local idx_param = ""
+
+  if (not style) then
+    return
+  end
+
+  if (array_elements) then
+    if (style.aligned and ((bit % 8) ~= 0 or (style.bits % 8) ~= 0)) then
+      return
+    end
+    offset_expr = string.format("%d + (Idx * %d)", bit, ref_type.resolved_size.bits)
+    idx_param = ", uint32_t Idx"
+    output:add_documentation(string.format("Get/Set element of %s in packed buffer", path),
+      string.format("Idx must be less than %d", array_elements))
+  else
+    if (style.aligned and (bit % 8) ~= 0) then
+      return
+    end
+    output:add_documentation(string.format("Get/Set %s in packed buffer", path),
+      string.format("%d bits at bit offset %d", style.bits, bit))
+  end
+
+  output:write(string.format("static inline %s %s_Get_%s(const %s Buf%s)", ctype, prefix, path, packed_typedef, idx_param))
+  output:start_group("{")
+  output:write(string.format("return %s;", string.format(style.to_native or "%s",
+    string.format("EdsLib_PackedAccess_GetBits%s(Buf, %s, %d)", style.suffix, offset_expr, style.bits))))
+  output:end_group("}")
+  output:write(string.format("static inline void %s_Set_%s(%s Buf%s, %s Value)", prefix, path, packed_typedef, idx_param, ctype))
+  output:start_group("{")
+  output:write(string.format("EdsLib_PackedAccess_SetBits%s(Buf, %s, %d, %s);", style.suffix, offset_expr, style.bits,
+    string.format(style.from_native or "%s", "Value")))
+  output:end_group("}")
+  output:add_whitespace(1)
+end
+
+-- -------------------------------------------------
+-- Helper function to write the packed accessors for all fields of a container
+-- -------------------------------------------------
+-- Nested containers are flattened, so every field is addressed by its full
+-- path from the outer container and its absolute bit offset.
+local function write_c_packed_container_accessors(output,prefix,packed_typedef,path,bit,node)
+  for _,ref in ipairs(node.decode_sequence) do
+    local ref_type = ref.type
+    local ref_path = SEDS.to_safe_identifier(ref.name or ref.type.name)
+    local ref_bit = bit + ref.bit
+
+    if (path) then
+      ref_path = path .. "_" .. ref_path
+    end
+
+    while (ref_type.entity_type == "ALIAS_DATATYPE" and ref_type.type) do
+      ref_type = ref_type.type
+    end
+
+    if (ref_type.entity_type == "CONTAINER_DATATYPE") then
+      if (not ref_type.is_union) then
+        write_c_packed_container_accessors(output,prefix,packed_typedef,ref_path,ref_bit,ref_type)
+      end
+    elseif (ref_type.entity_type == "ARRAY_DATATYPE") then
+      if (ref_type.datatyperef and ref_type.datatyperef.resolved_size and ref_type.total_elements) then
+        write_c_packed_accessor(output,prefix,packed_typedef,ref_path,ref_bit,ref_type.datatyperef,ref_type.total_elements)
+      end
+    else
+      write_c_packed_accessor(output,prefix,packed_typedef,ref_path,ref_bit,ref.type)
+    end
+  end
+end
+
 -- -----------------------------------------------------------------------------------------
 --                              Main output routine begins
 -- -----------------------------------------------------------------------------------------
@@ -292,6 +437,13 @@ local global_sym_prefix = SEDS.get_define("MISSION_NAME")
 local global_file_prefix = global_sym_prefix and string.lower(global_sym_prefix) or "eds"
 global_sym_prefix = global_sym_prefix and string.upper(global_sym_prefix) or "EDS"
 
+-- The packed field accessors are only generated if requested, as they
+-- add a large number of inline functions to the build.
+local packed_accessors_enabled = SEDS.get_define("EDSLIB_PACKED_ACCESSORS")
+if (packed_accessors_enabled == 0 or packed_accessors_enabled == "0" or packed_accessors_enabled == "OFF") then
+  packed_accessors_enabled = nil
+end
+
 for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
 
   local output
@@ -454,6 +606,28 @@ for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
   output:write(string.format("extern const struct EdsLib_App_DisplayDB %s_DISPLAY_DB;", symbol_name))
   SEDS.output_close(output)
 
+  -- -----------------------------------------------------
+  -- DATASHEET OUTPUT FILE 4: The "accessors.h" file (optional)
+  -- -----------------------------------------------------
+  -- This contains inline functions to get/set individual fields directly
+  -- within the packed (encoded) form of each container, without unpacking
+  -- the whole object.  These do not use the EDS database at all.
+  if (packed_accessors_enabled) then
+    output = SEDS.output_open(SEDS.to_filename("accessors.h", ds.name),ds.xml_filename)
+    output:write("#include \"edslib_packed_access.h\"")
+    output:write(string.format("#include \"%s\"", SEDS.to_filename("datatypes.h", ds.name)))
+
+    output:section_marker("Packed Field Accessors")
+    for node in ds:iterate_subtree("CONTAINER_DATATYPE") do
+      if (node.header_data and node.resolved_size and not node.is_union and #node.decode_sequence > 0) then
+        write_c_packed_container_accessors(output, "EdsPacked_" .. node:get_ctype_basename(),
+          SEDS.to_ctype_typedef(node, "packed"), nil, 0, node)
+      end
+    end
+
+    SEDS.output_close(output)
+  end
+
 end
 
 -- -----------------------------------------------------
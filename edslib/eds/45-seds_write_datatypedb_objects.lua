@@ -257,6 +257,88 @@ local function write_length_entry_handler(output,ds,parent_name)
   return fields
 end
 
+-- -----------------------------------------------------------------------
+-- Generate the calibration coefficients for a normal container entry
+-- Unlike the length entry calibrators these are data for the runtime
+-- library to apply to whole arrays, rather than generated functions.
+-- -----------------------------------------------------------------------
+local function write_entry_calibration_handler(output,ds,parent_name)
+  local calnode = ds.entry:find_first({"POLYNOMIAL_CALIBRATOR","SPLINE_CALIBRATOR"})
+  local cal_name
+  local fields = {}
+  local arrays = {}
+
+  if (not calnode) then
+    return
+  end
+
+  cal_name = string.format("%s_%s_CALIBRATION", parent_name, ds.entry.name)
+
+  if (calnode.entity_type == "POLYNOMIAL_CALIBRATOR") then
+    local coefficients = {}
+    local maxord = 0
+    for term in calnode:iterate_children("POLYNOMIAL_TERM") do
+      local exp = math.floor(tonumber(term.attributes.exponent) or 0)
+      if (exp >= 0) then
+        coefficients[exp] = (coefficients[exp] or 0) + (tonumber(term.attributes.coefficient) or 1)
+        if (exp > maxord) then
+          maxord = exp
+        end
+      end
+    end
+    arrays.COEFFICIENTS = {}
+    for exp = 0,maxord do
+      arrays.COEFFICIENTS[1 + exp] = coefficients[exp] or 0
+    end
+    fields.CalibrationType = "EDSLIB_CALIBRATIONTYPE_POLYNOMIAL"
+    fields.NumPoints = maxord + 1
+    fields.Coefficients = cal_name .. "_COEFFICIENTS"
+  else
+    local points = {}
+    for point in calnode:iterate_children("SPLINE_POINT") do
+      points[1 + #points] = { raw = tonumber(point.attributes.raw), cal = tonumber(point.attributes.calibrated) }
+    end
+    if (#points == 0) then
+      ds.entry:error("Spline calibrator has no points")
+      return
+    end
+    table.sort(points, function(a,b) return a.raw < b.raw end)
+    arrays.RAW_POINTS = {}
+    arrays.CALIBRATED_POINTS = {}
+    for i,point in ipairs(points) do
+      arrays.RAW_POINTS[i] = point.raw
+      arrays.CALIBRATED_POINTS[i] = point.cal
+    end
+    fields.CalibrationType = "EDSLIB_CALIBRATIONTYPE_SPLINE"
+    fields.Order = math.floor(tonumber(calnode.attributes.order) or 1)
+    fields.Extrapolate = (string.lower(tostring(calnode.attributes.extrapolate)) == "true") and "true" or "false"
+    fields.NumPoints = #points
+    fields.RawPoints = cal_name .. "_RAW_POINTS"
+    fields.CalibratedPoints = cal_name .. "_CALIBRATED_POINTS"
+  end
+
+  for _,suffix in ipairs({ "COEFFICIENTS", "RAW_POINTS", "CALIBRATED_POINTS" }) do
+    if (arrays[suffix]) then
+      output:write(string.format("static const double %s_%s[] =", cal_name, suffix))
+      output:start_group("{")
+      for _,v in ipairs(arrays[suffix]) do
+        output:append_previous(",")
+        output:write(string.format("%.17g", v))
+      end
+      output:end_group("};")
+    end
+  end
+
+  output:write(string.format("static const EdsLib_CalibrationDescriptor_t %s =", cal_name))
+  output:start_group("{")
+  do_write_field_list(output,fields,{ "CalibrationType", "Order", "Extrapolate", "NumPoints",
+    "Coefficients", "RawPoints", "CalibratedPoints" })
+  output:end_group("};")
+  output:add_whitespace(1)
+
+  return { ["HandlerArg.Calibration"] = "&" .. cal_name }
+end
+
 -- -----------------------------------------------------------------------
 -- Generate fields for a container Fixed Value entry
 -- -----------------------------------------------------------------------
@@ -293,6 +375,7 @@ end
 
 
 local special_entry_handler_table = {
+  CONTAINER_ENTRY = write_entry_calibration_handler,
   CONTAINER_LIST_ENTRY = write_list_entry_handler,
   CONTAINER_LENGTH_ENTRY = write_length_entry_handler,
   CONTAINER_FIXED_VALUE_ENTRY = write_fixedvalue_entry_handler,
@@ -847,6 +930,111 @@ local function get_object_detail_fields(output,node)
   return retval
 end
 
+-- -----------------------------------------------------------------------
+-- Generate the valid range of a numeric node, if the EDS declares one
+-- Integer and float types use the Range element, enumerations list all valid values
+-- -----------------------------------------------------------------------
+local function write_c_valid_range_object(output,node)
+  local detail_name = string.format("%s_VALID_RANGE", node:get_flattened_name())
+  local fields = {}
+
+  if (node.entity_type == "ENUMERATION_DATATYPE") then
+    local values = {}
+    local seen = {}
+    for ent in node:iterate_subtree("ENUMERATION_ENTRY") do
+      if (ent.value and not seen[ent.value]) then
+        seen[ent.value] = true
+        values[1 + #values] = ent.value
+      end
+    end
+    if (#values == 0) then
+      return
+    end
+    table.sort(values)
+
+    output:write(string.format("static const intmax_t %s_VALUES[] =", detail_name))
+    output:start_group("{")
+    for _,v in ipairs(values) do
+      output:append_previous(",")
+      output:write(string.format("%d", v))
+    end
+    output:end_group("};")
+    output:add_whitespace(1)
+
+    fields.ValidValueListSize = #values
+    fields.ValidValueList = detail_name .. "_VALUES"
+  elseif (node.entity_type == "INTEGER_DATATYPE" or node.entity_type == "FLOAT_DATATYPE") then
+    local rangenode = node:find_first("RANGE")
+    local range = rangenode and rangenode.resolved_range
+    local flags = {}
+    local is_unsigned
+    if (not range) then
+      return
+    end
+
+    -- unsigned limits are stored as such, as they may not fit in intmax_t
+    if (node.entity_type == "INTEGER_DATATYPE" and not node.is_signed) then
+      is_unsigned = true
+      for _,limit in ipairs({ "min", "max" }) do
+        local r = range[limit]
+        if (r and r.value and r.value < 0) then
+          is_unsigned = false
+        end
+      end
+    end
+
+    for _,limit in ipairs({ "min", "max" }) do
+      local r = range[limit]
+      if (r and r.value) then
+        local value = r.value
+        local inclusive = r.inclusive
+        local key = (limit == "min") and "Min" or "Max"
+        if (node.entity_type == "INTEGER_DATATYPE") then
+          -- a fractional limit on an integer is equivalent to the nearest inclusive integer
+          if (value ~= math.floor(value)) then
+            value = (limit == "min") and math.ceil(value) or math.floor(value)
+            inclusive = true
+          end
+          if (is_unsigned and value >= 18446744073709551615.0) then
+            -- the float nearest to the 64-bit limit rounds above it
+            fields[key] = "{ .Unsigned = UINTMAX_MAX }"
+          elseif (is_unsigned) then
+            -- integers beyond the range of a Lua integer are represented as floats
+            local fmt = (math.type and math.type(value) == "float") and "%.0f" or "%d"
+            fields[key] = string.format("{ .Unsigned = " .. fmt .. "u }", value)
+          else
+            fields[key] = string.format("{ .Integer = %d }", value)
+          end
+        else
+          fields[key] = string.format("{ .Float = %.17g }", value)
+        end
+        flags[1 + #flags] = "EDSLIB_VALIDRANGE_FLAG_HAS_" .. string.upper(limit)
+        if (not inclusive) then
+          flags[1 + #flags] = "EDSLIB_VALIDRANGE_FLAG_" .. string.upper(limit) .. "_EXCLUSIVE"
+        end
+      end
+    end
+    if (#flags == 0) then
+      return
+    end
+    if (is_unsigned) then
+      flags[1 + #flags] = "EDSLIB_VALIDRANGE_FLAG_UNSIGNED"
+    end
+
+    fields.Flags = table.concat(flags, " | ")
+  else
+    return
+  end
+
+  output:write(string.format("static const EdsLib_ValidRangeDescriptor_t %s =", detail_name))
+  output:start_group("{")
+  do_write_field_list(output,fields,{ "Flags", "ValidValueListSize", "Min", "Max", "ValidValueList" })
+  output:end_group("};")
+  output:add_whitespace(1)
+
+  return { ValidRange = "&" .. detail_name }
+end
+
 -- -----------------------------------------------------------------------
 -- MAIN ROUTINE BEGINS HERE
 -- -----------------------------------------------------------------------
@@ -856,7 +1044,8 @@ end
 local datatype_output_handlers =
 {
   get_basic_size_fields,
-  get_object_detail_fields
+  get_object_detail_fields,
+  write_c_valid_range_object
 }
 
 local global_sym_prefix = SEDS.get_define("MISSION_NAME")
@@ -908,6 +1097,24 @@ for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
   end
   output:end_group("};")
 
+  -- The valid range table is parallel to the lookup table, but only needed if any ranges exist
+  local has_ranges = false
+  for _,dsobj in ipairs(datasheet_objs) do
+    has_ranges = has_ranges or (dsobj.ValidRange ~= nil)
+  end
+  if (has_ranges) then
+    output:add_whitespace(1)
+    output:write(string.format("static const EdsLib_ValidRangeDescriptor_t * const %s_VALIDRANGE_TABLE[%d] =", ds_name, #datasheet_objs))
+    output:start_group("{")
+    for idx,dsobj in ipairs(datasheet_objs) do
+      if (dsobj.ValidRange) then
+        output:append_previous(",")
+        output:write(string.format("[%d] = %s", idx - 1, dsobj.ValidRange))
+      end
+    end
+    output:end_group("};")
+  end
+
   output:section_marker("Database Object")
 
 
@@ -916,6 +1123,10 @@ for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
   output:write(string.format(".MissionIdx = %s_INDEX_%s,",global_sym_prefix, ds_name));
   output:write(string.format(".DataTypeTableSize = %d,",#datasheet_objs));
   output:write(string.format(".DataTypeTable = %s_DATADICTIONARY_TABLE", ds_name));
+  if (has_ranges) then
+    output:append_previous(",")
+    output:write(string.format(".ValidRangeTable = %s_VALIDRANGE_TABLE", ds_name));
+  end
   output:end_group("};")
 
   -- Close the output files
@@ -24,6 +24,9 @@
 --
 -- This creates the C source files containing the objects that map the EDS
 -- binary blobs into native C structures and vice versa.
+--
+-- SEDS_PARALLEL_SAFE: this script only reads the DOM and writes its own
+-- output files, so it may be executed in a separate worker process.
 -- -------------------------------------------------------------------------
 SEDS.info ("SEDS write display objects START")
 
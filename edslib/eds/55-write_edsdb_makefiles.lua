@@ -26,6 +26,9 @@
 -- set of Lua bindings for the EDS objects just as it would be in an external tool,
 -- and thus it can be used to instantiate C versions of EDS-described objects that
 -- will be compatible with future Flight Software code.
+--
+-- SEDS_PARALLEL_SAFE: this script only reads the DOM and writes its own
+-- output files, so it may be executed in a separate worker process.
 -- -------------------------------------------------------------------------
 
 local output
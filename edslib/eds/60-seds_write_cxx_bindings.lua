@@ -0,0 +1,289 @@
+--
+-- LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+--
+-- Copyright (c) 2020 United States Government as represented by
+-- the Administrator of the National Aeronautics and Space Administration.
+-- All Rights Reserved.
+--
+-- Licensed under the Apache License, Version 2.0 (the "License");
+-- you may not use this file except in compliance with the License.
+-- You may obtain a copy of the License at
+--
+--    http://www.apache.org/licenses/LICENSE-2.0
+--
+-- Unless required by applicable law or agreed to in writing, software
+-- distributed under the License is distributed on an "AS IS" BASIS,
+-- WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+-- See the License for the specific language governing permissions and
+-- limitations under the License.
+--
+
+
+-- -------------------------------------------------------------------------
+-- Lua implementation of "write C++ bindings" EdsLib processing step
+--
+-- This generates a header-only set of C++17 classes, one per EDS container,
+-- which wrap the native C structures from the "datatypes.h" files.  Members
+-- are accessed through typed getters/setters at compile-time offsets rather
+-- than by name lookup through the DisplayDB, and pack/unpack is done via the
+-- existing C API using an EdsId that is fixed at compile time.
+--
+-- The generated headers only depend on the generated C headers and the
+-- public EdsLib C API; no additional runtime library is required.
+--
+-- This must execute after the "write headers" step, as it uses the typedef
+-- names and dictionary indices that step records in the DOM.
+--
+-- SEDS_PARALLEL_SAFE: this script only reads the DOM and writes its own
+-- output files, so it may be executed in a separate worker process.
+-- -------------------------------------------------------------------------
+SEDS.info ("SEDS write C++ bindings START")
+
+local BINDING_NAMESPACE = "EdsBinding"
+
+-- -------------------------------------------------
+-- Helper function to check if a node has a binding class
+-- -------------------------------------------------
+-- This matches the containers that are rendered as a C struct
+-- by the "write headers" step, which is what the class wraps.
+local function has_binding_class(node)
+  return (node.entity_type == "CONTAINER_DATATYPE" and not node.is_union and
+    node.header_data ~= nil and node.header_data.typedef_name ~= nil and
+    node.edslib_refobj_initializer ~= nil and #node.decode_sequence > 0)
+end
+
+-- -------------------------------------------------
+-- Helper function to check if a type is a C array
+-- -------------------------------------------------
+-- Arrays, strings and binary blobs are all rendered as C arrays,
+-- which may also be hidden behind an alias or subrange type.
+local function is_array_type(node)
+  while (node and node.header_data) do
+    if (node.header_data.typedef_modifier) then
+      return true
+    elseif (node.entity_type == "ALIAS_DATATYPE") then
+      node = node.type
+    elseif (node.entity_type == "SUBRANGE_DATATYPE") then
+      node = node.basetype
+    else
+      break
+    end
+  end
+  return false
+end
+
+-- -------------------------------------------------
+-- Helper function to write the accessors for one member
+-- -------------------------------------------------
+local function write_member_accessors(output,ref)
+  local member_name = ref.name or ref.type.name
+  local method_name = SEDS.to_safe_identifier(member_name)
+  local member_ctype
+
+  -- This must match the logic in write_c_struct_typedef()
+  local is_containment
+  if (ref.name and ref.type.max_size and (ref.type.max_size.bits > ref.type.resolved_size.bits) and not ref.type.is_union) then
+    is_containment = true
+  end
+  member_ctype = SEDS.to_ctype_typedef(ref.type, is_containment)
+
+  if (ref.entry) then
+    output:add_documentation(ref.entry.attributes.shortdescription, ref.entry.longdescription)
+  end
+  output:write(string.format("static constexpr std::size_t OFFSET_%s = offsetof(NativeType, %s);", method_name, member_name))
+
+  if (is_array_type(ref.type)) then
+    -- Arrays are accessed through a view which supports range-for
+    local view_type = string.format("ArrayView<std::remove_extent_t<%s>>", member_ctype)
+    output:write(string.format("%s %s() { return %s(Native->%s); }", view_type, method_name, view_type, member_name))
+    view_type = string.format("ArrayView<const std::remove_extent_t<%s>>", member_ctype)
+    output:write(string.format("%s %s() const { return %s(Native->%s); }", view_type, method_name, view_type, member_name))
+  else
+    if (not is_containment and has_binding_class(ref.type)) then
+      -- Nested containers (including the base type) are also accessible through their own binding class
+      local class_name = BINDING_NAMESPACE .. "::" .. ref.type:get_ctype_basename()
+      output:write(string.format("%s %s() { return %s(Native->%s); }", class_name, method_name, class_name, member_name))
+    end
+    output:write(string.format("const %s &get_%s() const { return Native->%s; }", member_ctype, method_name, member_name))
+    output:write(string.format("void set_%s(const %s &Value) { Native->%s = Value; }", method_name, member_ctype, member_name))
+  end
+end
+
+-- -------------------------------------------------
+-- Helper function to write a binding class for a container
+-- -------------------------------------------------
+local function write_binding_class(output,node,ds)
+  local class_name = node:get_ctype_basename()
+
+  output:add_documentation(string.format("Binding class for %s \'%s\'", node.entity_type, node:get_qualified_name()),
+    node.attributes.shortdescription)
+  output:write(string.format("class %s", class_name))
+  output:start_group("{")
+  output:write("public:")
+  output:write(string.format("typedef %-50s NativeType;", node.header_data.typedef_name))
+  output:write(string.format("typedef %-50s PackedType;", SEDS.to_ctype_typedef(node, "packed")))
+  output:add_whitespace(1)
+  output:write(string.format("static constexpr EdsLib_Id_t EDS_ID = EDSLIB_MAKE_ID(%s, %s);",
+    ds.edslib_refobj_global_index, node.edslib_refobj_local_index))
+  output:write(string.format("static constexpr std::size_t NATIVE_SIZE = sizeof(NativeType);"))
+  output:write(string.format("static constexpr std::size_t PACKED_SIZE = sizeof(PackedType);"))
+  output:add_whitespace(1)
+  output:write(string.format("explicit %s(NativeType &Obj) : Native(&Obj) {}", class_name))
+  output:write("NativeType &native() { return *Native; }")
+  output:write("const NativeType &native() const { return *Native; }")
+  output:add_whitespace(1)
+  output:write("int32_t Pack(const EdsLib_DatabaseObject_t *GD, PackedType &Dest) const")
+  output:start_group("{")
+  output:write(string.format("return %s::Pack<%s>(GD, *Native, Dest);", BINDING_NAMESPACE, class_name))
+  output:end_group("}")
+  output:write("int32_t Unpack(const EdsLib_DatabaseObject_t *GD, const PackedType &Src)")
+  output:start_group("{")
+  output:write(string.format("return %s::Unpack<%s>(GD, *Native, Src);", BINDING_NAMESPACE, class_name))
+  output:end_group("}")
+  output:add_whitespace(1)
+
+  for _,ref in ipairs(node.decode_sequence) do
+    write_member_accessors(output,ref)
+  end
+
+  output:add_whitespace(1)
+  output:write("private:")
+  output:write("NativeType *Native;")
+  output:end_group("};")
+  output:add_whitespace(1)
+
+  output:write("template<>")
+  output:write(string.format("struct BindingFor<%s>", node.header_data.typedef_name))
+  output:start_group("{")
+  output:write(string.format("typedef %s Type;", class_name))
+  output:end_group("};")
+  output:add_whitespace(1)
+end
+
+-- -----------------------------------------------------------------------------------------
+--                              Main output routine begins
+-- -----------------------------------------------------------------------------------------
+
+-- -----------------------------------------------------
+-- GLOBAL HEADER FILE: The "bindings.hpp" file
+-- -----------------------------------------------------
+-- This contains the generic templates which are used by all the per-datasheet
+-- binding classes.  Each specialization is resolved entirely at compile time.
+local output = SEDS.output_open(SEDS.to_filename("bindings.hpp"))
+
+output:write("#include <cstddef>")
+output:write("#include <cstdint>")
+output:write("#include <type_traits>")
+output:add_whitespace(1)
+output:write("#include \"edslib_id.h\"")
+output:write("#include \"edslib_datatypedb.h\"")
+output:write(string.format("#include \"%s\"", SEDS.to_filename("master_index.h")))
+output:add_whitespace(1)
+
+output:write(string.format("namespace %s", BINDING_NAMESPACE))
+output:write("{")
+output:add_whitespace(1)
+
+output:add_documentation("View of a fixed size array member, supports indexing and range-for")
+output:write("template<typename T>")
+output:write("class ArrayView")
+output:start_group("{")
+output:write("public:")
+output:write("template<std::size_t N>")
+output:write("explicit ArrayView(T (&Arr)[N]) : Data(Arr), Count(N) {}")
+output:add_whitespace(1)
+output:write("T *begin() const { return Data; }")
+output:write("T *end() const { return Data + Count; }")
+output:write("T &operator[](std::size_t Idx) const { return Data[Idx]; }")
+output:write("std::size_t size() const { return Count; }")
+output:add_whitespace(1)
+output:write("private:")
+output:write("T *Data;")
+output:write("std::size_t Count;")
+output:end_group("};")
+output:add_whitespace(1)
+
+output:add_documentation("Maps a native C type to its binding class",
+  "Specializations are generated for every EDS container which has a binding class.")
+output:write("template<typename NativeT>")
+output:write("struct BindingFor;")
+output:add_whitespace(1)
+
+output:add_documentation("Pack a native object into its EDS binary format",
+  "This calls EdsLib_DataTypeDB_PackCompleteObject() with the EdsId and buffer sizes of the binding class.")
+output:write("template<typename Binding>")
+output:write("int32_t Pack(const EdsLib_DatabaseObject_t *GD, const typename Binding::NativeType &Src,")
+output:write("        typename Binding::PackedType &Dest)")
+output:start_group("{")
+output:write("EdsLib_Id_t EdsId = Binding::EDS_ID;")
+output:write("return EdsLib_DataTypeDB_PackCompleteObject(GD, &EdsId, Dest, &Src, 8 * Binding::PACKED_SIZE, Binding::NATIVE_SIZE);")
+output:end_group("}")
+output:add_whitespace(1)
+
+output:add_documentation("Unpack an EDS binary object into its native format",
+  "This calls EdsLib_DataTypeDB_UnpackCompleteObject() with the EdsId and buffer sizes of the binding class.")
+output:write("template<typename Binding>")
+output:write("int32_t Unpack(const EdsLib_DatabaseObject_t *GD, typename Binding::NativeType &Dest,")
+output:write("        const typename Binding::PackedType &Src)")
+output:start_group("{")
+output:write("EdsLib_Id_t EdsId = Binding::EDS_ID;")
+output:write("return EdsLib_DataTypeDB_UnpackCompleteObject(GD, &EdsId, &Dest, Src, Binding::NATIVE_SIZE, 8 * Binding::PACKED_SIZE);")
+output:end_group("}")
+output:add_whitespace(1)
+
+output:add_documentation("Pack a native object, deducing the binding class from the object type")
+output:write("template<typename NativeT>")
+output:write("int32_t Pack(const EdsLib_DatabaseObject_t *GD, const NativeT &Src,")
+output:write("        typename BindingFor<NativeT>::Type::PackedType &Dest)")
+output:start_group("{")
+output:write("return Pack<typename BindingFor<NativeT>::Type>(GD, Src, Dest);")
+output:end_group("}")
+output:add_whitespace(1)
+
+output:add_documentation("Unpack a native object, deducing the binding class from the object type")
+output:write("template<typename NativeT>")
+output:write("int32_t Unpack(const EdsLib_DatabaseObject_t *GD, NativeT &Dest,")
+output:write("        const typename BindingFor<NativeT>::Type::PackedType &Src)")
+output:start_group("{")
+output:write("return Unpack<typename BindingFor<NativeT>::Type>(GD, Dest, Src);")
+output:end_group("}")
+output:add_whitespace(1)
+
+output:write(string.format("} /* namespace %s */", BINDING_NAMESPACE))
+
+SEDS.output_close(output)
+
+-- -----------------------------------------------------
+-- DATASHEET OUTPUT FILE: The "bindings.hpp" file
+-- -----------------------------------------------------
+-- This contains one class per container in the datasheet.  The classes are
+-- written in the same order as the typedefs, so any nested container class
+-- is always defined before the class which refers to it.
+for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
+
+  output = SEDS.output_open(SEDS.to_filename("bindings.hpp", ds.name),ds.xml_filename)
+
+  output:write(string.format("#include \"%s\"", SEDS.to_filename("bindings.hpp")))
+  output:write(string.format("#include \"%s\"", SEDS.to_filename("datatypes.h", ds.name)))
+  for _,dep in ipairs(ds:get_references("datatype")) do
+    output:write(string.format("#include \"%s\"", SEDS.to_filename("bindings.hpp", dep.name)))
+  end
+  output:add_whitespace(1)
+
+  output:write(string.format("namespace %s", BINDING_NAMESPACE))
+  output:write("{")
+  output:add_whitespace(1)
+
+  output:section_marker("Container Bindings")
+  for node in ds:iterate_subtree() do
+    if (has_binding_class(node)) then
+      write_binding_class(output,node,ds)
+    end
+  end
+
+  output:write(string.format("} /* namespace %s */", BINDING_NAMESPACE))
+
+  SEDS.output_close(output)
+end
+
+SEDS.info ("SEDS write C++ bindings END")
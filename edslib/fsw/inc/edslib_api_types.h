@@ -115,6 +115,17 @@ typedef enum
    EDSLIB_DISPLAYHINT_MAX
 } EdsLib_DisplayHint_t;
 
+/**
+ * Calibration to convert raw values into engineering units, as defined in the EDS
+ */
+typedef enum
+{
+    EDSLIB_CALIBRATIONTYPE_NONE = 0,     /**< No calibration, raw value is used as-is */
+    EDSLIB_CALIBRATIONTYPE_POLYNOMIAL,   /**< Polynomial, coefficients indexed by exponent */
+    EDSLIB_CALIBRATIONTYPE_SPLINE,       /**< Piecewise interpolation between points (order 0 is a lookup table) */
+    EDSLIB_CALIBRATIONTYPE_MAX
+} EdsLib_CalibrationType_t;
+
 struct EdsLib_SizeInfo
 {
     uint32_t Bits;
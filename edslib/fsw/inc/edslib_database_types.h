@@ -99,11 +99,30 @@ struct EdsLib_FloatCalPair
 
 typedef struct EdsLib_FloatCalPair EdsLib_FloatCalPair_t;
 
+/*
+ * Calibration coefficients of a container entry, as declared in the EDS.
+ * Polynomials use Coefficients[N] as the coefficient of x^N; splines use
+ * the (RawPoints, CalibratedPoints) pairs, with RawPoints in ascending order.
+ */
+struct EdsLib_CalibrationDescriptor
+{
+    uint8_t CalibrationType;
+    uint8_t Order;
+    bool Extrapolate;
+    uint16_t NumPoints;
+    const double *Coefficients;
+    const double *RawPoints;
+    const double *CalibratedPoints;
+};
+
+typedef struct EdsLib_CalibrationDescriptor EdsLib_CalibrationDescriptor_t;
+
 union EdsLib_HandlerArgument
 {
     EdsLib_ErrorControlType_t ErrorControl;
     EdsLib_FloatCalPair_t FloatCalibrator;
     EdsLib_IntegerCalPair_t IntegerCalibrator;
+    const EdsLib_CalibrationDescriptor_t *Calibration;  /**< Only for EDSLIB_ENTRYTYPE_CONTAINER_ENTRY */
     const char *FixedString;
     double FixedFloat;
     intmax_t FixedInteger;
@@ -290,6 +309,40 @@ struct EdsLib_DataTypeDB_Entry
 
 typedef struct EdsLib_DataTypeDB_Entry EdsLib_DataTypeDB_Entry_t;
 
+/*
+ * Flags for the valid range of a numeric data type
+ */
+#define EDSLIB_VALIDRANGE_FLAG_NONE             0x00
+#define EDSLIB_VALIDRANGE_FLAG_HAS_MIN          0x01
+#define EDSLIB_VALIDRANGE_FLAG_HAS_MAX          0x02
+#define EDSLIB_VALIDRANGE_FLAG_MIN_EXCLUSIVE    0x04
+#define EDSLIB_VALIDRANGE_FLAG_MAX_EXCLUSIVE    0x08
+#define EDSLIB_VALIDRANGE_FLAG_UNSIGNED         0x10    /* Min/Max are in the Unsigned member rather than Integer */
+
+union EdsLib_RangeLimit
+{
+    intmax_t Integer;
+    uintmax_t Unsigned;
+    double Float;
+};
+
+typedef union EdsLib_RangeLimit EdsLib_RangeLimit_t;
+
+/*
+ * Valid range of a numeric data type, as declared in the EDS.
+ * For enumerations, the valid values are listed instead (in ascending order).
+ */
+struct EdsLib_ValidRangeDescriptor
+{
+    uint8_t Flags;
+    uint16_t ValidValueListSize;
+    EdsLib_RangeLimit_t Min;
+    EdsLib_RangeLimit_t Max;
+    const intmax_t *ValidValueList;
+};
+
+typedef struct EdsLib_ValidRangeDescriptor EdsLib_ValidRangeDescriptor_t;
+
 
 typedef enum
 {
@@ -349,6 +402,7 @@ struct EdsLib_App_DataTypeDB
    uint16_t MissionIdx;
    uint16_t DataTypeTableSize;
    const EdsLib_DataTypeDB_Entry_t *DataTypeTable;
+   const EdsLib_ValidRangeDescriptor_t * const *ValidRangeTable;  /**< Optional, parallel to DataTypeTable */
 };
 
 struct EdsLib_App_DisplayDB
@@ -101,7 +101,8 @@ enum
     EDSLIB_NO_MATCHING_VALUE = -8,      /**< No matching values were found in the DB */
     EDSLIB_ERROR_CONTROL_MISMATCH = -9, /**< Error control field did not match */
     EDSLIB_FIELD_MISMATCH = -10,        /**< Length or Fixed Value field did not match */
-    EDSLIB_INSUFFICIENT_MEMORY = -11    /**< Internal structure sizes were insufficient for operation */
+    EDSLIB_INSUFFICIENT_MEMORY = -11,   /**< Internal structure sizes were insufficient for operation */
+    EDSLIB_VALUE_OUT_OF_RANGE = -12     /**< One or more values are outside of the valid range */
 };
 
 /*
@@ -237,6 +238,371 @@ struct EdsLib_DataTypeDB_DerivativeObjectInfo
 
 typedef struct EdsLib_DataTypeDB_DerivativeObjectInfo EdsLib_DataTypeDB_DerivativeObjectInfo_t;
 
+/**
+ * Location and encoding of the length field within an encoded container
+ *
+ * This is resolved once from the EDS via EdsLib_DataTypeDB_GetLengthFieldInfo(),
+ * after which it can be used to get the total size of any number of encoded
+ * objects through EdsLib_DataTypeDB_DecodeLengthField() without any database lookups.
+ */
+struct EdsLib_DataTypeDB_LengthFieldInfo
+{
+    EdsLib_Id_t LengthTypeId;           /**< The EDS ID of the length field data type */
+    uint32_t BitOffset;                 /**< Offset of the length field within the encoded object */
+    uint32_t BitSize;                   /**< Size of the length field within the encoded object */
+    uint32_t MinPackedBytes;            /**< Encoded bytes required in order to decode the length field */
+    bool LittleEndian;                  /**< Set if the length field is encoded least significant byte first */
+    intmax_t (*Calibrator)(intmax_t);   /**< Converts the field value into the total encoded size, may be NULL */
+};
+
+typedef struct EdsLib_DataTypeDB_LengthFieldInfo EdsLib_DataTypeDB_LengthFieldInfo_t;
+
+/**
+ * The number of identification fields that are cached in a size recipe.
+ *
+ * This is the number of constraint entities in the base type; constraints on
+ * further derived types are looked up from the database as needed.
+ */
+#define EDSLIB_SIZERECIPE_MAX_IDENT_FIELDS      8
+
+/**
+ * Location and encoding of an integer field within an encoded object
+ */
+struct EdsLib_DataTypeDB_PackedFieldInfo
+{
+    uint32_t BitOffset;                 /**< Offset of the field within the encoded object */
+    uint16_t BitSize;                   /**< Size of the field within the encoded object, 0 if not decodable */
+    uint8_t BasicType;                  /**< EDSLIB_BASICTYPE_SIGNED_INT or EDSLIB_BASICTYPE_UNSIGNED_INT */
+    bool LittleEndian;                  /**< Set if the field is encoded least significant byte first */
+};
+
+typedef struct EdsLib_DataTypeDB_PackedFieldInfo EdsLib_DataTypeDB_PackedFieldInfo_t;
+
+/**
+ * Precomputed information to get the size of an encoded object without unpacking it
+ *
+ * This is resolved once per base type via EdsLib_DataTypeDB_InitSizeRecipe(), after
+ * which EdsLib_DataTypeDB_GetPackedSizes() only needs to read the length field and
+ * the fields used to identify the derived type from the encoded data.
+ */
+struct EdsLib_DataTypeDB_SizeRecipe
+{
+    EdsLib_Id_t EdsId;                  /**< The EDS ID of the base type */
+    bool HasLengthField;                /**< Set if the total encoded size is given by LengthInfo */
+    EdsLib_DataTypeDB_LengthFieldInfo_t LengthInfo;
+    uint16_t NumIdentFields;            /**< Number of valid entries in IdentFields */
+    EdsLib_DataTypeDB_PackedFieldInfo_t IdentFields[EDSLIB_SIZERECIPE_MAX_IDENT_FIELDS];
+};
+
+typedef struct EdsLib_DataTypeDB_SizeRecipe EdsLib_DataTypeDB_SizeRecipe_t;
+
+/**
+ * Sizes of an encoded object as determined by EdsLib_DataTypeDB_GetPackedSizes()
+ */
+struct EdsLib_DataTypeDB_PackedSizeInfo
+{
+    EdsLib_Id_t EdsId;                  /**< The most derived type that was identified */
+    uint32_t PackedBytes;               /**< Total encoded size of the object */
+    uint32_t NativeBytes;               /**< Native buffer size required to unpack the object */
+};
+
+typedef struct EdsLib_DataTypeDB_PackedSizeInfo EdsLib_DataTypeDB_PackedSizeInfo_t;
+
+/**
+ * The maximum number of operations in an array plan.
+ *
+ * Each field of a type requires one operation, except that runs of identical
+ * fields (such as array elements) are merged into a single operation.
+ */
+#ifndef EDSLIB_ARRAYPLAN_MAX_OPS
+#define EDSLIB_ARRAYPLAN_MAX_OPS                64
+#endif
+
+/**
+ * A single (possibly repeated) field copy within an array plan
+ */
+struct EdsLib_DataTypeDB_ArrayPlanOp
+{
+    const struct EdsLib_DataTypeDB_Entry *DataDictPtr;
+    const union EdsLib_HandlerArgument *HandlerArg;     /**< Only set for length, fixed value and error control fields */
+    uint32_t PackedBitOffset;
+    uint32_t NativeByteOffset;
+    uint32_t PackedRepeatBits;
+    uint32_t NativeRepeatBytes;
+    uint16_t RepeatCount;
+    uint16_t EntryType;
+    uint8_t AlignedAction;              /**< Action to use when the packed field is byte aligned */
+};
+
+typedef struct EdsLib_DataTypeDB_ArrayPlanOp EdsLib_DataTypeDB_ArrayPlanOp_t;
+
+/**
+ * Precomputed field copies for packing or unpacking arrays of a single type
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+struct EdsLib_DataTypeDB_ArrayPlan
+{
+    EdsLib_Id_t EdsId;
+    uint8_t OperMode;
+    bool RecordAligned;
+    bool HasSpecialEntries;
+    uint32_t PackedStrideBits;
+    uint32_t NativeStrideBytes;
+    const struct EdsLib_DataTypeDB_Entry *BaseDictPtr;
+    uint16_t ErrorCtlOpIdx;             /**< Index+1 of the error control entry, 0 if none */
+    uint16_t NumOps;
+    EdsLib_DataTypeDB_ArrayPlanOp_t Ops[EDSLIB_ARRAYPLAN_MAX_OPS];
+};
+
+typedef struct EdsLib_DataTypeDB_ArrayPlan EdsLib_DataTypeDB_ArrayPlan_t;
+
+/**
+ * Array codec flag: check compiled code against the interpreter before using it
+ */
+#define EDSLIB_ARRAYCODEC_FLAG_SELFCHECK        0x01
+
+/**
+ * State of one direction (pack or unpack) of an array codec
+ */
+struct EdsLib_DataTypeDB_ArrayCodecState
+{
+    bool HasPlan;                       /**< Set once the plan has been built */
+    uint32_t CallCount;                 /**< Number of calls made, up to the JIT threshold */
+    int32_t Status;                     /**< Result of compilation, EDSLIB_SUCCESS if Code is valid */
+    void *Code;                         /**< Compiled code, or NULL if the interpreter is used */
+    size_t CodeSize;                    /**< Size of the compiled code, in bytes */
+    EdsLib_DataTypeDB_ArrayPlan_t Plan; /**< Plan used by the interpreter, and to compile the code */
+};
+
+typedef struct EdsLib_DataTypeDB_ArrayCodecState EdsLib_DataTypeDB_ArrayCodecState_t;
+
+/**
+ * Repeated pack/unpack of arrays of a single type
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+struct EdsLib_DataTypeDB_ArrayCodec
+{
+    EdsLib_Id_t EdsId;
+    uint32_t PackedStrideBits;
+    uint32_t NativeStrideBytes;
+    uint32_t JitThreshold;
+    uint32_t Flags;
+    EdsLib_DataTypeDB_ArrayCodecState_t Pack;
+    EdsLib_DataTypeDB_ArrayCodecState_t Unpack;
+};
+
+typedef struct EdsLib_DataTypeDB_ArrayCodec EdsLib_DataTypeDB_ArrayCodec_t;
+
+/**
+ * The maximum number of range checks in a validator.
+ *
+ * Each field of a type that has a valid range (or valid set of enumeration values)
+ * in the EDS requires one check, including each element of an array.
+ */
+#ifndef EDSLIB_VALIDATOR_MAX_CHECKS
+#define EDSLIB_VALIDATOR_MAX_CHECKS             128
+#endif
+
+/**
+ * The number of 32-bit words in a validator violation bitmap
+ */
+#define EDSLIB_VALIDATOR_MASK_WORDS             ((EDSLIB_VALIDATOR_MAX_CHECKS + 31) / 32)
+
+/**
+ * Limit value of a range check, interpreted according to the type of the field
+ */
+union EdsLib_DataTypeDB_RangeLimit
+{
+    EdsLib_Generic_SignedInt_t SignedInteger;
+    EdsLib_Generic_UnsignedInt_t UnsignedInteger;
+    double FloatingPoint;
+};
+
+typedef union EdsLib_DataTypeDB_RangeLimit EdsLib_DataTypeDB_RangeLimit_t;
+
+/**
+ * A single range check within a validator
+ *
+ * Limits are always stored as inclusive values; exclusive and missing limits in
+ * the EDS are converted when the validator is initialized.
+ */
+struct EdsLib_DataTypeDB_RangeCheck
+{
+    EdsLib_SizeInfo_t Offset;           /**< Offset of the value within the packed and native objects */
+    uint8_t CheckType;                  /**< Kind of value and test to apply */
+    uint8_t Size;                       /**< Size of the native value, in bytes */
+    uint16_t ValidValueListSize;        /**< Number of values in ValidValueList */
+    EdsLib_Id_t EdsId;                  /**< The EDS ID of the field type */
+    EdsLib_DataTypeDB_RangeLimit_t Min;
+    EdsLib_DataTypeDB_RangeLimit_t Max;
+    uint64_t ValidMask;                 /**< For small enumerations, bit N is set if (Min + N) is valid */
+    const intmax_t *ValidValueList;     /**< For large enumerations, sorted list of valid values */
+};
+
+typedef struct EdsLib_DataTypeDB_RangeCheck EdsLib_DataTypeDB_RangeCheck_t;
+
+/**
+ * Precomputed range checks for all fields of a native object
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+struct EdsLib_DataTypeDB_Validator
+{
+    EdsLib_Id_t EdsId;
+    uint32_t NativeSize;
+    uint16_t NumChecks;
+    EdsLib_DataTypeDB_RangeCheck_t Checks[EDSLIB_VALIDATOR_MAX_CHECKS];
+};
+
+typedef struct EdsLib_DataTypeDB_Validator EdsLib_DataTypeDB_Validator_t;
+
+/**
+ * Outcome of validating a single object
+ *
+ * Bit N of the violation mask corresponds to check N of the validator, and
+ * is set if the value was outside of its valid range.  Use
+ * EdsLib_DataTypeDB_GetValidatorCheckInfo() to find the field that it refers to.
+ */
+struct EdsLib_DataTypeDB_ValidationResult
+{
+    uint16_t NumChecks;
+    uint16_t NumViolations;
+    uint32_t ViolationMask[EDSLIB_VALIDATOR_MASK_WORDS];
+};
+
+typedef struct EdsLib_DataTypeDB_ValidationResult EdsLib_DataTypeDB_ValidationResult_t;
+
+/**
+ * The maximum number of leaf fields that can be compared by an object differ.
+ *
+ * Each number or string within a type requires one field, including each element of an array.
+ */
+#ifndef EDSLIB_DIFF_MAX_FIELDS
+#define EDSLIB_DIFF_MAX_FIELDS                  256
+#endif
+
+/**
+ * The number of 32-bit words in a differ changed field bitmap
+ */
+#define EDSLIB_DIFF_MASK_WORDS                  ((EDSLIB_DIFF_MAX_FIELDS + 31) / 32)
+
+/**
+ * A single leaf field within an object differ
+ */
+struct EdsLib_DataTypeDB_DiffField
+{
+    EdsLib_SizeInfo_t Offset;           /**< Offset of the field within the packed and native objects */
+    uint32_t Size;                      /**< Size of the native field, in bytes */
+    EdsLib_Id_t EdsId;                  /**< The EDS ID of the field type */
+};
+
+typedef struct EdsLib_DataTypeDB_DiffField EdsLib_DataTypeDB_DiffField_t;
+
+/**
+ * A range of adjacent fields that is compared as a single block of memory
+ */
+struct EdsLib_DataTypeDB_DiffRun
+{
+    uint32_t Offset;                    /**< Native offset of the first field in the run */
+    uint32_t Size;                      /**< Native size of the run, including any padding between fields */
+    uint16_t FirstField;                /**< Index of the first field in the run */
+    uint16_t NumFields;                 /**< Number of fields in the run */
+};
+
+typedef struct EdsLib_DataTypeDB_DiffRun EdsLib_DataTypeDB_DiffRun_t;
+
+/**
+ * Precomputed leaf field table for comparing native objects
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+struct EdsLib_DataTypeDB_Differ
+{
+    EdsLib_Id_t EdsId;
+    uint32_t NativeSize;
+    uint16_t NumFields;
+    uint16_t NumRuns;
+    EdsLib_DataTypeDB_DiffField_t Fields[EDSLIB_DIFF_MAX_FIELDS];
+    EdsLib_DataTypeDB_DiffRun_t Runs[EDSLIB_DIFF_MAX_FIELDS];
+};
+
+typedef struct EdsLib_DataTypeDB_Differ EdsLib_DataTypeDB_Differ_t;
+
+/**
+ * Outcome of comparing two objects
+ *
+ * Bit N of the changed mask corresponds to field N of the differ, and is set if
+ * the field is different between the two objects.  Use EdsLib_DataTypeDB_GetDiffFieldInfo()
+ * to find the field that it refers to.
+ */
+struct EdsLib_DataTypeDB_DiffResult
+{
+    uint16_t NumFields;
+    uint16_t NumChanged;
+    uint32_t ChangedMask[EDSLIB_DIFF_MASK_WORDS];
+};
+
+typedef struct EdsLib_DataTypeDB_DiffResult EdsLib_DataTypeDB_DiffResult_t;
+
+/**
+ * Hash of the logical content of an object
+ *
+ * The two words together form a 128-bit hash.  Either word may also be used
+ * on its own as a 64-bit hash.  The value is the same on every platform.
+ */
+struct EdsLib_DataTypeDB_ContentHash
+{
+    uint64_t Low;
+    uint64_t High;
+};
+
+typedef struct EdsLib_DataTypeDB_ContentHash EdsLib_DataTypeDB_ContentHash_t;
+
+/**
+ * Precomputed field walk for hashing native objects
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+struct EdsLib_DataTypeDB_ContentHasher
+{
+    EdsLib_Id_t EdsId;
+    uint32_t PackedBits;
+    uint32_t NativeSize;
+    EdsLib_DataTypeDB_ArrayPlan_t Plan;
+};
+
+typedef struct EdsLib_DataTypeDB_ContentHasher EdsLib_DataTypeDB_ContentHasher_t;
+
+/**
+ * Calibration of a numeric field, or of every element of a numeric array field
+ *
+ * This is filled in by EdsLib_DataTypeDB_GetMemberCalibration() from the EDS, but
+ * may also be filled in directly by the application to calibrate other raw data.
+ */
+struct EdsLib_DataTypeDB_Calibration
+{
+    EdsLib_CalibrationType_t CalibrationType;
+    uint8_t Order;                      /**< Spline interpolation order: 0 (lookup table) or 1 (linear) */
+    bool Extrapolate;                   /**< Splines: extend the end segments, otherwise clamp to the end points */
+    uint16_t NumPoints;                 /**< Number of polynomial coefficients or spline points */
+    const double *RawPoints;            /**< Splines: raw values of the points, in ascending order */
+    const double *Values;               /**< Polynomial coefficients indexed by exponent, or spline calibrated values */
+    EdsLib_BasicType_t RawType;         /**< Native type of the raw values: signed, unsigned or float */
+    uint32_t RawSize;                   /**< Size of each native raw value, in bytes */
+    uint32_t RawStride;                 /**< Distance between consecutive native raw values, in bytes (0 = RawSize) */
+    EdsLib_SizeInfo_t Offset;           /**< Offset of the first raw value within the parent object */
+    uint32_t NumValues;                 /**< Number of raw values in the field, 1 if not an array */
+};
+
+typedef struct EdsLib_DataTypeDB_Calibration EdsLib_DataTypeDB_Calibration_t;
+
 /**
  * Structure to represent entities within EDS defined data types.
  *
@@ -569,6 +935,189 @@ int32_t EdsLib_DataTypeDB_UnpackCompleteObject(const EdsLib_DatabaseObject_t *GD
 int32_t EdsLib_DataTypeDB_UnpackPartialObject(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t *EdsId,
         void *DestBuffer, const void *SourceBuffer, uint32_t MaxNativeByteSize, uint32_t SourceBitSize, uint32_t StartingByte);
 
+/**
+ * Perform conversion from an array of native/unpacked objects to EDS/packed bitstreams
+ *
+ * All objects must be exactly the type given by EdsId; unlike
+ * EdsLib_DataTypeDB_PackCompleteObject() no derived type identification is done.
+ * The layout is resolved only once and then applied to every object, which is
+ * much faster than packing each object individually.
+ *
+ * Each encoded object starts PackedStrideBits after the previous one, so objects
+ * may be packed end-to-end even if the encoded size is not a whole number of bytes.
+ * Bits between the encoded objects are not modified.  Special fields are set in each
+ * encoded object as in EdsLib_DataTypeDB_PackCompleteObject(), however an ErrorControl
+ * field can only be computed if PackedStrideBits is a multiple of 8.
+ *
+ * The buffers must be large enough for NumObjects at the given strides.
+ *
+ * This builds a temporary plan on the stack on every call, and is only part of the
+ * runtime library.  For repeated use, see EdsLib_DataTypeDB_InitPackArrayPlan().
+ *
+ * @param GD the runtime database object
+ * @param EdsId The identifier of the object type
+ * @param DestBuffer Pointer to the destination buffer
+ * @param SourceBuffer Pointer to the source buffer (not modified by this call)
+ * @param NumObjects Number of objects to pack
+ * @param PackedStrideBits Distance between the start of successive packed objects, in bits
+ * @param NativeStrideBytes Distance between the start of successive native objects, in bytes
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful.
+ *      EDSLIB_INSUFFICIENT_MEMORY indicates the type is too complex for batch processing,
+ *      and the objects should be packed individually.
+ */
+int32_t EdsLib_DataTypeDB_PackArray(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects, uint32_t PackedStrideBits, uint32_t NativeStrideBytes);
+
+/**
+ * Perform conversion from an array of EDS/packed bitstreams to native/unpacked objects
+ *
+ * This is the inverse of EdsLib_DataTypeDB_PackArray().  All objects are decoded
+ * as exactly the type given by EdsId, without derived type identification.
+ *
+ * Special fields in each object are verified as in EdsLib_DataTypeDB_UnpackCompleteObject().
+ * All objects are decoded even if verification fails, and the status reflects the first
+ * object that failed.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The identifier of the object type
+ * @param DestBuffer Pointer to the destination buffer
+ * @param SourceBuffer Pointer to the source buffer (not modified by this call)
+ * @param NumObjects Number of objects to unpack
+ * @param NativeStrideBytes Distance between the start of successive native objects, in bytes
+ * @param PackedStrideBits Distance between the start of successive packed objects, in bits
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful
+ *
+ * \sa EdsLib_DataTypeDB_PackArray()
+ */
+int32_t EdsLib_DataTypeDB_UnpackArray(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects, uint32_t NativeStrideBytes, uint32_t PackedStrideBits);
+
+/**
+ * Prepare an array plan for repeatedly packing arrays of the given type
+ *
+ * The type is walked once and flattened into the plan, which can then be
+ * executed any number of times via EdsLib_DataTypeDB_ExecuteArrayPlan() with
+ * no further database lookups.  The result is exactly the same as
+ * EdsLib_DataTypeDB_PackArray() with the same type and strides.
+ *
+ * EdsLib_DataTypeDB_PackArray() builds a temporary plan on the stack each time it
+ * is called, so this should be preferred for objects that are packed repeatedly,
+ * and on targets with limited stack space.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The identifier of the object type
+ * @param PackedStrideBits Distance between the start of successive packed objects, in bits
+ * @param NativeStrideBytes Distance between the start of successive native objects, in bytes
+ * @param Plan Buffer to store the plan
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful.
+ *      EDSLIB_INSUFFICIENT_MEMORY indicates the type needs more than EDSLIB_ARRAYPLAN_MAX_OPS
+ *      operations, and the objects should be packed individually.
+ */
+int32_t EdsLib_DataTypeDB_InitPackArrayPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        uint32_t PackedStrideBits, uint32_t NativeStrideBytes, EdsLib_DataTypeDB_ArrayPlan_t *Plan);
+
+/**
+ * Prepare an array plan for repeatedly unpacking arrays of the given type
+ *
+ * This is the inverse of EdsLib_DataTypeDB_InitPackArrayPlan().  The result of
+ * executing the plan is exactly the same as EdsLib_DataTypeDB_UnpackArray()
+ * with the same type and strides.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The identifier of the object type
+ * @param NativeStrideBytes Distance between the start of successive native objects, in bytes
+ * @param PackedStrideBits Distance between the start of successive packed objects, in bits
+ * @param Plan Buffer to store the plan
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful
+ *
+ * \sa EdsLib_DataTypeDB_InitPackArrayPlan()
+ */
+int32_t EdsLib_DataTypeDB_InitUnpackArrayPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        uint32_t NativeStrideBytes, uint32_t PackedStrideBits, EdsLib_DataTypeDB_ArrayPlan_t *Plan);
+
+/**
+ * Pack or unpack an array of objects using a prepared array plan
+ *
+ * The direction, type, and strides are those given when the plan was prepared.
+ * The buffers must be large enough for NumObjects at those strides.
+ *
+ * @param Plan The plan from EdsLib_DataTypeDB_InitPackArrayPlan() or EdsLib_DataTypeDB_InitUnpackArrayPlan()
+ * @param DestBuffer Pointer to the destination buffer
+ * @param SourceBuffer Pointer to the source buffer (not modified by this call)
+ * @param NumObjects Number of objects to process
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful
+ */
+int32_t EdsLib_DataTypeDB_ExecuteArrayPlan(const EdsLib_DataTypeDB_ArrayPlan_t *Plan,
+        void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects);
+
+/**
+ * Initialize an array codec for repeatedly packing or unpacking arrays of the given type
+ *
+ * The codec behaves exactly like EdsLib_DataTypeDB_PackArray() and EdsLib_DataTypeDB_UnpackArray()
+ * with the same type and strides.  In addition, if the library is built with EDSLIB_ENABLE_JIT
+ * on a supported host (Linux on x86-64 or AArch64), the plan for each direction is compiled into
+ * native code once it has been used JitThreshold times.
+ *
+ * Only types that consist entirely of byte aligned fields, with no length, fixed value,
+ * or error control fields, can be compiled.  Other types, or any type when the compiler
+ * is not available, always use the interpreter.  The outcome is stored in the Status
+ * member of the Pack and Unpack states.
+ *
+ * If EDSLIB_ARRAYCODEC_FLAG_SELFCHECK is set in Flags, random data is run through both
+ * the compiled code and the interpreter after compilation, and the compiled code is only
+ * used if the results are identical.  Otherwise Status is set to EDSLIB_FIELD_MISMATCH.
+ *
+ * The codec is not thread safe; each thread should use its own codec object.
+ *
+ * @param Codec the codec object to initialize
+ * @param EdsId The identifier of the object type
+ * @param PackedStrideBits Distance between the start of successive packed objects, in bits
+ * @param NativeStrideBytes Distance between the start of successive native objects, in bytes
+ * @param JitThreshold Number of calls after which the plan is compiled, or 0 to never compile
+ * @param Flags Combination of EDSLIB_ARRAYCODEC_FLAG values
+ */
+void EdsLib_DataTypeDB_ArrayCodec_Init(EdsLib_DataTypeDB_ArrayCodec_t *Codec, EdsLib_Id_t EdsId,
+        uint32_t PackedStrideBits, uint32_t NativeStrideBytes, uint32_t JitThreshold, uint32_t Flags);
+
+/**
+ * Pack an array of native objects using an array codec
+ *
+ * @param GD the runtime database object
+ * @param Codec the codec object
+ * @param DestBuffer Pointer to the destination buffer
+ * @param SourceBuffer Pointer to the source buffer (not modified by this call)
+ * @param NumObjects Number of objects to pack
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful
+ *
+ * \sa EdsLib_DataTypeDB_PackArray()
+ */
+int32_t EdsLib_DataTypeDB_ArrayCodec_Pack(const EdsLib_DatabaseObject_t *GD, EdsLib_DataTypeDB_ArrayCodec_t *Codec,
+        void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects);
+
+/**
+ * Unpack an array of encoded objects using an array codec
+ *
+ * @param GD the runtime database object
+ * @param Codec the codec object
+ * @param DestBuffer Pointer to the destination buffer
+ * @param SourceBuffer Pointer to the source buffer (not modified by this call)
+ * @param NumObjects Number of objects to unpack
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful
+ *
+ * \sa EdsLib_DataTypeDB_UnpackArray()
+ */
+int32_t EdsLib_DataTypeDB_ArrayCodec_Unpack(const EdsLib_DatabaseObject_t *GD, EdsLib_DataTypeDB_ArrayCodec_t *Codec,
+        void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects);
+
+/**
+ * Release any compiled code held by an array codec
+ *
+ * The codec is returned to its initial state, and may continue to be used.
+ *
+ * @param Codec the codec object
+ */
+void EdsLib_DataTypeDB_ArrayCodec_Release(EdsLib_DataTypeDB_ArrayCodec_t *Codec);
+
 /**
  * Compute values for special fields within a packed object.
  *
@@ -704,6 +1253,289 @@ int32_t EdsLib_DataTypeDB_StoreValue(const EdsLib_DatabaseObject_t *GD, EdsLib_I
  */
 int32_t EdsLib_DataTypeDB_IdentifyBuffer(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, const void *MessageBuffer, EdsLib_DataTypeDB_DerivativeObjectInfo_t *DerivObjInfo);
 
+/**
+ * Locate the length field (EDS LengthEntry) within a container
+ *
+ * The container and any base types or sub-containers are searched for the first
+ * LengthEntry.  The position, encoding, and calibration of that field is stored
+ * in the supplied structure for later use with EdsLib_DataTypeDB_DecodeLengthField().
+ *
+ * Only integer length fields are supported.  Little endian fields must be byte
+ * aligned and a whole number of bytes.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The ID of the container, typically the base type of a packet
+ * @param LengthInfo Buffer to store the length field information
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful
+ */
+int32_t EdsLib_DataTypeDB_GetLengthFieldInfo(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, EdsLib_DataTypeDB_LengthFieldInfo_t *LengthInfo);
+
+/**
+ * Get the total size of an encoded object from the value of its length field
+ *
+ * Only the bytes which contain the length field are read; the object is not
+ * unpacked or identified.  The caller must ensure that at least
+ * LengthInfo->MinPackedBytes are valid at PackedData.
+ *
+ * @param LengthInfo The length field information from EdsLib_DataTypeDB_GetLengthFieldInfo()
+ * @param PackedData Pointer to the start of the encoded object
+ * @param PackedSizeBytes Buffer to store the total encoded size of the object, in bytes
+ * @return EDSLIB_SUCCESS if successful, EDSLIB_FIELD_MISMATCH if the field value does not
+ *          translate into a valid size.
+ */
+int32_t EdsLib_DataTypeDB_DecodeLengthField(const EdsLib_DataTypeDB_LengthFieldInfo_t *LengthInfo, const void *PackedData, uint32_t *PackedSizeBytes);
+
+/**
+ * Prepare to get the sizes of encoded objects of the given base type
+ *
+ * The length field and the fields used to identify derived types are located
+ * in the EDS and stored in the recipe.  The recipe does not refer to any
+ * buffer and can be kept for the lifetime of the database object.
+ *
+ * Identification fields are only cached if they are plain integers that can be
+ * decoded directly from the encoded bits; objects that use other encodings
+ * will only be identified as far as the cached fields allow.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The ID of the base type, typically the base type of a packet
+ * @param Recipe Buffer to store the recipe
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful
+ */
+int32_t EdsLib_DataTypeDB_InitSizeRecipe(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, EdsLib_DataTypeDB_SizeRecipe_t *Recipe);
+
+/**
+ * Get the encoded and native sizes of an encoded object without unpacking it
+ *
+ * The derived type is identified using only the identification fields of the encoded
+ * data, using the same logic as EdsLib_DataTypeDB_UnpackCompleteObject().  The encoded
+ * size is taken from the length field if the base type has one, otherwise it is the
+ * size of the identified type.
+ *
+ * If a value required for identification is not decodable or is beyond PackedDataSize,
+ * identification stops at that point and the native size is reported as the largest
+ * size of any type derived from the last identified type, so it is always sufficient
+ * to unpack the object.
+ *
+ * @param GD the runtime database object
+ * @param Recipe The recipe from EdsLib_DataTypeDB_InitSizeRecipe()
+ * @param PackedData Pointer to the start of the encoded object
+ * @param PackedDataSize Number of bytes valid at PackedData
+ * @param SizeInfo Buffer to store the identified type and sizes
+ * @return EDSLIB_SUCCESS if successful,
+ *         EDSLIB_INCOMPLETE_DB_OBJECT if identification stopped early (sizes are still valid),
+ *         or other error code if the sizes could not be determined.
+ */
+int32_t EdsLib_DataTypeDB_GetPackedSizes(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_SizeRecipe_t *Recipe,
+        const void *PackedData, uint32_t PackedDataSize, EdsLib_DataTypeDB_PackedSizeInfo_t *SizeInfo);
+
+/**
+ * Initialize a validator to check the values within native objects of the given type
+ *
+ * This walks the complete type once and records a check for every field whose type
+ * has a valid range in the EDS, or is an enumeration.  The resulting table can then
+ * be evaluated against any number of native objects using EdsLib_DataTypeDB_ValidateObject().
+ *
+ * Only the ranges of the data types are checked; a valid range that is specific to one
+ * container entry is not part of the database and is not checked.  If the database
+ * does not include any valid ranges the validator is initialized with no checks.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The identifier of the object type
+ * @param Validator Buffer to store the range checks
+ * @return EDSLIB_SUCCESS if successful,
+ *         EDSLIB_INSUFFICIENT_MEMORY if the type has more than EDSLIB_VALIDATOR_MAX_CHECKS checks,
+ *         or other error code if unsuccessful
+ */
+int32_t EdsLib_DataTypeDB_InitValidator(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DataTypeDB_Validator_t *Validator);
+
+/**
+ * Check the values in a native object against their valid ranges
+ *
+ * All checks are evaluated, so the result indicates every field that is out of
+ * range.  The object is assumed to be exactly the type that the validator was
+ * initialized with; derived types are not identified.
+ *
+ * @param Validator The validator from EdsLib_DataTypeDB_InitValidator()
+ * @param NativeObj Pointer to the native object
+ * @param NativeSize Size of the native object buffer, in bytes
+ * @param Result Buffer to store the violation bitmap
+ * @return EDSLIB_SUCCESS if all values are valid,
+ *         EDSLIB_VALUE_OUT_OF_RANGE if any value is not valid,
+ *         EDSLIB_BUFFER_SIZE_ERROR if the buffer is smaller than the object type
+ */
+int32_t EdsLib_DataTypeDB_ValidateObject(const EdsLib_DataTypeDB_Validator_t *Validator, const void *NativeObj,
+        uint32_t NativeSize, EdsLib_DataTypeDB_ValidationResult_t *Result);
+
+/**
+ * Get the location and type of the field that a validator check applies to
+ *
+ * @param GD the runtime database object
+ * @param Validator The validator from EdsLib_DataTypeDB_InitValidator()
+ * @param CheckIdx The check index (bit position in the violation mask)
+ * @param MemberInfo Buffer to store the field information
+ * @return EDSLIB_SUCCESS if successful, EDSLIB_INVALID_INDEX if CheckIdx is not valid
+ */
+int32_t EdsLib_DataTypeDB_GetValidatorCheckInfo(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_Validator_t *Validator,
+        uint16_t CheckIdx, EdsLib_DataTypeDB_EntityInfo_t *MemberInfo);
+
+/**
+ * Initialize a differ to compare native objects of the given type field by field
+ *
+ * This walks the complete type once and records every leaf field (numbers and strings,
+ * including each element of an array) in offset order.  Adjacent fields are then grouped
+ * into runs of up to EDSLIB_DIFF_RUN_SIZE bytes that are compared as a single block.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The identifier of the object type
+ * @param Differ Buffer to store the field table
+ * @return EDSLIB_SUCCESS if successful,
+ *         EDSLIB_INSUFFICIENT_MEMORY if the type has more than EDSLIB_DIFF_MAX_FIELDS fields,
+ *         or other error code if unsuccessful
+ */
+int32_t EdsLib_DataTypeDB_InitDiffer(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DataTypeDB_Differ_t *Differ);
+
+/**
+ * Find the fields that differ between two native objects
+ *
+ * Each run is compared with a single memcmp(), and only the fields of runs that differ
+ * are compared individually.  Fields are compared bitwise, so e.g. a floating point
+ * 0.0 and -0.0 are different.  Padding between fields is never reported as a change.
+ * The objects are assumed to be exactly the type that the differ was initialized with;
+ * derived types are not identified.
+ *
+ * @param Differ The differ from EdsLib_DataTypeDB_InitDiffer()
+ * @param NativeObj1 Pointer to the first native object, e.g. the previous sample
+ * @param NativeObj2 Pointer to the second native object, e.g. the current sample
+ * @param NativeSize Size of both native object buffers, in bytes
+ * @param Result Buffer to store the changed field bitmap
+ * @return EDSLIB_SUCCESS if successful (including if fields have changed),
+ *         EDSLIB_BUFFER_SIZE_ERROR if the buffers are smaller than the object type
+ */
+int32_t EdsLib_DataTypeDB_DiffObjects(const EdsLib_DataTypeDB_Differ_t *Differ, const void *NativeObj1,
+        const void *NativeObj2, uint32_t NativeSize, EdsLib_DataTypeDB_DiffResult_t *Result);
+
+/**
+ * Get the location and type of a field within a differ
+ *
+ * @param GD the runtime database object
+ * @param Differ The differ from EdsLib_DataTypeDB_InitDiffer()
+ * @param FieldIdx The field index (bit position in the changed mask)
+ * @param MemberInfo Buffer to store the field information
+ * @return EDSLIB_SUCCESS if successful, EDSLIB_INVALID_INDEX if FieldIdx is not valid
+ */
+int32_t EdsLib_DataTypeDB_GetDiffFieldInfo(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_Differ_t *Differ,
+        uint16_t FieldIdx, EdsLib_DataTypeDB_EntityInfo_t *MemberInfo);
+
+/**
+ * Initialize a hasher for native objects of the given type
+ *
+ * This resolves the complete type once into the same flat table of fields that
+ * the array pack functions use, so that hashing each object needs no database
+ * lookups.  As with EdsLib_DataTypeDB_PackArray(), objects are assumed to be
+ * exactly the given type; derived types are not identified.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The identifier of the object type
+ * @param Hasher Buffer to store the field table
+ * @return EDSLIB_SUCCESS if successful,
+ *         EDSLIB_INSUFFICIENT_MEMORY if the type needs more than EDSLIB_ARRAYPLAN_MAX_OPS
+ *         table entries, or other error code if unsuccessful
+ */
+int32_t EdsLib_DataTypeDB_InitContentHasher(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DataTypeDB_ContentHasher_t *Hasher);
+
+/**
+ * Compute a hash over the canonical packed encoding of a native object
+ *
+ * The hash covers the bits that EdsLib_DataTypeDB_PackCompleteObject() would produce
+ * for the object, so native padding and layout differences have no effect.  Length,
+ * fixed value and error control fields are hashed as zero, since they are derived
+ * from the EDS and the other fields rather than being content.  Each field is packed
+ * into a small local buffer and added to the hash in turn, so no buffer is needed for
+ * the complete packed object.
+ *
+ * The hash is intended for change detection and de-duplication, it is not a
+ * cryptographic hash.
+ *
+ * @param Hasher The hasher from EdsLib_DataTypeDB_InitContentHasher()
+ * @param NativeObj Pointer to the native object
+ * @param NativeSize Size of the native object buffer, in bytes
+ * @param Hash Buffer to store the hash value
+ * @return EDSLIB_SUCCESS if successful,
+ *         EDSLIB_BUFFER_SIZE_ERROR if the buffer is smaller than the object type,
+ *         or other error code if unsuccessful
+ */
+int32_t EdsLib_DataTypeDB_ComputeContentHash(const EdsLib_DataTypeDB_ContentHasher_t *Hasher,
+        const void *NativeObj, uint32_t NativeSize, EdsLib_DataTypeDB_ContentHash_t *Hash);
+
+/**
+ * Convert numeric values of an EDS type into a C array of another numeric type
+ *
+ * This is equivalent to calling EdsLib_DataTypeDB_LoadValue() and EdsLib_DataTypeConvert()
+ * for every value and storing the result, but converts all values in one call.
+ *
+ * If EdsId is a numeric type, one value is converted from each of NumObjects objects,
+ * which are SrcStride bytes apart.  This is intended for extracting the same member from
+ * a series of records, where SrcPtr points to the member in the first record and SrcStride
+ * is the size of the record.  If EdsId is an array of numbers, all elements of each
+ * array are converted, so a single array member is converted by passing NumObjects=1.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The identifier of the source type (number or array of numbers)
+ * @param DestType Type of the destination values: signed, unsigned or float
+ * @param DestSize Size of each destination value, in bytes
+ * @param DestBuffer Buffer to store the converted values, consecutively
+ * @param DestBufferSize Size of the destination buffer, in bytes
+ * @param SrcPtr Pointer to the first native source object
+ * @param SrcStride Distance between native source objects in bytes, or 0 if consecutive
+ * @param NumObjects Number of source objects to convert
+ * @return EDSLIB_SUCCESS if successful,
+ *         EDSLIB_INVALID_SIZE_OR_TYPE if the source or destination is not a supported numeric type,
+ *         EDSLIB_BUFFER_SIZE_ERROR if the destination buffer is too small
+ */
+int32_t EdsLib_DataTypeDB_ConvertArray(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_BasicType_t DestType, uint32_t DestSize, void *DestBuffer, uint32_t DestBufferSize,
+        const void *SrcPtr, uint32_t SrcStride, uint32_t NumObjects);
+
+/**
+ * Get the calibration of a container member, as defined in the EDS
+ *
+ * If the member is an array of numbers, the calibration applies to every element,
+ * and NumValues is the number of elements.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The identifier of the container type
+ * @param SubIndex The member index, as in EdsLib_DataTypeDB_GetMemberByIndex()
+ * @param Calibration Buffer to store the calibration and the location of the raw values
+ * @return EDSLIB_SUCCESS if successful,
+ *         EDSLIB_NO_MATCHING_VALUE if the member has no calibration,
+ *         EDSLIB_INVALID_SIZE_OR_TYPE if the member is not a number or array of numbers,
+ *         or other error code if unsuccessful
+ */
+int32_t EdsLib_DataTypeDB_GetMemberCalibration(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, uint16_t SubIndex,
+        EdsLib_DataTypeDB_Calibration_t *Calibration);
+
+/**
+ * Convert an array of raw values into engineering units
+ *
+ * Values are read from RawValues using the RawType, RawSize and RawStride of the
+ * calibration, so a whole array member can be converted using the native object
+ * address plus Calibration->Offset.Bytes.  All values are converted in blocks with
+ * the calibration applied to a block at a time, rather than a call per value.
+ *
+ * @param Calibration The calibration to apply
+ * @param RawValues Pointer to the first raw value
+ * @param NumValues Number of values to convert
+ * @param EuValues Buffer to store the converted values, must have space for NumValues
+ * @return EDSLIB_SUCCESS if successful,
+ *         EDSLIB_INVALID_SIZE_OR_TYPE if the raw type is not supported,
+ *         EDSLIB_NOT_IMPLEMENTED if the calibration type or spline order is not supported
+ */
+int32_t EdsLib_DataTypeDB_CalibrateArray(const EdsLib_DataTypeDB_Calibration_t *Calibration, const void *RawValues,
+        uint32_t NumValues, double *EuValues);
+
 /**
  * Convert the numeric value representation from its current type into the desired type
  *
@@ -80,6 +80,282 @@ typedef void (*EdsLib_EntityCallback_t)(void *Arg, const EdsLib_EntityDescriptor
  */
 typedef void (*EdsLib_SymbolCallback_t)(void *Arg, const char *SymbolName, int32_t SymbolValue);
 
+/**
+ * The number of data bytes shown on each line of a hex dump
+ */
+#define EDSLIB_HEXDUMP_BYTES_PER_LINE           16
+
+/**
+ * Buffer space required for one line of a hex dump, including the newline and
+ * terminator.  This allows for an offset of up to 16 hex digits.
+ */
+#define EDSLIB_HEXDUMP_MAX_LINE_SIZE            (2 + 16 + 1 + (4 * EDSLIB_HEXDUMP_BYTES_PER_LINE) + 2 + 2)
+
+/**
+ * A single entity within a name table
+ */
+struct EdsLib_DisplayDB_NameTableEntry
+{
+    EdsLib_EntityDescriptor_t Descriptor;   /**< Entity location, the FullName points into the name table */
+    const char *TypeName;                   /**< Qualified type name of the entity, as from EdsLib_DisplayDB_GetTypeName() */
+};
+
+typedef struct EdsLib_DisplayDB_NameTableEntry EdsLib_DisplayDB_NameTableEntry_t;
+
+/**
+ * Precomputed full names of all entities within a type
+ *
+ * All names are stored in the buffers given to EdsLib_DisplayDB_InitNameTable(), so
+ * the pointers remain valid for as long as those buffers are not modified or moved.
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+struct EdsLib_DisplayDB_NameTable
+{
+    EdsLib_Id_t EdsId;
+    bool IsValid;
+    uint16_t NumEntities;
+    uint32_t StringSpaceUsed;
+    const char *TypeName;
+    EdsLib_DisplayDB_NameTableEntry_t *Entities;
+    char *StringSpace;
+};
+
+typedef struct EdsLib_DisplayDB_NameTable EdsLib_DisplayDB_NameTable_t;
+
+/**
+ * A set of name tables that are built on demand, one for each data type in the database
+ *
+ * The tables are indexed by the position of the type in the database, and the storage for
+ * the names of each table is taken from a common pool when the table is first built.
+ * Tables are never replaced, so a pointer to a table remains valid for as long as the cache.
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+struct EdsLib_DisplayDB_NameCache
+{
+    uint32_t NumSlots;
+    EdsLib_DisplayDB_NameTable_t *Slots;
+    uint32_t EntityPoolSize;
+    uint32_t EntityPoolUsed;
+    EdsLib_DisplayDB_NameTableEntry_t *EntityPool;
+    uint32_t StringPoolSize;
+    uint32_t StringPoolUsed;
+    char *StringPool;
+};
+
+typedef struct EdsLib_DisplayDB_NameCache EdsLib_DisplayDB_NameCache_t;
+
+/**
+ * The maximum number of instructions in a compiled expression
+ */
+#ifndef EDSLIB_EXPRESSION_MAX_OPS
+#define EDSLIB_EXPRESSION_MAX_OPS               64
+#endif
+
+/**
+ * The maximum number of intermediate values held while evaluating an expression
+ */
+#ifndef EDSLIB_EXPRESSION_MAX_DEPTH
+#define EDSLIB_EXPRESSION_MAX_DEPTH             8
+#endif
+
+/**
+ * A single instruction of a compiled expression
+ *
+ * Field loads refer to the native offset and type of the field, so no name lookup
+ * is needed during evaluation.  Binary operations with a constant right operand hold
+ * the constant in the instruction rather than pushing it separately.
+ */
+struct EdsLib_DisplayDB_ExprOp
+{
+    uint8_t OpCode;
+    bool ConstOperand;                  /**< Binary operations: right operand is the Constant value */
+    EdsLib_BasicType_t FieldType;       /**< Field loads: native type of the field */
+    uint32_t FieldSize;                 /**< Field loads: native size of the field, in bytes */
+    uint32_t FieldOffset;               /**< Field loads: native offset of the field within the object */
+    double Constant;
+};
+
+typedef struct EdsLib_DisplayDB_ExprOp EdsLib_DisplayDB_ExprOp_t;
+
+/**
+ * An expression compiled against the fields of an EDS type
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+struct EdsLib_DisplayDB_Expression
+{
+    EdsLib_Id_t EdsId;
+    uint32_t NativeSize;
+    uint32_t ErrorPos;                  /**< Position in the source text where compilation failed */
+    uint16_t NumOps;
+    uint16_t MaxDepth;
+    EdsLib_DisplayDB_ExprOp_t Ops[EDSLIB_EXPRESSION_MAX_OPS];
+};
+
+typedef struct EdsLib_DisplayDB_Expression EdsLib_DisplayDB_Expression_t;
+
+/**
+ * The maximum number of instructions in a compiled packet filter
+ *
+ * Jump distances and instruction indices are stored as 16 bits, so this may not exceed 65535.
+ */
+#ifndef EDSLIB_FILTER_MAX_INSNS
+#define EDSLIB_FILTER_MAX_INSNS                 64
+#endif
+
+/**
+ * A value held in a filter register or instruction
+ */
+union EdsLib_DisplayDB_FilterValue
+{
+    int64_t Signed;
+    uint64_t Unsigned;
+    double Float;
+};
+
+typedef union EdsLib_DisplayDB_FilterValue EdsLib_DisplayDB_FilterValue_t;
+
+/**
+ * A single instruction of a compiled packet filter
+ *
+ * Fields are read directly from the packed data at a fixed bit offset.  Jumps
+ * are relative to the next instruction and always forward, so every filter
+ * terminates after at most one pass through the instructions.
+ */
+struct EdsLib_DisplayDB_FilterInsn
+{
+    uint8_t OpCode;
+    uint8_t Compare;                    /**< Comparison operator for conditional jumps */
+    uint8_t ValueType;                  /**< Comparisons are done as signed, unsigned or floating point */
+    uint8_t FieldType;                  /**< Field encoding: unsigned, twos complement or IEEE-754 */
+    uint8_t NumBits;                    /**< Size of the field in the packed data, in bits */
+    bool LittleEndian;                  /**< Byte order of the field in the packed data */
+    uint8_t Register;                   /**< Destination register of field loads */
+    uint16_t JumpTrue;                  /**< Instructions to skip if the condition is true */
+    uint16_t JumpFalse;                 /**< Instructions to skip if the condition is false */
+    uint32_t BitOffset;                 /**< Offset of the field within the packed data, in bits */
+    uint64_t Mask;                      /**< Mask applied to the raw bits of integer fields */
+    EdsLib_DisplayDB_FilterValue_t Constant;
+};
+
+typedef struct EdsLib_DisplayDB_FilterInsn EdsLib_DisplayDB_FilterInsn_t;
+
+/**
+ * A packet filter compiled against an EDS message type
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+struct EdsLib_DisplayDB_Filter
+{
+    EdsLib_Id_t EdsId;
+    uint32_t RequiredBits;              /**< Packed size needed to hold all the fields that are read */
+    uint32_t ErrorPos;                  /**< Position in the source text where compilation failed */
+    uint16_t NumInsns;
+    EdsLib_DisplayDB_FilterInsn_t Insns[EDSLIB_FILTER_MAX_INSNS];
+};
+
+typedef struct EdsLib_DisplayDB_Filter EdsLib_DisplayDB_Filter_t;
+
+/**
+ * The maximum number of numeric fields that a decimator aggregates
+ */
+#ifndef EDSLIB_DECIMATOR_MAX_FIELDS
+#define EDSLIB_DECIMATOR_MAX_FIELDS             256
+#endif
+
+/**
+ * How a decimator selects the packets of a message type
+ */
+typedef enum
+{
+    EDSLIB_DECIMATE_POLICY_KEEP_EVERY_N = 0,    /**< Keep the first of every N packets */
+    EDSLIB_DECIMATE_POLICY_TIME_BUCKET,         /**< Combine all packets in a time interval into one */
+    EDSLIB_DECIMATE_POLICY_DEADBAND             /**< Keep a packet when a field moves outside a deadband */
+} EdsLib_DisplayDB_DecimatePolicy_t;
+
+/**
+ * How a time bucket decimator combines the numeric fields of the packets
+ */
+typedef enum
+{
+    EDSLIB_DECIMATE_AGGREGATE_MEAN = 0,
+    EDSLIB_DECIMATE_AGGREGATE_MIN,
+    EDSLIB_DECIMATE_AGGREGATE_MAX
+} EdsLib_DisplayDB_DecimateAggregate_t;
+
+/**
+ * The outcome of passing a packet to a decimator
+ */
+typedef enum
+{
+    EDSLIB_DECIMATE_DROP = 0,           /**< The packet is not needed */
+    EDSLIB_DECIMATE_KEEP,               /**< The packet should be forwarded as is */
+    EDSLIB_DECIMATE_EMIT,               /**< A combined packet was written to the output buffer */
+    EDSLIB_DECIMATE_INVALID             /**< The packet is too short, or a buffer is too small */
+} EdsLib_DisplayDB_DecimateResult_t;
+
+/**
+ * Decimator configuration
+ *
+ * Only the members used by the policy need to be set.
+ */
+struct EdsLib_DisplayDB_DecimateConfig
+{
+    uint8_t Policy;                     /**< One of the EDSLIB_DECIMATE_POLICY values */
+    uint8_t Aggregate;                  /**< One of the EDSLIB_DECIMATE_AGGREGATE values, for time buckets */
+    uint32_t KeepEveryN;                /**< Packets per kept packet, for keep every N */
+    double BucketWidth;                 /**< Width of a time bucket, in the units of the time field */
+    double Deadband;                    /**< Change of the field needed to keep a packet, for deadband */
+    const char *FieldName;              /**< The time field for time buckets, or the tested field for deadband */
+    void *Buffer;                       /**< Holds the first packet of the current time bucket */
+    uint32_t BufferSize;                /**< Size of the buffer, the largest packet that can be combined */
+};
+
+typedef struct EdsLib_DisplayDB_DecimateConfig EdsLib_DisplayDB_DecimateConfig_t;
+
+/**
+ * A numeric field read by a decimator, along with its running value
+ */
+struct EdsLib_DisplayDB_DecimateField
+{
+    uint32_t BitOffset;                 /**< Offset of the field within the packed data, in bits */
+    uint8_t NumBits;                    /**< Size of the field in the packed data, in bits */
+    uint8_t FieldType;                  /**< Field encoding: unsigned, twos complement or IEEE-754 */
+    bool LittleEndian;                  /**< Byte order of the field in the packed data */
+    EdsLib_DisplayDB_FilterValue_t Value;   /**< Sum, minimum or maximum over the current time bucket */
+};
+
+typedef struct EdsLib_DisplayDB_DecimateField EdsLib_DisplayDB_DecimateField_t;
+
+/**
+ * Decimation state for one EDS message type
+ *
+ * This should be treated as opaque by the application and only accessed via the API.
+ * It is declared here so that it can be statically allocated.
+ */
+struct EdsLib_DisplayDB_Decimator
+{
+    EdsLib_Id_t EdsId;
+    EdsLib_DisplayDB_DecimateConfig_t Config;
+    uint32_t RequiredBits;              /**< Packed size needed to hold all the fields that are read */
+    uint32_t PacketCount;               /**< Packets seen since the last kept packet, for keep every N */
+    uint32_t SampleCount;               /**< Packets combined in the current time bucket */
+    uint32_t HeldSize;                  /**< Size of the packet in the buffer, 0 if no bucket is open */
+    double Bucket;                      /**< Current time bucket, or the last kept value for deadband */
+    const struct EdsLib_DataTypeDB_Entry *ErrorCtlDictPtr;    /**< Error control field to recompute, if any */
+    uint32_t ErrorCtlOffsetBits;
+    uint8_t ErrorCtlType;
+    EdsLib_DisplayDB_DecimateField_t KeyField;  /**< The time or deadband field */
+    uint16_t NumFields;
+    EdsLib_DisplayDB_DecimateField_t Fields[EDSLIB_DECIMATOR_MAX_FIELDS];
+};
+
+typedef struct EdsLib_DisplayDB_Decimator EdsLib_DisplayDB_Decimator_t;
+
 
 /******************************
  * API CALLS
@@ -256,6 +532,125 @@ const char *EdsLib_DisplayDB_GetNameByIndex(const EdsLib_DatabaseObject_t *GD, E
  */
 void EdsLib_DisplayDB_IterateBaseEntities(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, EdsLib_EntityCallback_t Callback, void *Arg);
 void EdsLib_DisplayDB_IterateAllEntities(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, EdsLib_EntityCallback_t Callback, void *Arg);
+/**
+ * Get the storage needed for the name table of a type
+ *
+ * This walks the type in the same way as EdsLib_DisplayDB_InitNameTable(), without storing
+ * anything, so the sizes are exact for the given database.
+ *
+ * @param GD the active EdsLib runtime database object
+ * @param EdsId the message ID to walk.  This may be any known/valid ID (message ID or a bare structure ID).
+ * @param NumEntities Set to the number of entities in the type
+ * @param StringSpaceSize Set to the space needed for all names, in bytes
+ * @returns EDSLIB_SUCCESS if successful,
+ *          EDSLIB_INSUFFICIENT_MEMORY if the type has more entities than a name table can index,
+ *          or other error code if unsuccessful
+ */
+int32_t EdsLib_DisplayDB_GetNameTableSize(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        uint16_t *NumEntities, uint32_t *StringSpaceSize);
+
+/**
+ * Build a table of the full names of all entities within a type
+ *
+ * This is the same set of entities, in the same order and with the same names, as given to the
+ * callback of EdsLib_DisplayDB_IterateAllEntities().  The names are formatted once and stored in
+ * the table, so that repeated iteration does not need to generate them again.  The qualified type
+ * name of each entity is also stored, usually with one copy of each distinct type name.
+ *
+ * The required buffer sizes can be obtained from EdsLib_DisplayDB_GetNameTableSize().
+ *
+ * @param GD the active EdsLib runtime database object
+ * @param EdsId the message ID to walk.  This may be any known/valid ID (message ID or a bare structure ID).
+ * @param NameTable The table to initialize
+ * @param EntityBuffer Buffer to store the entities
+ * @param MaxEntities Number of entries in EntityBuffer
+ * @param StringBuffer Buffer to store the names
+ * @param StringBufferSize Size of StringBuffer, in bytes
+ * @returns EDSLIB_SUCCESS if successful,
+ *          EDSLIB_INSUFFICIENT_MEMORY if the names do not fit in the buffers,
+ *          or other error code if unsuccessful
+ */
+int32_t EdsLib_DisplayDB_InitNameTable(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DisplayDB_NameTable_t *NameTable, EdsLib_DisplayDB_NameTableEntry_t *EntityBuffer,
+        uint16_t MaxEntities, char *StringBuffer, uint32_t StringBufferSize);
+
+/**
+ * Invoke a callback for each entity in a name table
+ *
+ * This is equivalent to EdsLib_DisplayDB_IterateAllEntities() for the type of the table, but
+ * the FullName pointers given to the callback remain valid after the callback returns.
+ *
+ * @param NameTable The table from EdsLib_DisplayDB_InitNameTable()
+ * @param Callback the callback function to invoke for each entity
+ * @param Arg opaque argument that is passed directly to the callback function
+ */
+void EdsLib_DisplayDB_IterateNameTable(const EdsLib_DisplayDB_NameTable_t *NameTable, EdsLib_EntityCallback_t Callback, void *Arg);
+
+/**
+ * Get a single entity from a name table
+ *
+ * @param NameTable The table from EdsLib_DisplayDB_InitNameTable()
+ * @param Index The entity index, in iteration order
+ * @returns Pointer to the entity, or NULL if the index is not valid
+ */
+const EdsLib_DisplayDB_NameTableEntry_t *EdsLib_DisplayDB_GetNameTableEntry(const EdsLib_DisplayDB_NameTable_t *NameTable, uint16_t Index);
+
+/**
+ * Get the qualified name of the type of a name table
+ *
+ * @param NameTable The table from EdsLib_DisplayDB_InitNameTable()
+ * @returns The type name, or the same placeholder as EdsLib_DisplayDB_GetTypeName() if the type has no name
+ */
+const char *EdsLib_DisplayDB_GetNameTableTypeName(const EdsLib_DisplayDB_NameTable_t *NameTable);
+
+/**
+ * Get the number of name cache slots needed for a database
+ *
+ * This is the total number of data types in all applications currently in the database.
+ *
+ * @param GD the active EdsLib runtime database object
+ * @returns Number of slots
+ */
+uint32_t EdsLib_DisplayDB_GetNameCacheSlots(const EdsLib_DatabaseObject_t *GD);
+
+/**
+ * Initialize a name cache
+ *
+ * The slot table should have the number of entries given by EdsLib_DisplayDB_GetNameCacheSlots().
+ * The pools hold the entities and names of every table that is built, so their size determines
+ * how many distinct types can be cached; lookups of further types return NULL.
+ *
+ * If any of the buffers is NULL then nothing is cached, and every lookup returns NULL.
+ * The cache must be initialized again if applications are registered or unregistered
+ * in the database.
+ *
+ * @param Cache The cache to initialize
+ * @param Slots Storage for the name tables, one per data type
+ * @param NumSlots Number of entries in Slots
+ * @param EntityPool Storage for the entities of all tables
+ * @param EntityPoolSize Number of entries in EntityPool
+ * @param StringPool Storage for the names of all tables
+ * @param StringPoolSize Size of StringPool, in bytes
+ */
+void EdsLib_DisplayDB_InitNameCache(EdsLib_DisplayDB_NameCache_t *Cache, EdsLib_DisplayDB_NameTable_t *Slots,
+        uint32_t NumSlots, EdsLib_DisplayDB_NameTableEntry_t *EntityPool, uint32_t EntityPoolSize,
+        char *StringPool, uint32_t StringPoolSize);
+
+/**
+ * Get the name table for a type, building it if it is not already in the cache
+ *
+ * The storage for a table is sized for the type from the database, so any type can be
+ * cached as long as there is space left in the pools of the cache.
+ *
+ * @param GD the active EdsLib runtime database object
+ * @param Cache The cache from EdsLib_DisplayDB_InitNameCache()
+ * @param EdsId the message ID to look up
+ * @returns Pointer to the name table, or NULL if the table could not be built
+ *          (the application may use EdsLib_DisplayDB_IterateAllEntities() instead)
+ */
+const EdsLib_DisplayDB_NameTable_t *EdsLib_DisplayDB_GetCachedNameTable(const EdsLib_DatabaseObject_t *GD,
+        EdsLib_DisplayDB_NameCache_t *Cache, EdsLib_Id_t EdsId);
+
 /**
  * Walk through the deep payload structure of a given message/structure ID and find an element name matching
  * the name supplied as the "FullName" value within the LocateDesc parameter.  If found, the rest of the parameters
@@ -275,6 +670,173 @@ void EdsLib_DisplayDB_IterateAllEntities(const EdsLib_DatabaseObject_t *GD, EdsL
 int32_t EdsLib_DisplayDB_LocateSubEntity(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, const char *Name, EdsLib_DataTypeDB_EntityInfo_t *CompInfo);
 
 
+/**
+ * Compile an expression over the fields of an EDS type, i.e. for derived telemetry parameters
+ *
+ * The expression uses C-like syntax with the operators + - * / and parentheses.  Operands
+ * are numeric constants or field names as in EdsLib_DisplayDB_LocateSubEntity(), such as
+ * "Payload.Voltage * Payload.Current".  The following functions are also accepted:
+ *
+ *    abs(x), sqrt(x), min(x, y, ...), max(x, y, ...), avg(x, y, ...)
+ *
+ * All arithmetic is done in double precision using the raw (uncalibrated) field values.
+ * Field names are resolved once here, so evaluation does not need the database.
+ *
+ * On failure, the ErrorPos member of the Expression is set to the position in the
+ * text where the error was detected.
+ *
+ * @param GD the active EdsLib runtime database object
+ * @param EdsId the type of the objects that the expression will be evaluated on
+ * @param Text The expression text
+ * @param Expression Buffer to store the compiled expression
+ * @returns EDSLIB_SUCCESS if successful,
+ *          EDSLIB_NAME_NOT_FOUND if a field or function name is not known,
+ *          EDSLIB_INVALID_SIZE_OR_TYPE if a field is not a number,
+ *          EDSLIB_INSUFFICIENT_MEMORY if the expression is too large,
+ *          EDSLIB_FAILURE if the expression has a syntax error
+ */
+int32_t EdsLib_DisplayDB_CompileExpression(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, const char *Text,
+        EdsLib_DisplayDB_Expression_t *Expression);
+
+/**
+ * Evaluate a compiled expression over an array of native objects
+ *
+ * One result is written to Results for each object, so evaluating several expressions
+ * over the same objects produces one column of results per expression.  The objects
+ * are processed in blocks, each instruction being applied to a whole block at a time.
+ *
+ * @param Expression The compiled expression
+ * @param NativeObjs Pointer to the first object, of the type the expression was compiled for
+ * @param Stride Distance between consecutive objects, in bytes (0 = size of the type)
+ * @param NumObjects The number of objects
+ * @param Results Buffer to store the results, at least NumObjects in size
+ * @returns EDSLIB_SUCCESS if successful, error code if the expression is not valid
+ */
+int32_t EdsLib_DisplayDB_EvaluateExpression(const EdsLib_DisplayDB_Expression_t *Expression, const void *NativeObjs,
+        uint32_t Stride, uint32_t NumObjects, double *Results);
+
+
+/**
+ * Compile a packet filter for messages of an EDS type, i.e. for routers and recorders
+ *
+ * The filter only accepts packets that are identified as EdsId when decoded as BaseId.
+ * The identification checks come first, so packets of other types are rejected by
+ * the first comparison that differs, without reading any other fields.  If BaseId
+ * is the same as EdsId there are no identification checks.
+ *
+ * The predicate text further selects packets of this type, using C-like syntax:
+ *
+ *    Payload.Mode != 3 && (Payload.Flags & 0x4) == 0
+ *
+ * Comparisons are == != < <= > >= between field names, as in
+ * EdsLib_DisplayDB_LocateSubEntity(), and numeric constants.  An integer field may
+ * be masked with & and a constant.  Comparisons are combined with && || and !, and
+ * are evaluated left to right with short circuiting.  The predicate may be NULL
+ * or empty to accept all packets of the type.
+ *
+ * Fields are read directly from the packed data, so they must use unsigned, twos
+ * complement or IEEE-754 encoding.  Little endian fields must be byte aligned.
+ *
+ * On failure, the ErrorPos member of the Filter is set to the position in the
+ * text where the error was detected.
+ *
+ * @param GD the active EdsLib runtime database object
+ * @param BaseId the type that all packets are decoded as, i.e. the message header
+ * @param EdsId the type of the packets to select
+ * @param Text The predicate text
+ * @param Filter Buffer to store the compiled filter
+ * @returns EDSLIB_SUCCESS if successful,
+ *          EDSLIB_NAME_NOT_FOUND if a field name is not known,
+ *          EDSLIB_INVALID_SIZE_OR_TYPE if a field cannot be read from packed data,
+ *          EDSLIB_INSUFFICIENT_MEMORY if the filter is too large,
+ *          EDSLIB_FAILURE if the predicate has a syntax error,
+ *          or other error code if EdsId is not derived from BaseId
+ */
+int32_t EdsLib_DisplayDB_CompileFilter(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseId, EdsLib_Id_t EdsId,
+        const char *Text, EdsLib_DisplayDB_Filter_t *Filter);
+
+/**
+ * Check if a packed message is selected by a compiled filter
+ *
+ * This does not need the database, and does not decode the message.  Messages
+ * that are too short to contain all of the fields that are read are rejected.
+ *
+ * @param Filter The compiled filter
+ * @param PackedData The packed message
+ * @param PackedSize The size of the packed message, in bytes
+ * @returns true if the message is selected by the filter
+ */
+bool EdsLib_DisplayDB_FilterMatch(const EdsLib_DisplayDB_Filter_t *Filter, const void *PackedData, uint32_t PackedSize);
+
+/**
+ * Initialize a decimator for messages of an EDS type, i.e. for displays and trending
+ *
+ * The decimator thins out a stream of packed messages without decoding them.  Keep
+ * every N and deadband decide per packet whether it is forwarded.  A time bucket
+ * decimator combines all the packets within each interval of the time field into
+ * one packet: the first packet of the bucket is held in the configured buffer, and
+ * every numeric field after the BaseId header is replaced by the mean, minimum or
+ * maximum over the bucket.  The header, the time field, and any fields that are
+ * not plain numbers keep the values of the first packet.  If there is an error
+ * control field, it is recomputed over the full size of the first packet.
+ *
+ * The time and deadband fields are named as in EdsLib_DisplayDB_LocateSubEntity(),
+ * and, like all combined fields, are read directly from the packed data.  They must
+ * use unsigned, twos complement or IEEE-754 encoding, and little endian fields must
+ * be byte aligned.
+ *
+ * @param GD the active EdsLib runtime database object
+ * @param BaseId the type that all packets are decoded as, i.e. the message header
+ * @param EdsId the type of the packets to decimate
+ * @param Config The decimation policy, this is copied into the decimator
+ * @param Decimator Buffer to store the decimator
+ * @returns EDSLIB_SUCCESS if successful,
+ *          EDSLIB_NAME_NOT_FOUND if the field name is not known,
+ *          EDSLIB_INVALID_SIZE_OR_TYPE if the field cannot be read from packed data,
+ *          EDSLIB_INSUFFICIENT_MEMORY if the type has too many numeric fields,
+ *          EDSLIB_FAILURE if the configuration is not valid
+ */
+int32_t EdsLib_DisplayDB_InitDecimator(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseId, EdsLib_Id_t EdsId,
+        const EdsLib_DisplayDB_DecimateConfig_t *Config, EdsLib_DisplayDB_Decimator_t *Decimator);
+
+/**
+ * Pass a packed message to a decimator
+ *
+ * This does not need the database, and does not decode the message.  The packet
+ * must be of the type that the decimator was initialized for.
+ *
+ * A time bucket decimator emits the previous bucket when a packet arrives in a
+ * different bucket, so the output lags by one bucket.  The output buffer is only
+ * used by time bucket decimators, and may be NULL otherwise.
+ *
+ * @param Decimator The decimator
+ * @param PackedData The packed message
+ * @param PackedSize The size of the packed message, in bytes
+ * @param Output Buffer to store a combined packet
+ * @param OutputSize Size of the output buffer on input, size of the combined packet on output
+ * @returns EDSLIB_DECIMATE_KEEP or EDSLIB_DECIMATE_DROP for the packet,
+ *          EDSLIB_DECIMATE_EMIT if a combined packet was written to the output buffer,
+ *          EDSLIB_DECIMATE_INVALID if the packet cannot be used
+ */
+EdsLib_DisplayDB_DecimateResult_t EdsLib_DisplayDB_Decimate(EdsLib_DisplayDB_Decimator_t *Decimator,
+        const void *PackedData, uint32_t PackedSize, void *Output, uint32_t *OutputSize);
+
+/**
+ * Emit the current time bucket of a decimator, even though it is not complete
+ *
+ * This is typically done at the end of a stream, or periodically if packets
+ * may stop arriving.  The next packet starts a new bucket.
+ *
+ * @param Decimator The decimator
+ * @param Output Buffer to store the combined packet
+ * @param OutputSize Size of the output buffer on input, size of the combined packet on output
+ * @returns EDSLIB_DECIMATE_EMIT if a combined packet was written to the output buffer,
+ *          EDSLIB_DECIMATE_DROP if there is no open bucket,
+ *          EDSLIB_DECIMATE_INVALID if the output buffer is too small
+ */
+EdsLib_DisplayDB_DecimateResult_t EdsLib_DisplayDB_FlushDecimator(EdsLib_DisplayDB_Decimator_t *Decimator,
+        void *Output, uint32_t *OutputSize);
+
 /**
  * Debugging utility function to write arbitrary data contents to the stdio stream as hexadecimal
  * The data is treated as a binary blob.
@@ -287,6 +849,60 @@ int32_t EdsLib_DisplayDB_LocateSubEntity(const EdsLib_DatabaseObject_t *GD, EdsL
  */
 void EdsLib_Generate_Hexdump(void *output, const uint8_t *DataPtr, uint16_t DisplayOffset, uint16_t Count);
 
+/**
+ * Format binary data as hexadecimal into a character buffer
+ *
+ * Each line shows the offset, up to EDSLIB_HEXDUMP_BYTES_PER_LINE bytes in hexadecimal,
+ * and the same bytes as printable characters, in the same layout as EdsLib_Generate_Hexdump().
+ *
+ * Only complete lines are written.  If the buffer is not large enough for all the data,
+ * the number of bytes that were formatted is returned via ConsumedBytes, and the call
+ * can be repeated for the remaining data.  The output is null terminated if space permits.
+ *
+ * @param OutputBuffer the buffer to store the output
+ * @param BufferSize the size of the buffer.  This must be at least EDSLIB_HEXDUMP_MAX_LINE_SIZE
+ *        to make any progress.
+ * @param DataPtr pointer to the block of data
+ * @param DisplayOffset the offset to show for the first byte in the data block.
+ * @param Count The number of bytes to display.
+ * @param ConsumedBytes buffer to store the number of bytes formatted (may be NULL)
+ * @returns The number of characters written, not including the terminator
+ */
+uint32_t EdsLib_Hexdump_FormatLines(char *OutputBuffer, uint32_t BufferSize, const uint8_t *DataPtr,
+        uint64_t DisplayOffset, uint64_t Count, uint64_t *ConsumedBytes);
+
+/**
+ * Write arbitrary data contents to the stdio stream as hexadecimal
+ *
+ * This is the same as EdsLib_Generate_Hexdump() but without the header line, and
+ * the offset and count are not limited to 16 bits.  The output is formatted in blocks
+ * and written with a single stdio call per block.
+ *
+ * @param output any valid STDIO output stream (e.g. stdout)
+ * @param DataPtr pointer to the block of data
+ * @param DisplayOffset the offset to show for the first byte in the data block.
+ * @param Count The number of bytes to display.
+ */
+void EdsLib_Hexdump_Write(void *output, const uint8_t *DataPtr, uint64_t DisplayOffset, uint64_t Count);
+
+/**
+ * Write a native object to the stdio stream as hexadecimal, with field boundaries
+ *
+ * Each field of the object starts on a new line, which is followed by the full name of
+ * the field from the DisplayDB.  Fields that are larger than one line continue on the
+ * following lines.  Bytes which are not part of any field, such as padding, are shown
+ * on separate lines without a name.
+ *
+ * @param output any valid STDIO output stream (e.g. stdout)
+ * @param GD the active EdsLib runtime database object
+ * @param EdsId the type of the object
+ * @param NativeObj pointer to the object in native format
+ * @param DisplayOffset the offset to show for the first byte of the object.
+ * @param Size The number of bytes to display.  Fields beyond this size are not shown.
+ */
+void EdsLib_Hexdump_WriteAnnotated(void *output, const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        const void *NativeObj, uint64_t DisplayOffset, uint32_t Size);
+
 
 /* **************************************************************************************
  * EDS BINARY <-> STRING CONVERTERS
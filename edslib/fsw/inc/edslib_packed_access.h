@@ -0,0 +1,233 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_packed_access.h
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Primitive routines to read and write a single value directly within
+ * a packed (EDS encoded) buffer.
+ *
+ * These are used by the generated field accessor headers, which call them
+ * with bit offsets and sizes that are fixed at code generation time.  All
+ * routines are implemented as inline functions and do not require the EDS
+ * database or the runtime library.
+ *
+ * Packed data is a bit stream where the first bit is the MSB of the first byte.
+ * Big endian numbers may start at any bit offset and have any size up to 64 bits.
+ * Little endian numbers must be byte aligned and a whole number of bytes.
+ */
+
+#ifndef _EDSLIB_PACKED_ACCESS_H_
+#define _EDSLIB_PACKED_ACCESS_H_
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Read a big endian number of up to 64 bits from a packed buffer
+ *
+ * @param Buf the packed buffer
+ * @param BitOffset offset of the first bit from the start of the buffer
+ * @param NumBits size of the number in bits (1-64)
+ * @returns the value, zero-extended
+ */
+static inline uint64_t EdsLib_PackedAccess_GetBitsBE(const uint8_t *Buf, uint32_t BitOffset, uint32_t NumBits)
+{
+    const uint8_t *Ptr = Buf + (BitOffset >> 3);
+    uint32_t AvailBits = 8 - (BitOffset & 0x7);
+    uint64_t Value;
+
+    Value = *Ptr & (0xFFU >> (8 - AvailBits));
+    if (NumBits <= AvailBits)
+    {
+        return Value >> (AvailBits - NumBits);
+    }
+
+    NumBits -= AvailBits;
+    while (NumBits >= 8)
+    {
+        ++Ptr;
+        Value = (Value << 8) | *Ptr;
+        NumBits -= 8;
+    }
+    if (NumBits > 0)
+    {
+        ++Ptr;
+        Value = (Value << NumBits) | (*Ptr >> (8 - NumBits));
+    }
+
+    return Value;
+}
+
+/**
+ * Write a big endian number of up to 64 bits into a packed buffer
+ *
+ * Bits in the buffer outside of the value are not modified.
+ *
+ * @param Buf the packed buffer
+ * @param BitOffset offset of the first bit from the start of the buffer
+ * @param NumBits size of the number in bits (1-64)
+ * @param Value the value to write, any bits above NumBits are ignored
+ */
+static inline void EdsLib_PackedAccess_SetBitsBE(uint8_t *Buf, uint32_t BitOffset, uint32_t NumBits, uint64_t Value)
+{
+    uint8_t *Ptr = Buf + (BitOffset >> 3);
+    uint32_t AvailBits = 8 - (BitOffset & 0x7);
+    uint8_t Mask;
+
+    Mask = 0xFFU >> (8 - AvailBits);
+    if (NumBits <= AvailBits)
+    {
+        Mask &= 0xFFU << (AvailBits - NumBits);
+        *Ptr = (*Ptr & ~Mask) | ((uint8_t)(Value << (AvailBits - NumBits)) & Mask);
+        return;
+    }
+
+    NumBits -= AvailBits;
+    *Ptr = (*Ptr & ~Mask) | ((uint8_t)(Value >> NumBits) & Mask);
+    while (NumBits >= 8)
+    {
+        ++Ptr;
+        NumBits -= 8;
+        *Ptr = (uint8_t)(Value >> NumBits);
+    }
+    if (NumBits > 0)
+    {
+        ++Ptr;
+        Mask = 0xFFU << (8 - NumBits);
+        *Ptr = (*Ptr & ~Mask) | ((uint8_t)(Value << (8 - NumBits)) & Mask);
+    }
+}
+
+/**
+ * Read a little endian number from a byte aligned location in a packed buffer
+ *
+ * @param Buf the packed buffer
+ * @param BitOffset offset of the first bit from the start of the buffer, multiple of 8
+ * @param NumBits size of the number in bits, multiple of 8 (8-64)
+ * @returns the value, zero-extended
+ */
+static inline uint64_t EdsLib_PackedAccess_GetBitsLE(const uint8_t *Buf, uint32_t BitOffset, uint32_t NumBits)
+{
+    const uint8_t *Ptr = Buf + (BitOffset >> 3);
+    uint32_t NumBytes = NumBits >> 3;
+    uint64_t Value = 0;
+
+    while (NumBytes > 0)
+    {
+        --NumBytes;
+        Value = (Value << 8) | Ptr[NumBytes];
+    }
+
+    return Value;
+}
+
+/**
+ * Write a little endian number to a byte aligned location in a packed buffer
+ *
+ * @param Buf the packed buffer
+ * @param BitOffset offset of the first bit from the start of the buffer, multiple of 8
+ * @param NumBits size of the number in bits, multiple of 8 (8-64)
+ * @param Value the value to write, any bits above NumBits are ignored
+ */
+static inline void EdsLib_PackedAccess_SetBitsLE(uint8_t *Buf, uint32_t BitOffset, uint32_t NumBits, uint64_t Value)
+{
+    uint8_t *Ptr = Buf + (BitOffset >> 3);
+    uint32_t NumBytes = NumBits >> 3;
+
+    while (NumBytes > 0)
+    {
+        *Ptr = (uint8_t)Value;
+        Value >>= 8;
+        ++Ptr;
+        --NumBytes;
+    }
+}
+
+/**
+ * Sign-extend a twos complement number that was read from a packed buffer
+ *
+ * @param Value the value from one of the "GetBits" routines
+ * @param NumBits size of the number in bits (1-64)
+ * @returns the signed value
+ */
+static inline int64_t EdsLib_PackedAccess_SignExtend(uint64_t Value, uint32_t NumBits)
+{
+    if (NumBits < 64 && ((Value >> (NumBits - 1)) & 1) != 0)
+    {
+        Value |= ~UINT64_C(0) << NumBits;
+    }
+
+    return (int64_t)Value;
+}
+
+/**
+ * Convert the bits of an IEEE-754 single precision value read from a packed buffer
+ */
+static inline float EdsLib_PackedAccess_ToFloat(uint64_t Value)
+{
+    uint32_t Bits = (uint32_t)Value;
+    float Result;
+
+    memcpy(&Result, &Bits, sizeof(Result));
+
+    return Result;
+}
+
+/**
+ * Convert a single precision value to IEEE-754 bits for writing into a packed buffer
+ */
+static inline uint64_t EdsLib_PackedAccess_FromFloat(float Value)
+{
+    uint32_t Bits;
+
+    memcpy(&Bits, &Value, sizeof(Bits));
+
+    return Bits;
+}
+
+/**
+ * Convert the bits of an IEEE-754 double precision value read from a packed buffer
+ */
+static inline double EdsLib_PackedAccess_ToDouble(uint64_t Value)
+{
+    double Result;
+
+    memcpy(&Result, &Value, sizeof(Result));
+
+    return Result;
+}
+
+/**
+ * Convert a double precision value to IEEE-754 bits for writing into a packed buffer
+ */
+static inline uint64_t EdsLib_PackedAccess_FromDouble(double Value)
+{
+    uint64_t Bits;
+
+    memcpy(&Bits, &Value, sizeof(Bits));
+
+    return Bits;
+}
+
+#endif  /* _EDSLIB_PACKED_ACCESS_H_ */
@@ -555,6 +555,39 @@ int32_t EdsLib_DataTypeDB_UnpackPartialObject(const EdsLib_DatabaseObject_t *GD,
     return PackState.Status;
 }
 
+int32_t EdsLib_DataTypeDB_InitPackArrayPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        uint32_t PackedStrideBits, uint32_t NativeStrideBytes, EdsLib_DataTypeDB_ArrayPlan_t *Plan)
+{
+    EdsLib_DatabaseRef_t RefObj;
+
+    EdsLib_Decode_StructId(&RefObj, EdsId);
+
+    return EdsLib_DataTypeArrayPlan_Build(GD, &RefObj, EDSLIB_BITPACK_OPERMODE_PACK, EDSLIB_ARRAYPLAN_MODE_NORMAL,
+            PackedStrideBits, NativeStrideBytes, Plan);
+}
+
+int32_t EdsLib_DataTypeDB_InitUnpackArrayPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        uint32_t NativeStrideBytes, uint32_t PackedStrideBits, EdsLib_DataTypeDB_ArrayPlan_t *Plan)
+{
+    EdsLib_DatabaseRef_t RefObj;
+
+    EdsLib_Decode_StructId(&RefObj, EdsId);
+
+    return EdsLib_DataTypeArrayPlan_Build(GD, &RefObj, EDSLIB_BITPACK_OPERMODE_UNPACK, EDSLIB_ARRAYPLAN_MODE_NORMAL,
+            PackedStrideBits, NativeStrideBytes, Plan);
+}
+
+int32_t EdsLib_DataTypeDB_ExecuteArrayPlan(const EdsLib_DataTypeDB_ArrayPlan_t *Plan,
+        void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects)
+{
+    if (Plan->BaseDictPtr == NULL)
+    {
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    return EdsLib_DataTypeArrayPlan_Execute(Plan, DestBuffer, SourceBuffer, NumObjects);
+}
+
 int32_t EdsLib_DataTypeDB_VerifyUnpackedObject(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
         void *UnpackedObj, const void *PackedObj, uint32_t RecomputeFields)
 {
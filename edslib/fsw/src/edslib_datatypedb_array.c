@@ -0,0 +1,69 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_datatypedb_array.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Single-call pack/unpack of object arrays.
+ *
+ * These build a temporary array plan on the stack for every call, which is
+ * convenient for tools but too large for constrained flight stacks.  Flight
+ * code should keep a plan from EdsLib_DataTypeDB_InitPackArrayPlan() or
+ * EdsLib_DataTypeDB_InitUnpackArrayPlan() instead.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <string.h>
+
+#include "edslib_internal.h"
+
+int32_t EdsLib_DataTypeDB_PackArray(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects, uint32_t PackedStrideBits, uint32_t NativeStrideBytes)
+{
+    EdsLib_DataTypeDB_ArrayPlan_t Plan;
+    int32_t Status;
+
+    Status = EdsLib_DataTypeDB_InitPackArrayPlan(GD, EdsId, PackedStrideBits, NativeStrideBytes, &Plan);
+    if (Status == EDSLIB_SUCCESS)
+    {
+        Status = EdsLib_DataTypeArrayPlan_Execute(&Plan, DestBuffer, SourceBuffer, NumObjects);
+    }
+
+    return Status;
+}
+
+int32_t EdsLib_DataTypeDB_UnpackArray(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects, uint32_t NativeStrideBytes, uint32_t PackedStrideBits)
+{
+    EdsLib_DataTypeDB_ArrayPlan_t Plan;
+    int32_t Status;
+
+    Status = EdsLib_DataTypeDB_InitUnpackArrayPlan(GD, EdsId, NativeStrideBytes, PackedStrideBits, &Plan);
+    if (Status == EDSLIB_SUCCESS)
+    {
+        Status = EdsLib_DataTypeArrayPlan_Execute(&Plan, DestBuffer, SourceBuffer, NumObjects);
+    }
+
+    return Status;
+}
@@ -0,0 +1,305 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_datatypedb_calibrate.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Converts arrays of raw values into engineering units using the
+ * polynomial and spline calibrators declared in the EDS.
+ *
+ * Values are processed in fixed size blocks: each block is first loaded
+ * into doubles using the same loaders as EdsLib_DataTypeDB_ConvertArray(),
+ * and the calibration
+ * is then applied to the whole block.  This keeps the inner loops free
+ * of type dispatch so that the compiler can vectorize them.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <string.h>
+#include "edslib_internal.h"
+
+/**
+ * Number of values converted per block.  This is the size of the
+ * temporary buffer on the stack, in doubles.
+ */
+#ifndef EDSLIB_CALIBRATE_BLOCK_SIZE
+#define EDSLIB_CALIBRATE_BLOCK_SIZE     64
+#endif
+
+/*
+ * Evaluate the polynomial using Horner's method, one coefficient at a time
+ * across the whole block, so each pass is a single multiply-add per value.
+ */
+static void EdsLib_Calibrate_Polynomial(const double *Coefficients, uint16_t NumCoefficients,
+        const double *X, double *Y, uint32_t Count)
+{
+    uint32_t Idx;
+    uint16_t Exp;
+    double Coeff;
+
+    Coeff = (NumCoefficients > 0) ? Coefficients[NumCoefficients - 1] : 0.0;
+    for (Idx = 0; Idx < Count; ++Idx)
+    {
+        Y[Idx] = Coeff;
+    }
+
+    for (Exp = NumCoefficients; Exp > 1; --Exp)
+    {
+        Coeff = Coefficients[Exp - 2];
+        for (Idx = 0; Idx < Count; ++Idx)
+        {
+            Y[Idx] = (Y[Idx] * X[Idx]) + Coeff;
+        }
+    }
+}
+
+/*
+ * Find the spline segment for the value, i.e. the last point
+ * that is not greater than X, limited to the range [0, NumPoints - 2]
+ */
+static uint16_t EdsLib_Calibrate_FindSegment(const double *RawPoints, uint16_t NumPoints, double X)
+{
+    uint16_t Low;
+    uint16_t High;
+    uint16_t Mid;
+
+    Low = 1;
+    High = NumPoints - 1;
+    while (Low < High)
+    {
+        Mid = Low + ((High - Low) / 2);
+        if (RawPoints[Mid] <= X)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+
+    return Low - 1;
+}
+
+/*
+ * Interpolate between spline points.  Array telemetry from a sensor bank is
+ * usually similar from one value to the next, so the segment used for the
+ * previous value is checked before searching.
+ */
+static void EdsLib_Calibrate_Spline(const EdsLib_DataTypeDB_Calibration_t *Calibration, uint16_t *SegmentHint,
+        const double *X, double *Y, uint32_t Count)
+{
+    const double *RawPoints = Calibration->RawPoints;
+    const double *CalPoints = Calibration->Values;
+    uint16_t LastPoint = Calibration->NumPoints - 1;
+    uint16_t Seg;
+    uint32_t Idx;
+    double Value;
+
+    Seg = *SegmentHint;
+    for (Idx = 0; Idx < Count; ++Idx)
+    {
+        Value = X[Idx];
+
+        if (LastPoint == 0)
+        {
+            Y[Idx] = CalPoints[0];
+            continue;
+        }
+
+        if (!(Value >= RawPoints[Seg] && Value < RawPoints[Seg + 1]))
+        {
+            Seg = EdsLib_Calibrate_FindSegment(RawPoints, Calibration->NumPoints, Value);
+        }
+
+        if (Value < RawPoints[0] && (!Calibration->Extrapolate || Calibration->Order == 0))
+        {
+            Y[Idx] = CalPoints[0];
+        }
+        else if (Value > RawPoints[LastPoint] && (!Calibration->Extrapolate || Calibration->Order == 0))
+        {
+            Y[Idx] = CalPoints[LastPoint];
+        }
+        else if (Calibration->Order == 0)
+        {
+            Y[Idx] = (Value >= RawPoints[Seg + 1]) ? CalPoints[Seg + 1] : CalPoints[Seg];
+        }
+        else
+        {
+            Y[Idx] = CalPoints[Seg] + ((Value - RawPoints[Seg]) * (CalPoints[Seg + 1] - CalPoints[Seg]) /
+                    (RawPoints[Seg + 1] - RawPoints[Seg]));
+        }
+    }
+
+    *SegmentHint = Seg;
+}
+
+int32_t EdsLib_DataTypeDB_GetMemberCalibration(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, uint16_t SubIndex,
+        EdsLib_DataTypeDB_Calibration_t *Calibration)
+{
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    const EdsLib_FieldDetailEntry_t *EntryPtr;
+    const EdsLib_CalibrationDescriptor_t *CalPtr;
+    EdsLib_DatabaseRef_t TempRef;
+
+    memset(Calibration, 0, sizeof(*Calibration));
+
+    EdsLib_Decode_StructId(&TempRef, EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &TempRef);
+    if (DataDictPtr == NULL || DataDictPtr->BasicType != EDSLIB_BASICTYPE_CONTAINER)
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    if (SubIndex >= DataDictPtr->NumSubElements)
+    {
+        return EDSLIB_INVALID_INDEX;
+    }
+
+    EntryPtr = &DataDictPtr->Detail.Container->EntryList[SubIndex];
+    if (EntryPtr->EntryType != EDSLIB_ENTRYTYPE_CONTAINER_ENTRY || EntryPtr->HandlerArg.Calibration == NULL)
+    {
+        return EDSLIB_NO_MATCHING_VALUE;
+    }
+
+    CalPtr = EntryPtr->HandlerArg.Calibration;
+    Calibration->CalibrationType = CalPtr->CalibrationType;
+    Calibration->Order = CalPtr->Order;
+    Calibration->Extrapolate = CalPtr->Extrapolate;
+    Calibration->NumPoints = CalPtr->NumPoints;
+    if (CalPtr->CalibrationType == EDSLIB_CALIBRATIONTYPE_POLYNOMIAL)
+    {
+        Calibration->Values = CalPtr->Coefficients;
+    }
+    else
+    {
+        Calibration->RawPoints = CalPtr->RawPoints;
+        Calibration->Values = CalPtr->CalibratedPoints;
+    }
+    Calibration->Offset = EntryPtr->Offset;
+    Calibration->NumValues = 1;
+
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &EntryPtr->RefObj);
+    if (DataDictPtr != NULL && DataDictPtr->BasicType == EDSLIB_BASICTYPE_ARRAY && DataDictPtr->NumSubElements > 0)
+    {
+        /* the calibration applies to each element of the array */
+        Calibration->NumValues = DataDictPtr->NumSubElements;
+        Calibration->RawStride = DataDictPtr->SizeInfo.Bytes / DataDictPtr->NumSubElements;
+        DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &DataDictPtr->Detail.Array->ElementRefObj);
+    }
+
+    if (DataDictPtr == NULL)
+    {
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    Calibration->RawType = DataDictPtr->BasicType;
+    Calibration->RawSize = DataDictPtr->SizeInfo.Bytes;
+    if (Calibration->RawStride == 0)
+    {
+        Calibration->RawStride = Calibration->RawSize;
+    }
+
+    if (Calibration->RawType != EDSLIB_BASICTYPE_SIGNED_INT &&
+            Calibration->RawType != EDSLIB_BASICTYPE_UNSIGNED_INT &&
+            Calibration->RawType != EDSLIB_BASICTYPE_FLOAT)
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    return EDSLIB_SUCCESS;
+}
+
+int32_t EdsLib_DataTypeDB_CalibrateArray(const EdsLib_DataTypeDB_Calibration_t *Calibration, const void *RawValues,
+        uint32_t NumValues, double *EuValues)
+{
+    double X[EDSLIB_CALIBRATE_BLOCK_SIZE];
+    const uint8_t *Src;
+    uint32_t Stride;
+    uint32_t Count;
+    uint16_t SegmentHint;
+
+    if (!EdsLib_DataTypeConvert_IsNumeric(Calibration->RawType, Calibration->RawSize))
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    switch(Calibration->CalibrationType)
+    {
+    case EDSLIB_CALIBRATIONTYPE_NONE:
+    case EDSLIB_CALIBRATIONTYPE_POLYNOMIAL:
+        break;
+    case EDSLIB_CALIBRATIONTYPE_SPLINE:
+        if (Calibration->NumPoints == 0)
+        {
+            return EDSLIB_INCOMPLETE_DB_OBJECT;
+        }
+        if (Calibration->Order > 1)
+        {
+            return EDSLIB_NOT_IMPLEMENTED;
+        }
+        break;
+    default:
+        return EDSLIB_NOT_IMPLEMENTED;
+    }
+
+    Src = RawValues;
+    Stride = Calibration->RawStride;
+    if (Stride == 0)
+    {
+        Stride = Calibration->RawSize;
+    }
+    SegmentHint = 0;
+
+    while (NumValues > 0)
+    {
+        Count = NumValues;
+        if (Count > EDSLIB_CALIBRATE_BLOCK_SIZE)
+        {
+            Count = EDSLIB_CALIBRATE_BLOCK_SIZE;
+        }
+
+        switch(Calibration->CalibrationType)
+        {
+        case EDSLIB_CALIBRATIONTYPE_POLYNOMIAL:
+            EdsLib_DataTypeConvert_LoadFloatBlock(Calibration->RawType, Calibration->RawSize, Src, Stride, X, Count);
+            EdsLib_Calibrate_Polynomial(Calibration->Values, Calibration->NumPoints, X, EuValues, Count);
+            break;
+        case EDSLIB_CALIBRATIONTYPE_SPLINE:
+            EdsLib_DataTypeConvert_LoadFloatBlock(Calibration->RawType, Calibration->RawSize, Src, Stride, X, Count);
+            EdsLib_Calibrate_Spline(Calibration, &SegmentHint, X, EuValues, Count);
+            break;
+        default:
+            /* no calibration, the raw values are loaded directly into the output */
+            EdsLib_DataTypeConvert_LoadFloatBlock(Calibration->RawType, Calibration->RawSize, Src, Stride, EuValues, Count);
+            break;
+        }
+
+        Src += Count * Stride;
+        EuValues += Count;
+        NumValues -= Count;
+    }
+
+    return EDSLIB_SUCCESS;
+}
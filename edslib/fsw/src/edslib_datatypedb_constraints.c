@@ -152,13 +152,33 @@ int32_t EdsLib_DataTypeDB_ConstraintIterator_Impl(const EdsLib_DatabaseObject_t
     return EDSLIB_SUCCESS;
 }
 
+/*
+ * Loads a constraint entity value from a native object buffer
+ */
+static void EdsLib_DataTypeIdentify_LoadNative(const EdsLib_DatabaseObject_t *GD, EdsLib_GenericValueBuffer_t *ValueBuff,
+        const EdsLib_ConstraintEntity_t *Location, uint16_t EntityIdx, const void *Arg)
+{
+    EdsLib_ConstPtr_t DataPtr;
+
+    (void)EntityIdx;
+
+    DataPtr.Ptr = Arg;
+    DataPtr.Addr += Location->Offset.Bytes;
+    EdsLib_DataTypeLoad_Impl(ValueBuff, DataPtr, EdsLib_DataTypeDB_GetEntry(GD, &Location->RefObj));
+}
+
 int32_t EdsLib_DataTypeIdentifyBuffer_Impl(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_Entry_t *DataDictPtr, const void *Buffer, uint16_t *DerivTableIndex, EdsLib_DatabaseRef_t *ActualObj)
+{
+    return EdsLib_DataTypeIdentify_Impl(GD, DataDictPtr, EdsLib_DataTypeIdentify_LoadNative, Buffer, DerivTableIndex, ActualObj);
+}
+
+int32_t EdsLib_DataTypeIdentify_Impl(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_Entry_t *DataDictPtr,
+        EdsLib_IdentifyLoadFunc_t LoadFunc, const void *LoadArg, uint16_t *DerivTableIndex, EdsLib_DatabaseRef_t *ActualObj)
 {
     const EdsLib_ValueEntry_t *SelectedEntry;
     const EdsLib_ConstraintEntity_t *SelectedLocation;
     const EdsLib_ContainerDescriptor_t *DerivedContainerDesc;
     const EdsLib_IdentSequenceEntry_t *IdentSequencePtr;
-    EdsLib_ConstPtr_t DataPtr;
     EdsLib_GenericValueBuffer_t ValueBuff;
     intmax_t CompareResult;
     int32_t Status;
@@ -171,6 +191,7 @@ int32_t EdsLib_DataTypeIdentifyBuffer_Impl(const EdsLib_DatabaseObject_t *GD, co
     DerivedContainerDesc = DataDictPtr->Detail.Container;
 
     Status = EDSLIB_NO_MATCHING_VALUE;
+    ValueBuff.ValueType = EDSLIB_BASICTYPE_NONE;
     if (DerivedContainerDesc->IdentSequenceList != NULL)
     {
         IdentSequencePtr = &DerivedContainerDesc->IdentSequenceList[DerivedContainerDesc->IdentSequenceBase];
@@ -200,9 +221,7 @@ int32_t EdsLib_DataTypeIdentifyBuffer_Impl(const EdsLib_DatabaseObject_t *GD, co
             else if (IdentSequencePtr->EntryType == EDSLIB_IDENT_SEQUENCE_ENTITY_LOCATION)
             {
                 SelectedLocation = &DerivedContainerDesc->ConstraintEntityList[IdentSequencePtr->RefIdx];
-                DataPtr.Ptr = Buffer;
-                DataPtr.Addr += SelectedLocation->Offset.Bytes;
-                EdsLib_DataTypeLoad_Impl(&ValueBuff, DataPtr, EdsLib_DataTypeDB_GetEntry(GD, &SelectedLocation->RefObj));
+                LoadFunc(GD, &ValueBuff, SelectedLocation, IdentSequencePtr->RefIdx, LoadArg);
                 if (ValueBuff.ValueType != EDSLIB_BASICTYPE_NONE)
                 {
                     CompareResult = 0;
@@ -0,0 +1,419 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_datatypedb_convert.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Converts many numeric values from their native EDS type into a plain
+ * C array of another numeric type, following the same rules as
+ * EdsLib_DataTypeConvert() for each value.
+ *
+ * Rather than one loop for every combination of source and destination
+ * type, values are converted in blocks through an intermediate of either
+ * intmax_t (integer to integer) or double (anything involving a float).
+ * Each load and store loop is specific to one C type and reads
+ * consecutive values when possible, which allows the compiler to use
+ * vector instructions for the widening and narrowing.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <string.h>
+#include "edslib_internal.h"
+
+/**
+ * Number of values converted per block.  This is the size of the
+ * temporary buffer on the stack, in intmax_t or double values.
+ */
+#ifndef EDSLIB_CONVERT_BLOCK_SIZE
+#define EDSLIB_CONVERT_BLOCK_SIZE       64
+#endif
+
+/*
+ * Load a block of values of one C type, with a separate loop for the
+ * common case of consecutive values so that it can be vectorized.
+ */
+#define EDSLIB_CONVERT_LOAD_LOOP(type, desttype)                        \
+    if (Stride == sizeof(type))                                         \
+    {                                                                   \
+        for (Idx = 0; Idx < Count; ++Idx)                               \
+        {                                                               \
+            type Value;                                                 \
+            memcpy(&Value, &Src[Idx * sizeof(type)], sizeof(Value));    \
+            Dest[Idx] = (desttype)Value;                                \
+        }                                                               \
+    }                                                                   \
+    else                                                                \
+    {                                                                   \
+        for (Idx = 0; Idx < Count; ++Idx)                               \
+        {                                                               \
+            type Value;                                                 \
+            memcpy(&Value, Src, sizeof(Value));                         \
+            Dest[Idx] = (desttype)Value;                                \
+            Src += Stride;                                              \
+        }                                                               \
+    }
+
+#define EDSLIB_CONVERT_STORE_LOOP(type, via)                            \
+    for (Idx = 0; Idx < Count; ++Idx)                                   \
+    {                                                                   \
+        type Value = (type)(via)Src[Idx];                               \
+        memcpy(&Dest[Idx * sizeof(type)], &Value, sizeof(Value));       \
+    }
+
+bool EdsLib_DataTypeConvert_IsNumeric(EdsLib_BasicType_t Type, uint32_t Size)
+{
+    switch(Type)
+    {
+    case EDSLIB_BASICTYPE_SIGNED_INT:
+    case EDSLIB_BASICTYPE_UNSIGNED_INT:
+        return (Size == 1 || Size == 2 || Size == 4 || Size == 8);
+    case EDSLIB_BASICTYPE_FLOAT:
+#ifdef EDSLIB_HAVE_LONG_DOUBLE
+        if (Size == sizeof(long double))
+        {
+            return true;
+        }
+#endif
+        return (Size == sizeof(float) || Size == sizeof(double));
+    default:
+        break;
+    }
+
+    return false;
+}
+
+void EdsLib_DataTypeConvert_LoadFloatBlock(EdsLib_BasicType_t SrcType, uint32_t SrcSize, const uint8_t *Src,
+        uint32_t Stride, double *Dest, uint32_t Count)
+{
+    uint32_t Idx;
+
+    if (SrcType == EDSLIB_BASICTYPE_FLOAT)
+    {
+        /* double is checked before long double in case they are the same size */
+        if (SrcSize == sizeof(float))
+        {
+            EDSLIB_CONVERT_LOAD_LOOP(float, double)
+        }
+        else if (SrcSize == sizeof(double))
+        {
+            EDSLIB_CONVERT_LOAD_LOOP(double, double)
+        }
+#ifdef EDSLIB_HAVE_LONG_DOUBLE
+        else
+        {
+            EDSLIB_CONVERT_LOAD_LOOP(long double, double)
+        }
+#endif
+    }
+    else if (SrcType == EDSLIB_BASICTYPE_SIGNED_INT)
+    {
+        switch(SrcSize)
+        {
+        case 1:
+            EDSLIB_CONVERT_LOAD_LOOP(int8_t, double)
+            break;
+        case 2:
+            EDSLIB_CONVERT_LOAD_LOOP(int16_t, double)
+            break;
+        case 4:
+            EDSLIB_CONVERT_LOAD_LOOP(int32_t, double)
+            break;
+        default:
+            EDSLIB_CONVERT_LOAD_LOOP(int64_t, double)
+            break;
+        }
+    }
+    else
+    {
+        switch(SrcSize)
+        {
+        case 1:
+            EDSLIB_CONVERT_LOAD_LOOP(uint8_t, double)
+            break;
+        case 2:
+            EDSLIB_CONVERT_LOAD_LOOP(uint16_t, double)
+            break;
+        case 4:
+            EDSLIB_CONVERT_LOAD_LOOP(uint32_t, double)
+            break;
+        default:
+            EDSLIB_CONVERT_LOAD_LOOP(uint64_t, double)
+            break;
+        }
+    }
+}
+
+/*
+ * Load integers, sign or zero extended according to the source type.
+ * Unsigned 64-bit values above INTMAX_MAX wrap, which is undone when stored.
+ */
+static void EdsLib_DataTypeConvert_LoadIntegerBlock(EdsLib_BasicType_t SrcType, uint32_t SrcSize, const uint8_t *Src,
+        uint32_t Stride, intmax_t *Dest, uint32_t Count)
+{
+    uint32_t Idx;
+
+    if (SrcType == EDSLIB_BASICTYPE_SIGNED_INT)
+    {
+        switch(SrcSize)
+        {
+        case 1:
+            EDSLIB_CONVERT_LOAD_LOOP(int8_t, intmax_t)
+            break;
+        case 2:
+            EDSLIB_CONVERT_LOAD_LOOP(int16_t, intmax_t)
+            break;
+        case 4:
+            EDSLIB_CONVERT_LOAD_LOOP(int32_t, intmax_t)
+            break;
+        default:
+            EDSLIB_CONVERT_LOAD_LOOP(int64_t, intmax_t)
+            break;
+        }
+    }
+    else
+    {
+        switch(SrcSize)
+        {
+        case 1:
+            EDSLIB_CONVERT_LOAD_LOOP(uint8_t, intmax_t)
+            break;
+        case 2:
+            EDSLIB_CONVERT_LOAD_LOOP(uint16_t, intmax_t)
+            break;
+        case 4:
+            EDSLIB_CONVERT_LOAD_LOOP(uint32_t, intmax_t)
+            break;
+        default:
+            EDSLIB_CONVERT_LOAD_LOOP(uint64_t, intmax_t)
+            break;
+        }
+    }
+}
+
+static void EdsLib_DataTypeConvert_StoreIntegerBlock(EdsLib_BasicType_t DestType, uint32_t DestSize, uint8_t *Dest,
+        const intmax_t *Src, uint32_t Count)
+{
+    uint32_t Idx;
+
+    switch(EDSLIB_TYPE_AND_SIZE(DestSize, DestType))
+    {
+    case EDSLIB_TYPE_AND_SIZE(1, EDSLIB_BASICTYPE_SIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(int8_t, intmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(2, EDSLIB_BASICTYPE_SIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(int16_t, intmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(4, EDSLIB_BASICTYPE_SIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(int32_t, intmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(8, EDSLIB_BASICTYPE_SIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(int64_t, intmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(1, EDSLIB_BASICTYPE_UNSIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(uint8_t, intmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(2, EDSLIB_BASICTYPE_UNSIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(uint16_t, intmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(4, EDSLIB_BASICTYPE_UNSIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(uint32_t, intmax_t)
+        break;
+    default:
+        EDSLIB_CONVERT_STORE_LOOP(uint64_t, intmax_t)
+        break;
+    }
+}
+
+/*
+ * Store values from a floating point block.  Integers are converted via
+ * intmax_t or uintmax_t, the same as EdsLib_DataTypeConvert() does.
+ */
+static void EdsLib_DataTypeConvert_StoreFloatBlock(EdsLib_BasicType_t DestType, uint32_t DestSize, uint8_t *Dest,
+        const double *Src, uint32_t Count)
+{
+    uint32_t Idx;
+
+    switch(EDSLIB_TYPE_AND_SIZE(DestSize, DestType))
+    {
+    case EDSLIB_TYPE_AND_SIZE(1, EDSLIB_BASICTYPE_SIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(int8_t, intmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(2, EDSLIB_BASICTYPE_SIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(int16_t, intmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(4, EDSLIB_BASICTYPE_SIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(int32_t, intmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(8, EDSLIB_BASICTYPE_SIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(int64_t, intmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(1, EDSLIB_BASICTYPE_UNSIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(uint8_t, uintmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(2, EDSLIB_BASICTYPE_UNSIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(uint16_t, uintmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(4, EDSLIB_BASICTYPE_UNSIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(uint32_t, uintmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(8, EDSLIB_BASICTYPE_UNSIGNED_INT):
+        EDSLIB_CONVERT_STORE_LOOP(uint64_t, uintmax_t)
+        break;
+    case EDSLIB_TYPE_AND_SIZE(sizeof(float), EDSLIB_BASICTYPE_FLOAT):
+        EDSLIB_CONVERT_STORE_LOOP(float, double)
+        break;
+    default:
+        if (DestSize == sizeof(double))
+        {
+            memcpy(Dest, Src, Count * sizeof(double));
+        }
+#ifdef EDSLIB_HAVE_LONG_DOUBLE
+        else
+        {
+            EDSLIB_CONVERT_STORE_LOOP(long double, double)
+        }
+#endif
+        break;
+    }
+}
+
+/*
+ * Convert a run of values that are all the same distance apart
+ */
+static void EdsLib_DataTypeConvert_Run(EdsLib_BasicType_t SrcType, uint32_t SrcSize, const uint8_t *Src, uint32_t SrcStride,
+        EdsLib_BasicType_t DestType, uint32_t DestSize, uint8_t *Dest, uint32_t NumValues)
+{
+    union
+    {
+        intmax_t Integer[EDSLIB_CONVERT_BLOCK_SIZE];
+        double FloatingPoint[EDSLIB_CONVERT_BLOCK_SIZE];
+    } Block;
+    uint32_t Count;
+    bool IntegerPath;
+
+    IntegerPath = (SrcType != EDSLIB_BASICTYPE_FLOAT && DestType != EDSLIB_BASICTYPE_FLOAT);
+
+    while (NumValues > 0)
+    {
+        Count = NumValues;
+        if (Count > EDSLIB_CONVERT_BLOCK_SIZE)
+        {
+            Count = EDSLIB_CONVERT_BLOCK_SIZE;
+        }
+
+        if (IntegerPath)
+        {
+            EdsLib_DataTypeConvert_LoadIntegerBlock(SrcType, SrcSize, Src, SrcStride, Block.Integer, Count);
+            EdsLib_DataTypeConvert_StoreIntegerBlock(DestType, DestSize, Dest, Block.Integer, Count);
+        }
+        else
+        {
+            EdsLib_DataTypeConvert_LoadFloatBlock(SrcType, SrcSize, Src, SrcStride, Block.FloatingPoint, Count);
+            EdsLib_DataTypeConvert_StoreFloatBlock(DestType, DestSize, Dest, Block.FloatingPoint, Count);
+        }
+
+        Src += Count * SrcStride;
+        Dest += Count * DestSize;
+        NumValues -= Count;
+    }
+}
+
+int32_t EdsLib_DataTypeDB_ConvertArray(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_BasicType_t DestType, uint32_t DestSize, void *DestBuffer, uint32_t DestBufferSize,
+        const void *SrcPtr, uint32_t SrcStride, uint32_t NumObjects)
+{
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    EdsLib_DatabaseRef_t TempRef;
+    const uint8_t *Src;
+    uint8_t *Dest;
+    uint32_t ObjectSize;
+    uint32_t ValuesPerObject;
+    uint32_t ValueStride;
+
+    EdsLib_Decode_StructId(&TempRef, EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &TempRef);
+    if (DataDictPtr == NULL)
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    ObjectSize = DataDictPtr->SizeInfo.Bytes;
+    ValuesPerObject = 1;
+
+    /* arrays, including multi-dimensional arrays, are flattened into consecutive values */
+    while (DataDictPtr != NULL && DataDictPtr->BasicType == EDSLIB_BASICTYPE_ARRAY)
+    {
+        if (DataDictPtr->NumSubElements == 0)
+        {
+            return EDSLIB_INVALID_SIZE_OR_TYPE;
+        }
+        ValuesPerObject *= DataDictPtr->NumSubElements;
+        DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &DataDictPtr->Detail.Array->ElementRefObj);
+    }
+
+    if (DataDictPtr == NULL)
+    {
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    if (!EdsLib_DataTypeConvert_IsNumeric(DataDictPtr->BasicType, DataDictPtr->SizeInfo.Bytes) ||
+            !EdsLib_DataTypeConvert_IsNumeric(DestType, DestSize))
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    if (((uint64_t)NumObjects * ValuesPerObject * DestSize) > DestBufferSize)
+    {
+        return EDSLIB_BUFFER_SIZE_ERROR;
+    }
+
+    if (SrcStride == 0)
+    {
+        SrcStride = ObjectSize;
+    }
+
+    ValueStride = ObjectSize / ValuesPerObject;
+    Src = SrcPtr;
+    Dest = DestBuffer;
+
+    if (ValuesPerObject == 1)
+    {
+        /* scalars are a single run, one value per object */
+        EdsLib_DataTypeConvert_Run(DataDictPtr->BasicType, DataDictPtr->SizeInfo.Bytes, Src, SrcStride,
+                DestType, DestSize, Dest, NumObjects);
+    }
+    else
+    {
+        while (NumObjects > 0)
+        {
+            EdsLib_DataTypeConvert_Run(DataDictPtr->BasicType, DataDictPtr->SizeInfo.Bytes, Src, ValueStride,
+                    DestType, DestSize, Dest, ValuesPerObject);
+            Src += SrcStride;
+            Dest += ValuesPerObject * DestSize;
+            --NumObjects;
+        }
+    }
+
+    return EDSLIB_SUCCESS;
+}
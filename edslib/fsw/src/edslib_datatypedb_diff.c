@@ -0,0 +1,268 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_datatypedb_diff.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Finds the leaf fields that differ between two native objects of the
+ * same type, i.e. for change-only telemetry displays and archiving.
+ *
+ * The leaf fields of the type are resolved once into a flat table, and
+ * adjacent fields are grouped into runs.  Comparing two objects is then
+ * one memcmp() per run, with individual fields only compared within runs
+ * that are not identical.  Consecutive samples of telemetry usually have
+ * few changes, so most runs are skipped after the block compare.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <string.h>
+#include "edslib_internal.h"
+
+/**
+ * The largest run of adjacent fields that is compared as one block, in bytes.
+ * Smaller runs need fewer individual field compares when a run has changed,
+ * larger runs need fewer block compares when nothing has changed.
+ */
+#ifndef EDSLIB_DIFF_RUN_SIZE
+#define EDSLIB_DIFF_RUN_SIZE            64
+#endif
+
+typedef struct
+{
+    EdsLib_DataTypeDB_Differ_t *Differ;
+    int32_t Status;
+} EdsLib_Differ_ControlBlock_t;
+
+static EdsLib_Iterator_Rc_t EdsLib_Differ_Callback(const EdsLib_DatabaseObject_t *GD,
+        EdsLib_Iterator_CbType_t CbType,
+        const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
+        void *OpaqueArg)
+{
+    EdsLib_Differ_ControlBlock_t *CtlBlock = (EdsLib_Differ_ControlBlock_t *)OpaqueArg;
+    EdsLib_DataTypeDB_Differ_t *Differ = CtlBlock->Differ;
+    EdsLib_DataTypeDB_DiffField_t *Field;
+
+    (void)GD;
+
+    if (CbType != EDSLIB_ITERATOR_CBTYPE_MEMBER || CbInfo->DataDictPtr == NULL ||
+            CbInfo->Details.EntryType == EDSLIB_ENTRYTYPE_CONTAINER_PADDING_ENTRY)
+    {
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    if (CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_CONTAINER ||
+            CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_ARRAY)
+    {
+        return EDSLIB_ITERATOR_RC_DESCEND;
+    }
+
+    if (CbInfo->DataDictPtr->SizeInfo.Bytes == 0)
+    {
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    if (Differ->NumFields >= EDSLIB_DIFF_MAX_FIELDS)
+    {
+        CtlBlock->Status = EDSLIB_INSUFFICIENT_MEMORY;
+        return EDSLIB_ITERATOR_RC_STOP;
+    }
+
+    Field = &Differ->Fields[Differ->NumFields];
+    Field->Offset = CbInfo->StartOffset;
+    Field->Size = CbInfo->DataDictPtr->SizeInfo.Bytes;
+    Field->EdsId = EdsLib_Encode_StructId(&CbInfo->Details.RefObj);
+    ++Differ->NumFields;
+
+    return EDSLIB_ITERATOR_RC_CONTINUE;
+}
+
+/*
+ * Group the fields into runs.  The fields are visited in offset order, so each
+ * run is extended until adding the next field would exceed the run size limit.
+ * Any padding between the fields of a run is part of the block compare, but
+ * is not reported because the fields are compared individually after that.
+ */
+static void EdsLib_Differ_BuildRuns(EdsLib_DataTypeDB_Differ_t *Differ)
+{
+    EdsLib_DataTypeDB_DiffRun_t *Run;
+    const EdsLib_DataTypeDB_DiffField_t *Field;
+    uint32_t FieldEnd;
+    uint16_t FieldIdx;
+
+    Run = NULL;
+    for (FieldIdx = 0; FieldIdx < Differ->NumFields; ++FieldIdx)
+    {
+        Field = &Differ->Fields[FieldIdx];
+        FieldEnd = Field->Offset.Bytes + Field->Size;
+
+        if (Run != NULL && Field->Offset.Bytes >= Run->Offset &&
+                (FieldEnd - Run->Offset) <= EDSLIB_DIFF_RUN_SIZE)
+        {
+            if (FieldEnd > (Run->Offset + Run->Size))
+            {
+                Run->Size = FieldEnd - Run->Offset;
+            }
+            ++Run->NumFields;
+        }
+        else
+        {
+            Run = &Differ->Runs[Differ->NumRuns];
+            Run->Offset = Field->Offset.Bytes;
+            Run->Size = Field->Size;
+            Run->FirstField = FieldIdx;
+            Run->NumFields = 1;
+            ++Differ->NumRuns;
+        }
+    }
+}
+
+int32_t EdsLib_DataTypeDB_InitDiffer(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DataTypeDB_Differ_t *Differ)
+{
+    EdsLib_Differ_ControlBlock_t CtlBlock;
+    EdsLib_DatabaseRef_t TempRef;
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    int32_t Status;
+
+    EDSLIB_DECLARE_ITERATOR_CB(IteratorState,
+            EDSLIB_ITERATOR_MAX_DEEP_DEPTH,
+            EdsLib_Differ_Callback,
+            &CtlBlock);
+
+    memset(Differ, 0, sizeof(*Differ));
+    Differ->EdsId = EdsId;
+
+    EdsLib_Decode_StructId(&TempRef, EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &TempRef);
+    if (DataDictPtr == NULL)
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    Differ->NativeSize = DataDictPtr->SizeInfo.Bytes;
+
+    memset(&CtlBlock, 0, sizeof(CtlBlock));
+    CtlBlock.Differ = Differ;
+    CtlBlock.Status = EDSLIB_SUCCESS;
+
+    if (DataDictPtr->BasicType == EDSLIB_BASICTYPE_CONTAINER || DataDictPtr->BasicType == EDSLIB_BASICTYPE_ARRAY)
+    {
+        EDSLIB_RESET_ITERATOR_FROM_REFOBJ(IteratorState, TempRef);
+        Status = EdsLib_DataTypeIterator_Impl(GD, &IteratorState.Cb);
+        if (Status == EDSLIB_SUCCESS)
+        {
+            Status = CtlBlock.Status;
+        }
+    }
+    else
+    {
+        /* a scalar type is a single field */
+        Differ->Fields[0].Size = Differ->NativeSize;
+        Differ->Fields[0].EdsId = EdsId;
+        Differ->NumFields = (Differ->NativeSize > 0);
+        Status = EDSLIB_SUCCESS;
+    }
+
+    if (Status != EDSLIB_SUCCESS)
+    {
+        Differ->NumFields = 0;
+        return Status;
+    }
+
+    EdsLib_Differ_BuildRuns(Differ);
+
+    return EDSLIB_SUCCESS;
+}
+
+int32_t EdsLib_DataTypeDB_DiffObjects(const EdsLib_DataTypeDB_Differ_t *Differ, const void *NativeObj1,
+        const void *NativeObj2, uint32_t NativeSize, EdsLib_DataTypeDB_DiffResult_t *Result)
+{
+    const EdsLib_DataTypeDB_DiffRun_t *Run;
+    const EdsLib_DataTypeDB_DiffField_t *Field;
+    const uint8_t *Ptr1;
+    const uint8_t *Ptr2;
+    uint16_t RunIdx;
+    uint16_t FieldIdx;
+    uint16_t EndIdx;
+
+    memset(Result, 0, sizeof(*Result));
+    Result->NumFields = Differ->NumFields;
+
+    if (NativeSize < Differ->NativeSize)
+    {
+        return EDSLIB_BUFFER_SIZE_ERROR;
+    }
+
+    Ptr1 = NativeObj1;
+    Ptr2 = NativeObj2;
+    for (RunIdx = 0; RunIdx < Differ->NumRuns; ++RunIdx)
+    {
+        Run = &Differ->Runs[RunIdx];
+        if (memcmp(&Ptr1[Run->Offset], &Ptr2[Run->Offset], Run->Size) == 0)
+        {
+            continue;
+        }
+
+        EndIdx = Run->FirstField + Run->NumFields;
+        for (FieldIdx = Run->FirstField; FieldIdx < EndIdx; ++FieldIdx)
+        {
+            Field = &Differ->Fields[FieldIdx];
+            if (memcmp(&Ptr1[Field->Offset.Bytes], &Ptr2[Field->Offset.Bytes], Field->Size) != 0)
+            {
+                Result->ChangedMask[FieldIdx / 32] |= ((uint32_t)1) << (FieldIdx & 31);
+                ++Result->NumChanged;
+            }
+        }
+    }
+
+    return EDSLIB_SUCCESS;
+}
+
+int32_t EdsLib_DataTypeDB_GetDiffFieldInfo(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_Differ_t *Differ,
+        uint16_t FieldIdx, EdsLib_DataTypeDB_EntityInfo_t *MemberInfo)
+{
+    const EdsLib_DataTypeDB_DiffField_t *Field;
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    EdsLib_DatabaseRef_t TempRef;
+
+    memset(MemberInfo, 0, sizeof(*MemberInfo));
+
+    if (FieldIdx >= Differ->NumFields)
+    {
+        return EDSLIB_INVALID_INDEX;
+    }
+
+    Field = &Differ->Fields[FieldIdx];
+    MemberInfo->EdsId = Field->EdsId;
+    MemberInfo->Offset = Field->Offset;
+
+    EdsLib_Decode_StructId(&TempRef, Field->EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &TempRef);
+    if (DataDictPtr != NULL)
+    {
+        MemberInfo->MaxSize = DataDictPtr->SizeInfo;
+    }
+
+    return EDSLIB_SUCCESS;
+}
@@ -0,0 +1,317 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_datatypedb_hash.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Computes a hash of the logical content of a native object, i.e. for
+ * de-duplication of archived data and for detecting changed tables.
+ *
+ * The object type is resolved once into the same plan as the array pack
+ * functions, and for each object every field is packed into a small local
+ * buffer and added to the hash as a stream of bits.  The result is the same as hashing the
+ * complete packed object, without needing a buffer for it.
+ *
+ * The bits are collected into 64-bit big endian words, and each word is
+ * mixed into two 64-bit lanes using multiply/rotate rounds.  The final
+ * avalanche step is the 64-bit finalizer from MurmurHash3.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <string.h>
+#include "edslib_internal.h"
+
+#define EDSLIB_HASH_PRIME1      UINT64_C(0x9E3779B185EBCA87)
+#define EDSLIB_HASH_PRIME2      UINT64_C(0xC2B2AE3D27D4EB4F)
+#define EDSLIB_HASH_PRIME3      UINT64_C(0x165667B19E3779F9)
+#define EDSLIB_HASH_PRIME4      UINT64_C(0x85EBCA77C2B2AE63)
+#define EDSLIB_HASH_PRIME5      UINT64_C(0x27D4EB2F165667C5)
+
+typedef struct
+{
+    uint64_t Lane[2];
+    uint64_t Word;
+    uint32_t WordBits;
+    uint64_t TotalBits;
+} EdsLib_ContentHash_State_t;
+
+static inline uint64_t EdsLib_ContentHash_Rotate(uint64_t Value, uint32_t Bits)
+{
+    return (Value << Bits) | (Value >> (64 - Bits));
+}
+
+static inline uint64_t EdsLib_ContentHash_Avalanche(uint64_t Value)
+{
+    Value ^= Value >> 33;
+    Value *= UINT64_C(0xFF51AFD7ED558CCD);
+    Value ^= Value >> 33;
+    Value *= UINT64_C(0xC4CEB9FE1A85EC53);
+    Value ^= Value >> 33;
+    return Value;
+}
+
+static inline void EdsLib_ContentHash_MixWord(EdsLib_ContentHash_State_t *State, uint64_t Word)
+{
+    State->Lane[0] = EdsLib_ContentHash_Rotate(State->Lane[0] + (Word * EDSLIB_HASH_PRIME2), 31) * EDSLIB_HASH_PRIME1;
+    State->Lane[1] = EdsLib_ContentHash_Rotate(State->Lane[1] ^ (Word * EDSLIB_HASH_PRIME4), 27) * EDSLIB_HASH_PRIME3;
+    State->Lane[1] += State->Lane[0];
+}
+
+/*
+ * Add up to 8 bits to the stream, Value is right-justified
+ */
+static void EdsLib_ContentHash_AddSmall(EdsLib_ContentHash_State_t *State, uint32_t Value, uint32_t NumBits)
+{
+    uint32_t SpaceBits;
+
+    SpaceBits = 64 - State->WordBits;
+    if (NumBits < SpaceBits)
+    {
+        State->Word = (State->Word << NumBits) | Value;
+        State->WordBits += NumBits;
+    }
+    else
+    {
+        /* complete the current word with the upper part of the value */
+        NumBits -= SpaceBits;
+        State->Word = (State->Word << SpaceBits) | (Value >> NumBits);
+        EdsLib_ContentHash_MixWord(State, State->Word);
+        State->Word = Value & ((1U << NumBits) - 1);
+        State->WordBits = NumBits;
+    }
+}
+
+/*
+ * Add bits to the stream from a buffer, starting at the MSB of the first byte
+ */
+static void EdsLib_ContentHash_AddBits(EdsLib_ContentHash_State_t *State, const uint8_t *Data, uint32_t NumBits)
+{
+    uint64_t Word;
+    uint32_t Idx;
+
+    State->TotalBits += NumBits;
+
+    /* whole words can be mixed directly when the stream is word aligned */
+    while (State->WordBits == 0 && NumBits >= 64)
+    {
+        Word = 0;
+        for (Idx = 0; Idx < 8; ++Idx)
+        {
+            Word = (Word << 8) | Data[Idx];
+        }
+        EdsLib_ContentHash_MixWord(State, Word);
+        Data += 8;
+        NumBits -= 64;
+    }
+
+    while (NumBits >= 8)
+    {
+        EdsLib_ContentHash_AddSmall(State, *Data, 8);
+        ++Data;
+        NumBits -= 8;
+    }
+
+    if (NumBits > 0)
+    {
+        EdsLib_ContentHash_AddSmall(State, *Data >> (8 - NumBits), NumBits);
+    }
+}
+
+/*
+ * Add zero bits to the stream, for padding and special fields
+ */
+static void EdsLib_ContentHash_AddZeros(EdsLib_ContentHash_State_t *State, uint32_t NumBits)
+{
+    State->TotalBits += NumBits;
+
+    while (NumBits >= 8)
+    {
+        EdsLib_ContentHash_AddSmall(State, 0, 8);
+        NumBits -= 8;
+    }
+
+    if (NumBits > 0)
+    {
+        EdsLib_ContentHash_AddSmall(State, 0, NumBits);
+    }
+}
+
+static void EdsLib_ContentHash_Finish(EdsLib_ContentHash_State_t *State, EdsLib_DataTypeDB_ContentHash_t *Hash)
+{
+    /* the last partial word is left-justified and zero filled, the total length disambiguates it */
+    if (State->WordBits > 0)
+    {
+        EdsLib_ContentHash_MixWord(State, State->Word << (64 - State->WordBits));
+    }
+
+    State->Lane[0] ^= State->TotalBits;
+    State->Lane[1] ^= State->TotalBits * EDSLIB_HASH_PRIME5;
+
+    Hash->Low = EdsLib_ContentHash_Avalanche(State->Lane[0] + State->Lane[1]);
+    Hash->High = EdsLib_ContentHash_Avalanche(State->Lane[1] + EdsLib_ContentHash_Rotate(State->Lane[0], 17));
+}
+
+static inline bool EdsLib_ContentHash_IsNumber(const EdsLib_DataTypeDB_Entry_t *DataDictPtr)
+{
+    return (DataDictPtr->BasicType == EDSLIB_BASICTYPE_SIGNED_INT ||
+            DataDictPtr->BasicType == EDSLIB_BASICTYPE_UNSIGNED_INT ||
+            DataDictPtr->BasicType == EDSLIB_BASICTYPE_FLOAT);
+}
+
+int32_t EdsLib_DataTypeDB_InitContentHasher(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DataTypeDB_ContentHasher_t *Hasher)
+{
+    EdsLib_DatabaseRef_t RefObj;
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    int32_t Status;
+
+    memset(Hasher, 0, sizeof(*Hasher));
+
+    EdsLib_Decode_StructId(&RefObj, EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &RefObj);
+    if (DataDictPtr == NULL)
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    /*
+     * The object always starts at bit 0 of the stream, so the plan is
+     * built as a byte aligned record and sub-objects may be block copied.
+     */
+    Status = EdsLib_DataTypeArrayPlan_Build(GD, &RefObj, EDSLIB_BITPACK_OPERMODE_PACK, EDSLIB_ARRAYPLAN_MODE_NORMAL,
+            (DataDictPtr->SizeInfo.Bits + 7) & ~UINT32_C(7), DataDictPtr->SizeInfo.Bytes, &Hasher->Plan);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        Hasher->Plan.BaseDictPtr = NULL;
+        return Status;
+    }
+
+    Hasher->EdsId = EdsId;
+    Hasher->PackedBits = DataDictPtr->SizeInfo.Bits;
+    Hasher->NativeSize = DataDictPtr->SizeInfo.Bytes;
+
+    return EDSLIB_SUCCESS;
+}
+
+int32_t EdsLib_DataTypeDB_ComputeContentHash(const EdsLib_DataTypeDB_ContentHasher_t *Hasher,
+        const void *NativeObj, uint32_t NativeSize, EdsLib_DataTypeDB_ContentHash_t *Hash)
+{
+    EdsLib_ContentHash_State_t State;
+    const EdsLib_ArrayPlanOp_t *Op;
+    const uint8_t *NativePtr;
+    uint8_t FieldBuffer[sizeof(EdsLib_GenericValueUnion_t) + 8];
+    uint32_t StreamBit;
+    uint32_t PackedBit;
+    uint32_t NativeByte;
+    uint16_t OpIdx;
+    uint16_t RepeatIdx;
+    EdsLib_PackAction_t PackAction;
+
+    memset(Hash, 0, sizeof(*Hash));
+
+    if (Hasher->Plan.BaseDictPtr == NULL)
+    {
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    if (NativeSize < Hasher->NativeSize)
+    {
+        return EDSLIB_BUFFER_SIZE_ERROR;
+    }
+
+    memset(&State, 0, sizeof(State));
+    State.Lane[0] = EDSLIB_HASH_PRIME5;
+    State.Lane[1] = EDSLIB_HASH_PRIME1 ^ EDSLIB_HASH_PRIME3;
+
+    NativePtr = NativeObj;
+    StreamBit = 0;
+
+    for (OpIdx = 0; OpIdx < Hasher->Plan.NumOps; ++OpIdx)
+    {
+        Op = &Hasher->Plan.Ops[OpIdx];
+
+        /* length, fixed value and error control fields are not content, these become zero fill */
+        if (Op->EntryType == EDSLIB_ENTRYTYPE_CONTAINER_ERROR_CONTROL_ENTRY ||
+                Op->EntryType == EDSLIB_ENTRYTYPE_CONTAINER_LENGTH_ENTRY ||
+                Op->EntryType == EDSLIB_ENTRYTYPE_CONTAINER_FIXED_VALUE_ENTRY)
+        {
+            continue;
+        }
+
+        PackedBit = Op->PackedBitOffset;
+        NativeByte = Op->NativeByteOffset;
+
+        for (RepeatIdx = 0; RepeatIdx < Op->RepeatCount; ++RepeatIdx)
+        {
+            if (PackedBit < StreamBit)
+            {
+                /* overlapping fields, which a valid pack plan does not have */
+                return EDSLIB_INVALID_SIZE_OR_TYPE;
+            }
+
+            EdsLib_ContentHash_AddZeros(&State, PackedBit - StreamBit);
+
+            /*
+             * As in EdsLib_DataTypeArrayPlan_Execute(), numbers that are not byte
+             * aligned are always bit packed.  Binary data and sub-objects have the
+             * same bits at any alignment, so these are not packed into the buffer.
+             */
+            PackAction = Op->AlignedAction;
+            if ((PackedBit & 0x07) != 0 && EdsLib_ContentHash_IsNumber(Op->DataDictPtr))
+            {
+                PackAction = EDSLIB_PACKACTION_BITPACK;
+            }
+
+            if (PackAction == EDSLIB_PACKACTION_BYTECOPY_STRAIGHT)
+            {
+                /* the packed bits are the same as the native bytes */
+                EdsLib_ContentHash_AddBits(&State, &NativePtr[NativeByte], Op->DataDictPtr->SizeInfo.Bits);
+            }
+            else
+            {
+                if (Op->DataDictPtr->SizeInfo.Bytes > sizeof(FieldBuffer))
+                {
+                    return EDSLIB_INVALID_SIZE_OR_TYPE;
+                }
+                memset(FieldBuffer, 0, sizeof(FieldBuffer));
+                EdsLib_DataTypeArrayPlan_PackField(Op, PackAction, FieldBuffer, &NativePtr[NativeByte], 0);
+                EdsLib_ContentHash_AddBits(&State, FieldBuffer, Op->DataDictPtr->SizeInfo.Bits);
+            }
+
+            StreamBit = PackedBit + Op->DataDictPtr->SizeInfo.Bits;
+            PackedBit += Op->PackedRepeatBits;
+            NativeByte += Op->NativeRepeatBytes;
+        }
+    }
+
+    /* trailing padding or special fields */
+    if (StreamBit < Hasher->PackedBits)
+    {
+        EdsLib_ContentHash_AddZeros(&State, Hasher->PackedBits - StreamBit);
+    }
+
+    EdsLib_ContentHash_Finish(&State, Hash);
+
+    return EDSLIB_SUCCESS;
+}
@@ -150,18 +150,19 @@ int32_t EdsLib_DataTypeIterator_Impl(const EdsLib_DatabaseObject_t *GD,
                     /* Lookup the actual array type.  Unlike containers, this only needs to be
                      * done on the first time since all entries are of the same type.
                      *
-                     * This calculates the END offset of this element based on the parent size.  Doing
+                     * This calculates the END offset of this element based on the size of the array.  Doing
                      * it this way accounts for (potential) extra padding between elements, such as
                      * cases where we have an array of base type containers.  This would not be accounted
                      * for when using the "SizeInfo" of the current level directly, as this would only be
-                     * the size of the base type.
+                     * the size of the base type.  The parent offsets are not used, as the space that
+                     * the array occupies in a container may also include alignment padding after
+                     * the last element.
                      */
                     CurrLev->Details.RefObj = ParentLev->DataDictPtr->Detail.Array->ElementRefObj;
                     CurrLev->DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &CurrLev->Details.RefObj);
                     CurrLev->Details.EntryType = EDSLIB_ENTRYTYPE_ARRAY_ELEMENT;
                     CurrLev->StartOffset = ParentLev->StartOffset;
-                    CurrLev->EndOffset.Bytes = (ParentLev->EndOffset.Bytes - ParentLev->StartOffset.Bytes);
-                    CurrLev->EndOffset.Bits = (ParentLev->EndOffset.Bits - ParentLev->StartOffset.Bits);
+                    CurrLev->EndOffset = ParentLev->DataDictPtr->SizeInfo;
                     CurrLev->EndOffset.Bytes /= ParentLev->DataDictPtr->NumSubElements;
                     CurrLev->EndOffset.Bits /= ParentLev->DataDictPtr->NumSubElements;
                     CurrLev->EndOffset.Bytes += CurrLev->StartOffset.Bytes;
@@ -0,0 +1,818 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_datatypedb_jit.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Array codec objects, which repeatedly pack or unpack arrays of a single type,
+ * and an optional compiler that translates the array plan of frequently used
+ * types into native machine code.
+ *
+ * The compiler is only built when EDSLIB_ENABLE_JIT is defined, and only on
+ * Linux x86-64 and AArch64 hosts.  It handles plans consisting entirely of byte
+ * aligned copies, with or without byte swapping, which covers most telemetry
+ * records.  Anything else (bit fields, unaligned records, or records with length,
+ * fixed value, or error control fields) is always handled by the interpreter.
+ *
+ * The generated code is placed into memory obtained directly from mmap(), which
+ * is made executable via mprotect() only after the code is completely written.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "edslib_internal.h"
+
+#if defined(EDSLIB_ENABLE_JIT) && defined(__linux__)
+#if !defined(EDSLIB_JIT_ARCH_X86_64) && !defined(EDSLIB_JIT_ARCH_AARCH64)
+#if defined(__x86_64__)
+#define EDSLIB_JIT_ARCH_X86_64
+#elif defined(__aarch64__)
+#define EDSLIB_JIT_ARCH_AARCH64
+#endif
+#endif
+#endif
+
+#if defined(EDSLIB_JIT_ARCH_X86_64) || defined(EDSLIB_JIT_ARCH_AARCH64)
+#define EDSLIB_JIT_SUPPORTED
+#include <sys/mman.h>
+#endif
+
+/*
+ * The largest destination record that will be compiled.  Every byte of the record
+ * is either copied or zeroed by straight-line code, so this bounds the code size.
+ */
+#define EDSLIB_JIT_MAX_RECORD_BYTES     4096
+
+/*
+ * The number of records passed through both the compiled code
+ * and the interpreter when the self check is enabled
+ */
+#define EDSLIB_JIT_SELFCHECK_RECORDS    4
+
+typedef void (*EdsLib_JitFunc_t)(uint8_t *DestBuffer, const uint8_t *SourceBuffer, uint32_t NumObjects);
+
+#ifdef EDSLIB_JIT_SUPPORTED
+
+typedef struct
+{
+    uint8_t *Buffer;    /**< Output location, or NULL when only computing the size */
+    size_t Position;
+    size_t LoopStart;
+    size_t SkipFixup;
+} EdsLib_JitEmitter_t;
+
+typedef struct
+{
+    uint32_t DestStride;
+    uint32_t SourceStride;
+    uint32_t DestRecordSize;
+    uint8_t Coverage[EDSLIB_JIT_MAX_RECORD_BYTES / 8];
+} EdsLib_JitLayout_t;
+
+static void EdsLib_Jit_EmitBytes(EdsLib_JitEmitter_t *Emitter, const uint8_t *Data, size_t Size)
+{
+    if (Emitter->Buffer != NULL)
+    {
+        memcpy(&Emitter->Buffer[Emitter->Position], Data, Size);
+    }
+    Emitter->Position += Size;
+}
+
+static void EdsLib_Jit_Put32(EdsLib_JitEmitter_t *Emitter, size_t Position, uint32_t Value)
+{
+    uint8_t Bytes[4];
+
+    if (Emitter->Buffer != NULL)
+    {
+        Bytes[0] = Value & 0xFF;
+        Bytes[1] = (Value >> 8) & 0xFF;
+        Bytes[2] = (Value >> 16) & 0xFF;
+        Bytes[3] = (Value >> 24) & 0xFF;
+        memcpy(&Emitter->Buffer[Position], Bytes, sizeof(Bytes));
+    }
+}
+
+static void EdsLib_Jit_Emit32(EdsLib_JitEmitter_t *Emitter, uint32_t Value)
+{
+    EdsLib_Jit_Put32(Emitter, Emitter->Position, Value);
+    Emitter->Position += 4;
+}
+
+#ifdef EDSLIB_JIT_ARCH_X86_64
+
+/*
+ * x86-64 (System V calling convention)
+ *
+ * rdi = destination record, rsi = source record, edx = remaining count.
+ * Data moves through rax, and rcx is held at zero for clearing the gaps.
+ */
+
+static void EdsLib_Jit_EmitPrologue(EdsLib_JitEmitter_t *Emitter, const EdsLib_JitLayout_t *Layout)
+{
+    static const uint8_t PROLOGUE[] =
+    {
+            0x31, 0xC9,             /* xor ecx,ecx */
+            0x85, 0xD2,             /* test edx,edx */
+            0x0F, 0x84              /* jz rel32 */
+    };
+
+    (void)Layout;
+
+    EdsLib_Jit_EmitBytes(Emitter, PROLOGUE, sizeof(PROLOGUE));
+    Emitter->SkipFixup = Emitter->Position;
+    Emitter->Position += 4;
+    Emitter->LoopStart = Emitter->Position;
+}
+
+static void EdsLib_Jit_EmitEpilogue(EdsLib_JitEmitter_t *Emitter, const EdsLib_JitLayout_t *Layout)
+{
+    static const uint8_t ADD_RDI[] = { 0x48, 0x81, 0xC7 };
+    static const uint8_t ADD_RSI[] = { 0x48, 0x81, 0xC6 };
+    static const uint8_t LOOP[] = { 0xFF, 0xCA, 0x0F, 0x85 };     /* dec edx; jnz rel32 */
+    static const uint8_t RET[] = { 0xC3 };
+
+    EdsLib_Jit_EmitBytes(Emitter, ADD_RDI, sizeof(ADD_RDI));
+    EdsLib_Jit_Emit32(Emitter, Layout->DestStride);
+    EdsLib_Jit_EmitBytes(Emitter, ADD_RSI, sizeof(ADD_RSI));
+    EdsLib_Jit_Emit32(Emitter, Layout->SourceStride);
+    EdsLib_Jit_EmitBytes(Emitter, LOOP, sizeof(LOOP));
+    EdsLib_Jit_Emit32(Emitter, (uint32_t)(Emitter->LoopStart - (Emitter->Position + 4)));
+    EdsLib_Jit_Put32(Emitter, Emitter->SkipFixup, (uint32_t)(Emitter->Position - (Emitter->SkipFixup + 4)));
+    EdsLib_Jit_EmitBytes(Emitter, RET, sizeof(RET));
+}
+
+static void EdsLib_Jit_EmitLoad(EdsLib_JitEmitter_t *Emitter, uint32_t Offset, uint32_t Size)
+{
+    static const uint8_t LOAD8[] = { 0x0F, 0xB6, 0x86 };          /* movzx eax,byte [rsi+disp32] */
+    static const uint8_t LOAD16[] = { 0x0F, 0xB7, 0x86 };         /* movzx eax,word [rsi+disp32] */
+    static const uint8_t LOAD32[] = { 0x8B, 0x86 };               /* mov eax,[rsi+disp32] */
+    static const uint8_t LOAD64[] = { 0x48, 0x8B, 0x86 };         /* mov rax,[rsi+disp32] */
+
+    switch(Size)
+    {
+    case 1:
+        EdsLib_Jit_EmitBytes(Emitter, LOAD8, sizeof(LOAD8));
+        break;
+    case 2:
+        EdsLib_Jit_EmitBytes(Emitter, LOAD16, sizeof(LOAD16));
+        break;
+    case 4:
+        EdsLib_Jit_EmitBytes(Emitter, LOAD32, sizeof(LOAD32));
+        break;
+    default:
+        EdsLib_Jit_EmitBytes(Emitter, LOAD64, sizeof(LOAD64));
+        break;
+    }
+    EdsLib_Jit_Emit32(Emitter, Offset);
+}
+
+static void EdsLib_Jit_EmitSwap(EdsLib_JitEmitter_t *Emitter, uint32_t Size)
+{
+    static const uint8_t SWAP16[] = { 0x66, 0xC1, 0xC0, 0x08 };   /* rol ax,8 */
+    static const uint8_t SWAP32[] = { 0x0F, 0xC8 };               /* bswap eax */
+    static const uint8_t SWAP64[] = { 0x48, 0x0F, 0xC8 };         /* bswap rax */
+
+    switch(Size)
+    {
+    case 2:
+        EdsLib_Jit_EmitBytes(Emitter, SWAP16, sizeof(SWAP16));
+        break;
+    case 4:
+        EdsLib_Jit_EmitBytes(Emitter, SWAP32, sizeof(SWAP32));
+        break;
+    case 8:
+        EdsLib_Jit_EmitBytes(Emitter, SWAP64, sizeof(SWAP64));
+        break;
+    default:
+        break;
+    }
+}
+
+static void EdsLib_Jit_EmitStoreReg(EdsLib_JitEmitter_t *Emitter, uint32_t Offset, uint32_t Size, uint8_t ModRM)
+{
+    uint8_t Insn[4];
+    size_t Len;
+
+    Len = 0;
+    if (Size == 2)
+    {
+        Insn[Len++] = 0x66;
+    }
+    else if (Size == 8)
+    {
+        Insn[Len++] = 0x48;
+    }
+    Insn[Len++] = (Size == 1) ? 0x88 : 0x89;
+    Insn[Len++] = ModRM;
+
+    EdsLib_Jit_EmitBytes(Emitter, Insn, Len);
+    EdsLib_Jit_Emit32(Emitter, Offset);
+}
+
+static void EdsLib_Jit_EmitStore(EdsLib_JitEmitter_t *Emitter, uint32_t Offset, uint32_t Size)
+{
+    EdsLib_Jit_EmitStoreReg(Emitter, Offset, Size, 0x87);       /* mov [rdi+disp32],rax */
+}
+
+static void EdsLib_Jit_EmitStoreZero(EdsLib_JitEmitter_t *Emitter, uint32_t Offset, uint32_t Size)
+{
+    EdsLib_Jit_EmitStoreReg(Emitter, Offset, Size, 0x8F);       /* mov [rdi+disp32],rcx */
+}
+
+#endif /* EDSLIB_JIT_ARCH_X86_64 */
+
+#ifdef EDSLIB_JIT_ARCH_AARCH64
+
+/*
+ * AArch64 (AAPCS64 calling convention)
+ *
+ * x0 = destination record, x1 = source record, w2 = remaining count.
+ * x3 holds the field offset, data moves through x4, and the strides
+ * are held in x5 (destination) and x6 (source).
+ */
+
+#define EDSLIB_JIT_A64_RET              0xD65F03C0
+
+static void EdsLib_Jit_EmitMoveImm(EdsLib_JitEmitter_t *Emitter, uint32_t Reg, uint32_t Value)
+{
+    EdsLib_Jit_Emit32(Emitter, 0xD2800000 | ((Value & 0xFFFF) << 5) | Reg);               /* movz xN,#lo */
+    if ((Value >> 16) != 0)
+    {
+        EdsLib_Jit_Emit32(Emitter, 0xF2A00000 | ((Value >> 16) << 5) | Reg);              /* movk xN,#hi,lsl #16 */
+    }
+}
+
+static uint32_t EdsLib_Jit_BranchImm19(size_t From, size_t To)
+{
+    return (((uint32_t)(To - From) >> 2) & 0x7FFFF) << 5;
+}
+
+static void EdsLib_Jit_EmitPrologue(EdsLib_JitEmitter_t *Emitter, const EdsLib_JitLayout_t *Layout)
+{
+    EdsLib_Jit_EmitMoveImm(Emitter, 5, Layout->DestStride);
+    EdsLib_Jit_EmitMoveImm(Emitter, 6, Layout->SourceStride);
+    Emitter->SkipFixup = Emitter->Position;
+    Emitter->Position += 4;                                                                 /* cbz w2,end */
+    Emitter->LoopStart = Emitter->Position;
+}
+
+static void EdsLib_Jit_EmitEpilogue(EdsLib_JitEmitter_t *Emitter, const EdsLib_JitLayout_t *Layout)
+{
+    EdsLib_Jit_Emit32(Emitter, 0x8B050000);                                                 /* add x0,x0,x5 */
+    EdsLib_Jit_Emit32(Emitter, 0x8B060021);                                                 /* add x1,x1,x6 */
+    EdsLib_Jit_Emit32(Emitter, 0x71000442);                                                 /* subs w2,w2,#1 */
+    EdsLib_Jit_Emit32(Emitter, 0x54000001 |
+            EdsLib_Jit_BranchImm19(Emitter->Position, Emitter->LoopStart));                 /* b.ne loop */
+    EdsLib_Jit_Put32(Emitter, Emitter->SkipFixup, 0x34000002 |
+            EdsLib_Jit_BranchImm19(Emitter->SkipFixup, Emitter->Position));                 /* cbz w2,end */
+    EdsLib_Jit_Emit32(Emitter, EDSLIB_JIT_A64_RET);
+}
+
+/*
+ * Opcode for a register offset load or store of the given size
+ */
+static uint32_t EdsLib_Jit_LoadStoreOpcode(uint32_t Size, bool IsLoad)
+{
+    uint32_t Opcode;
+
+    switch(Size)
+    {
+    case 1:
+        Opcode = 0x38206800;
+        break;
+    case 2:
+        Opcode = 0x78206800;
+        break;
+    case 4:
+        Opcode = 0xB8206800;
+        break;
+    default:
+        Opcode = 0xF8206800;
+        break;
+    }
+
+    if (IsLoad)
+    {
+        Opcode |= 0x00400000;
+    }
+
+    return Opcode;
+}
+
+static void EdsLib_Jit_EmitLoad(EdsLib_JitEmitter_t *Emitter, uint32_t Offset, uint32_t Size)
+{
+    EdsLib_Jit_EmitMoveImm(Emitter, 3, Offset);
+    EdsLib_Jit_Emit32(Emitter, EdsLib_Jit_LoadStoreOpcode(Size, true) | (3 << 16) | (1 << 5) | 4);    /* ldr x4,[x1,x3] */
+}
+
+static void EdsLib_Jit_EmitSwap(EdsLib_JitEmitter_t *Emitter, uint32_t Size)
+{
+    switch(Size)
+    {
+    case 2:
+        EdsLib_Jit_Emit32(Emitter, 0x5AC00484);                                             /* rev16 w4,w4 */
+        break;
+    case 4:
+        EdsLib_Jit_Emit32(Emitter, 0x5AC00884);                                             /* rev w4,w4 */
+        break;
+    case 8:
+        EdsLib_Jit_Emit32(Emitter, 0xDAC00C84);                                             /* rev x4,x4 */
+        break;
+    default:
+        break;
+    }
+}
+
+static void EdsLib_Jit_EmitStore(EdsLib_JitEmitter_t *Emitter, uint32_t Offset, uint32_t Size)
+{
+    EdsLib_Jit_EmitMoveImm(Emitter, 3, Offset);
+    EdsLib_Jit_Emit32(Emitter, EdsLib_Jit_LoadStoreOpcode(Size, false) | (3 << 16) | (0 << 5) | 4);   /* str x4,[x0,x3] */
+}
+
+static void EdsLib_Jit_EmitStoreZero(EdsLib_JitEmitter_t *Emitter, uint32_t Offset, uint32_t Size)
+{
+    EdsLib_Jit_EmitMoveImm(Emitter, 3, Offset);
+    EdsLib_Jit_Emit32(Emitter, EdsLib_Jit_LoadStoreOpcode(Size, false) | (3 << 16) | (0 << 5) | 31);  /* str xzr,[x0,x3] */
+}
+
+#endif /* EDSLIB_JIT_ARCH_AARCH64 */
+
+/*
+ * Largest power of two move (up to 8 bytes) that fits within the remaining size
+ */
+static uint32_t EdsLib_Jit_ChunkSize(uint32_t Remaining)
+{
+    if (Remaining >= 8)
+    {
+        return 8;
+    }
+    if (Remaining >= 4)
+    {
+        return 4;
+    }
+    if (Remaining >= 2)
+    {
+        return 2;
+    }
+    return 1;
+}
+
+static void EdsLib_Jit_EmitCopy(EdsLib_JitEmitter_t *Emitter, uint32_t DestOffset, uint32_t SourceOffset,
+        uint32_t Size, EdsLib_PackAction_t PackAction)
+{
+    uint32_t Chunk;
+    uint32_t Idx;
+
+    if (PackAction == EDSLIB_PACKACTION_BYTECOPY_STRAIGHT)
+    {
+        Idx = 0;
+        while (Idx < Size)
+        {
+            Chunk = EdsLib_Jit_ChunkSize(Size - Idx);
+            EdsLib_Jit_EmitLoad(Emitter, SourceOffset + Idx, Chunk);
+            EdsLib_Jit_EmitStore(Emitter, DestOffset + Idx, Chunk);
+            Idx += Chunk;
+        }
+    }
+    else if (Size == 1 || Size == 2 || Size == 4 || Size == 8)
+    {
+        EdsLib_Jit_EmitLoad(Emitter, SourceOffset, Size);
+        EdsLib_Jit_EmitSwap(Emitter, Size);
+        EdsLib_Jit_EmitStore(Emitter, DestOffset, Size);
+    }
+    else
+    {
+        /* odd sized integers are reversed one byte at a time */
+        for (Idx = 0; Idx < Size; ++Idx)
+        {
+            EdsLib_Jit_EmitLoad(Emitter, SourceOffset + Size - 1 - Idx, 1);
+            EdsLib_Jit_EmitStore(Emitter, DestOffset + Idx, 1);
+        }
+    }
+}
+
+/*
+ * Get the destination and source offsets of a single repetition of an operation
+ */
+static void EdsLib_Jit_GetOpOffsets(const EdsLib_ArrayPlan_t *Plan, const EdsLib_ArrayPlanOp_t *Op,
+        uint16_t RepeatIdx, uint32_t *DestOffset, uint32_t *SourceOffset)
+{
+    uint32_t PackedOffset;
+    uint32_t NativeOffset;
+
+    PackedOffset = (Op->PackedBitOffset + (RepeatIdx * Op->PackedRepeatBits)) / 8;
+    NativeOffset = Op->NativeByteOffset + (RepeatIdx * Op->NativeRepeatBytes);
+
+    if (Plan->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+    {
+        *DestOffset = PackedOffset;
+        *SourceOffset = NativeOffset;
+    }
+    else
+    {
+        *DestOffset = NativeOffset;
+        *SourceOffset = PackedOffset;
+    }
+}
+
+/*
+ * Check that the plan can be compiled, and determine which
+ * bytes of the destination record are written by the operations.
+ */
+static int32_t EdsLib_Jit_CheckPlan(const EdsLib_ArrayPlan_t *Plan, EdsLib_JitLayout_t *Layout)
+{
+    const EdsLib_ArrayPlanOp_t *Op;
+    uint32_t PackedRecordSize;
+    uint32_t NativeRecordSize;
+    uint32_t DestOffset;
+    uint32_t SourceOffset;
+    uint32_t Size;
+    uint32_t Idx;
+    uint16_t OpIdx;
+    uint16_t RepeatIdx;
+
+    if (!Plan->RecordAligned || Plan->HasSpecialEntries || (Plan->BaseDictPtr->SizeInfo.Bits & 0x07) != 0 ||
+            Plan->PackedStrideBits / 8 > INT32_MAX || Plan->NativeStrideBytes > INT32_MAX)
+    {
+        return EDSLIB_NOT_IMPLEMENTED;
+    }
+
+    memset(Layout, 0, sizeof(*Layout));
+    PackedRecordSize = Plan->BaseDictPtr->SizeInfo.Bits / 8;
+    NativeRecordSize = Plan->BaseDictPtr->SizeInfo.Bytes;
+
+    if (Plan->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+    {
+        Layout->DestStride = Plan->PackedStrideBits / 8;
+        Layout->SourceStride = Plan->NativeStrideBytes;
+        Layout->DestRecordSize = PackedRecordSize;
+    }
+    else
+    {
+        Layout->DestStride = Plan->NativeStrideBytes;
+        Layout->SourceStride = Plan->PackedStrideBits / 8;
+        Layout->DestRecordSize = NativeRecordSize;
+    }
+
+    if (Layout->DestRecordSize > EDSLIB_JIT_MAX_RECORD_BYTES)
+    {
+        return EDSLIB_NOT_IMPLEMENTED;
+    }
+
+    for (OpIdx = 0; OpIdx < Plan->NumOps; ++OpIdx)
+    {
+        Op = &Plan->Ops[OpIdx];
+        Size = Op->DataDictPtr->SizeInfo.Bytes;
+
+        if ((Op->AlignedAction != EDSLIB_PACKACTION_BYTECOPY_STRAIGHT &&
+                Op->AlignedAction != EDSLIB_PACKACTION_BYTECOPY_INVERT) ||
+                (Op->PackedBitOffset & 0x07) != 0 || (Op->PackedRepeatBits & 0x07) != 0 ||
+                Op->DataDictPtr->SizeInfo.Bits != (Size * 8))
+        {
+            return EDSLIB_NOT_IMPLEMENTED;
+        }
+
+        for (RepeatIdx = 0; RepeatIdx < Op->RepeatCount; ++RepeatIdx)
+        {
+            EdsLib_Jit_GetOpOffsets(Plan, Op, RepeatIdx, &DestOffset, &SourceOffset);
+            if ((DestOffset + Size) > Layout->DestRecordSize ||
+                    (DestOffset + Size) > Layout->DestStride ||
+                    (SourceOffset + Size) > Layout->SourceStride)
+            {
+                return EDSLIB_NOT_IMPLEMENTED;
+            }
+
+            for (Idx = DestOffset; Idx < (DestOffset + Size); ++Idx)
+            {
+                Layout->Coverage[Idx / 8] |= 1 << (Idx & 0x07);
+            }
+        }
+    }
+
+    return EDSLIB_SUCCESS;
+}
+
+/*
+ * Generate the complete function.  This is invoked twice, first with no
+ * output buffer to get the code size and then to actually write the code.
+ */
+static void EdsLib_Jit_Generate(EdsLib_JitEmitter_t *Emitter, const EdsLib_ArrayPlan_t *Plan,
+        const EdsLib_JitLayout_t *Layout)
+{
+    const EdsLib_ArrayPlanOp_t *Op;
+    uint32_t DestOffset;
+    uint32_t SourceOffset;
+    uint32_t RunStart;
+    uint32_t Chunk;
+    uint32_t Idx;
+    uint16_t OpIdx;
+    uint16_t RepeatIdx;
+
+    EdsLib_Jit_EmitPrologue(Emitter, Layout);
+
+    /*
+     * Bytes not written by any operation are cleared,
+     * the same as the interpreter does for the whole record.
+     */
+    Idx = 0;
+    while (Idx < Layout->DestRecordSize)
+    {
+        if ((Layout->Coverage[Idx / 8] & (1 << (Idx & 0x07))) != 0)
+        {
+            ++Idx;
+            continue;
+        }
+
+        RunStart = Idx;
+        while (Idx < Layout->DestRecordSize && (Layout->Coverage[Idx / 8] & (1 << (Idx & 0x07))) == 0)
+        {
+            ++Idx;
+        }
+
+        while (RunStart < Idx)
+        {
+            Chunk = EdsLib_Jit_ChunkSize(Idx - RunStart);
+            EdsLib_Jit_EmitStoreZero(Emitter, RunStart, Chunk);
+            RunStart += Chunk;
+        }
+    }
+
+    for (OpIdx = 0; OpIdx < Plan->NumOps; ++OpIdx)
+    {
+        Op = &Plan->Ops[OpIdx];
+        for (RepeatIdx = 0; RepeatIdx < Op->RepeatCount; ++RepeatIdx)
+        {
+            EdsLib_Jit_GetOpOffsets(Plan, Op, RepeatIdx, &DestOffset, &SourceOffset);
+            EdsLib_Jit_EmitCopy(Emitter, DestOffset, SourceOffset, Op->DataDictPtr->SizeInfo.Bytes, Op->AlignedAction);
+        }
+    }
+
+    EdsLib_Jit_EmitEpilogue(Emitter, Layout);
+}
+
+int32_t EdsLib_DataTypeArrayPlan_Compile(const EdsLib_ArrayPlan_t *Plan, void **Code, size_t *CodeSize)
+{
+    EdsLib_JitLayout_t Layout;
+    EdsLib_JitEmitter_t Emitter;
+    void *Mem;
+    int32_t Status;
+
+    *Code = NULL;
+    *CodeSize = 0;
+
+    Status = EdsLib_Jit_CheckPlan(Plan, &Layout);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return Status;
+    }
+
+    memset(&Emitter, 0, sizeof(Emitter));
+    EdsLib_Jit_Generate(&Emitter, Plan, &Layout);
+
+    Mem = mmap(NULL, Emitter.Position, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (Mem == MAP_FAILED)
+    {
+        return EDSLIB_INSUFFICIENT_MEMORY;
+    }
+
+    *CodeSize = Emitter.Position;
+    memset(&Emitter, 0, sizeof(Emitter));
+    Emitter.Buffer = Mem;
+    EdsLib_Jit_Generate(&Emitter, Plan, &Layout);
+
+    /* The memory is never writable and executable at the same time */
+    if (mprotect(Mem, *CodeSize, PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(Mem, *CodeSize);
+        *CodeSize = 0;
+        return EDSLIB_FAILURE;
+    }
+
+    __builtin___clear_cache((char *)Mem, (char *)Mem + *CodeSize);
+
+    *Code = Mem;
+    return EDSLIB_SUCCESS;
+}
+
+void EdsLib_DataTypeArrayPlan_ReleaseCode(void *Code, size_t CodeSize)
+{
+    if (Code != NULL)
+    {
+        munmap(Code, CodeSize);
+    }
+}
+
+#else /* not EDSLIB_JIT_SUPPORTED */
+
+int32_t EdsLib_DataTypeArrayPlan_Compile(const EdsLib_ArrayPlan_t *Plan, void **Code, size_t *CodeSize)
+{
+    (void)Plan;
+
+    *Code = NULL;
+    *CodeSize = 0;
+    return EDSLIB_NOT_IMPLEMENTED;
+}
+
+void EdsLib_DataTypeArrayPlan_ReleaseCode(void *Code, size_t CodeSize)
+{
+    (void)Code;
+    (void)CodeSize;
+}
+
+#endif /* EDSLIB_JIT_SUPPORTED */
+
+static void EdsLib_Jit_Invoke(const void *Code, void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects)
+{
+    EdsLib_JitFunc_t Func;
+
+    /* conversion between object and function pointers is done via memcpy to keep ISO C compilers happy */
+    memcpy(&Func, &Code, sizeof(Func));
+    Func(DestBuffer, SourceBuffer, NumObjects);
+}
+
+#ifdef EDSLIB_JIT_SUPPORTED
+
+/*
+ * Run random data through both the compiled code and the interpreter, and
+ * confirm that the results are identical, including the bytes between records.
+ */
+static int32_t EdsLib_Jit_SelfCheck(const EdsLib_ArrayPlan_t *Plan, const void *Code)
+{
+    uint8_t *Mem;
+    uint8_t *SourceBuffer;
+    uint8_t *InterpDest;
+    uint8_t *JitDest;
+    size_t SourceSize;
+    size_t DestSize;
+    size_t TotalSize;
+    size_t Idx;
+    uint32_t Random;
+    int32_t Status;
+
+    if (Plan->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+    {
+        SourceSize = (size_t)Plan->NativeStrideBytes * EDSLIB_JIT_SELFCHECK_RECORDS;
+        DestSize = (size_t)(Plan->PackedStrideBits / 8) * EDSLIB_JIT_SELFCHECK_RECORDS;
+    }
+    else
+    {
+        SourceSize = (size_t)(Plan->PackedStrideBits / 8) * EDSLIB_JIT_SELFCHECK_RECORDS;
+        DestSize = (size_t)Plan->NativeStrideBytes * EDSLIB_JIT_SELFCHECK_RECORDS;
+    }
+
+    TotalSize = SourceSize + (2 * DestSize);
+    Mem = mmap(NULL, TotalSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (Mem == MAP_FAILED)
+    {
+        return EDSLIB_INSUFFICIENT_MEMORY;
+    }
+
+    SourceBuffer = Mem;
+    InterpDest = &Mem[SourceSize];
+    JitDest = &Mem[SourceSize + DestSize];
+
+    /* simple xorshift generator, so the application random state is not disturbed */
+    Random = 0x2545F491;
+    for (Idx = 0; Idx < (SourceSize + DestSize); ++Idx)
+    {
+        Random ^= Random << 13;
+        Random ^= Random >> 17;
+        Random ^= Random << 5;
+        Mem[Idx] = Random & 0xFF;
+    }
+    memcpy(JitDest, InterpDest, DestSize);
+
+    Status = EdsLib_DataTypeArrayPlan_Execute(Plan, InterpDest, SourceBuffer, EDSLIB_JIT_SELFCHECK_RECORDS);
+    if (Status == EDSLIB_SUCCESS)
+    {
+        EdsLib_Jit_Invoke(Code, JitDest, SourceBuffer, EDSLIB_JIT_SELFCHECK_RECORDS);
+        if (memcmp(InterpDest, JitDest, DestSize) != 0)
+        {
+            Status = EDSLIB_FIELD_MISMATCH;
+        }
+    }
+
+    munmap(Mem, TotalSize);
+
+    return Status;
+}
+
+#endif /* EDSLIB_JIT_SUPPORTED */
+
+static int32_t EdsLib_ArrayCodec_Process(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_ArrayCodec_t *Codec,
+        EdsLib_DataTypeDB_ArrayCodecState_t *State, EdsLib_BitPack_OperMode_t OperMode,
+        void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects)
+{
+    EdsLib_DatabaseRef_t RefObj;
+    int32_t Status;
+
+    if (State->Code == NULL)
+    {
+        /* The plan is built on first use, as the codec is initialized without the DB */
+        if (!State->HasPlan)
+        {
+            EdsLib_Decode_StructId(&RefObj, Codec->EdsId);
+            Status = EdsLib_DataTypeArrayPlan_Build(GD, &RefObj, OperMode, EDSLIB_ARRAYPLAN_MODE_NORMAL,
+                    Codec->PackedStrideBits, Codec->NativeStrideBytes, &State->Plan);
+            if (Status != EDSLIB_SUCCESS)
+            {
+                return Status;
+            }
+            State->HasPlan = true;
+        }
+
+        /*
+         * Compilation is attempted exactly once, when the call count reaches
+         * the threshold.  If it is not successful the interpreter is used from
+         * then on, and the reason is kept in the state for diagnostics.
+         */
+        if (Codec->JitThreshold != 0 && State->CallCount < Codec->JitThreshold)
+        {
+            ++State->CallCount;
+            if (State->CallCount == Codec->JitThreshold)
+            {
+                State->Status = EdsLib_DataTypeArrayPlan_Compile(&State->Plan, &State->Code, &State->CodeSize);
+#ifdef EDSLIB_JIT_SUPPORTED
+                if (State->Status == EDSLIB_SUCCESS && (Codec->Flags & EDSLIB_ARRAYCODEC_FLAG_SELFCHECK) != 0)
+                {
+                    State->Status = EdsLib_Jit_SelfCheck(&State->Plan, State->Code);
+                }
+#endif
+                if (State->Status != EDSLIB_SUCCESS)
+                {
+                    EdsLib_DataTypeArrayPlan_ReleaseCode(State->Code, State->CodeSize);
+                    State->Code = NULL;
+                    State->CodeSize = 0;
+                }
+            }
+        }
+
+        if (State->Code == NULL)
+        {
+            return EdsLib_DataTypeArrayPlan_Execute(&State->Plan, DestBuffer, SourceBuffer, NumObjects);
+        }
+    }
+
+    /* compiled plans never have fields to verify, so this always succeeds */
+    EdsLib_Jit_Invoke(State->Code, DestBuffer, SourceBuffer, NumObjects);
+
+    return EDSLIB_SUCCESS;
+}
+
+void EdsLib_DataTypeDB_ArrayCodec_Init(EdsLib_DataTypeDB_ArrayCodec_t *Codec, EdsLib_Id_t EdsId,
+        uint32_t PackedStrideBits, uint32_t NativeStrideBytes, uint32_t JitThreshold, uint32_t Flags)
+{
+    memset(Codec, 0, sizeof(*Codec));
+    Codec->EdsId = EdsId;
+    Codec->PackedStrideBits = PackedStrideBits;
+    Codec->NativeStrideBytes = NativeStrideBytes;
+    Codec->JitThreshold = JitThreshold;
+    Codec->Flags = Flags;
+    Codec->Pack.Status = EDSLIB_NOT_IMPLEMENTED;
+    Codec->Unpack.Status = EDSLIB_NOT_IMPLEMENTED;
+}
+
+int32_t EdsLib_DataTypeDB_ArrayCodec_Pack(const EdsLib_DatabaseObject_t *GD, EdsLib_DataTypeDB_ArrayCodec_t *Codec,
+        void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects)
+{
+    return EdsLib_ArrayCodec_Process(GD, Codec, &Codec->Pack, EDSLIB_BITPACK_OPERMODE_PACK,
+            DestBuffer, SourceBuffer, NumObjects);
+}
+
+int32_t EdsLib_DataTypeDB_ArrayCodec_Unpack(const EdsLib_DatabaseObject_t *GD, EdsLib_DataTypeDB_ArrayCodec_t *Codec,
+        void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects)
+{
+    return EdsLib_ArrayCodec_Process(GD, Codec, &Codec->Unpack, EDSLIB_BITPACK_OPERMODE_UNPACK,
+            DestBuffer, SourceBuffer, NumObjects);
+}
+
+void EdsLib_DataTypeDB_ArrayCodec_Release(EdsLib_DataTypeDB_ArrayCodec_t *Codec)
+{
+    EdsLib_DataTypeArrayPlan_ReleaseCode(Codec->Pack.Code, Codec->Pack.CodeSize);
+    EdsLib_DataTypeArrayPlan_ReleaseCode(Codec->Unpack.Code, Codec->Unpack.CodeSize);
+    EdsLib_DataTypeDB_ArrayCodec_Init(Codec, Codec->EdsId, Codec->PackedStrideBits,
+            Codec->NativeStrideBytes, Codec->JitThreshold, Codec->Flags);
+}
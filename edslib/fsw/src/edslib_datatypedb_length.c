@@ -0,0 +1,437 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_datatypedb_length.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Functions to obtain the total size of an encoded object directly from
+ * its length field (EDS LengthEntry), without unpacking the object.
+ *
+ * This is useful for finding the boundaries of objects within a stream of
+ * encoded data, where only the size is needed and the content is not.
+ *
+ * The size query extends this by also identifying the derived type from
+ * the encoded identification fields, so the native size is also known
+ * before the object is unpacked.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "edslib_internal.h"
+
+/*
+ * The largest length field that can be decoded.  This is far beyond
+ * what any practical length field needs, and keeps the bit extraction
+ * within a single 64 bit accumulator.
+ */
+#define EDSLIB_LENGTHFIELD_MAX_BITS     32
+
+typedef struct
+{
+    const EdsLib_DataTypeDB_SizeRecipe_t *Recipe;   /**< Set only while identifying the base type */
+    const uint8_t *PackedData;
+    uint32_t PackedDataBits;
+    bool Incomplete;
+} EdsLib_PackedIdentify_ControlBlock_t;
+
+typedef struct
+{
+    EdsLib_DataTypeDB_LengthFieldInfo_t *LengthInfo;
+    int32_t Status;
+} EdsLib_LengthFieldSearch_ControlBlock_t;
+
+static EdsLib_Iterator_Rc_t EdsLib_LengthFieldSearch_Callback(const EdsLib_DatabaseObject_t *GD,
+        EdsLib_Iterator_CbType_t CbType,
+        const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
+        void *OpaqueArg)
+{
+    EdsLib_LengthFieldSearch_ControlBlock_t *CtlBlock = OpaqueArg;
+    EdsLib_DataTypeDB_LengthFieldInfo_t *LengthInfo = CtlBlock->LengthInfo;
+    EdsLib_PackedField_t PackedField;
+
+    (void)GD;
+
+    if (CbType != EDSLIB_ITERATOR_CBTYPE_MEMBER || CbInfo->DataDictPtr == NULL)
+    {
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    if (CbInfo->Details.EntryType != EDSLIB_ENTRYTYPE_CONTAINER_LENGTH_ENTRY)
+    {
+        /* Length fields in arrays are not meaningful, only look inside containers */
+        if (CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_CONTAINER)
+        {
+            return EDSLIB_ITERATOR_RC_DESCEND;
+        }
+
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    /*
+     * Found the length entry.  Check that the encoding is something
+     * that can be decoded directly from the raw bits.
+     */
+    CtlBlock->Status = EDSLIB_INVALID_SIZE_OR_TYPE;
+    LengthInfo->BitOffset = CbInfo->StartOffset.Bits;
+    LengthInfo->BitSize = CbInfo->EndOffset.Bits - CbInfo->StartOffset.Bits;
+
+    if (EdsLib_PackedField_Init(CbInfo->DataDictPtr, LengthInfo->BitOffset, &PackedField) == EDSLIB_SUCCESS &&
+            PackedField.FieldType == EDSLIB_PACKEDFIELD_VALUE_UNSIGNED &&
+            PackedField.NumBits == LengthInfo->BitSize && LengthInfo->BitSize <= EDSLIB_LENGTHFIELD_MAX_BITS)
+    {
+        LengthInfo->LittleEndian = PackedField.LittleEndian;
+        CtlBlock->Status = EDSLIB_SUCCESS;
+    }
+
+    LengthInfo->LengthTypeId = EdsLib_Encode_StructId(&CbInfo->Details.RefObj);
+    LengthInfo->MinPackedBytes = (LengthInfo->BitOffset + LengthInfo->BitSize + 7) / 8;
+    LengthInfo->Calibrator = CbInfo->Details.HandlerArg.IntegerCalibrator.Forward;
+
+    return EDSLIB_ITERATOR_RC_STOP;
+}
+
+int32_t EdsLib_DataTypeDB_GetLengthFieldInfo(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, EdsLib_DataTypeDB_LengthFieldInfo_t *LengthInfo)
+{
+    EdsLib_LengthFieldSearch_ControlBlock_t CtlBlock;
+    int32_t Status;
+
+    EDSLIB_DECLARE_ITERATOR_CB(IteratorState,
+            EDSLIB_ITERATOR_MAX_DEEP_DEPTH,
+            EdsLib_LengthFieldSearch_Callback,
+            &CtlBlock);
+
+    memset(LengthInfo, 0, sizeof(*LengthInfo));
+    memset(&CtlBlock, 0, sizeof(CtlBlock));
+    CtlBlock.LengthInfo = LengthInfo;
+    CtlBlock.Status = EDSLIB_NAME_NOT_FOUND;
+
+    EDSLIB_RESET_ITERATOR_FROM_EDSID(IteratorState, EdsId);
+
+    Status = EdsLib_DataTypeIterator_Impl(GD, &IteratorState.Cb);
+    if (Status == EDSLIB_SUCCESS)
+    {
+        Status = CtlBlock.Status;
+    }
+
+    return Status;
+}
+
+/*
+ * Get the location and encoding of a numeric field within packed data.
+ * This is shared by the size recipes, the packet filter and the decimator,
+ * so all of them read the encoded bits the same way.
+ */
+int32_t EdsLib_PackedField_Init(const EdsLib_DataTypeDB_Entry_t *DataDictPtr, uint32_t BitOffset, EdsLib_PackedField_t *Field)
+{
+    if ((DataDictPtr->BasicType != EDSLIB_BASICTYPE_UNSIGNED_INT && DataDictPtr->BasicType != EDSLIB_BASICTYPE_SIGNED_INT &&
+            DataDictPtr->BasicType != EDSLIB_BASICTYPE_FLOAT) ||
+            DataDictPtr->SizeInfo.Bits == 0 || DataDictPtr->SizeInfo.Bits > 64 ||
+            DataDictPtr->Detail.Number.BitInvertFlag || DataDictPtr->Detail.Number.LsbFirstFlag)
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    memset(Field, 0, sizeof(*Field));
+    Field->NumBits = DataDictPtr->SizeInfo.Bits;
+    Field->BitOffset = BitOffset;
+
+    switch(DataDictPtr->BasicType)
+    {
+    case EDSLIB_BASICTYPE_UNSIGNED_INT:
+        if (DataDictPtr->Detail.Number.Encoding != EDSLIB_NUMBERENCODING_UNSIGNED_INTEGER &&
+                DataDictPtr->Detail.Number.Encoding != EDSLIB_NUMBERENCODING_UNDEFINED)
+        {
+            return EDSLIB_INVALID_SIZE_OR_TYPE;
+        }
+        Field->FieldType = EDSLIB_PACKEDFIELD_VALUE_UNSIGNED;
+        break;
+    case EDSLIB_BASICTYPE_SIGNED_INT:
+        /* an undefined encoding is twos complement, as in the unpack routine */
+        if (DataDictPtr->Detail.Number.Encoding != EDSLIB_NUMBERENCODING_TWOS_COMPLEMENT &&
+                DataDictPtr->Detail.Number.Encoding != EDSLIB_NUMBERENCODING_UNDEFINED)
+        {
+            return EDSLIB_INVALID_SIZE_OR_TYPE;
+        }
+        Field->FieldType = EDSLIB_PACKEDFIELD_VALUE_SIGNED;
+        break;
+    default:
+        if (DataDictPtr->Detail.Number.Encoding != EDSLIB_NUMBERENCODING_IEEE_754 ||
+                (Field->NumBits != 32 && Field->NumBits != 64))
+        {
+            return EDSLIB_INVALID_SIZE_OR_TYPE;
+        }
+        Field->FieldType = EDSLIB_PACKEDFIELD_VALUE_FLOAT;
+        break;
+    }
+
+    /* single bytes are the same in either byte order */
+    if (DataDictPtr->Detail.Number.ByteOrder == EDSLIB_NUMBERBYTEORDER_LITTLE_ENDIAN && Field->NumBits > 8)
+    {
+        if ((Field->BitOffset & 0x07) != 0 || (Field->NumBits & 0x07) != 0)
+        {
+            return EDSLIB_INVALID_SIZE_OR_TYPE;
+        }
+        Field->LittleEndian = true;
+    }
+
+    return EDSLIB_SUCCESS;
+}
+
+int32_t EdsLib_DataTypeDB_DecodeLengthField(const EdsLib_DataTypeDB_LengthFieldInfo_t *LengthInfo, const void *PackedData, uint32_t *PackedSizeBytes)
+{
+    EdsLib_DisplayDB_FilterValue_t RawValue;
+    intmax_t Value;
+
+    EdsLib_PackedField_Load(PackedData, LengthInfo->BitOffset, LengthInfo->BitSize, EDSLIB_PACKEDFIELD_VALUE_UNSIGNED,
+            LengthInfo->LittleEndian, UINT64_MAX, &RawValue);
+    Value = RawValue.Unsigned;
+
+    if (LengthInfo->Calibrator != NULL)
+    {
+        Value = LengthInfo->Calibrator(Value);
+    }
+
+    if (Value < LengthInfo->MinPackedBytes || Value > UINT32_MAX)
+    {
+        *PackedSizeBytes = 0;
+        return EDSLIB_FIELD_MISMATCH;
+    }
+
+    *PackedSizeBytes = Value;
+    return EDSLIB_SUCCESS;
+}
+
+/*
+ * Determine if a constraint entity is an integer that can be decoded directly
+ * from the encoded bits, and if so, where it is.  Otherwise the BitSize
+ * of the field info is left as 0.
+ */
+static void EdsLib_DataTypeDB_GetPackedFieldInfo(const EdsLib_DatabaseObject_t *GD, const EdsLib_ConstraintEntity_t *Location,
+        EdsLib_DataTypeDB_PackedFieldInfo_t *FieldInfo)
+{
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    EdsLib_PackedField_t PackedField;
+
+    memset(FieldInfo, 0, sizeof(*FieldInfo));
+
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &Location->RefObj);
+    if (DataDictPtr == NULL ||
+            EdsLib_PackedField_Init(DataDictPtr, Location->Offset.Bits, &PackedField) != EDSLIB_SUCCESS ||
+            PackedField.FieldType == EDSLIB_PACKEDFIELD_VALUE_FLOAT)
+    {
+        /* identification only compares integer values */
+        return;
+    }
+
+    FieldInfo->BitOffset = PackedField.BitOffset;
+    FieldInfo->BitSize = PackedField.NumBits;
+    FieldInfo->BasicType = DataDictPtr->BasicType;
+    FieldInfo->LittleEndian = PackedField.LittleEndian;
+}
+
+/*
+ * Identification callback which loads constraint values directly from the encoded data.
+ * Fields of the base type come from the recipe, others are looked up from the DB.
+ */
+static void EdsLib_DataTypeDB_LoadPackedIdentField(const EdsLib_DatabaseObject_t *GD, EdsLib_GenericValueBuffer_t *ValueBuff,
+        const EdsLib_ConstraintEntity_t *Location, uint16_t EntityIdx, const void *Arg)
+{
+    EdsLib_PackedIdentify_ControlBlock_t *CtlBlock = (EdsLib_PackedIdentify_ControlBlock_t *)Arg;
+    EdsLib_DataTypeDB_PackedFieldInfo_t TempFieldInfo;
+    const EdsLib_DataTypeDB_PackedFieldInfo_t *FieldInfo;
+    EdsLib_DisplayDB_FilterValue_t Value;
+
+    if (CtlBlock->Recipe != NULL && EntityIdx < CtlBlock->Recipe->NumIdentFields)
+    {
+        FieldInfo = &CtlBlock->Recipe->IdentFields[EntityIdx];
+    }
+    else
+    {
+        EdsLib_DataTypeDB_GetPackedFieldInfo(GD, Location, &TempFieldInfo);
+        FieldInfo = &TempFieldInfo;
+    }
+
+    if (FieldInfo->BitSize == 0 || (FieldInfo->BitOffset + FieldInfo->BitSize) > CtlBlock->PackedDataBits)
+    {
+        ValueBuff->ValueType = EDSLIB_BASICTYPE_NONE;
+        CtlBlock->Incomplete = true;
+        return;
+    }
+
+    ValueBuff->ValueType = FieldInfo->BasicType;
+    if (FieldInfo->BasicType == EDSLIB_BASICTYPE_SIGNED_INT)
+    {
+        EdsLib_PackedField_Load(CtlBlock->PackedData, FieldInfo->BitOffset, FieldInfo->BitSize,
+                EDSLIB_PACKEDFIELD_VALUE_SIGNED, FieldInfo->LittleEndian, UINT64_MAX, &Value);
+        ValueBuff->Value.SignedInteger = Value.Signed;
+    }
+    else
+    {
+        EdsLib_PackedField_Load(CtlBlock->PackedData, FieldInfo->BitOffset, FieldInfo->BitSize,
+                EDSLIB_PACKEDFIELD_VALUE_UNSIGNED, FieldInfo->LittleEndian, UINT64_MAX, &Value);
+        ValueBuff->Value.UnsignedInteger = Value.Unsigned;
+    }
+}
+
+int32_t EdsLib_DataTypeDB_InitSizeRecipe(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, EdsLib_DataTypeDB_SizeRecipe_t *Recipe)
+{
+    EdsLib_DatabaseRef_t EdsRef;
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    const EdsLib_ContainerDescriptor_t *ContainerDesc;
+    int32_t Status;
+    uint16_t Idx;
+
+    memset(Recipe, 0, sizeof(*Recipe));
+
+    EdsLib_Decode_StructId(&EdsRef, EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &EdsRef);
+    if (DataDictPtr == NULL)
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    Recipe->EdsId = EdsId;
+
+    Status = EdsLib_DataTypeDB_GetLengthFieldInfo(GD, EdsId, &Recipe->LengthInfo);
+    if (Status == EDSLIB_SUCCESS)
+    {
+        Recipe->HasLengthField = true;
+    }
+    else if (Status != EDSLIB_NAME_NOT_FOUND)
+    {
+        /* there is a length field, but it cannot be used */
+        return Status;
+    }
+
+    if (DataDictPtr->BasicType == EDSLIB_BASICTYPE_CONTAINER)
+    {
+        ContainerDesc = DataDictPtr->Detail.Container;
+        if (ContainerDesc != NULL && ContainerDesc->ConstraintEntityList != NULL)
+        {
+            Recipe->NumIdentFields = ContainerDesc->ConstraintEntityListSize;
+            if (Recipe->NumIdentFields > EDSLIB_SIZERECIPE_MAX_IDENT_FIELDS)
+            {
+                Recipe->NumIdentFields = EDSLIB_SIZERECIPE_MAX_IDENT_FIELDS;
+            }
+            for (Idx = 0; Idx < Recipe->NumIdentFields; ++Idx)
+            {
+                EdsLib_DataTypeDB_GetPackedFieldInfo(GD, &ContainerDesc->ConstraintEntityList[Idx],
+                        &Recipe->IdentFields[Idx]);
+            }
+        }
+    }
+
+    return EDSLIB_SUCCESS;
+}
+
+int32_t EdsLib_DataTypeDB_GetPackedSizes(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_SizeRecipe_t *Recipe,
+        const void *PackedData, uint32_t PackedDataSize, EdsLib_DataTypeDB_PackedSizeInfo_t *SizeInfo)
+{
+    EdsLib_PackedIdentify_ControlBlock_t CtlBlock;
+    EdsLib_DatabaseRef_t CurrRef;
+    EdsLib_DatabaseRef_t NextRef;
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    const EdsLib_DataTypeDB_Entry_t *NextDictPtr;
+    int32_t Status;
+
+    memset(SizeInfo, 0, sizeof(*SizeInfo));
+
+    EdsLib_Decode_StructId(&CurrRef, Recipe->EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &CurrRef);
+    if (DataDictPtr == NULL)
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    if (Recipe->HasLengthField)
+    {
+        if (PackedDataSize < Recipe->LengthInfo.MinPackedBytes)
+        {
+            return EDSLIB_BUFFER_SIZE_ERROR;
+        }
+
+        Status = EdsLib_DataTypeDB_DecodeLengthField(&Recipe->LengthInfo, PackedData, &SizeInfo->PackedBytes);
+        if (Status != EDSLIB_SUCCESS)
+        {
+            return Status;
+        }
+
+        /* fields beyond the end of the object are not part of it */
+        if (PackedDataSize > SizeInfo->PackedBytes)
+        {
+            PackedDataSize = SizeInfo->PackedBytes;
+        }
+    }
+
+    memset(&CtlBlock, 0, sizeof(CtlBlock));
+    CtlBlock.Recipe = Recipe;
+    CtlBlock.PackedData = PackedData;
+    CtlBlock.PackedDataBits = PackedDataSize * 8;
+
+    /*
+     * Follow the same multi-level identification as the unpack routine,
+     * stopping at the first level that does not identify a derived type.
+     */
+    while (DataDictPtr->BasicType == EDSLIB_BASICTYPE_CONTAINER)
+    {
+        Status = EdsLib_DataTypeIdentify_Impl(GD, DataDictPtr, EdsLib_DataTypeDB_LoadPackedIdentField,
+                &CtlBlock, NULL, &NextRef);
+        if (Status != EDSLIB_SUCCESS || CtlBlock.Incomplete)
+        {
+            /* a result reached without all of the values is not trustworthy */
+            break;
+        }
+
+        NextDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &NextRef);
+        if (NextDictPtr == NULL)
+        {
+            return EDSLIB_INCOMPLETE_DB_OBJECT;
+        }
+
+        CurrRef = NextRef;
+        DataDictPtr = NextDictPtr;
+
+        /* the recipe only describes the fields of the base type */
+        CtlBlock.Recipe = NULL;
+    }
+
+    SizeInfo->EdsId = EdsLib_Encode_StructId(&CurrRef);
+    if (!Recipe->HasLengthField)
+    {
+        SizeInfo->PackedBytes = (DataDictPtr->SizeInfo.Bits + 7) / 8;
+    }
+
+    if (CtlBlock.Incomplete && DataDictPtr->BasicType == EDSLIB_BASICTYPE_CONTAINER &&
+            DataDictPtr->Detail.Container != NULL)
+    {
+        /* the exact type is unknown, but cannot be larger than this */
+        SizeInfo->NativeBytes = DataDictPtr->Detail.Container->MaxSize.Bytes;
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    SizeInfo->NativeBytes = DataDictPtr->SizeInfo.Bytes;
+    return EDSLIB_SUCCESS;
+}
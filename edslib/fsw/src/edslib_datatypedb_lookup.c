@@ -114,6 +114,42 @@ const EdsLib_DataTypeDB_Entry_t *EdsLib_DataTypeDB_GetEntry(const EdsLib_Databas
     return DataDictEntry;
 }
 
+const EdsLib_ValidRangeDescriptor_t *EdsLib_DataTypeDB_GetValidRange(const EdsLib_DatabaseObject_t *GD, const EdsLib_DatabaseRef_t *RefObj)
+{
+    EdsLib_DataTypeDB_t Dict;
+    const EdsLib_DataTypeDB_Entry_t *DataDictEntry;
+    const EdsLib_DatabaseRef_t *CurrRef;
+
+    CurrRef = RefObj;
+
+    /*
+     * This follows aliases the same way as EdsLib_DataTypeDB_GetEntry(),
+     * but stops at the first type that has a valid range.
+     */
+    while (CurrRef != NULL)
+    {
+        Dict = EdsLib_DataTypeDB_GetTopLevel(GD, CurrRef->AppIndex);
+        if (Dict == NULL || CurrRef->TypeIndex >= Dict->DataTypeTableSize)
+        {
+            break;
+        }
+
+        if (Dict->ValidRangeTable != NULL && Dict->ValidRangeTable[CurrRef->TypeIndex] != NULL)
+        {
+            return Dict->ValidRangeTable[CurrRef->TypeIndex];
+        }
+
+        DataDictEntry = &Dict->DataTypeTable[CurrRef->TypeIndex];
+        if (DataDictEntry->BasicType != EDSLIB_BASICTYPE_ALIAS)
+        {
+            break;
+        }
+
+        CurrRef = &DataDictEntry->Detail.Alias.RefObj;
+    }
+
+    return NULL;
+}
 
 void EdsLib_DataTypeDB_CopyTypeInfo(const EdsLib_DataTypeDB_Entry_t *DataDictEntry, EdsLib_DataTypeDB_TypeInfo_t *TypeInfo)
 {
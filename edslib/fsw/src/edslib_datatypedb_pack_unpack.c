@@ -1478,6 +1478,21 @@ static void EdsLib_Internal_DoBitwiseUnpack(uint8_t *DstPtr, const uint8_t *SrcP
     }
 }
 
+/*
+ * Copy bytes while reversing their order
+ */
+static void EdsLib_Internal_CopyInverted(uint8_t *DstPtr, const uint8_t *SrcPtr, uintptr_t Size)
+{
+    DstPtr += Size;
+    while(Size > 0)
+    {
+        --DstPtr;
+        *DstPtr = *SrcPtr;
+        ++SrcPtr;
+        --Size;
+    }
+}
+
 static EdsLib_Iterator_Rc_t EdsLib_DataTypePackUnpack_Callback(const EdsLib_DatabaseObject_t *GD,
         EdsLib_Iterator_CbType_t CbType,
         const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
@@ -1737,15 +1752,7 @@ static EdsLib_Iterator_Rc_t EdsLib_DataTypePackUnpack_Callback(const EdsLib_Data
     case EDSLIB_PACKACTION_BYTECOPY_INVERT:
     {
         /* need to invert byte order while copying, so use custom routine */
-        uintptr_t Size = CbInfo->DataDictPtr->SizeInfo.Bytes;
-        DstPtr += Size;
-        while(Size > 0)
-        {
-            --DstPtr;
-            *DstPtr = *SrcPtr;
-            ++SrcPtr;
-            --Size;
-        }
+        EdsLib_Internal_CopyInverted(DstPtr, SrcPtr, CbInfo->DataDictPtr->SizeInfo.Bytes);
         break;
     }
     case EDSLIB_PACKACTION_BITPACK:
@@ -1847,13 +1854,88 @@ void EdsLib_DataTypePackUnpack_Impl(const EdsLib_DatabaseObject_t *GD, EdsLib_Da
     }
 }
 
+/*
+ * Get the value of a length or fixed value entry.  These are determined entirely
+ * by the EDS and do not depend on the content of the object.  For any other entry
+ * type the ValueType is set to EDSLIB_BASICTYPE_NONE.  The pack and unpack post
+ * processing both use this, so the value written is always the value verified.
+ */
+static void EdsLib_Internal_GetFixedEntryValue(EdsLib_GenericValueBuffer_t *ValBuf, uint16_t EntryType,
+        const EdsLib_HandlerArgument_t *HandlerArg, const EdsLib_DataTypeDB_Entry_t *DataDictPtr,
+        const EdsLib_DataTypeDB_Entry_t *BaseDictPtr)
+{
+    ValBuf->ValueType = EDSLIB_BASICTYPE_NONE;
+    switch (EntryType)
+    {
+    case EDSLIB_ENTRYTYPE_CONTAINER_LENGTH_ENTRY:
+    {
+        ValBuf->Value.SignedInteger = (BaseDictPtr->SizeInfo.Bits + 7) / 8;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_SIGNED_INT;
+        if (HandlerArg->IntegerCalibrator.Reverse)
+        {
+            ValBuf->Value.SignedInteger =
+                    HandlerArg->IntegerCalibrator.Reverse(ValBuf->Value.SignedInteger);
+        }
+        break;
+    }
+    case EDSLIB_ENTRYTYPE_CONTAINER_FIXED_VALUE_ENTRY:
+    {
+        if (DataDictPtr->BasicType == EDSLIB_BASICTYPE_BINARY)
+        {
+            strncpy(ValBuf->Value.StringData, HandlerArg->FixedString, sizeof(ValBuf->Value.StringData));
+            ValBuf->ValueType = EDSLIB_BASICTYPE_BINARY;
+        }
+        else if (DataDictPtr->BasicType == EDSLIB_BASICTYPE_SIGNED_INT)
+        {
+            ValBuf->Value.SignedInteger = HandlerArg->FixedInteger;
+            ValBuf->ValueType = EDSLIB_BASICTYPE_SIGNED_INT;
+        }
+        else if (DataDictPtr->BasicType == EDSLIB_BASICTYPE_UNSIGNED_INT)
+        {
+            ValBuf->Value.UnsignedInteger = HandlerArg->FixedUnsigned;
+            ValBuf->ValueType = EDSLIB_BASICTYPE_UNSIGNED_INT;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/*
+ * Write a length or fixed value entry into a packed object
+ */
+static void EdsLib_Internal_PackFixedEntry(uint8_t *PackedObject, uint32_t BitOffset, uint16_t EntryType,
+        const EdsLib_HandlerArgument_t *HandlerArg, const EdsLib_DataTypeDB_Entry_t *DataDictPtr,
+        const EdsLib_DataTypeDB_Entry_t *BaseDictPtr)
+{
+    EdsLib_GenericValueBuffer_t ScratchBuf;
+    EdsLib_ConstPtr_t TempSrc;
+    EdsLib_Ptr_t TempDst;
+
+    EdsLib_Internal_GetFixedEntryValue(&ScratchBuf, EntryType, HandlerArg, DataDictPtr, BaseDictPtr);
+    if (ScratchBuf.ValueType == EDSLIB_BASICTYPE_NONE)
+    {
+        return;
+    }
+
+    if (DataDictPtr->BasicType != EDSLIB_BASICTYPE_BINARY)
+    {
+        /* Value must be stored to intermediate location before packing */
+        TempDst.u = &ScratchBuf.Value;
+        EdsLib_DataTypeStore_Impl(TempDst, &ScratchBuf, DataDictPtr);
+    }
+
+    TempSrc.u = &ScratchBuf.Value;
+    EdsLib_Internal_DoBitwisePack(&PackedObject[BitOffset / 8], TempSrc.Addr, DataDictPtr, BitOffset & 0x07);
+}
+
 EdsLib_Iterator_Rc_t EdsLib_PackedObject_PostProc_Callback(const EdsLib_DatabaseObject_t *GD,
         EdsLib_Iterator_CbType_t CbType,
         const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
         void *OpaqueArg)
 {
     EdsLib_PackedPostProc_ControlBlock_t *Base = (EdsLib_PackedPostProc_ControlBlock_t *)OpaqueArg;
-    EdsLib_GenericValueBuffer_t ScratchBuf;
 
     /*
      * Any other callback types other than member, just continue on.
@@ -1880,21 +1962,7 @@ EdsLib_Iterator_Rc_t EdsLib_PackedObject_PostProc_Callback(const EdsLib_Database
         return EDSLIB_ITERATOR_RC_STOP;
     }
 
-    ScratchBuf.ValueType = EDSLIB_BASICTYPE_NONE;
-    switch (CbInfo->Details.EntryType)
-    {
-    case EDSLIB_ENTRYTYPE_CONTAINER_LENGTH_ENTRY:
-    {
-        ScratchBuf.Value.SignedInteger = (Base->BaseDictPtr->SizeInfo.Bits + 7) / 8;
-        ScratchBuf.ValueType = EDSLIB_BASICTYPE_SIGNED_INT;
-        if (CbInfo->Details.HandlerArg.IntegerCalibrator.Reverse)
-        {
-            ScratchBuf.Value.SignedInteger =
-                    CbInfo->Details.HandlerArg.IntegerCalibrator.Reverse(ScratchBuf.Value.SignedInteger);
-        }
-        break;
-    }
-    case EDSLIB_ENTRYTYPE_CONTAINER_ERROR_CONTROL_ENTRY:
+    if (CbInfo->Details.EntryType == EDSLIB_ENTRYTYPE_CONTAINER_ERROR_CONTROL_ENTRY)
     {
         /* error control MUST be calculated last, since
          * other fields like fixed value/lengths can affect the result.
@@ -1909,48 +1977,11 @@ EdsLib_Iterator_Rc_t EdsLib_PackedObject_PostProc_Callback(const EdsLib_Database
         Base->ErrorCtlType = CbInfo->Details.HandlerArg.ErrorControl;
         Base->ErrorCtlDictPtr = CbInfo->DataDictPtr;
         Base->ErrorCtlOffsetBits = CbInfo->StartOffset.Bits;
-        break;
-    }
-    case EDSLIB_ENTRYTYPE_CONTAINER_FIXED_VALUE_ENTRY:
-    {
-        if (CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_BINARY)
-        {
-            strncpy(ScratchBuf.Value.StringData, CbInfo->Details.HandlerArg.FixedString, sizeof(ScratchBuf.Value.StringData));
-            ScratchBuf.ValueType = EDSLIB_BASICTYPE_BINARY;
-        }
-        else if (CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_SIGNED_INT)
-        {
-            ScratchBuf.Value.SignedInteger = CbInfo->Details.HandlerArg.FixedInteger;
-            ScratchBuf.ValueType = EDSLIB_BASICTYPE_SIGNED_INT;
-        }
-        else if (CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_UNSIGNED_INT)
-        {
-            ScratchBuf.Value.UnsignedInteger = CbInfo->Details.HandlerArg.FixedUnsigned;
-            ScratchBuf.ValueType = EDSLIB_BASICTYPE_UNSIGNED_INT;
-        }
-        break;
-    }
-    default:
-        /* do nothing to the field */
-        break;
     }
-
-    if (ScratchBuf.ValueType != EDSLIB_BASICTYPE_NONE)
+    else
     {
-        EdsLib_ConstPtr_t TempSrc;
-        EdsLib_Ptr_t TempDst;
-
-        if (CbInfo->DataDictPtr->BasicType != EDSLIB_BASICTYPE_BINARY)
-        {
-            /* Value must be stored to intermediate location before packing */
-            TempDst.u = &ScratchBuf.Value;
-            EdsLib_DataTypeStore_Impl(TempDst, &ScratchBuf, CbInfo->DataDictPtr);
-        }
-
-        TempSrc.u = &ScratchBuf.Value;
-        TempDst.Ptr = Base->BasePtr;
-        TempDst.Addr += CbInfo->StartOffset.Bits / 8;
-        EdsLib_Internal_DoBitwisePack(TempDst.Addr, TempSrc.Addr, CbInfo->DataDictPtr, CbInfo->StartOffset.Bits & 0x07);
+        EdsLib_Internal_PackFixedEntry(Base->BasePtr, CbInfo->StartOffset.Bits, CbInfo->Details.EntryType,
+                &CbInfo->Details.HandlerArg, CbInfo->DataDictPtr, Base->BaseDictPtr);
     }
 
     return EDSLIB_ITERATOR_RC_CONTINUE;
@@ -2002,13 +2033,8 @@ EdsLib_Iterator_Rc_t EdsLib_NativeObject_PostProc_Callback(const EdsLib_Database
         /* If PackedPtr is supplied, will verify value in existing field */
         if (Base->PackedPtr != NULL)
         {
-            ExpectedValue.Value.SignedInteger = (Base->BaseDictPtr->SizeInfo.Bits + 7) / 8;
-            ExpectedValue.ValueType = EDSLIB_BASICTYPE_SIGNED_INT;
-            if (CbInfo->Details.HandlerArg.IntegerCalibrator.Reverse)
-            {
-                ExpectedValue.Value.SignedInteger =
-                        CbInfo->Details.HandlerArg.IntegerCalibrator.Reverse(ExpectedValue.Value.SignedInteger);
-            }
+            EdsLib_Internal_GetFixedEntryValue(&ExpectedValue, CbInfo->Details.EntryType, &CbInfo->Details.HandlerArg,
+                    CbInfo->DataDictPtr, Base->BaseDictPtr);
         }
 
         /*
@@ -2060,23 +2086,9 @@ EdsLib_Iterator_Rc_t EdsLib_NativeObject_PostProc_Callback(const EdsLib_Database
         if (Base->PackedPtr != NULL ||
                 (Base->RecomputeFields & EDSLIB_DATATYPEDB_RECOMPUTE_ERRORCONTROL))
         {
-            if (CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_BINARY)
-            {
-                strncpy(InitValue.Value.StringData, CbInfo->Details.HandlerArg.FixedString,
-                        sizeof(InitValue.Value.StringData));
-                InitValue.ValueType = EDSLIB_BASICTYPE_BINARY;
-            }
-            else if (CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_SIGNED_INT)
-            {
-                InitValue.Value.SignedInteger = CbInfo->Details.HandlerArg.FixedInteger;
-                InitValue.ValueType = EDSLIB_BASICTYPE_SIGNED_INT;
-            }
-            else if (CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_UNSIGNED_INT)
-            {
-                InitValue.Value.UnsignedInteger = CbInfo->Details.HandlerArg.FixedUnsigned;
-                InitValue.ValueType = EDSLIB_BASICTYPE_UNSIGNED_INT;
-            }
-            else
+            EdsLib_Internal_GetFixedEntryValue(&InitValue, CbInfo->Details.EntryType, &CbInfo->Details.HandlerArg,
+                    CbInfo->DataDictPtr, Base->BaseDictPtr);
+            if (InitValue.ValueType == EDSLIB_BASICTYPE_NONE)
             {
                 Base->Status = EDSLIB_FIELD_MISMATCH;
             }
@@ -2180,3 +2192,530 @@ void EdsLib_UpdateErrorControlField(const EdsLib_DataTypeDB_Entry_t *ErrorCtlDic
     EdsLib_Internal_DoBitwisePack(TempDst.Addr, TempSrc.Addr, ErrorCtlDictPtr, ErrorCtlOffsetBits & 0x07);
 }
 
+
+/*
+ * ------------------------------------------------------
+ * Array (batch) pack/unpack
+ *
+ * When many objects of the same type are processed, the layout is walked only once
+ * to build a flat list of copy operations (the "plan"), which is then applied to
+ * every object.  Consecutive identical fields such as array elements are merged into
+ * a single operation with a repeat count, so the plan remains short for most types.
+ *
+ * Because successive objects may start at any bit position in the packed buffer, the
+ * byte copy optimizations are only applied where the actual position is byte aligned.
+ * If the packed stride is not a whole number of bytes then sub-containers are always
+ * broken down into their individual fields.
+ * ------------------------------------------------------
+ */
+
+static bool EdsLib_Internal_IsSpecialEntry(uint16_t EntryType)
+{
+    return (EntryType == EDSLIB_ENTRYTYPE_CONTAINER_ERROR_CONTROL_ENTRY ||
+            EntryType == EDSLIB_ENTRYTYPE_CONTAINER_LENGTH_ENTRY ||
+            EntryType == EDSLIB_ENTRYTYPE_CONTAINER_FIXED_VALUE_ENTRY);
+}
+
+/*
+ * Clear a range of bits in a packed buffer, preserving any other bits
+ * that share the first or last byte.
+ */
+static void EdsLib_Internal_ClearPackedBits(uint8_t *BasePtr, uint64_t StartBit, uint32_t NumBits)
+{
+    uint8_t *DstPtr;
+    uint32_t LeadBits;
+    uint32_t TrailBits;
+
+    DstPtr = &BasePtr[StartBit / 8];
+    LeadBits = StartBit & 0x07;
+
+    if (LeadBits != 0)
+    {
+        if (LeadBits + NumBits <= 8)
+        {
+            /* entirely within one byte */
+            *DstPtr &= ~((0xFFU >> LeadBits) & (0xFFU << (8 - LeadBits - NumBits)));
+            return;
+        }
+
+        *DstPtr &= 0xFFU << (8 - LeadBits);
+        ++DstPtr;
+        NumBits -= 8 - LeadBits;
+    }
+
+    TrailBits = NumBits & 0x07;
+    memset(DstPtr, 0, NumBits / 8);
+    if (TrailBits != 0)
+    {
+        DstPtr[NumBits / 8] &= 0xFFU >> TrailBits;
+    }
+}
+
+/*
+ * State of the iterator callback while building an array plan
+ */
+typedef struct
+{
+    EdsLib_ArrayPlan_t *Plan;
+    EdsLib_ArrayPlan_Mode_t PlanMode;
+    int32_t Status;
+    uint16_t Depth;
+
+    /* The container or array at each level, to locate the DB entry of special fields */
+    const EdsLib_DataTypeDB_Entry_t *ParentDictPtr[EDSLIB_ITERATOR_MAX_DEEP_DEPTH];
+} EdsLib_ArrayPlanBuild_ControlBlock_t;
+
+static void EdsLib_Internal_AddArrayPlanOp(EdsLib_ArrayPlanBuild_ControlBlock_t *CtlBlock,
+        const EdsLib_DataTypeIterator_StackEntry_t *CbInfo, EdsLib_PackAction_t AlignedAction)
+{
+    EdsLib_ArrayPlan_t *Plan = CtlBlock->Plan;
+    const EdsLib_DataTypeDB_Entry_t *ParentDictPtr;
+    EdsLib_ArrayPlanOp_t *Op;
+    uint32_t PackedDelta;
+    uint32_t NativeDelta;
+
+    /*
+     * If this is the same type as the previous field, see if it can be merged
+     * by repeating that operation.  This is typically the case for array elements.
+     */
+    if (Plan->NumOps > 0 && !EdsLib_Internal_IsSpecialEntry(CbInfo->Details.EntryType))
+    {
+        Op = &Plan->Ops[Plan->NumOps - 1];
+        if (Op->DataDictPtr == CbInfo->DataDictPtr && Op->AlignedAction == AlignedAction &&
+                !EdsLib_Internal_IsSpecialEntry(Op->EntryType) && Op->RepeatCount < UINT16_MAX)
+        {
+            PackedDelta = CbInfo->StartOffset.Bits - Op->PackedBitOffset;
+            NativeDelta = CbInfo->StartOffset.Bytes - Op->NativeByteOffset;
+
+            if (Op->RepeatCount == 1 && PackedDelta > 0 && NativeDelta > 0)
+            {
+                Op->PackedRepeatBits = PackedDelta;
+                Op->NativeRepeatBytes = NativeDelta;
+                ++Op->RepeatCount;
+                return;
+            }
+
+            if (Op->RepeatCount > 1 &&
+                    PackedDelta == (Op->PackedRepeatBits * Op->RepeatCount) &&
+                    NativeDelta == (Op->NativeRepeatBytes * Op->RepeatCount))
+            {
+                ++Op->RepeatCount;
+                return;
+            }
+        }
+    }
+
+    if (Plan->NumOps >= EDSLIB_ARRAYPLAN_MAX_OPS)
+    {
+        CtlBlock->Status = EDSLIB_INSUFFICIENT_MEMORY;
+        return;
+    }
+
+    Op = &Plan->Ops[Plan->NumOps];
+    ++Plan->NumOps;
+
+    memset(Op, 0, sizeof(*Op));
+    Op->DataDictPtr = CbInfo->DataDictPtr;
+    Op->PackedBitOffset = CbInfo->StartOffset.Bits;
+    Op->NativeByteOffset = CbInfo->StartOffset.Bytes;
+    Op->RepeatCount = 1;
+    Op->EntryType = CbInfo->Details.EntryType;
+    Op->AlignedAction = AlignedAction;
+
+    if (EdsLib_Internal_IsSpecialEntry(Op->EntryType))
+    {
+        /*
+         * The plan refers to the handler argument within the DB, rather than
+         * the copy in the iterator state.  Special fields are always direct
+         * members of a container.
+         */
+        ParentDictPtr = NULL;
+        if (CtlBlock->Depth > 0 && CtlBlock->Depth <= EDSLIB_ITERATOR_MAX_DEEP_DEPTH)
+        {
+            ParentDictPtr = CtlBlock->ParentDictPtr[CtlBlock->Depth - 1];
+        }
+        if (ParentDictPtr == NULL || ParentDictPtr->BasicType != EDSLIB_BASICTYPE_CONTAINER)
+        {
+            CtlBlock->Status = EDSLIB_INVALID_SIZE_OR_TYPE;
+            return;
+        }
+        Op->HandlerArg = &ParentDictPtr->Detail.Container->EntryList[CbInfo->CurrIndex].HandlerArg;
+
+        Plan->HasSpecialEntries = true;
+        if (Op->EntryType == EDSLIB_ENTRYTYPE_CONTAINER_ERROR_CONTROL_ENTRY)
+        {
+            /* as with single objects, only the last error control field is used */
+            Plan->ErrorCtlOpIdx = Plan->NumOps;
+        }
+    }
+}
+
+static EdsLib_Iterator_Rc_t EdsLib_ArrayPlan_Callback(const EdsLib_DatabaseObject_t *GD,
+        EdsLib_Iterator_CbType_t CbType,
+        const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
+        void *OpaqueArg)
+{
+    EdsLib_ArrayPlanBuild_ControlBlock_t *CtlBlock = (EdsLib_ArrayPlanBuild_ControlBlock_t *)OpaqueArg;
+    EdsLib_PackAction_t PackAction;
+    bool IsByteOrderMatch;
+    bool IsPacked;
+
+    (void)GD;
+
+    if (CbType == EDSLIB_ITERATOR_CBTYPE_START)
+    {
+        if (CtlBlock->Depth < EDSLIB_ITERATOR_MAX_DEEP_DEPTH)
+        {
+            CtlBlock->ParentDictPtr[CtlBlock->Depth] = CbInfo->DataDictPtr;
+        }
+        ++CtlBlock->Depth;
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    if (CbType == EDSLIB_ITERATOR_CBTYPE_END)
+    {
+        --CtlBlock->Depth;
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    if (CbType != EDSLIB_ITERATOR_CBTYPE_MEMBER ||
+            CbInfo->Details.EntryType == EDSLIB_ENTRYTYPE_CONTAINER_PADDING_ENTRY)
+    {
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    IsPacked = (CbInfo->DataDictPtr->Flags & EDSLIB_DATATYPE_FLAG_PACKED_MASK) != 0;
+    IsByteOrderMatch = (CbInfo->DataDictPtr->Flags & EDSLIB_DATATYPE_FLAG_PACKED_MASK) == EDSLIB_NATIVE_BYTE_PACK;
+
+    /*
+     * This selects the same actions as EdsLib_DataTypePackUnpack_Callback(), except that
+     * alignment is not known yet for scalars.  Sub-containers can only be copied as a
+     * block if every object will be byte aligned, and never in scalar mode.
+     */
+    switch(CbInfo->DataDictPtr->BasicType)
+    {
+    case EDSLIB_BASICTYPE_CONTAINER:
+    case EDSLIB_BASICTYPE_ARRAY:
+    {
+        if (CtlBlock->PlanMode != EDSLIB_ARRAYPLAN_MODE_SCALARS && IsByteOrderMatch && IsPacked &&
+                CtlBlock->Plan->RecordAligned && (CbInfo->StartOffset.Bits & 0x07) == 0)
+        {
+            PackAction = EDSLIB_PACKACTION_BYTECOPY_STRAIGHT;
+        }
+        else
+        {
+            PackAction = EDSLIB_PACKACTION_SUBCOMPONENTS;
+        }
+        break;
+    }
+    case EDSLIB_BASICTYPE_BINARY:
+    {
+        PackAction = EDSLIB_PACKACTION_BYTECOPY_STRAIGHT;
+        break;
+    }
+    case EDSLIB_BASICTYPE_SIGNED_INT:
+    case EDSLIB_BASICTYPE_UNSIGNED_INT:
+    case EDSLIB_BASICTYPE_FLOAT:
+    {
+        if (!IsPacked)
+        {
+            PackAction = EDSLIB_PACKACTION_BITPACK;
+        }
+        else if (IsByteOrderMatch)
+        {
+            PackAction = EDSLIB_PACKACTION_BYTECOPY_STRAIGHT;
+        }
+        else
+        {
+            PackAction = EDSLIB_PACKACTION_BYTECOPY_INVERT;
+        }
+        break;
+    }
+    default:
+    {
+        PackAction = EDSLIB_PACKACTION_NONE;
+        break;
+    }
+    }
+
+    if (PackAction == EDSLIB_PACKACTION_SUBCOMPONENTS)
+    {
+        return EDSLIB_ITERATOR_RC_DESCEND;
+    }
+
+    if (PackAction != EDSLIB_PACKACTION_NONE)
+    {
+        EdsLib_Internal_AddArrayPlanOp(CtlBlock, CbInfo, PackAction);
+        if (CtlBlock->Status != EDSLIB_SUCCESS)
+        {
+            return EDSLIB_ITERATOR_RC_STOP;
+        }
+    }
+
+    return EDSLIB_ITERATOR_RC_CONTINUE;
+}
+
+/*
+ * Check the length, fixed value, and error control fields of a single unpacked object
+ */
+static int32_t EdsLib_Internal_VerifyArrayObject(const EdsLib_ArrayPlan_t *Plan, const uint8_t *NativeObj,
+        const uint8_t *PackedObj)
+{
+    const EdsLib_ArrayPlanOp_t *Op;
+    EdsLib_GenericValueBuffer_t ExpectedValue;
+    EdsLib_GenericValueBuffer_t ActualValue;
+    EdsLib_ConstPtr_t TempSrc;
+    bool IsMatch;
+    uint16_t OpIdx;
+
+    for (OpIdx = 0; OpIdx < Plan->NumOps; ++OpIdx)
+    {
+        Op = &Plan->Ops[OpIdx];
+        if (Op->EntryType == EDSLIB_ENTRYTYPE_CONTAINER_ERROR_CONTROL_ENTRY)
+        {
+            ExpectedValue.Value.UnsignedInteger = EdsLib_ErrorControlCompute(Op->HandlerArg->ErrorControl,
+                    PackedObj, Plan->BaseDictPtr->SizeInfo.Bits, Op->PackedBitOffset);
+            ExpectedValue.ValueType = EDSLIB_BASICTYPE_UNSIGNED_INT;
+        }
+        else
+        {
+            EdsLib_Internal_GetFixedEntryValue(&ExpectedValue, Op->EntryType, Op->HandlerArg,
+                    Op->DataDictPtr, Plan->BaseDictPtr);
+            if (ExpectedValue.ValueType == EDSLIB_BASICTYPE_NONE)
+            {
+                continue;
+            }
+        }
+
+        EdsLib_DataTypeConvert(&ExpectedValue, Op->DataDictPtr->BasicType);
+
+        TempSrc.Addr = &NativeObj[Op->NativeByteOffset];
+        EdsLib_DataTypeLoad_Impl(&ActualValue, TempSrc, Op->DataDictPtr);
+
+        if (ActualValue.ValueType != ExpectedValue.ValueType)
+        {
+            IsMatch = false;
+        }
+        else switch(ExpectedValue.ValueType)
+        {
+        case EDSLIB_BASICTYPE_SIGNED_INT:
+            IsMatch = (ActualValue.Value.SignedInteger == ExpectedValue.Value.SignedInteger);
+            break;
+        case EDSLIB_BASICTYPE_UNSIGNED_INT:
+            IsMatch = (ActualValue.Value.UnsignedInteger == ExpectedValue.Value.UnsignedInteger);
+            break;
+        case EDSLIB_BASICTYPE_BINARY:
+            IsMatch = memcmp(ActualValue.Value.BinaryData,
+                    ExpectedValue.Value.BinaryData, Op->DataDictPtr->SizeInfo.Bytes) == 0;
+            break;
+        default:
+            IsMatch = false;
+            break;
+        }
+
+        if (!IsMatch)
+        {
+            if (Op->EntryType == EDSLIB_ENTRYTYPE_CONTAINER_ERROR_CONTROL_ENTRY)
+            {
+                return EDSLIB_ERROR_CONTROL_MISMATCH;
+            }
+            return EDSLIB_FIELD_MISMATCH;
+        }
+    }
+
+    return EDSLIB_SUCCESS;
+}
+
+int32_t EdsLib_DataTypeArrayPlan_Build(const EdsLib_DatabaseObject_t *GD, const EdsLib_DatabaseRef_t *RefObj,
+        EdsLib_BitPack_OperMode_t OperMode, EdsLib_ArrayPlan_Mode_t PlanMode, uint32_t PackedStrideBits,
+        uint32_t NativeStrideBytes, EdsLib_ArrayPlan_t *Plan)
+{
+    EdsLib_ArrayPlanBuild_ControlBlock_t CtlBlock;
+    int32_t Status;
+
+    EDSLIB_DECLARE_ITERATOR_CB(IteratorState,
+            EDSLIB_ITERATOR_MAX_DEEP_DEPTH,
+            EdsLib_ArrayPlan_Callback,
+            &CtlBlock);
+
+    memset(&CtlBlock, 0, sizeof(CtlBlock));
+    CtlBlock.Plan = Plan;
+    CtlBlock.PlanMode = PlanMode;
+    CtlBlock.Status = EDSLIB_SUCCESS;
+
+    memset(Plan, 0, sizeof(*Plan));
+    Plan->EdsId = EdsLib_Encode_StructId(RefObj);
+    Plan->OperMode = OperMode;
+    Plan->PackedStrideBits = PackedStrideBits;
+    Plan->NativeStrideBytes = NativeStrideBytes;
+    Plan->RecordAligned = (PackedStrideBits & 0x07) == 0;
+    Plan->BaseDictPtr = EdsLib_DataTypeDB_GetEntry(GD, RefObj);
+
+    if (Plan->BaseDictPtr == NULL || Plan->BaseDictPtr->SizeInfo.Bits == 0)
+    {
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    if (PackedStrideBits < Plan->BaseDictPtr->SizeInfo.Bits ||
+            NativeStrideBytes < Plan->BaseDictPtr->SizeInfo.Bytes)
+    {
+        return EDSLIB_BUFFER_SIZE_ERROR;
+    }
+
+    EDSLIB_RESET_ITERATOR_FROM_REFOBJ(IteratorState, *RefObj);
+    Status = EdsLib_DataTypeIterator_Impl(GD, &IteratorState.Cb);
+    if (Status == EDSLIB_SUCCESS)
+    {
+        Status = CtlBlock.Status;
+    }
+
+    /*
+     * Error control is always computed over a byte aligned object
+     */
+    if (Status == EDSLIB_SUCCESS && Plan->ErrorCtlOpIdx != 0 && !Plan->RecordAligned)
+    {
+        Status = EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    return Status;
+}
+
+void EdsLib_DataTypeArrayPlan_PackField(const EdsLib_ArrayPlanOp_t *Op, EdsLib_PackAction_t PackAction,
+        uint8_t *DstPtr, const uint8_t *SrcPtr, uint32_t DstBitOffset)
+{
+    switch(PackAction)
+    {
+    case EDSLIB_PACKACTION_BYTECOPY_STRAIGHT:
+        memcpy(DstPtr, SrcPtr, Op->DataDictPtr->SizeInfo.Bytes);
+        break;
+    case EDSLIB_PACKACTION_BYTECOPY_INVERT:
+        EdsLib_Internal_CopyInverted(DstPtr, SrcPtr, Op->DataDictPtr->SizeInfo.Bytes);
+        break;
+    default:
+        EdsLib_Internal_DoBitwisePack(DstPtr, SrcPtr, Op->DataDictPtr, DstBitOffset);
+        break;
+    }
+}
+
+int32_t EdsLib_DataTypeArrayPlan_Execute(const EdsLib_ArrayPlan_t *Plan, void *DestBuffer, const void *SourceBuffer,
+        uint32_t NumObjects)
+{
+    const EdsLib_ArrayPlanOp_t *Op;
+    const uint8_t *SrcBase;
+    uint8_t *DstBase;
+    uint8_t *PackedPtr;
+    uint8_t *NativePtr;
+    uint64_t RecordBit;
+    uint32_t RecordIdx;
+    uint32_t PackedBit;
+    uint32_t NativeByte;
+    uint32_t AlignBits;
+    uint32_t Size;
+    uint16_t OpIdx;
+    uint16_t RepeatIdx;
+    EdsLib_PackAction_t PackAction;
+    int32_t Status;
+
+    SrcBase = SourceBuffer;
+    DstBase = DestBuffer;
+    RecordBit = 0;
+    Status = EDSLIB_SUCCESS;
+
+    for (RecordIdx = 0; RecordIdx < NumObjects; ++RecordIdx)
+    {
+        if (Plan->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+        {
+            PackedPtr = &DstBase[RecordBit / 8];
+            NativePtr = (uint8_t *)&SrcBase[(size_t)RecordIdx * Plan->NativeStrideBytes];
+            EdsLib_Internal_ClearPackedBits(DstBase, RecordBit, Plan->BaseDictPtr->SizeInfo.Bits);
+        }
+        else
+        {
+            PackedPtr = (uint8_t *)&SrcBase[RecordBit / 8];
+            NativePtr = &DstBase[(size_t)RecordIdx * Plan->NativeStrideBytes];
+            memset(NativePtr, 0, Plan->BaseDictPtr->SizeInfo.Bytes);
+        }
+
+        for (OpIdx = 0; OpIdx < Plan->NumOps; ++OpIdx)
+        {
+            Op = &Plan->Ops[OpIdx];
+
+            /* when packing these are computed afterward, from the EDS rather than the source */
+            if (Plan->OperMode == EDSLIB_BITPACK_OPERMODE_PACK && EdsLib_Internal_IsSpecialEntry(Op->EntryType))
+            {
+                continue;
+            }
+
+            PackedBit = (RecordBit & 0x07) + Op->PackedBitOffset;
+            NativeByte = Op->NativeByteOffset;
+            Size = Op->DataDictPtr->SizeInfo.Bytes;
+
+            for (RepeatIdx = 0; RepeatIdx < Op->RepeatCount; ++RepeatIdx)
+            {
+                AlignBits = PackedBit & 0x07;
+                PackAction = (AlignBits == 0) ? Op->AlignedAction : EDSLIB_PACKACTION_BITPACK;
+
+                if (Plan->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+                {
+                    EdsLib_DataTypeArrayPlan_PackField(Op, PackAction, &PackedPtr[PackedBit / 8],
+                            &NativePtr[NativeByte], AlignBits);
+                }
+                else
+                {
+                    switch(PackAction)
+                    {
+                    case EDSLIB_PACKACTION_BYTECOPY_STRAIGHT:
+                        memcpy(&NativePtr[NativeByte], &PackedPtr[PackedBit / 8], Size);
+                        break;
+                    case EDSLIB_PACKACTION_BYTECOPY_INVERT:
+                        EdsLib_Internal_CopyInverted(&NativePtr[NativeByte], &PackedPtr[PackedBit / 8], Size);
+                        break;
+                    default:
+                        EdsLib_Internal_DoBitwiseUnpack(&NativePtr[NativeByte], &PackedPtr[PackedBit / 8],
+                                Op->DataDictPtr, AlignBits);
+                        break;
+                    }
+                }
+
+                PackedBit += Op->PackedRepeatBits;
+                NativeByte += Op->NativeRepeatBytes;
+            }
+        }
+
+        if (Plan->HasSpecialEntries)
+        {
+            if (Plan->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+            {
+                for (OpIdx = 0; OpIdx < Plan->NumOps; ++OpIdx)
+                {
+                    Op = &Plan->Ops[OpIdx];
+                    if (Op->EntryType == EDSLIB_ENTRYTYPE_CONTAINER_LENGTH_ENTRY ||
+                            Op->EntryType == EDSLIB_ENTRYTYPE_CONTAINER_FIXED_VALUE_ENTRY)
+                    {
+                        EdsLib_Internal_PackFixedEntry(PackedPtr, (RecordBit & 0x07) + Op->PackedBitOffset,
+                                Op->EntryType, Op->HandlerArg, Op->DataDictPtr, Plan->BaseDictPtr);
+                    }
+                }
+
+                if (Plan->ErrorCtlOpIdx != 0)
+                {
+                    Op = &Plan->Ops[Plan->ErrorCtlOpIdx - 1];
+                    EdsLib_UpdateErrorControlField(Op->DataDictPtr, PackedPtr, Plan->BaseDictPtr->SizeInfo.Bits,
+                            Op->HandlerArg->ErrorControl, Op->PackedBitOffset);
+                }
+            }
+            else if (Status == EDSLIB_SUCCESS)
+            {
+                /*
+                 * Only fixed fields and lengths can be verified if the object is not aligned,
+                 * and in that case there is no error control field (checked in the build)
+                 */
+                Status = EdsLib_Internal_VerifyArrayObject(Plan, NativePtr, PackedPtr);
+            }
+        }
+
+        RecordBit += Plan->PackedStrideBits;
+    }
+
+    return Status;
+}
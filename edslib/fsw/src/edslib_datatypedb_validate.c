@@ -0,0 +1,547 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_datatypedb_validate.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Checks the values within native objects against the valid ranges
+ * declared in the EDS, i.e. for limit monitoring of received telemetry.
+ *
+ * The ranges of every field are resolved once into a flat table of checks,
+ * which is then evaluated against each object in a single pass with no
+ * database lookups.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <string.h>
+#include <math.h>
+#include "edslib_internal.h"
+
+/*
+ * Check types, stored in the CheckType field of each check.
+ * The signed flag may be combined with any of the integer checks.
+ */
+#define EDSLIB_RANGECHECK_INTEGER       0x01    /**< Integer within Min/Max */
+#define EDSLIB_RANGECHECK_FLOAT         0x02    /**< Floating point within Min/Max */
+#define EDSLIB_RANGECHECK_ENUM_MASK     0x03    /**< Enumeration within ValidMask */
+#define EDSLIB_RANGECHECK_ENUM_LIST     0x04    /**< Enumeration within ValidValueList */
+#define EDSLIB_RANGECHECK_KIND_MASK     0x0F
+#define EDSLIB_RANGECHECK_SIGNED        0x80
+
+typedef struct
+{
+    EdsLib_DataTypeDB_Validator_t *Validator;
+    int32_t Status;
+} EdsLib_Validator_ControlBlock_t;
+
+/*
+ * Convert the limits of an integer range to inclusive values for the native type.
+ * Returns false if no value can be within the range.
+ */
+static bool EdsLib_Validator_SetIntegerLimits(EdsLib_DataTypeDB_RangeCheck_t *Check,
+        const EdsLib_ValidRangeDescriptor_t *Range, bool IsSigned)
+{
+    intmax_t Min;
+    intmax_t Max;
+
+    Min = INTMAX_MIN;
+    Max = INTMAX_MAX;
+
+    if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_HAS_MIN)
+    {
+        Min = Range->Min.Integer;
+        if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_MIN_EXCLUSIVE)
+        {
+            if (Min == INTMAX_MAX)
+            {
+                return false;
+            }
+            ++Min;
+        }
+    }
+
+    if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_HAS_MAX)
+    {
+        Max = Range->Max.Integer;
+        if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_MAX_EXCLUSIVE)
+        {
+            if (Max == INTMAX_MIN)
+            {
+                return false;
+            }
+            --Max;
+        }
+    }
+
+    if (Max < Min)
+    {
+        return false;
+    }
+
+    if (IsSigned)
+    {
+        Check->Min.SignedInteger = Min;
+        Check->Max.SignedInteger = Max;
+    }
+    else
+    {
+        if (Max < 0)
+        {
+            return false;
+        }
+        Check->Min.UnsignedInteger = (Min < 0) ? 0 : Min;
+        Check->Max.UnsignedInteger = ((Range->Flags & EDSLIB_VALIDRANGE_FLAG_HAS_MAX) == 0) ? UINTMAX_MAX : (uintmax_t)Max;
+    }
+
+    return true;
+}
+
+/*
+ * As EdsLib_Validator_SetIntegerLimits(), for ranges whose limits are stored
+ * as unsigned values.  This is used for unsigned types where the limits may
+ * exceed the range of intmax_t.
+ */
+static bool EdsLib_Validator_SetUnsignedLimits(EdsLib_DataTypeDB_RangeCheck_t *Check,
+        const EdsLib_ValidRangeDescriptor_t *Range, bool IsSigned)
+{
+    uintmax_t Min;
+    uintmax_t Max;
+
+    Min = 0;
+    Max = UINTMAX_MAX;
+
+    if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_HAS_MIN)
+    {
+        Min = Range->Min.Unsigned;
+        if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_MIN_EXCLUSIVE)
+        {
+            if (Min == UINTMAX_MAX)
+            {
+                return false;
+            }
+            ++Min;
+        }
+    }
+
+    if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_HAS_MAX)
+    {
+        Max = Range->Max.Unsigned;
+        if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_MAX_EXCLUSIVE)
+        {
+            if (Max == 0)
+            {
+                return false;
+            }
+            --Max;
+        }
+    }
+
+    if (Max < Min)
+    {
+        return false;
+    }
+
+    if (IsSigned)
+    {
+        if (Min > (uintmax_t)INTMAX_MAX)
+        {
+            return false;
+        }
+        Check->Min.SignedInteger = ((Range->Flags & EDSLIB_VALIDRANGE_FLAG_HAS_MIN) == 0) ? INTMAX_MIN : (intmax_t)Min;
+        Check->Max.SignedInteger = (Max > (uintmax_t)INTMAX_MAX) ? INTMAX_MAX : (intmax_t)Max;
+    }
+    else
+    {
+        Check->Min.UnsignedInteger = Min;
+        Check->Max.UnsignedInteger = Max;
+    }
+
+    return true;
+}
+
+static void EdsLib_Validator_SetFloatLimits(EdsLib_DataTypeDB_RangeCheck_t *Check,
+        const EdsLib_ValidRangeDescriptor_t *Range)
+{
+    Check->Min.FloatingPoint = -INFINITY;
+    Check->Max.FloatingPoint = INFINITY;
+
+    if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_HAS_MIN)
+    {
+        Check->Min.FloatingPoint = Range->Min.Float;
+        if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_MIN_EXCLUSIVE)
+        {
+            Check->Min.FloatingPoint = nextafter(Check->Min.FloatingPoint, INFINITY);
+        }
+    }
+
+    if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_HAS_MAX)
+    {
+        Check->Max.FloatingPoint = Range->Max.Float;
+        if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_MAX_EXCLUSIVE)
+        {
+            Check->Max.FloatingPoint = nextafter(Check->Max.FloatingPoint, -INFINITY);
+        }
+    }
+}
+
+static void EdsLib_Validator_SetEnumValues(EdsLib_DataTypeDB_RangeCheck_t *Check,
+        const EdsLib_ValidRangeDescriptor_t *Range)
+{
+    uintmax_t Span;
+    uint16_t Idx;
+
+    Check->Min.SignedInteger = Range->ValidValueList[0];
+    Check->Max.SignedInteger = Range->ValidValueList[Range->ValidValueListSize - 1];
+    Span = (uintmax_t)Check->Max.SignedInteger - (uintmax_t)Check->Min.SignedInteger;
+
+    /*
+     * Most enumerations are small and dense, so the valid set fits into
+     * a single 64-bit mask relative to the smallest value.
+     */
+    if (Span < 64)
+    {
+        Check->CheckType |= EDSLIB_RANGECHECK_ENUM_MASK;
+        for (Idx = 0; Idx < Range->ValidValueListSize; ++Idx)
+        {
+            Check->ValidMask |= ((uint64_t)1) << ((uintmax_t)Range->ValidValueList[Idx] - Check->Min.UnsignedInteger);
+        }
+    }
+    else
+    {
+        Check->CheckType |= EDSLIB_RANGECHECK_ENUM_LIST;
+        Check->ValidValueList = Range->ValidValueList;
+        Check->ValidValueListSize = Range->ValidValueListSize;
+    }
+}
+
+static void EdsLib_Validator_AddCheck(EdsLib_Validator_ControlBlock_t *CtlBlock,
+        const EdsLib_DataTypeIterator_StackEntry_t *CbInfo, const EdsLib_ValidRangeDescriptor_t *Range)
+{
+    EdsLib_DataTypeDB_Validator_t *Validator = CtlBlock->Validator;
+    EdsLib_DataTypeDB_RangeCheck_t *Check;
+    uint32_t Size;
+    bool IsValid;
+
+    if (Validator->NumChecks >= EDSLIB_VALIDATOR_MAX_CHECKS)
+    {
+        CtlBlock->Status = EDSLIB_INSUFFICIENT_MEMORY;
+        return;
+    }
+
+    Check = &Validator->Checks[Validator->NumChecks];
+    memset(Check, 0, sizeof(*Check));
+
+    Size = CbInfo->DataDictPtr->SizeInfo.Bytes;
+    Check->Offset = CbInfo->StartOffset;
+    Check->Size = Size;
+    Check->EdsId = EdsLib_Encode_StructId(&CbInfo->Details.RefObj);
+
+    switch(CbInfo->DataDictPtr->BasicType)
+    {
+    case EDSLIB_BASICTYPE_SIGNED_INT:
+        Check->CheckType = EDSLIB_RANGECHECK_SIGNED;
+        /* fall through */
+    case EDSLIB_BASICTYPE_UNSIGNED_INT:
+        if (Size != 1 && Size != 2 && Size != 4 && Size != 8)
+        {
+            return;
+        }
+        if (Range->ValidValueListSize > 0)
+        {
+            EdsLib_Validator_SetEnumValues(Check, Range);
+        }
+        else
+        {
+            Check->CheckType |= EDSLIB_RANGECHECK_INTEGER;
+            if (Range->Flags & EDSLIB_VALIDRANGE_FLAG_UNSIGNED)
+            {
+                IsValid = EdsLib_Validator_SetUnsignedLimits(Check, Range,
+                        (Check->CheckType & EDSLIB_RANGECHECK_SIGNED) != 0);
+            }
+            else
+            {
+                IsValid = EdsLib_Validator_SetIntegerLimits(Check, Range,
+                        (Check->CheckType & EDSLIB_RANGECHECK_SIGNED) != 0);
+            }
+            if (!IsValid)
+            {
+                /* nothing is valid, which is represented as an empty enumeration */
+                Check->CheckType = (Check->CheckType & EDSLIB_RANGECHECK_SIGNED) | EDSLIB_RANGECHECK_ENUM_MASK;
+                Check->ValidMask = 0;
+            }
+        }
+        break;
+    case EDSLIB_BASICTYPE_FLOAT:
+        if (Size != sizeof(float) && Size != sizeof(double))
+        {
+            return;
+        }
+        Check->CheckType = EDSLIB_RANGECHECK_FLOAT;
+        EdsLib_Validator_SetFloatLimits(Check, Range);
+        break;
+    default:
+        /* ranges only apply to numbers */
+        return;
+    }
+
+    ++Validator->NumChecks;
+}
+
+static EdsLib_Iterator_Rc_t EdsLib_Validator_Callback(const EdsLib_DatabaseObject_t *GD,
+        EdsLib_Iterator_CbType_t CbType,
+        const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
+        void *OpaqueArg)
+{
+    EdsLib_Validator_ControlBlock_t *CtlBlock = (EdsLib_Validator_ControlBlock_t *)OpaqueArg;
+    const EdsLib_ValidRangeDescriptor_t *Range;
+
+    if (CbType != EDSLIB_ITERATOR_CBTYPE_MEMBER || CbInfo->DataDictPtr == NULL ||
+            CbInfo->Details.EntryType == EDSLIB_ENTRYTYPE_CONTAINER_PADDING_ENTRY)
+    {
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    if (CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_CONTAINER ||
+            CbInfo->DataDictPtr->BasicType == EDSLIB_BASICTYPE_ARRAY)
+    {
+        return EDSLIB_ITERATOR_RC_DESCEND;
+    }
+
+    Range = EdsLib_DataTypeDB_GetValidRange(GD, &CbInfo->Details.RefObj);
+    if (Range != NULL)
+    {
+        EdsLib_Validator_AddCheck(CtlBlock, CbInfo, Range);
+        if (CtlBlock->Status != EDSLIB_SUCCESS)
+        {
+            return EDSLIB_ITERATOR_RC_STOP;
+        }
+    }
+
+    return EDSLIB_ITERATOR_RC_CONTINUE;
+}
+
+/*
+ * Load an integer of the given size, sign or zero extended to the full width
+ */
+static uintmax_t EdsLib_Validator_LoadInteger(const uint8_t *Ptr, uint8_t Size, bool IsSigned)
+{
+    union
+    {
+        int8_t i8;
+        uint8_t u8;
+        int16_t i16;
+        uint16_t u16;
+        int32_t i32;
+        uint32_t u32;
+        int64_t i64;
+        uint64_t u64;
+    } Value;
+
+    memcpy(&Value, Ptr, Size);
+
+    switch(Size)
+    {
+    case 1:
+        return IsSigned ? (uintmax_t)(intmax_t)Value.i8 : Value.u8;
+    case 2:
+        return IsSigned ? (uintmax_t)(intmax_t)Value.i16 : Value.u16;
+    case 4:
+        return IsSigned ? (uintmax_t)(intmax_t)Value.i32 : Value.u32;
+    default:
+        return IsSigned ? (uintmax_t)(intmax_t)Value.i64 : Value.u64;
+    }
+}
+
+static bool EdsLib_Validator_FindValue(const intmax_t *List, uint16_t ListSize, intmax_t Value)
+{
+    uint16_t Low;
+    uint16_t High;
+    uint16_t Mid;
+
+    Low = 0;
+    High = ListSize;
+    while (Low < High)
+    {
+        Mid = Low + ((High - Low) / 2);
+        if (List[Mid] < Value)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+
+    return (Low < ListSize && List[Low] == Value);
+}
+
+int32_t EdsLib_DataTypeDB_InitValidator(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DataTypeDB_Validator_t *Validator)
+{
+    EdsLib_Validator_ControlBlock_t CtlBlock;
+    EdsLib_DatabaseRef_t TempRef;
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    int32_t Status;
+
+    EDSLIB_DECLARE_ITERATOR_CB(IteratorState,
+            EDSLIB_ITERATOR_MAX_DEEP_DEPTH,
+            EdsLib_Validator_Callback,
+            &CtlBlock);
+
+    memset(Validator, 0, sizeof(*Validator));
+    Validator->EdsId = EdsId;
+
+    EdsLib_Decode_StructId(&TempRef, EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &TempRef);
+    if (DataDictPtr == NULL)
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    Validator->NativeSize = DataDictPtr->SizeInfo.Bytes;
+
+    memset(&CtlBlock, 0, sizeof(CtlBlock));
+    CtlBlock.Validator = Validator;
+    CtlBlock.Status = EDSLIB_SUCCESS;
+
+    EDSLIB_RESET_ITERATOR_FROM_REFOBJ(IteratorState, TempRef);
+    Status = EdsLib_DataTypeIterator_Impl(GD, &IteratorState.Cb);
+    if (Status == EDSLIB_SUCCESS)
+    {
+        Status = CtlBlock.Status;
+    }
+
+    return Status;
+}
+
+int32_t EdsLib_DataTypeDB_ValidateObject(const EdsLib_DataTypeDB_Validator_t *Validator, const void *NativeObj,
+        uint32_t NativeSize, EdsLib_DataTypeDB_ValidationResult_t *Result)
+{
+    const EdsLib_DataTypeDB_RangeCheck_t *Check;
+    const uint8_t *BasePtr;
+    uintmax_t IntValue;
+    uintmax_t Delta;
+    double FloatValue;
+    float SingleValue;
+    uint32_t Violation;
+    uint16_t CheckIdx;
+
+    memset(Result, 0, sizeof(*Result));
+    Result->NumChecks = Validator->NumChecks;
+
+    if (NativeSize < Validator->NativeSize)
+    {
+        return EDSLIB_BUFFER_SIZE_ERROR;
+    }
+
+    BasePtr = NativeObj;
+    for (CheckIdx = 0; CheckIdx < Validator->NumChecks; ++CheckIdx)
+    {
+        Check = &Validator->Checks[CheckIdx];
+
+        /*
+         * All limits are inclusive and missing limits are already replaced by the extremes
+         * of the type, so each check is just a pair of comparisons combined without branching.
+         */
+        if (Check->CheckType == EDSLIB_RANGECHECK_FLOAT)
+        {
+            if (Check->Size == sizeof(float))
+            {
+                memcpy(&SingleValue, &BasePtr[Check->Offset.Bytes], sizeof(SingleValue));
+                FloatValue = SingleValue;
+            }
+            else
+            {
+                memcpy(&FloatValue, &BasePtr[Check->Offset.Bytes], sizeof(FloatValue));
+            }
+
+            /* written so that NaN is also a violation */
+            Violation = !((FloatValue >= Check->Min.FloatingPoint) & (FloatValue <= Check->Max.FloatingPoint));
+        }
+        else
+        {
+            IntValue = EdsLib_Validator_LoadInteger(&BasePtr[Check->Offset.Bytes], Check->Size,
+                    (Check->CheckType & EDSLIB_RANGECHECK_SIGNED) != 0);
+
+            switch(Check->CheckType)
+            {
+            case EDSLIB_RANGECHECK_INTEGER | EDSLIB_RANGECHECK_SIGNED:
+                Violation = ((intmax_t)IntValue < Check->Min.SignedInteger) |
+                        ((intmax_t)IntValue > Check->Max.SignedInteger);
+                break;
+            case EDSLIB_RANGECHECK_INTEGER:
+                Violation = (IntValue < Check->Min.UnsignedInteger) | (IntValue > Check->Max.UnsignedInteger);
+                break;
+            case EDSLIB_RANGECHECK_ENUM_MASK:
+            case EDSLIB_RANGECHECK_ENUM_MASK | EDSLIB_RANGECHECK_SIGNED:
+                Delta = IntValue - Check->Min.UnsignedInteger;
+                Violation = (Delta > 63) | (((Check->ValidMask >> (Delta & 63)) & 1) == 0);
+                break;
+            default:
+                Violation = !EdsLib_Validator_FindValue(Check->ValidValueList, Check->ValidValueListSize,
+                        (intmax_t)IntValue);
+                break;
+            }
+        }
+
+        Result->ViolationMask[CheckIdx / 32] |= Violation << (CheckIdx & 31);
+        Result->NumViolations += Violation;
+    }
+
+    if (Result->NumViolations != 0)
+    {
+        return EDSLIB_VALUE_OUT_OF_RANGE;
+    }
+
+    return EDSLIB_SUCCESS;
+}
+
+int32_t EdsLib_DataTypeDB_GetValidatorCheckInfo(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_Validator_t *Validator,
+        uint16_t CheckIdx, EdsLib_DataTypeDB_EntityInfo_t *MemberInfo)
+{
+    const EdsLib_DataTypeDB_RangeCheck_t *Check;
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    EdsLib_DatabaseRef_t TempRef;
+
+    memset(MemberInfo, 0, sizeof(*MemberInfo));
+
+    if (CheckIdx >= Validator->NumChecks)
+    {
+        return EDSLIB_INVALID_INDEX;
+    }
+
+    Check = &Validator->Checks[CheckIdx];
+    MemberInfo->EdsId = Check->EdsId;
+    MemberInfo->Offset = Check->Offset;
+
+    EdsLib_Decode_StructId(&TempRef, Check->EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &TempRef);
+    if (DataDictPtr != NULL)
+    {
+        MemberInfo->MaxSize = DataDictPtr->SizeInfo;
+    }
+
+    return EDSLIB_SUCCESS;
+}
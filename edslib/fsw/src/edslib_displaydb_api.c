@@ -414,44 +414,6 @@ int32_t EdsLib_DisplayDB_LocateSubEntity(const EdsLib_DatabaseObject_t *GD, EdsL
     return Status;
 }
 
-void EdsLib_Generate_Hexdump(void *output, const uint8_t *DataPtr, uint16_t DisplayOffset, uint16_t Count)
-{
-   uint16_t i;
-   char display[20];
-   FILE *fp = output;
-
-   fprintf(fp, "Data Segment Length=%u:",Count);
-   memset(display,0,sizeof(display));
-   for (i = 0; i < Count; ++i)
-   {
-      if ((i & 0x0F) == 0)
-      {
-         fprintf(fp, "  %s\n  %03x:",display,DisplayOffset);
-         memset(display,0,sizeof(display));
-      }
-      fprintf(fp, " %02x",*DataPtr);
-      if (isprint(*DataPtr))
-      {
-         display[i & 0x0F] = *DataPtr;
-      }
-      else
-      {
-         display[i & 0x0F] = '.';
-      }
-      ++DataPtr;
-      ++DisplayOffset;
-   }
-   if (i > 0)
-   {
-      while (i & 0xF)
-      {
-         fprintf(fp, "   ");
-         ++i;
-      }
-   }
-   fprintf(fp, "  %s\n", display);
-}
-
 int32_t EdsLib_Scalar_ToString(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, char *OutputBuffer, uint32_t BufferSize, const void *SrcPtr)
 {
     EdsLib_DatabaseRef_t TempRef;
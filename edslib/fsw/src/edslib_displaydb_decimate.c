@@ -0,0 +1,547 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_displaydb_decimate.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Thins out streams of packed EDS messages for displays and trending tools,
+ * which do not need every sample of high rate telemetry.
+ *
+ * The keep or drop decision is made from the packed data alone: the time or
+ * deadband field is located by name once, and then read at a fixed bit offset
+ * from every packet.  For time buckets, the numeric fields of the message are
+ * taken from the array plan of the type, which is a flat list of every scalar
+ * field in the packed layout.  Each packet in the bucket is folded into one
+ * running value per field, and when the bucket is complete those values are
+ * written over the fields of the first packet, again in packed form.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <string.h>
+#include <math.h>
+
+#include "edslib_displaydb.h"
+#include "edslib_internal.h"
+
+/*
+ * Get the location and encoding of a field within the packed data.  These
+ * are the same rules as for packet filter fields.
+ */
+static int32_t EdsLib_Decimate_SetField(const EdsLib_DataTypeDB_Entry_t *DataDictPtr, uint32_t BitOffset,
+        EdsLib_DisplayDB_DecimateField_t *Field)
+{
+    EdsLib_PackedField_t PackedField;
+    int32_t Status;
+
+    Status = EdsLib_PackedField_Init(DataDictPtr, BitOffset, &PackedField);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return Status;
+    }
+
+    memset(Field, 0, sizeof(*Field));
+    Field->BitOffset = PackedField.BitOffset;
+    Field->NumBits = PackedField.NumBits;
+    Field->FieldType = PackedField.FieldType;
+    Field->LittleEndian = PackedField.LittleEndian;
+
+    return EDSLIB_SUCCESS;
+}
+
+static void EdsLib_Decimate_UpdateRequiredBits(EdsLib_DisplayDB_Decimator_t *Decimator, uint32_t EndBit)
+{
+    if (EndBit > Decimator->RequiredBits)
+    {
+        Decimator->RequiredBits = EndBit;
+    }
+}
+
+/*
+ * Locate the time or deadband field by name
+ */
+static int32_t EdsLib_Decimate_SetKeyField(const EdsLib_DatabaseObject_t *GD, EdsLib_DisplayDB_Decimator_t *Decimator)
+{
+    EdsLib_DataTypeDB_EntityInfo_t FieldInfo;
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    EdsLib_DatabaseRef_t RefObj;
+    int32_t Status;
+
+    if (Decimator->Config.FieldName == NULL)
+    {
+        return EDSLIB_NAME_NOT_FOUND;
+    }
+
+    Status = EdsLib_DisplayDB_LocateSubEntity(GD, Decimator->EdsId, Decimator->Config.FieldName, &FieldInfo);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return EDSLIB_NAME_NOT_FOUND;
+    }
+
+    EdsLib_Decode_StructId(&RefObj, FieldInfo.EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &RefObj);
+    if (DataDictPtr == NULL)
+    {
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    Status = EdsLib_Decimate_SetField(DataDictPtr, FieldInfo.Offset.Bits, &Decimator->KeyField);
+    if (Status == EDSLIB_SUCCESS)
+    {
+        EdsLib_Decimate_UpdateRequiredBits(Decimator, FieldInfo.Offset.Bits + Decimator->KeyField.NumBits);
+    }
+
+    return Status;
+}
+
+/*
+ * Collect every numeric field after the header from the array plan of the type
+ */
+static int32_t EdsLib_Decimate_SetFields(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseId,
+        EdsLib_DisplayDB_Decimator_t *Decimator)
+{
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    const EdsLib_ArrayPlanOp_t *Op;
+    EdsLib_DisplayDB_DecimateField_t *Field;
+    EdsLib_DatabaseRef_t RefObj;
+    EdsLib_ArrayPlan_t Plan;
+    uint32_t HeaderBits;
+    uint32_t BitOffset;
+    uint16_t OpIdx;
+    uint16_t RepeatIdx;
+    int32_t Status;
+
+    HeaderBits = 0;
+    if (!EdsLib_Is_Similar(BaseId, Decimator->EdsId))
+    {
+        EdsLib_Decode_StructId(&RefObj, BaseId);
+        DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &RefObj);
+        if (DataDictPtr == NULL)
+        {
+            return EDSLIB_INCOMPLETE_DB_OBJECT;
+        }
+        HeaderBits = DataDictPtr->SizeInfo.Bits;
+    }
+
+    EdsLib_Decode_StructId(&RefObj, Decimator->EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, &RefObj);
+    if (DataDictPtr == NULL)
+    {
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    /*
+     * The plan is only used to list every scalar field of a single packet,
+     * which always starts at bit 0, so it is built as a byte aligned record.
+     */
+    Status = EdsLib_DataTypeArrayPlan_Build(GD, &RefObj, EDSLIB_BITPACK_OPERMODE_PACK, EDSLIB_ARRAYPLAN_MODE_SCALARS,
+            (DataDictPtr->SizeInfo.Bits + 7) & ~UINT32_C(7), DataDictPtr->SizeInfo.Bytes, &Plan);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return Status;
+    }
+
+    for (OpIdx = 0; OpIdx < Plan.NumOps; ++OpIdx)
+    {
+        Op = &Plan.Ops[OpIdx];
+
+        /* length, fixed value and error control fields are never combined */
+        if (Op->EntryType == EDSLIB_ENTRYTYPE_CONTAINER_ERROR_CONTROL_ENTRY ||
+                Op->EntryType == EDSLIB_ENTRYTYPE_CONTAINER_LENGTH_ENTRY ||
+                Op->EntryType == EDSLIB_ENTRYTYPE_CONTAINER_FIXED_VALUE_ENTRY)
+        {
+            continue;
+        }
+
+        for (RepeatIdx = 0; RepeatIdx < Op->RepeatCount; ++RepeatIdx)
+        {
+            BitOffset = Op->PackedBitOffset + (RepeatIdx * Op->PackedRepeatBits);
+            if (BitOffset < HeaderBits || (Decimator->Config.Policy == EDSLIB_DECIMATE_POLICY_TIME_BUCKET &&
+                    BitOffset == Decimator->KeyField.BitOffset))
+            {
+                continue;
+            }
+
+            if (Decimator->NumFields >= EDSLIB_DECIMATOR_MAX_FIELDS)
+            {
+                return EDSLIB_INSUFFICIENT_MEMORY;
+            }
+
+            /* anything that is not a plain number keeps the value from the first packet */
+            Field = &Decimator->Fields[Decimator->NumFields];
+            if (EdsLib_Decimate_SetField(Op->DataDictPtr, BitOffset, Field) == EDSLIB_SUCCESS)
+            {
+                EdsLib_Decimate_UpdateRequiredBits(Decimator, BitOffset + Field->NumBits);
+                ++Decimator->NumFields;
+            }
+        }
+    }
+
+    if (Plan.ErrorCtlOpIdx != 0)
+    {
+        Op = &Plan.Ops[Plan.ErrorCtlOpIdx - 1];
+        Decimator->ErrorCtlDictPtr = Op->DataDictPtr;
+        Decimator->ErrorCtlType = Op->HandlerArg->ErrorControl;
+        Decimator->ErrorCtlOffsetBits = Op->PackedBitOffset;
+        EdsLib_Decimate_UpdateRequiredBits(Decimator, DataDictPtr->SizeInfo.Bits);
+    }
+
+    return EDSLIB_SUCCESS;
+}
+
+int32_t EdsLib_DisplayDB_InitDecimator(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseId, EdsLib_Id_t EdsId,
+        const EdsLib_DisplayDB_DecimateConfig_t *Config, EdsLib_DisplayDB_Decimator_t *Decimator)
+{
+    int32_t Status;
+
+    memset(Decimator, 0, sizeof(*Decimator));
+    Decimator->EdsId = EdsId;
+    Decimator->Config = *Config;
+
+    switch(Config->Policy)
+    {
+    case EDSLIB_DECIMATE_POLICY_KEEP_EVERY_N:
+        if (Config->KeepEveryN == 0)
+        {
+            return EDSLIB_FAILURE;
+        }
+        Status = EDSLIB_SUCCESS;
+        break;
+    case EDSLIB_DECIMATE_POLICY_DEADBAND:
+        if (!(Config->Deadband >= 0.0))
+        {
+            return EDSLIB_FAILURE;
+        }
+        Status = EdsLib_Decimate_SetKeyField(GD, Decimator);
+        break;
+    case EDSLIB_DECIMATE_POLICY_TIME_BUCKET:
+        if (!(Config->BucketWidth > 0.0) || Config->Buffer == NULL ||
+                Config->Aggregate > EDSLIB_DECIMATE_AGGREGATE_MAX)
+        {
+            return EDSLIB_FAILURE;
+        }
+        Status = EdsLib_Decimate_SetKeyField(GD, Decimator);
+        if (Status == EDSLIB_SUCCESS)
+        {
+            Status = EdsLib_Decimate_SetFields(GD, BaseId, Decimator);
+        }
+        break;
+    default:
+        Status = EDSLIB_FAILURE;
+        break;
+    }
+
+    if (Status != EDSLIB_SUCCESS)
+    {
+        Decimator->NumFields = 0;
+    }
+
+    return Status;
+}
+
+/*
+ * Read a numeric field from the packed data
+ */
+static inline void EdsLib_Decimate_LoadField(const EdsLib_DisplayDB_DecimateField_t *Field, const uint8_t *PackedData,
+        EdsLib_DisplayDB_FilterValue_t *Value)
+{
+    EdsLib_PackedField_Load(PackedData, Field->BitOffset, Field->NumBits, Field->FieldType, Field->LittleEndian,
+            ~UINT64_C(0), Value);
+}
+
+static inline double EdsLib_Decimate_ToDouble(const EdsLib_DisplayDB_DecimateField_t *Field,
+        const EdsLib_DisplayDB_FilterValue_t *Value)
+{
+    switch(Field->FieldType)
+    {
+    case EDSLIB_PACKEDFIELD_VALUE_FLOAT:
+        return Value->Float;
+    case EDSLIB_PACKEDFIELD_VALUE_SIGNED:
+        return (double)Value->Signed;
+    default:
+        return (double)Value->Unsigned;
+    }
+}
+
+/*
+ * Check if the first value is less than the second.  A NaN is treated as
+ * less than anything, so it is replaced by the first real number seen.
+ */
+static inline bool EdsLib_Decimate_IsLess(uint8_t FieldType, const EdsLib_DisplayDB_FilterValue_t *Left,
+        const EdsLib_DisplayDB_FilterValue_t *Right)
+{
+    switch(FieldType)
+    {
+    case EDSLIB_PACKEDFIELD_VALUE_FLOAT:
+        return (Left->Float < Right->Float || (Left->Float != Left->Float && Right->Float == Right->Float));
+    case EDSLIB_PACKEDFIELD_VALUE_SIGNED:
+        return (Left->Signed < Right->Signed);
+    default:
+        return (Left->Unsigned < Right->Unsigned);
+    }
+}
+
+/*
+ * Fold one packet into the running values of all fields.  Means are summed
+ * as floating point, so very large 64 bit integers lose their low bits.
+ */
+static void EdsLib_Decimate_Fold(EdsLib_DisplayDB_Decimator_t *Decimator, const uint8_t *PackedData)
+{
+    EdsLib_DisplayDB_DecimateField_t *Field;
+    EdsLib_DisplayDB_FilterValue_t Value;
+    uint16_t FieldIdx;
+
+    Field = Decimator->Fields;
+    for (FieldIdx = 0; FieldIdx < Decimator->NumFields; ++FieldIdx)
+    {
+        EdsLib_Decimate_LoadField(Field, PackedData, &Value);
+        switch(Decimator->Config.Aggregate)
+        {
+        case EDSLIB_DECIMATE_AGGREGATE_MIN:
+            if (Decimator->SampleCount == 0 || EdsLib_Decimate_IsLess(Field->FieldType, &Value, &Field->Value))
+            {
+                Field->Value = Value;
+            }
+            break;
+        case EDSLIB_DECIMATE_AGGREGATE_MAX:
+            if (Decimator->SampleCount == 0 || EdsLib_Decimate_IsLess(Field->FieldType, &Field->Value, &Value))
+            {
+                Field->Value = Value;
+            }
+            break;
+        default:
+            if (Decimator->SampleCount == 0)
+            {
+                Field->Value.Float = 0.0;
+            }
+            Field->Value.Float += EdsLib_Decimate_ToDouble(Field, &Value);
+            break;
+        }
+        ++Field;
+    }
+
+    ++Decimator->SampleCount;
+}
+
+/*
+ * Round a mean to the nearest value of an integer field, staying within its range
+ */
+static uint64_t EdsLib_Decimate_RoundMean(const EdsLib_DisplayDB_DecimateField_t *Field, double Mean)
+{
+    double Limit;
+
+    Mean = floor(Mean + 0.5);
+    if (Field->FieldType == EDSLIB_PACKEDFIELD_VALUE_SIGNED)
+    {
+        Limit = ldexp(1.0, Field->NumBits - 1);
+        if (Mean >= Limit)
+        {
+            return (UINT64_C(1) << (Field->NumBits - 1)) - 1;
+        }
+        if (Mean < -Limit)
+        {
+            return -(UINT64_C(1) << (Field->NumBits - 1));
+        }
+        return (uint64_t)(int64_t)Mean;
+    }
+
+    Limit = ldexp(1.0, Field->NumBits);
+    if (Mean >= Limit)
+    {
+        return ~UINT64_C(0);
+    }
+    if (Mean < 0.0)
+    {
+        return 0;
+    }
+    return (uint64_t)Mean;
+}
+
+/*
+ * Write the combined values over the fields of the held packet, and copy it to the output
+ */
+static EdsLib_DisplayDB_DecimateResult_t EdsLib_Decimate_Emit(EdsLib_DisplayDB_Decimator_t *Decimator,
+        void *Output, uint32_t *OutputSize)
+{
+    const EdsLib_DisplayDB_DecimateField_t *Field;
+    uint8_t *HeldData = Decimator->Config.Buffer;
+    uint64_t Raw;
+    double Mean;
+    uint16_t FieldIdx;
+
+    Field = Decimator->Fields;
+    for (FieldIdx = 0; FieldIdx < Decimator->NumFields; ++FieldIdx)
+    {
+        if (Decimator->Config.Aggregate != EDSLIB_DECIMATE_AGGREGATE_MEAN)
+        {
+            if (Field->FieldType != EDSLIB_PACKEDFIELD_VALUE_FLOAT)
+            {
+                /* signed values share the same bits, and are truncated to the field size */
+                Raw = Field->Value.Unsigned;
+            }
+            else if (Field->NumBits == 32)
+            {
+                Raw = EdsLib_PackedAccess_FromFloat((float)Field->Value.Float);
+            }
+            else
+            {
+                Raw = EdsLib_PackedAccess_FromDouble(Field->Value.Float);
+            }
+        }
+        else
+        {
+            Mean = Field->Value.Float / (double)Decimator->SampleCount;
+            if (Field->FieldType != EDSLIB_PACKEDFIELD_VALUE_FLOAT)
+            {
+                Raw = EdsLib_Decimate_RoundMean(Field, Mean);
+            }
+            else if (Field->NumBits == 32)
+            {
+                Raw = EdsLib_PackedAccess_FromFloat((float)Mean);
+            }
+            else
+            {
+                Raw = EdsLib_PackedAccess_FromDouble(Mean);
+            }
+        }
+
+        if (Field->LittleEndian)
+        {
+            EdsLib_PackedAccess_SetBitsLE(HeldData, Field->BitOffset, Field->NumBits, Raw);
+        }
+        else
+        {
+            EdsLib_PackedAccess_SetBitsBE(HeldData, Field->BitOffset, Field->NumBits, Raw);
+        }
+        ++Field;
+    }
+
+    /* the held packet may be longer than the static size of the type, so the whole packet is covered */
+    if (Decimator->ErrorCtlDictPtr != NULL)
+    {
+        EdsLib_UpdateErrorControlField(Decimator->ErrorCtlDictPtr, HeldData, 8 * Decimator->HeldSize,
+                Decimator->ErrorCtlType, Decimator->ErrorCtlOffsetBits);
+    }
+
+    memcpy(Output, HeldData, Decimator->HeldSize);
+    *OutputSize = Decimator->HeldSize;
+    Decimator->HeldSize = 0;
+    Decimator->SampleCount = 0;
+
+    return EDSLIB_DECIMATE_EMIT;
+}
+
+EdsLib_DisplayDB_DecimateResult_t EdsLib_DisplayDB_Decimate(EdsLib_DisplayDB_Decimator_t *Decimator,
+        const void *PackedData, uint32_t PackedSize, void *Output, uint32_t *OutputSize)
+{
+    EdsLib_DisplayDB_DecimateResult_t Result;
+    EdsLib_DisplayDB_FilterValue_t Value;
+    double KeyValue;
+    double Bucket;
+
+    if (((uint64_t)PackedSize * 8) < Decimator->RequiredBits)
+    {
+        return EDSLIB_DECIMATE_INVALID;
+    }
+
+    switch(Decimator->Config.Policy)
+    {
+    case EDSLIB_DECIMATE_POLICY_KEEP_EVERY_N:
+        Result = (Decimator->PacketCount == 0) ? EDSLIB_DECIMATE_KEEP : EDSLIB_DECIMATE_DROP;
+        ++Decimator->PacketCount;
+        if (Decimator->PacketCount >= Decimator->Config.KeepEveryN)
+        {
+            Decimator->PacketCount = 0;
+        }
+        break;
+
+    case EDSLIB_DECIMATE_POLICY_DEADBAND:
+        EdsLib_Decimate_LoadField(&Decimator->KeyField, PackedData, &Value);
+        KeyValue = EdsLib_Decimate_ToDouble(&Decimator->KeyField, &Value);
+        /* the packet count is only used to tell if anything was kept yet */
+        if (Decimator->PacketCount != 0 && !(fabs(KeyValue - Decimator->Bucket) > Decimator->Config.Deadband))
+        {
+            Result = EDSLIB_DECIMATE_DROP;
+        }
+        else
+        {
+            Decimator->Bucket = KeyValue;
+            Decimator->PacketCount = 1;
+            Result = EDSLIB_DECIMATE_KEEP;
+        }
+        break;
+
+    case EDSLIB_DECIMATE_POLICY_TIME_BUCKET:
+        EdsLib_Decimate_LoadField(&Decimator->KeyField, PackedData, &Value);
+        KeyValue = EdsLib_Decimate_ToDouble(&Decimator->KeyField, &Value);
+        Bucket = floor(KeyValue / Decimator->Config.BucketWidth);
+
+        if (Decimator->HeldSize != 0 && Bucket == Decimator->Bucket)
+        {
+            EdsLib_Decimate_Fold(Decimator, PackedData);
+            Result = EDSLIB_DECIMATE_DROP;
+            break;
+        }
+
+        if (PackedSize > Decimator->Config.BufferSize ||
+                (Decimator->HeldSize != 0 && (Output == NULL || *OutputSize < Decimator->HeldSize)))
+        {
+            return EDSLIB_DECIMATE_INVALID;
+        }
+
+        Result = EDSLIB_DECIMATE_DROP;
+        if (Decimator->HeldSize != 0)
+        {
+            Result = EdsLib_Decimate_Emit(Decimator, Output, OutputSize);
+        }
+
+        /* this packet starts the next bucket */
+        memcpy(Decimator->Config.Buffer, PackedData, PackedSize);
+        Decimator->HeldSize = PackedSize;
+        Decimator->Bucket = Bucket;
+        EdsLib_Decimate_Fold(Decimator, PackedData);
+        break;
+
+    default:
+        Result = EDSLIB_DECIMATE_INVALID;
+        break;
+    }
+
+    return Result;
+}
+
+EdsLib_DisplayDB_DecimateResult_t EdsLib_DisplayDB_FlushDecimator(EdsLib_DisplayDB_Decimator_t *Decimator,
+        void *Output, uint32_t *OutputSize)
+{
+    if (Decimator->Config.Policy != EDSLIB_DECIMATE_POLICY_TIME_BUCKET || Decimator->HeldSize == 0)
+    {
+        return EDSLIB_DECIMATE_DROP;
+    }
+
+    if (*OutputSize < Decimator->HeldSize)
+    {
+        return EDSLIB_DECIMATE_INVALID;
+    }
+
+    return EdsLib_Decimate_Emit(Decimator, Output, OutputSize);
+}
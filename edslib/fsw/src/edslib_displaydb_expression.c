@@ -0,0 +1,742 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_displaydb_expression.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Compiles and evaluates derived parameter expressions over the fields
+ * of EDS defined types, i.e. "Power = Voltage * Current".
+ *
+ * The expression text is parsed once into a small stack-based program,
+ * where each field reference becomes a load from a fixed native offset.
+ * Evaluation processes the objects in fixed size blocks, and each
+ * instruction is applied to the whole block before moving to the next
+ * one.  The loads use the same block loaders as the array conversion
+ * functions, and the arithmetic loops are free of type dispatch so that
+ * the compiler can vectorize them.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <math.h>
+
+#include "edslib_displaydb.h"
+#include "edslib_internal.h"
+
+/**
+ * Number of objects evaluated per block.  The evaluation stack on the
+ * C stack is this many doubles per level of EDSLIB_EXPRESSION_MAX_DEPTH.
+ */
+#ifndef EDSLIB_EXPRESSION_BLOCK_SIZE
+#define EDSLIB_EXPRESSION_BLOCK_SIZE    32
+#endif
+
+/**
+ * The longest field name that can appear in an expression
+ */
+#define EDSLIB_EXPRESSION_MAX_NAME      128
+
+/**
+ * The deepest nesting of parentheses, functions and unary operators in an expression
+ */
+#define EDSLIB_EXPRESSION_MAX_NESTING   32
+
+typedef enum
+{
+    EDSLIB_EXPR_OP_NONE = 0,
+    EDSLIB_EXPR_OP_LOAD,
+    EDSLIB_EXPR_OP_CONST,
+    EDSLIB_EXPR_OP_NEG,
+    EDSLIB_EXPR_OP_ABS,
+    EDSLIB_EXPR_OP_SQRT,
+    EDSLIB_EXPR_OP_ADD,
+    EDSLIB_EXPR_OP_SUB,
+    EDSLIB_EXPR_OP_MUL,
+    EDSLIB_EXPR_OP_DIV,
+    EDSLIB_EXPR_OP_MIN,
+    EDSLIB_EXPR_OP_MAX
+} EdsLib_Expression_OpCode_t;
+
+typedef struct
+{
+    const EdsLib_DatabaseObject_t *GD;
+    EdsLib_DisplayDB_Expression_t *Expression;
+    const char *Text;
+    const char *Pos;
+    uint16_t Depth;
+    uint16_t Nesting;
+    int32_t Status;
+} EdsLib_Expression_Compiler_t;
+
+static void EdsLib_Expression_Parse(EdsLib_Expression_Compiler_t *Compiler);
+
+static void EdsLib_Expression_SetError(EdsLib_Expression_Compiler_t *Compiler, int32_t Status)
+{
+    if (Compiler->Status == EDSLIB_SUCCESS)
+    {
+        Compiler->Status = Status;
+        Compiler->Expression->ErrorPos = Compiler->Pos - Compiler->Text;
+    }
+}
+
+static void EdsLib_Expression_SkipSpace(EdsLib_Expression_Compiler_t *Compiler)
+{
+    while (isspace((int)*Compiler->Pos))
+    {
+        ++Compiler->Pos;
+    }
+}
+
+static bool EdsLib_Expression_Accept(EdsLib_Expression_Compiler_t *Compiler, char Token)
+{
+    EdsLib_Expression_SkipSpace(Compiler);
+    if (*Compiler->Pos != Token)
+    {
+        return false;
+    }
+
+    ++Compiler->Pos;
+    return true;
+}
+
+static EdsLib_DisplayDB_ExprOp_t *EdsLib_Expression_Emit(EdsLib_Expression_Compiler_t *Compiler, uint8_t OpCode)
+{
+    EdsLib_DisplayDB_Expression_t *Expression = Compiler->Expression;
+    EdsLib_DisplayDB_ExprOp_t *Op;
+
+    if (Expression->NumOps >= EDSLIB_EXPRESSION_MAX_OPS)
+    {
+        EdsLib_Expression_SetError(Compiler, EDSLIB_INSUFFICIENT_MEMORY);
+        return NULL;
+    }
+
+    Op = &Expression->Ops[Expression->NumOps];
+    memset(Op, 0, sizeof(*Op));
+    Op->OpCode = OpCode;
+    ++Expression->NumOps;
+
+    return Op;
+}
+
+static void EdsLib_Expression_Push(EdsLib_Expression_Compiler_t *Compiler)
+{
+    ++Compiler->Depth;
+    if (Compiler->Depth > EDSLIB_EXPRESSION_MAX_DEPTH)
+    {
+        EdsLib_Expression_SetError(Compiler, EDSLIB_INSUFFICIENT_MEMORY);
+    }
+    else if (Compiler->Depth > Compiler->Expression->MaxDepth)
+    {
+        Compiler->Expression->MaxDepth = Compiler->Depth;
+    }
+}
+
+static void EdsLib_Expression_EmitConstant(EdsLib_Expression_Compiler_t *Compiler, double Value)
+{
+    EdsLib_DisplayDB_ExprOp_t *Op;
+
+    Op = EdsLib_Expression_Emit(Compiler, EDSLIB_EXPR_OP_CONST);
+    if (Op != NULL)
+    {
+        Op->Constant = Value;
+        EdsLib_Expression_Push(Compiler);
+    }
+}
+
+static double EdsLib_Expression_Apply(uint8_t OpCode, double Left, double Right)
+{
+    switch(OpCode)
+    {
+    case EDSLIB_EXPR_OP_NEG:
+        return -Left;
+    case EDSLIB_EXPR_OP_ABS:
+        return fabs(Left);
+    case EDSLIB_EXPR_OP_SQRT:
+        return sqrt(Left);
+    case EDSLIB_EXPR_OP_ADD:
+        return Left + Right;
+    case EDSLIB_EXPR_OP_SUB:
+        return Left - Right;
+    case EDSLIB_EXPR_OP_MUL:
+        return Left * Right;
+    case EDSLIB_EXPR_OP_DIV:
+        return Left / Right;
+    case EDSLIB_EXPR_OP_MIN:
+        return (Right < Left) ? Right : Left;
+    case EDSLIB_EXPR_OP_MAX:
+        return (Right > Left) ? Right : Left;
+    default:
+        break;
+    }
+
+    return Left;
+}
+
+/*
+ * Unary operations on a constant are folded into the constant
+ */
+static void EdsLib_Expression_EmitUnary(EdsLib_Expression_Compiler_t *Compiler, uint8_t OpCode)
+{
+    EdsLib_DisplayDB_Expression_t *Expression = Compiler->Expression;
+    EdsLib_DisplayDB_ExprOp_t *Last;
+
+    if (Compiler->Status != EDSLIB_SUCCESS)
+    {
+        return;
+    }
+
+    Last = &Expression->Ops[Expression->NumOps - 1];
+    if (Last->OpCode == EDSLIB_EXPR_OP_CONST)
+    {
+        Last->Constant = EdsLib_Expression_Apply(OpCode, Last->Constant, 0.0);
+    }
+    else
+    {
+        EdsLib_Expression_Emit(Compiler, OpCode);
+    }
+}
+
+/*
+ * A constant right operand is moved into the binary operation itself,
+ * and if both operands are constants the operation is folded entirely.
+ */
+static void EdsLib_Expression_EmitBinary(EdsLib_Expression_Compiler_t *Compiler, uint8_t OpCode)
+{
+    EdsLib_DisplayDB_Expression_t *Expression = Compiler->Expression;
+    EdsLib_DisplayDB_ExprOp_t *Left;
+    EdsLib_DisplayDB_ExprOp_t *Right;
+
+    if (Compiler->Status != EDSLIB_SUCCESS)
+    {
+        return;
+    }
+
+    --Compiler->Depth;
+    Right = &Expression->Ops[Expression->NumOps - 1];
+    if (Right->OpCode != EDSLIB_EXPR_OP_CONST)
+    {
+        EdsLib_Expression_Emit(Compiler, OpCode);
+        return;
+    }
+
+    Left = &Expression->Ops[Expression->NumOps - 2];
+    if (Left->OpCode == EDSLIB_EXPR_OP_CONST)
+    {
+        Left->Constant = EdsLib_Expression_Apply(OpCode, Left->Constant, Right->Constant);
+        --Expression->NumOps;
+        return;
+    }
+
+    Right->OpCode = OpCode;
+    Right->ConstOperand = true;
+}
+
+static void EdsLib_Expression_ParseField(EdsLib_Expression_Compiler_t *Compiler)
+{
+    EdsLib_DataTypeDB_EntityInfo_t FieldInfo;
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    EdsLib_DisplayDB_ExprOp_t *Op;
+    char Name[EDSLIB_EXPRESSION_MAX_NAME];
+    const char *EndPos;
+    int32_t Status;
+
+    EndPos = Compiler->Pos;
+    while (isalnum((int)*EndPos) || *EndPos == '_' || *EndPos == '.' || *EndPos == '[' || *EndPos == ']')
+    {
+        ++EndPos;
+    }
+
+    if ((size_t)(EndPos - Compiler->Pos) >= sizeof(Name))
+    {
+        EdsLib_Expression_SetError(Compiler, EDSLIB_NAME_NOT_FOUND);
+        return;
+    }
+
+    memcpy(Name, Compiler->Pos, EndPos - Compiler->Pos);
+    Name[EndPos - Compiler->Pos] = 0;
+
+    Status = EdsLib_DisplayDB_LocateSubEntity(Compiler->GD, Compiler->Expression->EdsId, Name, &FieldInfo);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        EdsLib_Expression_SetError(Compiler, EDSLIB_NAME_NOT_FOUND);
+        return;
+    }
+
+    Status = EdsLib_DataTypeDB_GetTypeInfo(Compiler->GD, FieldInfo.EdsId, &TypeInfo);
+    if (Status != EDSLIB_SUCCESS || !EdsLib_DataTypeConvert_IsNumeric(TypeInfo.ElemType, TypeInfo.Size.Bytes) ||
+            (FieldInfo.Offset.Bytes + TypeInfo.Size.Bytes) > Compiler->Expression->NativeSize)
+    {
+        EdsLib_Expression_SetError(Compiler, EDSLIB_INVALID_SIZE_OR_TYPE);
+        return;
+    }
+
+    Op = EdsLib_Expression_Emit(Compiler, EDSLIB_EXPR_OP_LOAD);
+    if (Op != NULL)
+    {
+        Op->FieldType = TypeInfo.ElemType;
+        Op->FieldSize = TypeInfo.Size.Bytes;
+        Op->FieldOffset = FieldInfo.Offset.Bytes;
+        EdsLib_Expression_Push(Compiler);
+    }
+
+    Compiler->Pos = EndPos;
+}
+
+static void EdsLib_Expression_ParseFunction(EdsLib_Expression_Compiler_t *Compiler, const char *Name, uint32_t NameLen)
+{
+    uint8_t OpCode;
+    uint16_t NumArgs;
+    bool IsAverage;
+
+    OpCode = EDSLIB_EXPR_OP_NONE;
+    IsAverage = false;
+    if (NameLen == 3 && memcmp(Name, "abs", 3) == 0)
+    {
+        OpCode = EDSLIB_EXPR_OP_ABS;
+    }
+    else if (NameLen == 4 && memcmp(Name, "sqrt", 4) == 0)
+    {
+        OpCode = EDSLIB_EXPR_OP_SQRT;
+    }
+    else if (NameLen == 3 && memcmp(Name, "min", 3) == 0)
+    {
+        OpCode = EDSLIB_EXPR_OP_MIN;
+    }
+    else if (NameLen == 3 && memcmp(Name, "max", 3) == 0)
+    {
+        OpCode = EDSLIB_EXPR_OP_MAX;
+    }
+    else if (NameLen == 3 && memcmp(Name, "avg", 3) == 0)
+    {
+        OpCode = EDSLIB_EXPR_OP_ADD;
+        IsAverage = true;
+    }
+    else
+    {
+        EdsLib_Expression_SetError(Compiler, EDSLIB_NAME_NOT_FOUND);
+        return;
+    }
+
+    /* the opening parenthesis was already checked by the caller */
+    Compiler->Pos = Name + NameLen;
+    EdsLib_Expression_Accept(Compiler, '(');
+
+    NumArgs = 0;
+    do
+    {
+        EdsLib_Expression_Parse(Compiler);
+        if (NumArgs > 0)
+        {
+            EdsLib_Expression_EmitBinary(Compiler, OpCode);
+        }
+        ++NumArgs;
+    }
+    while (Compiler->Status == EDSLIB_SUCCESS && EdsLib_Expression_Accept(Compiler, ','));
+
+    if (!EdsLib_Expression_Accept(Compiler, ')'))
+    {
+        EdsLib_Expression_SetError(Compiler, EDSLIB_FAILURE);
+        return;
+    }
+
+    if (OpCode == EDSLIB_EXPR_OP_ABS || OpCode == EDSLIB_EXPR_OP_SQRT)
+    {
+        if (NumArgs != 1)
+        {
+            EdsLib_Expression_SetError(Compiler, EDSLIB_FAILURE);
+        }
+        EdsLib_Expression_EmitUnary(Compiler, OpCode);
+    }
+    else if (IsAverage && NumArgs > 1)
+    {
+        EdsLib_Expression_EmitConstant(Compiler, 1.0 / NumArgs);
+        EdsLib_Expression_EmitBinary(Compiler, EDSLIB_EXPR_OP_MUL);
+    }
+}
+
+static void EdsLib_Expression_ParsePrimary(EdsLib_Expression_Compiler_t *Compiler)
+{
+    const char *EndPos;
+    double Value;
+
+    EdsLib_Expression_SkipSpace(Compiler);
+
+    if (EdsLib_Expression_Accept(Compiler, '('))
+    {
+        EdsLib_Expression_Parse(Compiler);
+        if (!EdsLib_Expression_Accept(Compiler, ')'))
+        {
+            EdsLib_Expression_SetError(Compiler, EDSLIB_FAILURE);
+        }
+    }
+    else if (isdigit((int)*Compiler->Pos) || *Compiler->Pos == '.')
+    {
+        Value = strtod(Compiler->Pos, (char **)&EndPos);
+        if (EndPos == Compiler->Pos)
+        {
+            EdsLib_Expression_SetError(Compiler, EDSLIB_FAILURE);
+            return;
+        }
+        Compiler->Pos = EndPos;
+        EdsLib_Expression_EmitConstant(Compiler, Value);
+    }
+    else if (isalpha((int)*Compiler->Pos) || *Compiler->Pos == '_')
+    {
+        /* a name followed by a parenthesis is a function, otherwise it is a field */
+        EndPos = Compiler->Pos;
+        while (isalnum((int)*EndPos) || *EndPos == '_')
+        {
+            ++EndPos;
+        }
+        while (isspace((int)*EndPos))
+        {
+            ++EndPos;
+        }
+
+        if (*EndPos == '(')
+        {
+            EndPos = Compiler->Pos;
+            while (isalnum((int)*EndPos) || *EndPos == '_')
+            {
+                ++EndPos;
+            }
+            EdsLib_Expression_ParseFunction(Compiler, Compiler->Pos, EndPos - Compiler->Pos);
+        }
+        else
+        {
+            EdsLib_Expression_ParseField(Compiler);
+        }
+    }
+    else
+    {
+        EdsLib_Expression_SetError(Compiler, EDSLIB_FAILURE);
+    }
+}
+
+static void EdsLib_Expression_ParseUnary(EdsLib_Expression_Compiler_t *Compiler)
+{
+    /* all recursion passes through here, this limits the use of the C stack */
+    if (Compiler->Nesting >= EDSLIB_EXPRESSION_MAX_NESTING)
+    {
+        EdsLib_Expression_SetError(Compiler, EDSLIB_INSUFFICIENT_MEMORY);
+        return;
+    }
+
+    ++Compiler->Nesting;
+    if (EdsLib_Expression_Accept(Compiler, '-'))
+    {
+        EdsLib_Expression_ParseUnary(Compiler);
+        EdsLib_Expression_EmitUnary(Compiler, EDSLIB_EXPR_OP_NEG);
+    }
+    else if (EdsLib_Expression_Accept(Compiler, '+'))
+    {
+        EdsLib_Expression_ParseUnary(Compiler);
+    }
+    else
+    {
+        EdsLib_Expression_ParsePrimary(Compiler);
+    }
+    --Compiler->Nesting;
+}
+
+static void EdsLib_Expression_ParseTerm(EdsLib_Expression_Compiler_t *Compiler)
+{
+    uint8_t OpCode;
+
+    EdsLib_Expression_ParseUnary(Compiler);
+    while (Compiler->Status == EDSLIB_SUCCESS)
+    {
+        if (EdsLib_Expression_Accept(Compiler, '*'))
+        {
+            OpCode = EDSLIB_EXPR_OP_MUL;
+        }
+        else if (EdsLib_Expression_Accept(Compiler, '/'))
+        {
+            OpCode = EDSLIB_EXPR_OP_DIV;
+        }
+        else
+        {
+            break;
+        }
+
+        EdsLib_Expression_ParseUnary(Compiler);
+        EdsLib_Expression_EmitBinary(Compiler, OpCode);
+    }
+}
+
+static void EdsLib_Expression_Parse(EdsLib_Expression_Compiler_t *Compiler)
+{
+    uint8_t OpCode;
+
+    EdsLib_Expression_ParseTerm(Compiler);
+    while (Compiler->Status == EDSLIB_SUCCESS)
+    {
+        if (EdsLib_Expression_Accept(Compiler, '+'))
+        {
+            OpCode = EDSLIB_EXPR_OP_ADD;
+        }
+        else if (EdsLib_Expression_Accept(Compiler, '-'))
+        {
+            OpCode = EDSLIB_EXPR_OP_SUB;
+        }
+        else
+        {
+            break;
+        }
+
+        EdsLib_Expression_ParseTerm(Compiler);
+        EdsLib_Expression_EmitBinary(Compiler, OpCode);
+    }
+}
+
+int32_t EdsLib_DisplayDB_CompileExpression(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, const char *Text,
+        EdsLib_DisplayDB_Expression_t *Expression)
+{
+    EdsLib_Expression_Compiler_t Compiler;
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    int32_t Status;
+
+    memset(Expression, 0, sizeof(*Expression));
+
+    Status = EdsLib_DataTypeDB_GetTypeInfo(GD, EdsId, &TypeInfo);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return Status;
+    }
+
+    Expression->EdsId = EdsId;
+    Expression->NativeSize = TypeInfo.Size.Bytes;
+
+    memset(&Compiler, 0, sizeof(Compiler));
+    Compiler.GD = GD;
+    Compiler.Expression = Expression;
+    Compiler.Text = Text;
+    Compiler.Pos = Text;
+    Compiler.Status = EDSLIB_SUCCESS;
+
+    EdsLib_Expression_Parse(&Compiler);
+
+    /* the whole text must be consumed */
+    EdsLib_Expression_SkipSpace(&Compiler);
+    if (*Compiler.Pos != 0)
+    {
+        EdsLib_Expression_SetError(&Compiler, EDSLIB_FAILURE);
+    }
+
+    if (Compiler.Status == EDSLIB_SUCCESS && Compiler.Depth != 1)
+    {
+        EdsLib_Expression_SetError(&Compiler, EDSLIB_FAILURE);
+    }
+
+    if (Compiler.Status != EDSLIB_SUCCESS)
+    {
+        Expression->NumOps = 0;
+        Expression->MaxDepth = 0;
+    }
+
+    return Compiler.Status;
+}
+
+/*
+ * Apply a binary operation to a block.  The right operand is either
+ * the top of the stack or the constant in the instruction.
+ */
+static void EdsLib_Expression_BinaryBlock(const EdsLib_DisplayDB_ExprOp_t *Op, double *Left, const double *Right,
+        uint32_t Count)
+{
+    double K = Op->Constant;
+    uint32_t Idx;
+
+    switch(Op->OpCode)
+    {
+    case EDSLIB_EXPR_OP_ADD:
+        if (Op->ConstOperand)
+        {
+            for (Idx = 0; Idx < Count; ++Idx)
+            {
+                Left[Idx] += K;
+            }
+        }
+        else
+        {
+            for (Idx = 0; Idx < Count; ++Idx)
+            {
+                Left[Idx] += Right[Idx];
+            }
+        }
+        break;
+    case EDSLIB_EXPR_OP_SUB:
+        if (Op->ConstOperand)
+        {
+            for (Idx = 0; Idx < Count; ++Idx)
+            {
+                Left[Idx] -= K;
+            }
+        }
+        else
+        {
+            for (Idx = 0; Idx < Count; ++Idx)
+            {
+                Left[Idx] -= Right[Idx];
+            }
+        }
+        break;
+    case EDSLIB_EXPR_OP_MUL:
+        if (Op->ConstOperand)
+        {
+            for (Idx = 0; Idx < Count; ++Idx)
+            {
+                Left[Idx] *= K;
+            }
+        }
+        else
+        {
+            for (Idx = 0; Idx < Count; ++Idx)
+            {
+                Left[Idx] *= Right[Idx];
+            }
+        }
+        break;
+    case EDSLIB_EXPR_OP_DIV:
+        if (Op->ConstOperand)
+        {
+            for (Idx = 0; Idx < Count; ++Idx)
+            {
+                Left[Idx] /= K;
+            }
+        }
+        else
+        {
+            for (Idx = 0; Idx < Count; ++Idx)
+            {
+                Left[Idx] /= Right[Idx];
+            }
+        }
+        break;
+    default:
+        /* min and max are less common, these share one loop */
+        for (Idx = 0; Idx < Count; ++Idx)
+        {
+            Left[Idx] = EdsLib_Expression_Apply(Op->OpCode, Left[Idx], Op->ConstOperand ? K : Right[Idx]);
+        }
+        break;
+    }
+}
+
+int32_t EdsLib_DisplayDB_EvaluateExpression(const EdsLib_DisplayDB_Expression_t *Expression, const void *NativeObjs,
+        uint32_t Stride, uint32_t NumObjects, double *Results)
+{
+    double Stack[EDSLIB_EXPRESSION_MAX_DEPTH][EDSLIB_EXPRESSION_BLOCK_SIZE];
+    const EdsLib_DisplayDB_ExprOp_t *Op;
+    const uint8_t *Src;
+    double *Top;
+    uint32_t Count;
+    uint32_t Idx;
+    uint16_t OpIdx;
+    uint16_t Depth;
+
+    if (Expression->NumOps == 0 || Expression->MaxDepth > EDSLIB_EXPRESSION_MAX_DEPTH)
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    if (Stride == 0)
+    {
+        Stride = Expression->NativeSize;
+    }
+
+    Src = NativeObjs;
+    while (NumObjects > 0)
+    {
+        Count = NumObjects;
+        if (Count > EDSLIB_EXPRESSION_BLOCK_SIZE)
+        {
+            Count = EDSLIB_EXPRESSION_BLOCK_SIZE;
+        }
+
+        Depth = 0;
+        for (OpIdx = 0; OpIdx < Expression->NumOps; ++OpIdx)
+        {
+            Op = &Expression->Ops[OpIdx];
+            switch(Op->OpCode)
+            {
+            case EDSLIB_EXPR_OP_LOAD:
+                EdsLib_DataTypeConvert_LoadFloatBlock(Op->FieldType, Op->FieldSize, Src + Op->FieldOffset, Stride,
+                        Stack[Depth], Count);
+                ++Depth;
+                break;
+            case EDSLIB_EXPR_OP_CONST:
+                Top = Stack[Depth];
+                for (Idx = 0; Idx < Count; ++Idx)
+                {
+                    Top[Idx] = Op->Constant;
+                }
+                ++Depth;
+                break;
+            case EDSLIB_EXPR_OP_NEG:
+                Top = Stack[Depth - 1];
+                for (Idx = 0; Idx < Count; ++Idx)
+                {
+                    Top[Idx] = -Top[Idx];
+                }
+                break;
+            case EDSLIB_EXPR_OP_ABS:
+                Top = Stack[Depth - 1];
+                for (Idx = 0; Idx < Count; ++Idx)
+                {
+                    Top[Idx] = fabs(Top[Idx]);
+                }
+                break;
+            case EDSLIB_EXPR_OP_SQRT:
+                Top = Stack[Depth - 1];
+                for (Idx = 0; Idx < Count; ++Idx)
+                {
+                    Top[Idx] = sqrt(Top[Idx]);
+                }
+                break;
+            default:
+                if (Op->ConstOperand)
+                {
+                    EdsLib_Expression_BinaryBlock(Op, Stack[Depth - 1], NULL, Count);
+                }
+                else
+                {
+                    --Depth;
+                    EdsLib_Expression_BinaryBlock(Op, Stack[Depth - 1], Stack[Depth], Count);
+                }
+                break;
+            }
+        }
+
+        memcpy(Results, Stack[0], Count * sizeof(double));
+
+        Src += Count * Stride;
+        Results += Count;
+        NumObjects -= Count;
+    }
+
+    return EDSLIB_SUCCESS;
+}
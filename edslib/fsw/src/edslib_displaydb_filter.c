@@ -0,0 +1,1021 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_displaydb_filter.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Compiles and runs packet filters over packed EDS messages, i.e. for
+ * selecting the packets that a router forwards or a recorder stores.
+ *
+ * A filter predicate is parsed into a small expression tree, which is then
+ * translated into a register program in the style of the Berkeley Packet
+ * Filter: each comparison is a conditional jump with separate forward
+ * offsets for the true and false outcomes, so && and || short circuit
+ * without any evaluation stack.  Field names are resolved to bit offsets
+ * in the packed data at compile time, so running a filter reads only the
+ * bits of the fields that are compared, and never decodes the message.
+ *
+ * The identification constraints of the message type (i.e. the message
+ * ID fields in the headers) are checked before the predicate, so packets
+ * of other types are rejected as soon as one of these differs.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+#include "edslib_displaydb.h"
+#include "edslib_internal.h"
+
+#if EDSLIB_FILTER_MAX_INSNS > 65535
+#error "EDSLIB_FILTER_MAX_INSNS exceeds the range of the 16-bit jump and label fields"
+#endif
+
+/**
+ * The maximum number of comparisons and logical operators in a filter predicate
+ */
+#define EDSLIB_FILTER_MAX_NODES         EDSLIB_FILTER_MAX_INSNS
+
+/**
+ * The deepest nesting of parentheses and ! operators in a filter predicate
+ */
+#define EDSLIB_FILTER_MAX_NESTING       32
+
+/**
+ * The longest field name that can appear in a filter predicate
+ */
+#define EDSLIB_FILTER_MAX_NAME          128
+
+/**
+ * Label numbers for the final accept and reject instructions
+ */
+#define EDSLIB_FILTER_LABEL_ACCEPT      0
+#define EDSLIB_FILTER_LABEL_REJECT      1
+
+typedef enum
+{
+    EDSLIB_FILTER_OP_RET = 0,           /**< Stop, the packet is selected if the constant is nonzero */
+    EDSLIB_FILTER_OP_JA,                /**< Always jump by JumpTrue */
+    EDSLIB_FILTER_OP_LOAD,              /**< Load a field into a register */
+    EDSLIB_FILTER_OP_JFIELD,            /**< Compare a field to the constant and jump */
+    EDSLIB_FILTER_OP_JREG               /**< Compare register 0 to register 1 and jump */
+} EdsLib_Filter_OpCode_t;
+
+typedef enum
+{
+    EDSLIB_FILTER_CMP_EQ = 0,
+    EDSLIB_FILTER_CMP_NE,
+    EDSLIB_FILTER_CMP_LT,
+    EDSLIB_FILTER_CMP_LE,
+    EDSLIB_FILTER_CMP_GT,
+    EDSLIB_FILTER_CMP_GE
+} EdsLib_Filter_Compare_t;
+
+typedef enum
+{
+    EDSLIB_FILTER_NODE_FALSE = 0,
+    EDSLIB_FILTER_NODE_TRUE,
+    EDSLIB_FILTER_NODE_COMPARE,
+    EDSLIB_FILTER_NODE_NOT,
+    EDSLIB_FILTER_NODE_AND,
+    EDSLIB_FILTER_NODE_OR
+} EdsLib_Filter_NodeType_t;
+
+/*
+ * A field or a constant in a comparison.  Fields use the same members
+ * as the filter instruction, and constants use ValueType and Constant.
+ */
+typedef struct
+{
+    bool IsField;
+    EdsLib_DisplayDB_FilterInsn_t Field;
+    uint8_t ValueType;
+    EdsLib_DisplayDB_FilterValue_t Constant;
+} EdsLib_Filter_Operand_t;
+
+typedef struct
+{
+    uint8_t NodeType;
+    uint8_t Compare;
+    uint16_t Left;
+    uint16_t Right;
+    EdsLib_Filter_Operand_t Operand[2];
+} EdsLib_Filter_Node_t;
+
+typedef struct
+{
+    const EdsLib_DatabaseObject_t *GD;
+    EdsLib_DisplayDB_Filter_t *Filter;
+    const char *Text;
+    const char *Pos;
+    uint16_t Nesting;
+    uint16_t NumNodes;
+    uint16_t NumLabels;
+    int32_t Status;
+    EdsLib_Filter_Node_t Nodes[EDSLIB_FILTER_MAX_NODES];
+    uint16_t JumpLabels[EDSLIB_FILTER_MAX_INSNS][2];
+    uint16_t LabelPos[EDSLIB_FILTER_MAX_INSNS + 2];
+} EdsLib_Filter_Compiler_t;
+
+static uint16_t EdsLib_Filter_ParseOr(EdsLib_Filter_Compiler_t *Compiler);
+
+static void EdsLib_Filter_SetError(EdsLib_Filter_Compiler_t *Compiler, int32_t Status)
+{
+    if (Compiler->Status == EDSLIB_SUCCESS)
+    {
+        Compiler->Status = Status;
+        if (Compiler->Text != NULL)
+        {
+            Compiler->Filter->ErrorPos = Compiler->Pos - Compiler->Text;
+        }
+    }
+}
+
+static void EdsLib_Filter_SkipSpace(EdsLib_Filter_Compiler_t *Compiler)
+{
+    while (isspace((int)*Compiler->Pos))
+    {
+        ++Compiler->Pos;
+    }
+}
+
+static bool EdsLib_Filter_Accept(EdsLib_Filter_Compiler_t *Compiler, const char *Token)
+{
+    size_t Len = strlen(Token);
+
+    EdsLib_Filter_SkipSpace(Compiler);
+    if (strncmp(Compiler->Pos, Token, Len) != 0)
+    {
+        return false;
+    }
+
+    Compiler->Pos += Len;
+    return true;
+}
+
+/*
+ * Get the location and encoding of a field within the packed data
+ */
+static int32_t EdsLib_Filter_SetField(EdsLib_Filter_Compiler_t *Compiler, const EdsLib_DataTypeDB_EntityInfo_t *FieldInfo,
+        EdsLib_DisplayDB_FilterInsn_t *Field)
+{
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    EdsLib_DatabaseRef_t RefObj;
+    EdsLib_PackedField_t PackedField;
+    int32_t Status;
+
+    EdsLib_Decode_StructId(&RefObj, FieldInfo->EdsId);
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(Compiler->GD, &RefObj);
+    if (DataDictPtr == NULL)
+    {
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    Status = EdsLib_PackedField_Init(DataDictPtr, FieldInfo->Offset.Bits, &PackedField);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return Status;
+    }
+
+    memset(Field, 0, sizeof(*Field));
+    Field->OpCode = EDSLIB_FILTER_OP_LOAD;
+    Field->NumBits = PackedField.NumBits;
+    Field->BitOffset = PackedField.BitOffset;
+    Field->FieldType = PackedField.FieldType;
+    Field->LittleEndian = PackedField.LittleEndian;
+    Field->Mask = ~UINT64_C(0);
+
+    if ((Field->BitOffset + Field->NumBits) > Compiler->Filter->RequiredBits)
+    {
+        Compiler->Filter->RequiredBits = Field->BitOffset + Field->NumBits;
+    }
+
+    return EDSLIB_SUCCESS;
+}
+
+static void EdsLib_Filter_ParseConstant(EdsLib_Filter_Compiler_t *Compiler, EdsLib_Filter_Operand_t *Operand)
+{
+    const char *IntEnd;
+    const char *FloatEnd;
+    const char *NumPos;
+    uint64_t IntValue;
+    double FloatValue;
+    bool IsNegative;
+
+    NumPos = Compiler->Pos;
+    IsNegative = (*NumPos == '-');
+    if (IsNegative)
+    {
+        ++NumPos;
+    }
+
+    IntValue = strtoull(NumPos, (char **)&IntEnd, 0);
+    FloatValue = strtod(NumPos, (char **)&FloatEnd);
+    if (FloatEnd == NumPos)
+    {
+        EdsLib_Filter_SetError(Compiler, EDSLIB_FAILURE);
+        return;
+    }
+
+    if (FloatEnd > IntEnd)
+    {
+        Operand->ValueType = EDSLIB_PACKEDFIELD_VALUE_FLOAT;
+        Operand->Constant.Float = IsNegative ? -FloatValue : FloatValue;
+        Compiler->Pos = FloatEnd;
+    }
+    else if (IsNegative)
+    {
+        Operand->ValueType = EDSLIB_PACKEDFIELD_VALUE_SIGNED;
+        Operand->Constant.Signed = -(int64_t)IntValue;
+        Compiler->Pos = IntEnd;
+    }
+    else
+    {
+        /* only values that do not fit a signed integer need an unsigned compare */
+        Operand->ValueType = (IntValue > INT64_MAX) ? EDSLIB_PACKEDFIELD_VALUE_UNSIGNED : EDSLIB_PACKEDFIELD_VALUE_SIGNED;
+        Operand->Constant.Unsigned = IntValue;
+        Compiler->Pos = IntEnd;
+    }
+}
+
+static void EdsLib_Filter_ParseField(EdsLib_Filter_Compiler_t *Compiler, EdsLib_Filter_Operand_t *Operand)
+{
+    EdsLib_DataTypeDB_EntityInfo_t FieldInfo;
+    EdsLib_Filter_Operand_t MaskValue;
+    char Name[EDSLIB_FILTER_MAX_NAME];
+    const char *EndPos;
+    int32_t Status;
+
+    EndPos = Compiler->Pos;
+    while (isalnum((int)*EndPos) || *EndPos == '_' || *EndPos == '.' || *EndPos == '[' || *EndPos == ']')
+    {
+        ++EndPos;
+    }
+
+    if ((size_t)(EndPos - Compiler->Pos) >= sizeof(Name))
+    {
+        EdsLib_Filter_SetError(Compiler, EDSLIB_NAME_NOT_FOUND);
+        return;
+    }
+
+    memcpy(Name, Compiler->Pos, EndPos - Compiler->Pos);
+    Name[EndPos - Compiler->Pos] = 0;
+
+    Status = EdsLib_DisplayDB_LocateSubEntity(Compiler->GD, Compiler->Filter->EdsId, Name, &FieldInfo);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        EdsLib_Filter_SetError(Compiler, EDSLIB_NAME_NOT_FOUND);
+        return;
+    }
+
+    Status = EdsLib_Filter_SetField(Compiler, &FieldInfo, &Operand->Field);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        EdsLib_Filter_SetError(Compiler, Status);
+        return;
+    }
+
+    Operand->IsField = true;
+    Operand->ValueType = Operand->Field.FieldType;
+    Compiler->Pos = EndPos;
+
+    /* a single & is a mask, a double && is the logical operator */
+    EdsLib_Filter_SkipSpace(Compiler);
+    if (Compiler->Pos[0] == '&' && Compiler->Pos[1] != '&')
+    {
+        ++Compiler->Pos;
+        EdsLib_Filter_SkipSpace(Compiler);
+        memset(&MaskValue, 0, sizeof(MaskValue));
+        EdsLib_Filter_ParseConstant(Compiler, &MaskValue);
+        if (Compiler->Status != EDSLIB_SUCCESS)
+        {
+            return;
+        }
+        if (Operand->Field.FieldType == EDSLIB_PACKEDFIELD_VALUE_FLOAT || MaskValue.ValueType == EDSLIB_PACKEDFIELD_VALUE_FLOAT)
+        {
+            EdsLib_Filter_SetError(Compiler, EDSLIB_INVALID_SIZE_OR_TYPE);
+            return;
+        }
+
+        /* the masked bits are always treated as an unsigned number */
+        Operand->Field.Mask = MaskValue.Constant.Unsigned;
+        Operand->Field.FieldType = EDSLIB_PACKEDFIELD_VALUE_UNSIGNED;
+        Operand->ValueType = (Operand->Field.NumBits < 64) ? EDSLIB_PACKEDFIELD_VALUE_SIGNED : EDSLIB_PACKEDFIELD_VALUE_UNSIGNED;
+    }
+    else if (Operand->ValueType == EDSLIB_PACKEDFIELD_VALUE_UNSIGNED && Operand->Field.NumBits < 64)
+    {
+        /* smaller unsigned fields always fit in a signed comparison */
+        Operand->ValueType = EDSLIB_PACKEDFIELD_VALUE_SIGNED;
+    }
+}
+
+static void EdsLib_Filter_ParseOperand(EdsLib_Filter_Compiler_t *Compiler, EdsLib_Filter_Operand_t *Operand)
+{
+    EdsLib_Filter_SkipSpace(Compiler);
+    memset(Operand, 0, sizeof(*Operand));
+
+    if (EdsLib_Filter_Accept(Compiler, "("))
+    {
+        /* a masked field is often written in parentheses, i.e. "(Flags & 0x4) != 0" */
+        if (Compiler->Nesting >= EDSLIB_FILTER_MAX_NESTING)
+        {
+            EdsLib_Filter_SetError(Compiler, EDSLIB_INSUFFICIENT_MEMORY);
+            return;
+        }
+        ++Compiler->Nesting;
+        EdsLib_Filter_ParseOperand(Compiler, Operand);
+        --Compiler->Nesting;
+        if (Compiler->Status == EDSLIB_SUCCESS && !EdsLib_Filter_Accept(Compiler, ")"))
+        {
+            EdsLib_Filter_SetError(Compiler, EDSLIB_FAILURE);
+        }
+    }
+    else if (isdigit((int)Compiler->Pos[0]) || Compiler->Pos[0] == '.' ||
+            (Compiler->Pos[0] == '-' && (isdigit((int)Compiler->Pos[1]) || Compiler->Pos[1] == '.')))
+    {
+        EdsLib_Filter_ParseConstant(Compiler, Operand);
+    }
+    else if (isalpha((int)*Compiler->Pos) || *Compiler->Pos == '_')
+    {
+        EdsLib_Filter_ParseField(Compiler, Operand);
+    }
+    else
+    {
+        EdsLib_Filter_SetError(Compiler, EDSLIB_FAILURE);
+    }
+}
+
+static uint16_t EdsLib_Filter_NewNode(EdsLib_Filter_Compiler_t *Compiler, uint8_t NodeType)
+{
+    EdsLib_Filter_Node_t *Node;
+
+    if (Compiler->NumNodes >= EDSLIB_FILTER_MAX_NODES)
+    {
+        EdsLib_Filter_SetError(Compiler, EDSLIB_INSUFFICIENT_MEMORY);
+        return 0;
+    }
+
+    Node = &Compiler->Nodes[Compiler->NumNodes];
+    memset(Node, 0, sizeof(*Node));
+    Node->NodeType = NodeType;
+
+    return Compiler->NumNodes++;
+}
+
+/*
+ * Decide how two operands are compared.  Integers are compared as signed
+ * unless one of them only fits in an unsigned 64 bit value, and anything
+ * involving a floating point value is compared as floating point.
+ */
+static uint8_t EdsLib_Filter_GetCompareType(const EdsLib_Filter_Node_t *Node)
+{
+    uint8_t Type0 = Node->Operand[0].ValueType;
+    uint8_t Type1 = Node->Operand[1].ValueType;
+
+    if (Type0 == EDSLIB_PACKEDFIELD_VALUE_FLOAT || Type1 == EDSLIB_PACKEDFIELD_VALUE_FLOAT)
+    {
+        return EDSLIB_PACKEDFIELD_VALUE_FLOAT;
+    }
+
+    if (Type0 == Type1)
+    {
+        return Type0;
+    }
+
+    /* mixing a large unsigned value with a signed field */
+    if ((Type0 == EDSLIB_PACKEDFIELD_VALUE_SIGNED && Node->Operand[0].IsField &&
+            Node->Operand[0].Field.FieldType == EDSLIB_PACKEDFIELD_VALUE_SIGNED) ||
+            (Type1 == EDSLIB_PACKEDFIELD_VALUE_SIGNED && Node->Operand[1].IsField &&
+            Node->Operand[1].Field.FieldType == EDSLIB_PACKEDFIELD_VALUE_SIGNED))
+    {
+        return EDSLIB_PACKEDFIELD_VALUE_FLOAT;
+    }
+
+    return EDSLIB_PACKEDFIELD_VALUE_UNSIGNED;
+}
+
+static void EdsLib_Filter_ConvertConstant(EdsLib_Filter_Operand_t *Operand, uint8_t ValueType)
+{
+    if (Operand->ValueType == ValueType)
+    {
+        return;
+    }
+
+    if (ValueType == EDSLIB_PACKEDFIELD_VALUE_FLOAT)
+    {
+        if (Operand->ValueType == EDSLIB_PACKEDFIELD_VALUE_SIGNED)
+        {
+            Operand->Constant.Float = (double)Operand->Constant.Signed;
+        }
+        else
+        {
+            Operand->Constant.Float = (double)Operand->Constant.Unsigned;
+        }
+    }
+
+    /* signed and unsigned share the same bits */
+    Operand->ValueType = ValueType;
+}
+
+static bool EdsLib_Filter_Compare(uint8_t Compare, uint8_t ValueType, const EdsLib_DisplayDB_FilterValue_t *Left,
+        const EdsLib_DisplayDB_FilterValue_t *Right)
+{
+    int Order;
+
+    switch(ValueType)
+    {
+    case EDSLIB_PACKEDFIELD_VALUE_FLOAT:
+        Order = (Left->Float > Right->Float) - (Left->Float < Right->Float);
+        if (Order == 0 && Left->Float != Right->Float)
+        {
+            /* NaN is unordered, only != is true */
+            return (Compare == EDSLIB_FILTER_CMP_NE);
+        }
+        break;
+    case EDSLIB_PACKEDFIELD_VALUE_UNSIGNED:
+        Order = (Left->Unsigned > Right->Unsigned) - (Left->Unsigned < Right->Unsigned);
+        break;
+    default:
+        Order = (Left->Signed > Right->Signed) - (Left->Signed < Right->Signed);
+        break;
+    }
+
+    switch(Compare)
+    {
+    case EDSLIB_FILTER_CMP_EQ:
+        return (Order == 0);
+    case EDSLIB_FILTER_CMP_NE:
+        return (Order != 0);
+    case EDSLIB_FILTER_CMP_LT:
+        return (Order < 0);
+    case EDSLIB_FILTER_CMP_LE:
+        return (Order <= 0);
+    case EDSLIB_FILTER_CMP_GT:
+        return (Order > 0);
+    default:
+        return (Order >= 0);
+    }
+}
+
+static uint16_t EdsLib_Filter_ParseCompare(EdsLib_Filter_Compiler_t *Compiler)
+{
+    static const struct
+    {
+        const char *Token;
+        uint8_t Compare;
+        uint8_t Mirror;
+    } OPERATORS[] =
+    {
+        { "==", EDSLIB_FILTER_CMP_EQ, EDSLIB_FILTER_CMP_EQ },
+        { "!=", EDSLIB_FILTER_CMP_NE, EDSLIB_FILTER_CMP_NE },
+        { "<=", EDSLIB_FILTER_CMP_LE, EDSLIB_FILTER_CMP_GE },
+        { ">=", EDSLIB_FILTER_CMP_GE, EDSLIB_FILTER_CMP_LE },
+        { "<", EDSLIB_FILTER_CMP_LT, EDSLIB_FILTER_CMP_GT },
+        { ">", EDSLIB_FILTER_CMP_GT, EDSLIB_FILTER_CMP_LT }
+    };
+    EdsLib_Filter_Node_t *Node;
+    EdsLib_Filter_Operand_t Temp;
+    uint16_t NodeIdx;
+    uint16_t OpIdx;
+    uint8_t ValueType;
+
+    NodeIdx = EdsLib_Filter_NewNode(Compiler, EDSLIB_FILTER_NODE_COMPARE);
+    if (Compiler->Status != EDSLIB_SUCCESS)
+    {
+        return 0;
+    }
+    Node = &Compiler->Nodes[NodeIdx];
+
+    EdsLib_Filter_ParseOperand(Compiler, &Node->Operand[0]);
+    if (Compiler->Status != EDSLIB_SUCCESS)
+    {
+        return 0;
+    }
+
+    for (OpIdx = 0; OpIdx < (sizeof(OPERATORS) / sizeof(OPERATORS[0])); ++OpIdx)
+    {
+        if (EdsLib_Filter_Accept(Compiler, OPERATORS[OpIdx].Token))
+        {
+            break;
+        }
+    }
+    if (OpIdx >= (sizeof(OPERATORS) / sizeof(OPERATORS[0])))
+    {
+        EdsLib_Filter_SetError(Compiler, EDSLIB_FAILURE);
+        return 0;
+    }
+
+    EdsLib_Filter_ParseOperand(Compiler, &Node->Operand[1]);
+    if (Compiler->Status != EDSLIB_SUCCESS)
+    {
+        return 0;
+    }
+
+    /* a field is always the left operand, so a constant can go in the instruction */
+    Node->Compare = OPERATORS[OpIdx].Compare;
+    if (!Node->Operand[0].IsField && Node->Operand[1].IsField)
+    {
+        Temp = Node->Operand[0];
+        Node->Operand[0] = Node->Operand[1];
+        Node->Operand[1] = Temp;
+        Node->Compare = OPERATORS[OpIdx].Mirror;
+    }
+
+    ValueType = EdsLib_Filter_GetCompareType(Node);
+    if (!Node->Operand[0].IsField)
+    {
+        EdsLib_Filter_ConvertConstant(&Node->Operand[0], ValueType);
+    }
+    if (!Node->Operand[1].IsField)
+    {
+        EdsLib_Filter_ConvertConstant(&Node->Operand[1], ValueType);
+    }
+    Node->Operand[0].ValueType = ValueType;
+    Node->Operand[1].ValueType = ValueType;
+
+    /* comparing two constants is known now */
+    if (!Node->Operand[0].IsField)
+    {
+        if (EdsLib_Filter_Compare(Node->Compare, ValueType, &Node->Operand[0].Constant, &Node->Operand[1].Constant))
+        {
+            Node->NodeType = EDSLIB_FILTER_NODE_TRUE;
+        }
+        else
+        {
+            Node->NodeType = EDSLIB_FILTER_NODE_FALSE;
+        }
+    }
+
+    return NodeIdx;
+}
+
+/*
+ * Check if the parenthesis at the current position encloses a single
+ * operand rather than a logical expression, which is the case when the
+ * closing parenthesis is followed by a comparison operator.
+ */
+static bool EdsLib_Filter_IsOperandGroup(const EdsLib_Filter_Compiler_t *Compiler)
+{
+    const char *Pos;
+    uint32_t Depth;
+
+    Depth = 0;
+    for (Pos = Compiler->Pos; *Pos != 0; ++Pos)
+    {
+        if (*Pos == '(')
+        {
+            ++Depth;
+        }
+        else if (*Pos == ')')
+        {
+            --Depth;
+            if (Depth == 0)
+            {
+                break;
+            }
+        }
+    }
+
+    if (*Pos == 0)
+    {
+        return false;
+    }
+
+    ++Pos;
+    while (isspace((int)*Pos))
+    {
+        ++Pos;
+    }
+
+    return (*Pos == '=' || *Pos == '<' || *Pos == '>' || (Pos[0] == '!' && Pos[1] == '='));
+}
+
+static uint16_t EdsLib_Filter_ParseNot(EdsLib_Filter_Compiler_t *Compiler)
+{
+    uint16_t NodeIdx;
+    uint16_t ChildIdx;
+
+    /* all recursion passes through here, this limits the use of the C stack */
+    if (Compiler->Nesting >= EDSLIB_FILTER_MAX_NESTING)
+    {
+        EdsLib_Filter_SetError(Compiler, EDSLIB_INSUFFICIENT_MEMORY);
+        return 0;
+    }
+
+    ++Compiler->Nesting;
+    if (EdsLib_Filter_Accept(Compiler, "!"))
+    {
+        ChildIdx = EdsLib_Filter_ParseNot(Compiler);
+        NodeIdx = EdsLib_Filter_NewNode(Compiler, EDSLIB_FILTER_NODE_NOT);
+        Compiler->Nodes[NodeIdx].Left = ChildIdx;
+    }
+    else if (*Compiler->Pos == '(' && !EdsLib_Filter_IsOperandGroup(Compiler))
+    {
+        ++Compiler->Pos;
+        NodeIdx = EdsLib_Filter_ParseOr(Compiler);
+        if (!EdsLib_Filter_Accept(Compiler, ")"))
+        {
+            EdsLib_Filter_SetError(Compiler, EDSLIB_FAILURE);
+        }
+    }
+    else
+    {
+        NodeIdx = EdsLib_Filter_ParseCompare(Compiler);
+    }
+    --Compiler->Nesting;
+
+    return NodeIdx;
+}
+
+static uint16_t EdsLib_Filter_ParseAnd(EdsLib_Filter_Compiler_t *Compiler)
+{
+    uint16_t NodeIdx;
+    uint16_t LeftIdx;
+
+    NodeIdx = EdsLib_Filter_ParseNot(Compiler);
+    while (Compiler->Status == EDSLIB_SUCCESS && EdsLib_Filter_Accept(Compiler, "&&"))
+    {
+        LeftIdx = NodeIdx;
+        NodeIdx = EdsLib_Filter_NewNode(Compiler, EDSLIB_FILTER_NODE_AND);
+        Compiler->Nodes[NodeIdx].Left = LeftIdx;
+        Compiler->Nodes[NodeIdx].Right = EdsLib_Filter_ParseNot(Compiler);
+    }
+
+    return NodeIdx;
+}
+
+static uint16_t EdsLib_Filter_ParseOr(EdsLib_Filter_Compiler_t *Compiler)
+{
+    uint16_t NodeIdx;
+    uint16_t LeftIdx;
+
+    NodeIdx = EdsLib_Filter_ParseAnd(Compiler);
+    while (Compiler->Status == EDSLIB_SUCCESS && EdsLib_Filter_Accept(Compiler, "||"))
+    {
+        LeftIdx = NodeIdx;
+        NodeIdx = EdsLib_Filter_NewNode(Compiler, EDSLIB_FILTER_NODE_OR);
+        Compiler->Nodes[NodeIdx].Left = LeftIdx;
+        Compiler->Nodes[NodeIdx].Right = EdsLib_Filter_ParseAnd(Compiler);
+    }
+
+    return NodeIdx;
+}
+
+static uint16_t EdsLib_Filter_NewLabel(EdsLib_Filter_Compiler_t *Compiler)
+{
+    if (Compiler->NumLabels >= (sizeof(Compiler->LabelPos) / sizeof(Compiler->LabelPos[0])))
+    {
+        EdsLib_Filter_SetError(Compiler, EDSLIB_INSUFFICIENT_MEMORY);
+        return EDSLIB_FILTER_LABEL_REJECT;
+    }
+
+    return Compiler->NumLabels++;
+}
+
+static void EdsLib_Filter_PlaceLabel(EdsLib_Filter_Compiler_t *Compiler, uint16_t Label)
+{
+    Compiler->LabelPos[Label] = Compiler->Filter->NumInsns;
+}
+
+static EdsLib_DisplayDB_FilterInsn_t *EdsLib_Filter_Emit(EdsLib_Filter_Compiler_t *Compiler,
+        const EdsLib_DisplayDB_FilterInsn_t *Template, uint8_t OpCode, uint16_t TrueLabel, uint16_t FalseLabel)
+{
+    EdsLib_DisplayDB_Filter_t *Filter = Compiler->Filter;
+    EdsLib_DisplayDB_FilterInsn_t *Insn;
+
+    /* two instructions are always reserved for the final accept and reject */
+    if (Compiler->Status != EDSLIB_SUCCESS || Filter->NumInsns >= (EDSLIB_FILTER_MAX_INSNS - 2))
+    {
+        EdsLib_Filter_SetError(Compiler, EDSLIB_INSUFFICIENT_MEMORY);
+        return NULL;
+    }
+
+    Insn = &Filter->Insns[Filter->NumInsns];
+    if (Template != NULL)
+    {
+        *Insn = *Template;
+    }
+    else
+    {
+        memset(Insn, 0, sizeof(*Insn));
+    }
+    Insn->OpCode = OpCode;
+    Compiler->JumpLabels[Filter->NumInsns][0] = TrueLabel;
+    Compiler->JumpLabels[Filter->NumInsns][1] = FalseLabel;
+    ++Filter->NumInsns;
+
+    return Insn;
+}
+
+static void EdsLib_Filter_Generate(EdsLib_Filter_Compiler_t *Compiler, uint16_t NodeIdx,
+        uint16_t TrueLabel, uint16_t FalseLabel)
+{
+    const EdsLib_Filter_Node_t *Node = &Compiler->Nodes[NodeIdx];
+    EdsLib_DisplayDB_FilterInsn_t *Insn;
+    uint16_t NextLabel;
+
+    switch(Node->NodeType)
+    {
+    case EDSLIB_FILTER_NODE_TRUE:
+        EdsLib_Filter_Emit(Compiler, NULL, EDSLIB_FILTER_OP_JA, TrueLabel, TrueLabel);
+        break;
+    case EDSLIB_FILTER_NODE_FALSE:
+        EdsLib_Filter_Emit(Compiler, NULL, EDSLIB_FILTER_OP_JA, FalseLabel, FalseLabel);
+        break;
+    case EDSLIB_FILTER_NODE_NOT:
+        EdsLib_Filter_Generate(Compiler, Node->Left, FalseLabel, TrueLabel);
+        break;
+    case EDSLIB_FILTER_NODE_AND:
+        NextLabel = EdsLib_Filter_NewLabel(Compiler);
+        EdsLib_Filter_Generate(Compiler, Node->Left, NextLabel, FalseLabel);
+        EdsLib_Filter_PlaceLabel(Compiler, NextLabel);
+        EdsLib_Filter_Generate(Compiler, Node->Right, TrueLabel, FalseLabel);
+        break;
+    case EDSLIB_FILTER_NODE_OR:
+        NextLabel = EdsLib_Filter_NewLabel(Compiler);
+        EdsLib_Filter_Generate(Compiler, Node->Left, TrueLabel, NextLabel);
+        EdsLib_Filter_PlaceLabel(Compiler, NextLabel);
+        EdsLib_Filter_Generate(Compiler, Node->Right, TrueLabel, FalseLabel);
+        break;
+    default:
+        if (!Node->Operand[1].IsField)
+        {
+            /* the usual case, one instruction reads the field and compares it */
+            Insn = EdsLib_Filter_Emit(Compiler, &Node->Operand[0].Field, EDSLIB_FILTER_OP_JFIELD,
+                    TrueLabel, FalseLabel);
+            if (Insn != NULL)
+            {
+                Insn->Compare = Node->Compare;
+                Insn->ValueType = Node->Operand[0].ValueType;
+                Insn->Constant = Node->Operand[1].Constant;
+            }
+        }
+        else
+        {
+            Insn = EdsLib_Filter_Emit(Compiler, &Node->Operand[0].Field, EDSLIB_FILTER_OP_LOAD, 0, 0);
+            if (Insn != NULL)
+            {
+                Insn->ValueType = Node->Operand[0].ValueType;
+                Insn->Register = 0;
+            }
+            Insn = EdsLib_Filter_Emit(Compiler, &Node->Operand[1].Field, EDSLIB_FILTER_OP_LOAD, 0, 0);
+            if (Insn != NULL)
+            {
+                Insn->ValueType = Node->Operand[1].ValueType;
+                Insn->Register = 1;
+            }
+            Insn = EdsLib_Filter_Emit(Compiler, NULL, EDSLIB_FILTER_OP_JREG, TrueLabel, FalseLabel);
+            if (Insn != NULL)
+            {
+                Insn->Compare = Node->Compare;
+                Insn->ValueType = Node->Operand[0].ValueType;
+            }
+        }
+        break;
+    }
+}
+
+/*
+ * Each identification constraint becomes a field compare that continues
+ * to the next instruction if equal, or rejects the packet if not.
+ */
+static void EdsLib_Filter_ConstraintCallback(const EdsLib_DatabaseObject_t *GD,
+        const EdsLib_DataTypeDB_EntityInfo_t *MemberInfo,
+        EdsLib_GenericValueBuffer_t *ConstraintValue,
+        void *Arg)
+{
+    EdsLib_Filter_Compiler_t *Compiler = Arg;
+    EdsLib_DisplayDB_FilterInsn_t Field;
+    EdsLib_DisplayDB_FilterInsn_t *Insn;
+    uint16_t NextLabel;
+    int32_t Status;
+
+    (void)GD;
+
+    if (Compiler->Status != EDSLIB_SUCCESS)
+    {
+        return;
+    }
+
+    Status = EdsLib_Filter_SetField(Compiler, MemberInfo, &Field);
+    if (Status == EDSLIB_SUCCESS && Field.FieldType == EDSLIB_PACKEDFIELD_VALUE_FLOAT)
+    {
+        Status = EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+    if (Status != EDSLIB_SUCCESS)
+    {
+        EdsLib_Filter_SetError(Compiler, Status);
+        return;
+    }
+
+    NextLabel = EdsLib_Filter_NewLabel(Compiler);
+    Insn = EdsLib_Filter_Emit(Compiler, &Field, EDSLIB_FILTER_OP_JFIELD, NextLabel, EDSLIB_FILTER_LABEL_REJECT);
+    EdsLib_Filter_PlaceLabel(Compiler, NextLabel);
+    if (Insn == NULL)
+    {
+        return;
+    }
+
+    Insn->Compare = EDSLIB_FILTER_CMP_EQ;
+    if (ConstraintValue->ValueType == EDSLIB_BASICTYPE_SIGNED_INT)
+    {
+        Insn->ValueType = EDSLIB_PACKEDFIELD_VALUE_SIGNED;
+        Insn->Constant.Signed = ConstraintValue->Value.SignedInteger;
+    }
+    else if (ConstraintValue->ValueType == EDSLIB_BASICTYPE_UNSIGNED_INT)
+    {
+        Insn->ValueType = EDSLIB_PACKEDFIELD_VALUE_UNSIGNED;
+        Insn->Constant.Unsigned = ConstraintValue->Value.UnsignedInteger;
+    }
+    else
+    {
+        EdsLib_Filter_SetError(Compiler, EDSLIB_INVALID_SIZE_OR_TYPE);
+    }
+}
+
+/*
+ * Convert the jump labels into relative offsets
+ */
+static void EdsLib_Filter_ResolveJumps(EdsLib_Filter_Compiler_t *Compiler)
+{
+    EdsLib_DisplayDB_Filter_t *Filter = Compiler->Filter;
+    EdsLib_DisplayDB_FilterInsn_t *Insn;
+    uint16_t InsnIdx;
+
+    for (InsnIdx = 0; InsnIdx < Filter->NumInsns; ++InsnIdx)
+    {
+        Insn = &Filter->Insns[InsnIdx];
+        if (Insn->OpCode == EDSLIB_FILTER_OP_JA || Insn->OpCode == EDSLIB_FILTER_OP_JFIELD ||
+                Insn->OpCode == EDSLIB_FILTER_OP_JREG)
+        {
+            Insn->JumpTrue = Compiler->LabelPos[Compiler->JumpLabels[InsnIdx][0]] - (InsnIdx + 1);
+            Insn->JumpFalse = Compiler->LabelPos[Compiler->JumpLabels[InsnIdx][1]] - (InsnIdx + 1);
+        }
+    }
+}
+
+int32_t EdsLib_DisplayDB_CompileFilter(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseId, EdsLib_Id_t EdsId,
+        const char *Text, EdsLib_DisplayDB_Filter_t *Filter)
+{
+    EdsLib_Filter_Compiler_t Compiler;
+    EdsLib_DisplayDB_FilterInsn_t *Insn;
+    uint16_t RootIdx;
+    int32_t Status;
+
+    memset(Filter, 0, sizeof(*Filter));
+    Filter->EdsId = EdsId;
+
+    memset(&Compiler, 0, sizeof(Compiler));
+    Compiler.GD = GD;
+    Compiler.Filter = Filter;
+    Compiler.Text = Text;
+    Compiler.Pos = Text;
+    Compiler.Status = EDSLIB_SUCCESS;
+    Compiler.NumLabels = 2;
+
+    if (!EdsLib_Is_Similar(BaseId, EdsId))
+    {
+        Status = EdsLib_DataTypeDB_ConstraintIterator(GD, BaseId, EdsId, EdsLib_Filter_ConstraintCallback, &Compiler);
+        if (Status != EDSLIB_SUCCESS)
+        {
+            return Status;
+        }
+    }
+
+    if (Text != NULL)
+    {
+        EdsLib_Filter_SkipSpace(&Compiler);
+    }
+
+    if (Compiler.Status == EDSLIB_SUCCESS && Text != NULL && *Compiler.Pos != 0)
+    {
+        RootIdx = EdsLib_Filter_ParseOr(&Compiler);
+
+        /* the whole text must be consumed */
+        EdsLib_Filter_SkipSpace(&Compiler);
+        if (*Compiler.Pos != 0)
+        {
+            EdsLib_Filter_SetError(&Compiler, EDSLIB_FAILURE);
+        }
+
+        if (Compiler.Status == EDSLIB_SUCCESS)
+        {
+            EdsLib_Filter_Generate(&Compiler, RootIdx, EDSLIB_FILTER_LABEL_ACCEPT, EDSLIB_FILTER_LABEL_REJECT);
+        }
+    }
+
+    if (Compiler.Status != EDSLIB_SUCCESS)
+    {
+        Filter->NumInsns = 0;
+        return Compiler.Status;
+    }
+
+    /* the space for these was reserved by EdsLib_Filter_Emit() */
+    EdsLib_Filter_PlaceLabel(&Compiler, EDSLIB_FILTER_LABEL_ACCEPT);
+    Insn = &Filter->Insns[Filter->NumInsns];
+    memset(Insn, 0, sizeof(*Insn));
+    Insn->OpCode = EDSLIB_FILTER_OP_RET;
+    Insn->Constant.Unsigned = 1;
+    ++Filter->NumInsns;
+
+    EdsLib_Filter_PlaceLabel(&Compiler, EDSLIB_FILTER_LABEL_REJECT);
+    Insn = &Filter->Insns[Filter->NumInsns];
+    memset(Insn, 0, sizeof(*Insn));
+    Insn->OpCode = EDSLIB_FILTER_OP_RET;
+    ++Filter->NumInsns;
+
+    EdsLib_Filter_ResolveJumps(&Compiler);
+
+    return EDSLIB_SUCCESS;
+}
+
+/*
+ * Read a field from the packed data and convert it to the type used for the comparison
+ */
+static inline void EdsLib_Filter_LoadField(const EdsLib_DisplayDB_FilterInsn_t *Insn, const uint8_t *PackedData,
+        EdsLib_DisplayDB_FilterValue_t *Value)
+{
+    EdsLib_PackedField_Load(PackedData, Insn->BitOffset, Insn->NumBits, Insn->FieldType, Insn->LittleEndian,
+            Insn->Mask, Value);
+
+    if (Insn->ValueType == EDSLIB_PACKEDFIELD_VALUE_FLOAT)
+    {
+        if (Insn->FieldType == EDSLIB_PACKEDFIELD_VALUE_SIGNED)
+        {
+            Value->Float = (double)Value->Signed;
+        }
+        else if (Insn->FieldType == EDSLIB_PACKEDFIELD_VALUE_UNSIGNED)
+        {
+            Value->Float = (double)Value->Unsigned;
+        }
+    }
+}
+
+bool EdsLib_DisplayDB_FilterMatch(const EdsLib_DisplayDB_Filter_t *Filter, const void *PackedData, uint32_t PackedSize)
+{
+    EdsLib_DisplayDB_FilterValue_t Registers[2];
+    EdsLib_DisplayDB_FilterValue_t Value;
+    const EdsLib_DisplayDB_FilterInsn_t *Insn;
+    uint16_t Pc;
+    bool Result;
+
+    if (((uint64_t)PackedSize * 8) < Filter->RequiredBits)
+    {
+        return false;
+    }
+
+    /* jumps are always forward, so this always terminates */
+    Pc = 0;
+    while (Pc < Filter->NumInsns)
+    {
+        Insn = &Filter->Insns[Pc];
+        ++Pc;
+
+        switch(Insn->OpCode)
+        {
+        case EDSLIB_FILTER_OP_RET:
+            return (Insn->Constant.Unsigned != 0);
+        case EDSLIB_FILTER_OP_JA:
+            Pc += Insn->JumpTrue;
+            break;
+        case EDSLIB_FILTER_OP_LOAD:
+            EdsLib_Filter_LoadField(Insn, PackedData, &Registers[Insn->Register & 1]);
+            break;
+        case EDSLIB_FILTER_OP_JFIELD:
+            EdsLib_Filter_LoadField(Insn, PackedData, &Value);
+            Result = EdsLib_Filter_Compare(Insn->Compare, Insn->ValueType, &Value, &Insn->Constant);
+            Pc += Result ? Insn->JumpTrue : Insn->JumpFalse;
+            break;
+        case EDSLIB_FILTER_OP_JREG:
+            Result = EdsLib_Filter_Compare(Insn->Compare, Insn->ValueType, &Registers[0], &Registers[1]);
+            Pc += Result ? Insn->JumpTrue : Insn->JumpFalse;
+            break;
+        default:
+            return false;
+        }
+    }
+
+    return false;
+}
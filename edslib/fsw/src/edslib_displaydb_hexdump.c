@@ -0,0 +1,260 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_displaydb_hexdump.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Utility functions to display binary data as hexadecimal
+ *
+ * Lines are formatted directly into a character buffer using lookup
+ * tables, and written to the stream in large blocks, rather than using
+ * a separate stdio call for every byte.  This keeps dumps of whole
+ * packet captures from dominating the run time of verbose logging.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "edslib_displaydb.h"
+#include "edslib_internal.h"
+
+/**
+ * Size of the local buffer used when writing a dump to a stream
+ */
+#define EDSLIB_HEXDUMP_WRITE_BUFFER_SIZE    4096
+
+static const char EdsLib_HEXDUMP_DIGITS[16] = "0123456789abcdef";
+
+typedef struct
+{
+    FILE *fp;
+    const uint8_t *DataPtr;
+    uint64_t DisplayOffset;
+    uint32_t Position;
+    uint32_t Size;
+} EdsLib_Hexdump_AnnotateControlBlock_t;
+
+/*
+ * Format a single line of the dump, without the newline.
+ *
+ * The offset is shown with at least 3 hex digits, as in the original
+ * printf-based implementation.  If PadText is set, the text column of a
+ * short line is padded to full width so a suffix can be aligned.
+ */
+static uint32_t EdsLib_Hexdump_FormatOneLine(char *Out, const uint8_t *DataPtr, uint64_t DisplayOffset,
+        uint32_t Count, bool PadText)
+{
+    char *Start;
+    uint32_t NumDigits;
+    uint32_t Idx;
+    uint8_t Ch;
+
+    Start = Out;
+    NumDigits = 3;
+    while (NumDigits < 16 && (DisplayOffset >> (4 * NumDigits)) != 0)
+    {
+        ++NumDigits;
+    }
+
+    *Out++ = ' ';
+    *Out++ = ' ';
+    while (NumDigits > 0)
+    {
+        --NumDigits;
+        *Out++ = EdsLib_HEXDUMP_DIGITS[(DisplayOffset >> (4 * NumDigits)) & 0xF];
+    }
+    *Out++ = ':';
+
+    for (Idx = 0; Idx < EDSLIB_HEXDUMP_BYTES_PER_LINE; ++Idx)
+    {
+        *Out++ = ' ';
+        if (Idx < Count)
+        {
+            *Out++ = EdsLib_HEXDUMP_DIGITS[DataPtr[Idx] >> 4];
+            *Out++ = EdsLib_HEXDUMP_DIGITS[DataPtr[Idx] & 0xF];
+        }
+        else
+        {
+            *Out++ = ' ';
+            *Out++ = ' ';
+        }
+    }
+
+    *Out++ = ' ';
+    *Out++ = ' ';
+    for (Idx = 0; Idx < Count; ++Idx)
+    {
+        Ch = DataPtr[Idx];
+        if (Ch < 0x20 || Ch > 0x7E)
+        {
+            Ch = '.';
+        }
+        *Out++ = Ch;
+    }
+
+    if (PadText)
+    {
+        while (Idx < EDSLIB_HEXDUMP_BYTES_PER_LINE)
+        {
+            *Out++ = ' ';
+            ++Idx;
+        }
+    }
+
+    return Out - Start;
+}
+
+uint32_t EdsLib_Hexdump_FormatLines(char *OutputBuffer, uint32_t BufferSize, const uint8_t *DataPtr,
+        uint64_t DisplayOffset, uint64_t Count, uint64_t *ConsumedBytes)
+{
+    uint32_t OutputPos;
+    uint32_t LineBytes;
+    uint64_t Consumed;
+
+    OutputPos = 0;
+    Consumed = 0;
+    while (Consumed < Count && (BufferSize - OutputPos) >= EDSLIB_HEXDUMP_MAX_LINE_SIZE)
+    {
+        LineBytes = EDSLIB_HEXDUMP_BYTES_PER_LINE;
+        if ((Count - Consumed) < LineBytes)
+        {
+            LineBytes = Count - Consumed;
+        }
+
+        OutputPos += EdsLib_Hexdump_FormatOneLine(&OutputBuffer[OutputPos], &DataPtr[Consumed],
+                DisplayOffset + Consumed, LineBytes, false);
+        OutputBuffer[OutputPos] = '\n';
+        ++OutputPos;
+
+        Consumed += LineBytes;
+    }
+
+    if (OutputPos < BufferSize)
+    {
+        OutputBuffer[OutputPos] = 0;
+    }
+
+    if (ConsumedBytes != NULL)
+    {
+        *ConsumedBytes = Consumed;
+    }
+
+    return OutputPos;
+}
+
+void EdsLib_Hexdump_Write(void *output, const uint8_t *DataPtr, uint64_t DisplayOffset, uint64_t Count)
+{
+    char Buffer[EDSLIB_HEXDUMP_WRITE_BUFFER_SIZE];
+    uint32_t Length;
+    uint64_t Consumed;
+
+    while (Count > 0)
+    {
+        Length = EdsLib_Hexdump_FormatLines(Buffer, sizeof(Buffer), DataPtr, DisplayOffset, Count, &Consumed);
+        fwrite(Buffer, 1, Length, output);
+
+        DataPtr += Consumed;
+        DisplayOffset += Consumed;
+        Count -= Consumed;
+    }
+}
+
+/*
+ * Write a range of the object, with the name on the first line only.
+ * A NULL name indicates bytes that are not part of any field.
+ */
+static void EdsLib_Hexdump_WriteAnnotatedRange(EdsLib_Hexdump_AnnotateControlBlock_t *CtrlBlock,
+        uint32_t EndPosition, const char *Name)
+{
+    char Buffer[EDSLIB_HEXDUMP_MAX_LINE_SIZE];
+    uint32_t Length;
+    uint32_t LineBytes;
+
+    while (CtrlBlock->Position < EndPosition)
+    {
+        LineBytes = EndPosition - CtrlBlock->Position;
+        if (LineBytes > EDSLIB_HEXDUMP_BYTES_PER_LINE)
+        {
+            LineBytes = EDSLIB_HEXDUMP_BYTES_PER_LINE;
+        }
+
+        Length = EdsLib_Hexdump_FormatOneLine(Buffer, &CtrlBlock->DataPtr[CtrlBlock->Position],
+                CtrlBlock->DisplayOffset + CtrlBlock->Position, LineBytes, Name != NULL);
+        fwrite(Buffer, 1, Length, CtrlBlock->fp);
+        if (Name != NULL)
+        {
+            fputs("  ", CtrlBlock->fp);
+            fputs(Name, CtrlBlock->fp);
+            Name = NULL;
+        }
+        fputc('\n', CtrlBlock->fp);
+
+        CtrlBlock->Position += LineBytes;
+    }
+}
+
+static void EdsLib_Hexdump_AnnotateCallback(void *Arg, const EdsLib_EntityDescriptor_t *ParamDesc)
+{
+    EdsLib_Hexdump_AnnotateControlBlock_t *CtrlBlock = Arg;
+    uint32_t StartPosition;
+    uint32_t EndPosition;
+
+    StartPosition = ParamDesc->EntityInfo.Offset.Bytes;
+    EndPosition = StartPosition + ParamDesc->EntityInfo.MaxSize.Bytes;
+
+    /* Skip anything that overlaps what was already shown or is outside the data */
+    if (StartPosition < CtrlBlock->Position || EndPosition > CtrlBlock->Size ||
+            EndPosition == StartPosition)
+    {
+        return;
+    }
+
+    EdsLib_Hexdump_WriteAnnotatedRange(CtrlBlock, StartPosition, NULL);
+    EdsLib_Hexdump_WriteAnnotatedRange(CtrlBlock, EndPosition, ParamDesc->FullName);
+}
+
+void EdsLib_Hexdump_WriteAnnotated(void *output, const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        const void *NativeObj, uint64_t DisplayOffset, uint32_t Size)
+{
+    EdsLib_Hexdump_AnnotateControlBlock_t CtrlBlock;
+
+    memset(&CtrlBlock, 0, sizeof(CtrlBlock));
+    CtrlBlock.fp = output;
+    CtrlBlock.DataPtr = NativeObj;
+    CtrlBlock.DisplayOffset = DisplayOffset;
+    CtrlBlock.Size = Size;
+
+    EdsLib_DisplayDB_IterateAllEntities(GD, EdsId, EdsLib_Hexdump_AnnotateCallback, &CtrlBlock);
+
+    /* Anything after the last field, i.e. trailing padding or data beyond the object */
+    EdsLib_Hexdump_WriteAnnotatedRange(&CtrlBlock, Size, NULL);
+}
+
+void EdsLib_Generate_Hexdump(void *output, const uint8_t *DataPtr, uint16_t DisplayOffset, uint16_t Count)
+{
+    fprintf(output, "Data Segment Length=%u:  \n", Count);
+    EdsLib_Hexdump_Write(output, DataPtr, DisplayOffset, Count);
+}
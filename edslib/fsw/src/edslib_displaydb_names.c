@@ -0,0 +1,440 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_displaydb_names.c
+ * \ingroup  fsw
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Implementation of precomputed full name tables.
+ *
+ * Iterating all entities of a type generates every dotted/indexed full name
+ * in a scratch buffer, which is repeated for every packet by tools that
+ * display or export telemetry.  A name table keeps the result of one such
+ * iteration, so the names are formatted only once per type.  The storage for
+ * each table is sized for its type from the database, and a name cache keeps
+ * one table for each type in the database.
+ *
+ * Linked as part of the "full" EDS runtime library
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "edslib_displaydb.h"
+#include "edslib_internal.h"
+
+/*
+ * Recently stored type names are remembered while building a table, in a small
+ * table indexed by a hash of the type.  Most entities share a few types, so this
+ * avoids storing the same name many times without searching the whole table.
+ */
+#define EDSLIB_NAMETABLE_TYPENAME_MEMO_BITS     5
+#define EDSLIB_NAMETABLE_TYPENAME_MEMO_SIZE     (1 << EDSLIB_NAMETABLE_TYPENAME_MEMO_BITS)
+
+typedef struct
+{
+    const EdsLib_DatabaseObject_t *GD;
+    EdsLib_DisplayDB_NameTable_t *NameTable;
+    uint32_t MaxEntities;
+    uint32_t StringSpaceSize;
+    uint32_t NumEntities;
+    int32_t Status;
+    EdsLib_Id_t MemoId[EDSLIB_NAMETABLE_TYPENAME_MEMO_SIZE];
+    const char *MemoName[EDSLIB_NAMETABLE_TYPENAME_MEMO_SIZE];
+} EdsLib_DisplayNameTable_ControlBlock_t;
+
+/*
+ * Get the length of the qualified type name of a type, including the terminator,
+ * or 0 if the type has no name.  This matches the output of EdsLib_DisplayDB_GetTypeName().
+ */
+static uint32_t EdsLib_DisplayNameTable_TypeNameLength(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId)
+{
+    const EdsLib_DisplayDB_Entry_t *DispInfo;
+    EdsLib_DatabaseRef_t TempRef;
+    uint32_t Length;
+
+    EdsLib_Decode_StructId(&TempRef, EdsId);
+    DispInfo = EdsLib_DisplayDB_GetEntry(GD, &TempRef);
+    if (DispInfo == NULL || DispInfo->Name == NULL)
+    {
+        return 0;
+    }
+
+    Length = strlen(DispInfo->Name);
+    if (DispInfo->Namespace != NULL)
+    {
+        Length += strlen(DispInfo->Namespace) + 1;
+    }
+    if (Length == 0)
+    {
+        return 0;
+    }
+
+    return Length + 1;
+}
+
+/*
+ * Reserve string space in the table.  When only sizing the table there is no
+ * string space, and the result is NULL, but the space is still accounted for.
+ */
+static char *EdsLib_DisplayNameTable_Reserve(EdsLib_DisplayNameTable_ControlBlock_t *CtrlBlock, uint32_t Length)
+{
+    EdsLib_DisplayDB_NameTable_t *NameTable = CtrlBlock->NameTable;
+    char *Result;
+
+    if (Length > (CtrlBlock->StringSpaceSize - NameTable->StringSpaceUsed))
+    {
+        CtrlBlock->Status = EDSLIB_INSUFFICIENT_MEMORY;
+        return NULL;
+    }
+
+    if (NameTable->StringSpace != NULL)
+    {
+        Result = &NameTable->StringSpace[NameTable->StringSpaceUsed];
+    }
+    else
+    {
+        Result = NULL;
+    }
+
+    NameTable->StringSpaceUsed += Length;
+    return Result;
+}
+
+/*
+ * Get the type name of an entity, storing it in the string space if it was not stored recently.
+ */
+static const char *EdsLib_DisplayNameTable_InternTypeName(EdsLib_DisplayNameTable_ControlBlock_t *CtrlBlock,
+        EdsLib_Id_t EdsId)
+{
+    char *Buffer;
+    uint32_t Length;
+    uint32_t Slot;
+
+    Slot = ((uint32_t)(EdsId * 0x9E3779B1U)) >> (32 - EDSLIB_NAMETABLE_TYPENAME_MEMO_BITS);
+    if (CtrlBlock->MemoName[Slot] != NULL && CtrlBlock->MemoId[Slot] == EdsId)
+    {
+        return CtrlBlock->MemoName[Slot];
+    }
+
+    Length = EdsLib_DisplayNameTable_TypeNameLength(CtrlBlock->GD, EdsId);
+    if (Length == 0)
+    {
+        /* no storage needed for the placeholder */
+        return EdsLib_DisplayDB_GetTypeName(CtrlBlock->GD, EdsId, NULL, 0);
+    }
+
+    /*
+     * When only sizing there is no buffer, but the name is remembered all the same,
+     * so that exactly the same names are stored when the table is built.
+     */
+    Buffer = EdsLib_DisplayNameTable_Reserve(CtrlBlock, Length);
+    if (CtrlBlock->Status != EDSLIB_SUCCESS)
+    {
+        return NULL;
+    }
+
+    CtrlBlock->MemoId[Slot] = EdsId;
+    CtrlBlock->MemoName[Slot] = EdsLib_DisplayDB_GetTypeName(CtrlBlock->GD, EdsId, Buffer, Length);
+
+    return CtrlBlock->MemoName[Slot];
+}
+
+static void EdsLib_DisplayNameTable_Callback(void *Arg, const EdsLib_EntityDescriptor_t *ParamDesc)
+{
+    EdsLib_DisplayNameTable_ControlBlock_t *CtrlBlock = Arg;
+    EdsLib_DisplayDB_NameTable_t *NameTable = CtrlBlock->NameTable;
+    EdsLib_DisplayDB_NameTableEntry_t *Entry;
+    const char *TypeName;
+    char *FullName;
+    uint32_t Length;
+
+    if (CtrlBlock->Status != EDSLIB_SUCCESS)
+    {
+        return;
+    }
+
+    if (CtrlBlock->NumEntities >= CtrlBlock->MaxEntities)
+    {
+        CtrlBlock->Status = EDSLIB_INSUFFICIENT_MEMORY;
+        return;
+    }
+
+    TypeName = EdsLib_DisplayNameTable_InternTypeName(CtrlBlock, ParamDesc->EntityInfo.EdsId);
+    if (CtrlBlock->Status != EDSLIB_SUCCESS)
+    {
+        return;
+    }
+
+    Length = strlen(ParamDesc->FullName) + 1;
+    FullName = EdsLib_DisplayNameTable_Reserve(CtrlBlock, Length);
+    if (CtrlBlock->Status != EDSLIB_SUCCESS)
+    {
+        return;
+    }
+
+    if (NameTable->Entities != NULL)
+    {
+        Entry = &NameTable->Entities[CtrlBlock->NumEntities];
+        Entry->Descriptor = *ParamDesc;
+        Entry->Descriptor.FullName = FullName;
+        Entry->TypeName = TypeName;
+        memcpy(FullName, ParamDesc->FullName, Length);
+    }
+    ++CtrlBlock->NumEntities;
+}
+
+/*
+ * Common walk for sizing and building a table.  When sizing, the table has no
+ * storage and the limits are the largest that a table can index.
+ */
+static int32_t EdsLib_DisplayNameTable_Build(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DisplayDB_NameTable_t *NameTable, uint32_t MaxEntities, uint32_t StringSpaceSize)
+{
+    EdsLib_DisplayNameTable_ControlBlock_t CtrlBlock;
+    EdsLib_DatabaseRef_t TempRef;
+    char *Buffer;
+    uint32_t Length;
+
+    NameTable->EdsId = EdsId;
+    NameTable->IsValid = false;
+    NameTable->NumEntities = 0;
+    NameTable->StringSpaceUsed = 0;
+
+    EdsLib_Decode_StructId(&TempRef, EdsId);
+    if (EdsLib_DataTypeDB_GetEntry(GD, &TempRef) == NULL)
+    {
+        return EDSLIB_INVALID_SIZE_OR_TYPE;
+    }
+
+    memset(&CtrlBlock, 0, sizeof(CtrlBlock));
+    CtrlBlock.GD = GD;
+    CtrlBlock.NameTable = NameTable;
+    CtrlBlock.MaxEntities = MaxEntities;
+    CtrlBlock.StringSpaceSize = StringSpaceSize;
+    CtrlBlock.Status = EDSLIB_SUCCESS;
+
+    /* The type name of the table itself is always first in the string space */
+    Length = EdsLib_DisplayNameTable_TypeNameLength(GD, EdsId);
+    Buffer = EdsLib_DisplayNameTable_Reserve(&CtrlBlock, Length);
+    if (CtrlBlock.Status != EDSLIB_SUCCESS)
+    {
+        return CtrlBlock.Status;
+    }
+    NameTable->TypeName = EdsLib_DisplayDB_GetTypeName(GD, EdsId, Buffer, Length);
+
+    EdsLib_DisplayDB_IterateAllEntities(GD, EdsId, EdsLib_DisplayNameTable_Callback, &CtrlBlock);
+
+    if (CtrlBlock.Status != EDSLIB_SUCCESS)
+    {
+        return CtrlBlock.Status;
+    }
+
+    NameTable->NumEntities = CtrlBlock.NumEntities;
+
+    return EDSLIB_SUCCESS;
+}
+
+int32_t EdsLib_DisplayDB_GetNameTableSize(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        uint16_t *NumEntities, uint32_t *StringSpaceSize)
+{
+    EdsLib_DisplayDB_NameTable_t Sizing;
+    int32_t Status;
+
+    memset(&Sizing, 0, sizeof(Sizing));
+    Status = EdsLib_DisplayNameTable_Build(GD, EdsId, &Sizing, UINT16_MAX, UINT32_MAX);
+
+    *NumEntities = Sizing.NumEntities;
+    *StringSpaceSize = Sizing.StringSpaceUsed;
+
+    return Status;
+}
+
+int32_t EdsLib_DisplayDB_InitNameTable(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DisplayDB_NameTable_t *NameTable, EdsLib_DisplayDB_NameTableEntry_t *EntityBuffer,
+        uint16_t MaxEntities, char *StringBuffer, uint32_t StringBufferSize)
+{
+    int32_t Status;
+
+    NameTable->Entities = EntityBuffer;
+    NameTable->StringSpace = StringBuffer;
+
+    if (EntityBuffer == NULL || StringBuffer == NULL)
+    {
+        MaxEntities = 0;
+        StringBufferSize = 0;
+    }
+
+    Status = EdsLib_DisplayNameTable_Build(GD, EdsId, NameTable, MaxEntities, StringBufferSize);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        NameTable->NumEntities = 0;
+        return Status;
+    }
+
+    NameTable->IsValid = true;
+
+    return EDSLIB_SUCCESS;
+}
+
+void EdsLib_DisplayDB_IterateNameTable(const EdsLib_DisplayDB_NameTable_t *NameTable, EdsLib_EntityCallback_t Callback, void *Arg)
+{
+    uint16_t Idx;
+
+    for (Idx = 0; Idx < NameTable->NumEntities; ++Idx)
+    {
+        Callback(Arg, &NameTable->Entities[Idx].Descriptor);
+    }
+}
+
+const EdsLib_DisplayDB_NameTableEntry_t *EdsLib_DisplayDB_GetNameTableEntry(const EdsLib_DisplayDB_NameTable_t *NameTable, uint16_t Index)
+{
+    if (Index >= NameTable->NumEntities)
+    {
+        return NULL;
+    }
+
+    return &NameTable->Entities[Index];
+}
+
+const char *EdsLib_DisplayDB_GetNameTableTypeName(const EdsLib_DisplayDB_NameTable_t *NameTable)
+{
+    return NameTable->TypeName;
+}
+
+/*
+ * Get the slot of a type within a name cache.  Slots are assigned to the types of
+ * each application in turn, in database order.
+ */
+static EdsLib_DisplayDB_NameTable_t *EdsLib_DisplayNameCache_GetSlot(const EdsLib_DatabaseObject_t *GD,
+        EdsLib_DisplayDB_NameCache_t *Cache, EdsLib_Id_t EdsId)
+{
+    EdsLib_DataTypeDB_t Dict;
+    EdsLib_DatabaseRef_t TempRef;
+    uint32_t SlotIdx;
+    uint16_t AppIdx;
+
+    EdsLib_Decode_StructId(&TempRef, EdsId);
+    Dict = EdsLib_DataTypeDB_GetTopLevel(GD, TempRef.AppIndex);
+    if (Dict == NULL || TempRef.TypeIndex >= Dict->DataTypeTableSize)
+    {
+        return NULL;
+    }
+
+    SlotIdx = TempRef.TypeIndex;
+    for (AppIdx = 0; AppIdx < TempRef.AppIndex; ++AppIdx)
+    {
+        Dict = EdsLib_DataTypeDB_GetTopLevel(GD, AppIdx);
+        if (Dict != NULL)
+        {
+            SlotIdx += Dict->DataTypeTableSize;
+        }
+    }
+
+    if (SlotIdx >= Cache->NumSlots)
+    {
+        return NULL;
+    }
+
+    return &Cache->Slots[SlotIdx];
+}
+
+uint32_t EdsLib_DisplayDB_GetNameCacheSlots(const EdsLib_DatabaseObject_t *GD)
+{
+    EdsLib_DataTypeDB_t Dict;
+    uint32_t NumSlots;
+    uint16_t AppIdx;
+
+    NumSlots = 0;
+    for (AppIdx = 0; AppIdx < GD->AppTableSize; ++AppIdx)
+    {
+        Dict = EdsLib_DataTypeDB_GetTopLevel(GD, AppIdx);
+        if (Dict != NULL)
+        {
+            NumSlots += Dict->DataTypeTableSize;
+        }
+    }
+
+    return NumSlots;
+}
+
+void EdsLib_DisplayDB_InitNameCache(EdsLib_DisplayDB_NameCache_t *Cache, EdsLib_DisplayDB_NameTable_t *Slots,
+        uint32_t NumSlots, EdsLib_DisplayDB_NameTableEntry_t *EntityPool, uint32_t EntityPoolSize,
+        char *StringPool, uint32_t StringPoolSize)
+{
+    memset(Cache, 0, sizeof(*Cache));
+
+    if (Slots != NULL && EntityPool != NULL && StringPool != NULL)
+    {
+        memset(Slots, 0, NumSlots * sizeof(*Slots));
+        Cache->NumSlots = NumSlots;
+        Cache->Slots = Slots;
+        Cache->EntityPoolSize = EntityPoolSize;
+        Cache->EntityPool = EntityPool;
+        Cache->StringPoolSize = StringPoolSize;
+        Cache->StringPool = StringPool;
+    }
+}
+
+const EdsLib_DisplayDB_NameTable_t *EdsLib_DisplayDB_GetCachedNameTable(const EdsLib_DatabaseObject_t *GD,
+        EdsLib_DisplayDB_NameCache_t *Cache, EdsLib_Id_t EdsId)
+{
+    EdsLib_DisplayDB_NameTable_t *NameTable;
+    uint16_t NumEntities;
+    uint32_t StringSpaceSize;
+
+    NameTable = EdsLib_DisplayNameCache_GetSlot(GD, Cache, EdsId);
+    if (NameTable == NULL)
+    {
+        return NULL;
+    }
+
+    if (NameTable->IsValid)
+    {
+        return NameTable;
+    }
+
+    /* A slot that is not valid but has an ID was already tried, and did not fit */
+    if (NameTable->EdsId != EDSLIB_ID_INVALID)
+    {
+        return NULL;
+    }
+
+    if (EdsLib_DisplayDB_GetNameTableSize(GD, EdsId, &NumEntities, &StringSpaceSize) != EDSLIB_SUCCESS ||
+            NumEntities > (Cache->EntityPoolSize - Cache->EntityPoolUsed) ||
+            StringSpaceSize > (Cache->StringPoolSize - Cache->StringPoolUsed))
+    {
+        NameTable->EdsId = EdsId;
+        return NULL;
+    }
+
+    if (EdsLib_DisplayDB_InitNameTable(GD, EdsId, NameTable, &Cache->EntityPool[Cache->EntityPoolUsed], NumEntities,
+            &Cache->StringPool[Cache->StringPoolUsed], StringSpaceSize) != EDSLIB_SUCCESS)
+    {
+        return NULL;
+    }
+
+    Cache->EntityPoolUsed += NumEntities;
+    Cache->StringPoolUsed += StringSpaceSize;
+
+    return NameTable;
+}
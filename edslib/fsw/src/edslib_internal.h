@@ -37,6 +37,7 @@
 #include "edslib_datatypedb.h"
 #include "edslib_displaydb.h"
 #include "edslib_binding_objects.h"
+#include "edslib_packed_access.h"
 
 /******************************
  * MACROS
@@ -235,6 +236,12 @@ typedef enum
     EDSLIB_PACKACTION_SUBCOMPONENTS,
 } EdsLib_PackAction_t;
 
+typedef enum
+{
+    EDSLIB_ARRAYPLAN_MODE_NORMAL = 0,   /**< Sub-objects may be block copied where the layout allows */
+    EDSLIB_ARRAYPLAN_MODE_SCALARS       /**< Every scalar field is listed as its own operation */
+} EdsLib_ArrayPlan_Mode_t;
+
 typedef struct
 {
     const void *SourceBasePtr;
@@ -246,6 +253,10 @@ typedef struct
     int32_t Status;
 } EdsLib_DataTypePackUnpack_ControlBlock_t;
 
+/* The array plan is declared in the public API so it can be statically allocated */
+typedef EdsLib_DataTypeDB_ArrayPlanOp_t EdsLib_ArrayPlanOp_t;
+typedef EdsLib_DataTypeDB_ArrayPlan_t EdsLib_ArrayPlan_t;
+
 typedef struct
 {
     void *BasePtr;
@@ -326,6 +337,14 @@ typedef struct
     EdsLib_DataTypeDB_EntityInfo_t TempMemberInfo;
 } EdsLib_ConstraintIterator_ControlBlock_t;
 
+/*
+ * Obtains the value of a constraint entity for identifying a derived type.
+ * This abstracts the format of the object buffer, which may be native or packed.
+ * ValueBuff->ValueType should be set to EDSLIB_BASICTYPE_NONE if the value cannot be obtained.
+ */
+typedef void (*EdsLib_IdentifyLoadFunc_t)(const EdsLib_DatabaseObject_t *GD, EdsLib_GenericValueBuffer_t *ValueBuff,
+        const EdsLib_ConstraintEntity_t *Location, uint16_t EntityIdx, const void *Arg);
+
 typedef enum
 {
    EDSLIB_MATCHQUALITY_NONE,
@@ -367,6 +386,25 @@ typedef struct
     char ScratchNameBuffer[EDSLIB_ITERATOR_NAME_MAX_SIZE];
 } EdsLib_DisplayUserIterator_FullName_ControlBlock_t;
 
+/*
+ * A numeric field that is read directly from packed data, as used
+ * by the size recipes, the packet filter and the decimator
+ */
+typedef enum
+{
+    EDSLIB_PACKEDFIELD_VALUE_SIGNED = 0,
+    EDSLIB_PACKEDFIELD_VALUE_UNSIGNED,
+    EDSLIB_PACKEDFIELD_VALUE_FLOAT
+} EdsLib_PackedField_ValueType_t;
+
+typedef struct
+{
+    uint32_t BitOffset;
+    uint8_t NumBits;
+    uint8_t FieldType;
+    bool LittleEndian;
+} EdsLib_PackedField_t;
+
 /**********************************************************
  * PROTOTYPES - General purpose helper functions
  **********************************************************/
@@ -399,10 +437,14 @@ EdsLib_Id_t EdsLib_Encode_StructId(const EdsLib_DatabaseRef_t *RefObj);
 
 EdsLib_DataTypeDB_t EdsLib_DataTypeDB_GetTopLevel(const EdsLib_DatabaseObject_t *GD, uint16_t AppIdx);
 const EdsLib_DataTypeDB_Entry_t *EdsLib_DataTypeDB_GetEntry(const EdsLib_DatabaseObject_t *GD, const EdsLib_DatabaseRef_t *RefObj);
+const EdsLib_ValidRangeDescriptor_t *EdsLib_DataTypeDB_GetValidRange(const EdsLib_DatabaseObject_t *GD, const EdsLib_DatabaseRef_t *RefObj);
 void EdsLib_DataTypeDB_CopyTypeInfo(const EdsLib_DataTypeDB_Entry_t *DataDictEntry, EdsLib_DataTypeDB_TypeInfo_t *TypeInfo);
 
 void EdsLib_DataTypeLoad_Impl(EdsLib_GenericValueBuffer_t *ValueBuff, EdsLib_ConstPtr_t SrcPtr, const EdsLib_DataTypeDB_Entry_t *DictEntryPtr);
 void EdsLib_DataTypeStore_Impl(EdsLib_Ptr_t DstPtr, EdsLib_GenericValueBuffer_t *SrcBuff, const EdsLib_DataTypeDB_Entry_t *DictEntryPtr);
+bool EdsLib_DataTypeConvert_IsNumeric(EdsLib_BasicType_t Type, uint32_t Size);
+void EdsLib_DataTypeConvert_LoadFloatBlock(EdsLib_BasicType_t SrcType, uint32_t SrcSize, const uint8_t *Src,
+        uint32_t Stride, double *Dest, uint32_t Count);
 
 int32_t EdsLib_DataTypeIterator_Impl(const EdsLib_DatabaseObject_t *GD,
         EdsLib_DataTypeIterator_ControlBlock_t *StateInfo);
@@ -411,7 +453,18 @@ int32_t EdsLib_DataTypeDB_ConstraintIterator_Impl(const EdsLib_DatabaseObject_t
 int32_t EdsLib_DataTypeDB_ConstraintIterator(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseId, EdsLib_Id_t DerivedId, EdsLib_ConstraintCallback_t Callback, void *CbArg);
 
 void EdsLib_DataTypePackUnpack_Impl(const EdsLib_DatabaseObject_t *GD, EdsLib_DataTypePackUnpack_ControlBlock_t *PackState);
+int32_t EdsLib_DataTypeArrayPlan_Build(const EdsLib_DatabaseObject_t *GD, const EdsLib_DatabaseRef_t *RefObj,
+        EdsLib_BitPack_OperMode_t OperMode, EdsLib_ArrayPlan_Mode_t PlanMode, uint32_t PackedStrideBits,
+        uint32_t NativeStrideBytes, EdsLib_ArrayPlan_t *Plan);
+int32_t EdsLib_DataTypeArrayPlan_Execute(const EdsLib_ArrayPlan_t *Plan, void *DestBuffer, const void *SourceBuffer,
+        uint32_t NumObjects);
+void EdsLib_DataTypeArrayPlan_PackField(const EdsLib_ArrayPlanOp_t *Op, EdsLib_PackAction_t PackAction,
+        uint8_t *DstPtr, const uint8_t *SrcPtr, uint32_t DstBitOffset);
+int32_t EdsLib_DataTypeArrayPlan_Compile(const EdsLib_ArrayPlan_t *Plan, void **Code, size_t *CodeSize);
+void EdsLib_DataTypeArrayPlan_ReleaseCode(void *Code, size_t CodeSize);
 int32_t EdsLib_DataTypeIdentifyBuffer_Impl(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_Entry_t *DataDictPtr, const void *Buffer, uint16_t *DerivTableIndex, EdsLib_DatabaseRef_t *ActualObj);
+int32_t EdsLib_DataTypeIdentify_Impl(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_Entry_t *DataDictPtr,
+        EdsLib_IdentifyLoadFunc_t LoadFunc, const void *LoadArg, uint16_t *DerivTableIndex, EdsLib_DatabaseRef_t *ActualObj);
 
 void EdsLib_DataTypeConstraintEntityLookup_Impl(const EdsLib_DataTypeDB_Entry_t *DataDictPtr, uint16_t ConstraintIdx, const EdsLib_DatabaseRef_t **RefObjPtr, EdsLib_SizeInfo_t *Offset);
 
@@ -428,6 +481,48 @@ EdsLib_Iterator_Rc_t EdsLib_PackedObject_PostProc_Callback(const EdsLib_Database
 void EdsLib_UpdateErrorControlField(const EdsLib_DataTypeDB_Entry_t *ErrorCtlDictPtr, void *PackedObject,
         uint32_t TotalBitSize, EdsLib_ErrorControlType_t ErrorCtlType, uint32_t ErrorCtlOffsetBits);
 
+int32_t EdsLib_PackedField_Init(const EdsLib_DataTypeDB_Entry_t *DataDictPtr, uint32_t BitOffset, EdsLib_PackedField_t *Field);
+
+/*
+ * Read a numeric field located by EdsLib_PackedField_Init() from the packed data.
+ * The mask is applied to the raw bits before they are converted.
+ */
+static inline void EdsLib_PackedField_Load(const uint8_t *PackedData, uint32_t BitOffset, uint8_t NumBits,
+        uint8_t FieldType, bool LittleEndian, uint64_t Mask, EdsLib_DisplayDB_FilterValue_t *Value)
+{
+    uint64_t Raw;
+
+    if (LittleEndian)
+    {
+        Raw = EdsLib_PackedAccess_GetBitsLE(PackedData, BitOffset, NumBits);
+    }
+    else
+    {
+        Raw = EdsLib_PackedAccess_GetBitsBE(PackedData, BitOffset, NumBits);
+    }
+    Raw &= Mask;
+
+    switch(FieldType)
+    {
+    case EDSLIB_PACKEDFIELD_VALUE_FLOAT:
+        if (NumBits == 32)
+        {
+            Value->Float = EdsLib_PackedAccess_ToFloat(Raw);
+        }
+        else
+        {
+            Value->Float = EdsLib_PackedAccess_ToDouble(Raw);
+        }
+        break;
+    case EDSLIB_PACKEDFIELD_VALUE_SIGNED:
+        Value->Signed = EdsLib_PackedAccess_SignExtend(Raw, NumBits);
+        break;
+    default:
+        Value->Unsigned = Raw;
+        break;
+    }
+}
+
 /**********************************************************
  * PROTOTYPES - DisplayDB helper functions
  *
@@ -40,6 +40,79 @@ void EdsLib_DataTypeConvert(EdsLib_GenericValueBuffer_t *ValueBuff, EdsLib_Basic
     UT_GenStub_Execute(EdsLib_DataTypeConvert, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_ArrayCodec_Init()
+ * ----------------------------------------------------
+ */
+void EdsLib_DataTypeDB_ArrayCodec_Init(EdsLib_DataTypeDB_ArrayCodec_t *Codec, EdsLib_Id_t EdsId,
+                                       uint32_t PackedStrideBits, uint32_t NativeStrideBytes, uint32_t JitThreshold,
+                                       uint32_t Flags)
+{
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Init, EdsLib_DataTypeDB_ArrayCodec_t *, Codec);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Init, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Init, uint32_t, PackedStrideBits);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Init, uint32_t, NativeStrideBytes);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Init, uint32_t, JitThreshold);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Init, uint32_t, Flags);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_ArrayCodec_Init, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_ArrayCodec_Pack()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_ArrayCodec_Pack(const EdsLib_DatabaseObject_t *GD, EdsLib_DataTypeDB_ArrayCodec_t *Codec,
+                                          void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_ArrayCodec_Pack, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Pack, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Pack, EdsLib_DataTypeDB_ArrayCodec_t *, Codec);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Pack, void *, DestBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Pack, const void *, SourceBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Pack, uint32_t, NumObjects);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_ArrayCodec_Pack, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_ArrayCodec_Pack, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_ArrayCodec_Release()
+ * ----------------------------------------------------
+ */
+void EdsLib_DataTypeDB_ArrayCodec_Release(EdsLib_DataTypeDB_ArrayCodec_t *Codec)
+{
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Release, EdsLib_DataTypeDB_ArrayCodec_t *, Codec);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_ArrayCodec_Release, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_ArrayCodec_Unpack()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_ArrayCodec_Unpack(const EdsLib_DatabaseObject_t *GD, EdsLib_DataTypeDB_ArrayCodec_t *Codec,
+                                            void *DestBuffer, const void *SourceBuffer, uint32_t NumObjects)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_ArrayCodec_Unpack, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Unpack, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Unpack, EdsLib_DataTypeDB_ArrayCodec_t *, Codec);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Unpack, void *, DestBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Unpack, const void *, SourceBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ArrayCodec_Unpack, uint32_t, NumObjects);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_ArrayCodec_Unpack, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_ArrayCodec_Unpack, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_BaseCheck()
@@ -58,6 +131,46 @@ int32_t EdsLib_DataTypeDB_BaseCheck(const EdsLib_DatabaseObject_t *GD, EdsLib_Id
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_BaseCheck, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_CalibrateArray()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_CalibrateArray(const EdsLib_DataTypeDB_Calibration_t *Calibration, const void *RawValues,
+                                         uint32_t NumValues, double *EuValues)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_CalibrateArray, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_CalibrateArray, const EdsLib_DataTypeDB_Calibration_t *, Calibration);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_CalibrateArray, const void *, RawValues);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_CalibrateArray, uint32_t, NumValues);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_CalibrateArray, double *, EuValues);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_CalibrateArray, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_CalibrateArray, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_ComputeContentHash()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_ComputeContentHash(const EdsLib_DataTypeDB_ContentHasher_t *Hasher, const void *NativeObj,
+                                             uint32_t NativeSize, EdsLib_DataTypeDB_ContentHash_t *Hash)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_ComputeContentHash, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ComputeContentHash, const EdsLib_DataTypeDB_ContentHasher_t *, Hasher);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ComputeContentHash, const void *, NativeObj);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ComputeContentHash, uint32_t, NativeSize);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ComputeContentHash, EdsLib_DataTypeDB_ContentHash_t *, Hash);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_ComputeContentHash, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_ComputeContentHash, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_ConstraintIterator()
@@ -79,6 +192,94 @@ int32_t EdsLib_DataTypeDB_ConstraintIterator(const EdsLib_DatabaseObject_t *GD,
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_ConstraintIterator, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_ConvertArray()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_ConvertArray(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                       EdsLib_BasicType_t DestType, uint32_t DestSize, void *DestBuffer,
+                                       uint32_t DestBufferSize, const void *SrcPtr, uint32_t SrcStride,
+                                       uint32_t NumObjects)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_ConvertArray, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ConvertArray, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ConvertArray, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ConvertArray, EdsLib_BasicType_t, DestType);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ConvertArray, uint32_t, DestSize);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ConvertArray, void *, DestBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ConvertArray, uint32_t, DestBufferSize);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ConvertArray, const void *, SrcPtr);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ConvertArray, uint32_t, SrcStride);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ConvertArray, uint32_t, NumObjects);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_ConvertArray, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_ConvertArray, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_DecodeLengthField()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_DecodeLengthField(const EdsLib_DataTypeDB_LengthFieldInfo_t *LengthInfo,
+                                            const void *PackedData, uint32_t *PackedSizeBytes)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_DecodeLengthField, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_DecodeLengthField, const EdsLib_DataTypeDB_LengthFieldInfo_t *, LengthInfo);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_DecodeLengthField, const void *, PackedData);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_DecodeLengthField, uint32_t *, PackedSizeBytes);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_DecodeLengthField, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_DecodeLengthField, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_DiffObjects()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_DiffObjects(const EdsLib_DataTypeDB_Differ_t *Differ, const void *NativeObj1,
+                                      const void *NativeObj2, uint32_t NativeSize,
+                                      EdsLib_DataTypeDB_DiffResult_t *Result)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_DiffObjects, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_DiffObjects, const EdsLib_DataTypeDB_Differ_t *, Differ);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_DiffObjects, const void *, NativeObj1);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_DiffObjects, const void *, NativeObj2);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_DiffObjects, uint32_t, NativeSize);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_DiffObjects, EdsLib_DataTypeDB_DiffResult_t *, Result);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_DiffObjects, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_DiffObjects, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_ExecuteArrayPlan()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_ExecuteArrayPlan(const EdsLib_DataTypeDB_ArrayPlan_t *Plan, void *DestBuffer,
+                                           const void *SourceBuffer, uint32_t NumObjects)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_ExecuteArrayPlan, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ExecuteArrayPlan, const EdsLib_DataTypeDB_ArrayPlan_t *, Plan);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ExecuteArrayPlan, void *, DestBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ExecuteArrayPlan, const void *, SourceBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ExecuteArrayPlan, uint32_t, NumObjects);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_ExecuteArrayPlan, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_ExecuteArrayPlan, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_FinalizePackedObject()
@@ -172,6 +373,45 @@ int32_t EdsLib_DataTypeDB_GetDerivedTypeById(const EdsLib_DatabaseObject_t *GD,
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_GetDerivedTypeById, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_GetDiffFieldInfo()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_GetDiffFieldInfo(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_Differ_t *Differ,
+                                           uint16_t FieldIdx, EdsLib_DataTypeDB_EntityInfo_t *MemberInfo)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_GetDiffFieldInfo, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetDiffFieldInfo, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetDiffFieldInfo, const EdsLib_DataTypeDB_Differ_t *, Differ);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetDiffFieldInfo, uint16_t, FieldIdx);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetDiffFieldInfo, EdsLib_DataTypeDB_EntityInfo_t *, MemberInfo);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_GetDiffFieldInfo, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_GetDiffFieldInfo, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_GetLengthFieldInfo()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_GetLengthFieldInfo(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                             EdsLib_DataTypeDB_LengthFieldInfo_t *LengthInfo)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_GetLengthFieldInfo, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetLengthFieldInfo, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetLengthFieldInfo, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetLengthFieldInfo, EdsLib_DataTypeDB_LengthFieldInfo_t *, LengthInfo);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_GetLengthFieldInfo, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_GetLengthFieldInfo, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_GetMemberByIndex()
@@ -212,6 +452,48 @@ int32_t EdsLib_DataTypeDB_GetMemberByNativeOffset(const EdsLib_DatabaseObject_t
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_GetMemberByNativeOffset, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_GetMemberCalibration()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_GetMemberCalibration(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, uint16_t SubIndex,
+                                               EdsLib_DataTypeDB_Calibration_t *Calibration)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_GetMemberCalibration, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetMemberCalibration, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetMemberCalibration, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetMemberCalibration, uint16_t, SubIndex);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetMemberCalibration, EdsLib_DataTypeDB_Calibration_t *, Calibration);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_GetMemberCalibration, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_GetMemberCalibration, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_GetPackedSizes()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_GetPackedSizes(const EdsLib_DatabaseObject_t *GD,
+                                         const EdsLib_DataTypeDB_SizeRecipe_t *Recipe, const void *PackedData,
+                                         uint32_t PackedDataSize, EdsLib_DataTypeDB_PackedSizeInfo_t *SizeInfo)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_GetPackedSizes, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetPackedSizes, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetPackedSizes, const EdsLib_DataTypeDB_SizeRecipe_t *, Recipe);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetPackedSizes, const void *, PackedData);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetPackedSizes, uint32_t, PackedDataSize);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetPackedSizes, EdsLib_DataTypeDB_PackedSizeInfo_t *, SizeInfo);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_GetPackedSizes, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_GetPackedSizes, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_GetTypeInfo()
@@ -231,6 +513,27 @@ int32_t EdsLib_DataTypeDB_GetTypeInfo(const EdsLib_DatabaseObject_t *GD, EdsLib_
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_GetTypeInfo, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_GetValidatorCheckInfo()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_GetValidatorCheckInfo(const EdsLib_DatabaseObject_t *GD,
+                                                const EdsLib_DataTypeDB_Validator_t *Validator, uint16_t CheckIdx,
+                                                EdsLib_DataTypeDB_EntityInfo_t *MemberInfo)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_GetValidatorCheckInfo, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetValidatorCheckInfo, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetValidatorCheckInfo, const EdsLib_DataTypeDB_Validator_t *, Validator);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetValidatorCheckInfo, uint16_t, CheckIdx);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_GetValidatorCheckInfo, EdsLib_DataTypeDB_EntityInfo_t *, MemberInfo);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_GetValidatorCheckInfo, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_GetValidatorCheckInfo, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_IdentifyBuffer()
@@ -252,6 +555,126 @@ int32_t EdsLib_DataTypeDB_IdentifyBuffer(const EdsLib_DatabaseObject_t *GD, EdsL
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_IdentifyBuffer, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_InitContentHasher()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_InitContentHasher(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                            EdsLib_DataTypeDB_ContentHasher_t *Hasher)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_InitContentHasher, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitContentHasher, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitContentHasher, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitContentHasher, EdsLib_DataTypeDB_ContentHasher_t *, Hasher);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_InitContentHasher, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_InitContentHasher, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_InitDiffer()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_InitDiffer(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                     EdsLib_DataTypeDB_Differ_t *Differ)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_InitDiffer, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitDiffer, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitDiffer, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitDiffer, EdsLib_DataTypeDB_Differ_t *, Differ);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_InitDiffer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_InitDiffer, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_InitPackArrayPlan()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_InitPackArrayPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                            uint32_t PackedStrideBits, uint32_t NativeStrideBytes,
+                                            EdsLib_DataTypeDB_ArrayPlan_t *Plan)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_InitPackArrayPlan, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitPackArrayPlan, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitPackArrayPlan, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitPackArrayPlan, uint32_t, PackedStrideBits);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitPackArrayPlan, uint32_t, NativeStrideBytes);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitPackArrayPlan, EdsLib_DataTypeDB_ArrayPlan_t *, Plan);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_InitPackArrayPlan, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_InitPackArrayPlan, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_InitSizeRecipe()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_InitSizeRecipe(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                         EdsLib_DataTypeDB_SizeRecipe_t *Recipe)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_InitSizeRecipe, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitSizeRecipe, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitSizeRecipe, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitSizeRecipe, EdsLib_DataTypeDB_SizeRecipe_t *, Recipe);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_InitSizeRecipe, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_InitSizeRecipe, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_InitUnpackArrayPlan()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_InitUnpackArrayPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                              uint32_t NativeStrideBytes, uint32_t PackedStrideBits,
+                                              EdsLib_DataTypeDB_ArrayPlan_t *Plan)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_InitUnpackArrayPlan, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitUnpackArrayPlan, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitUnpackArrayPlan, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitUnpackArrayPlan, uint32_t, NativeStrideBytes);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitUnpackArrayPlan, uint32_t, PackedStrideBits);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitUnpackArrayPlan, EdsLib_DataTypeDB_ArrayPlan_t *, Plan);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_InitUnpackArrayPlan, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_InitUnpackArrayPlan, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_InitValidator()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_InitValidator(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                        EdsLib_DataTypeDB_Validator_t *Validator)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_InitValidator, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitValidator, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitValidator, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_InitValidator, EdsLib_DataTypeDB_Validator_t *, Validator);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_InitValidator, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_InitValidator, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_Initialize()
@@ -302,6 +725,30 @@ int32_t EdsLib_DataTypeDB_LoadValue(const EdsLib_DatabaseObject_t *GD, EdsLib_Id
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_LoadValue, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_PackArray()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_PackArray(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, void *DestBuffer,
+                                    const void *SourceBuffer, uint32_t NumObjects, uint32_t PackedStrideBits,
+                                    uint32_t NativeStrideBytes)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_PackArray, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackArray, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackArray, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackArray, void *, DestBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackArray, const void *, SourceBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackArray, uint32_t, NumObjects);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackArray, uint32_t, PackedStrideBits);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackArray, uint32_t, NativeStrideBytes);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_PackArray, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_PackArray, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_PackCompleteObject()
@@ -386,6 +833,30 @@ int32_t EdsLib_DataTypeDB_StoreValue(const EdsLib_DatabaseObject_t *GD, EdsLib_I
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_StoreValue, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_UnpackArray()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_UnpackArray(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, void *DestBuffer,
+                                      const void *SourceBuffer, uint32_t NumObjects, uint32_t NativeStrideBytes,
+                                      uint32_t PackedStrideBits)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_UnpackArray, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackArray, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackArray, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackArray, void *, DestBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackArray, const void *, SourceBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackArray, uint32_t, NumObjects);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackArray, uint32_t, NativeStrideBytes);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackArray, uint32_t, PackedStrideBits);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_UnpackArray, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_UnpackArray, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_UnpackCompleteObject()
@@ -450,6 +921,26 @@ int32_t EdsLib_DataTypeDB_Unregister(EdsLib_DatabaseObject_t *GD, uint16_t AppId
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_Unregister, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_ValidateObject()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_ValidateObject(const EdsLib_DataTypeDB_Validator_t *Validator, const void *NativeObj,
+                                         uint32_t NativeSize, EdsLib_DataTypeDB_ValidationResult_t *Result)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_ValidateObject, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ValidateObject, const EdsLib_DataTypeDB_Validator_t *, Validator);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ValidateObject, const void *, NativeObj);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ValidateObject, uint32_t, NativeSize);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_ValidateObject, EdsLib_DataTypeDB_ValidationResult_t *, Result);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_ValidateObject, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_ValidateObject, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_VerifyUnpackedObject()
@@ -56,6 +56,127 @@ void EdsLib_DisplayDB_Base64Encode(char *Out, uint32_t OutputLenBytes, const uin
     UT_GenStub_Execute(EdsLib_DisplayDB_Base64Encode, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_CompileExpression()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DisplayDB_CompileExpression(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, const char *Text,
+                                           EdsLib_DisplayDB_Expression_t *Expression)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_CompileExpression, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_CompileExpression, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_CompileExpression, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_CompileExpression, const char *, Text);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_CompileExpression, EdsLib_DisplayDB_Expression_t *, Expression);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_CompileExpression, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_CompileExpression, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_CompileFilter()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DisplayDB_CompileFilter(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseId, EdsLib_Id_t EdsId,
+                                       const char *Text, EdsLib_DisplayDB_Filter_t *Filter)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_CompileFilter, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_CompileFilter, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_CompileFilter, EdsLib_Id_t, BaseId);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_CompileFilter, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_CompileFilter, const char *, Text);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_CompileFilter, EdsLib_DisplayDB_Filter_t *, Filter);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_CompileFilter, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_CompileFilter, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_Decimate()
+ * ----------------------------------------------------
+ */
+EdsLib_DisplayDB_DecimateResult_t EdsLib_DisplayDB_Decimate(EdsLib_DisplayDB_Decimator_t *Decimator,
+                                                            const void *PackedData, uint32_t PackedSize, void *Output,
+                                                            uint32_t *OutputSize)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_Decimate, EdsLib_DisplayDB_DecimateResult_t);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_Decimate, EdsLib_DisplayDB_Decimator_t *, Decimator);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_Decimate, const void *, PackedData);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_Decimate, uint32_t, PackedSize);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_Decimate, void *, Output);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_Decimate, uint32_t *, OutputSize);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_Decimate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_Decimate, EdsLib_DisplayDB_DecimateResult_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_EvaluateExpression()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DisplayDB_EvaluateExpression(const EdsLib_DisplayDB_Expression_t *Expression, const void *NativeObjs,
+                                            uint32_t Stride, uint32_t NumObjects, double *Results)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_EvaluateExpression, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_EvaluateExpression, const EdsLib_DisplayDB_Expression_t *, Expression);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_EvaluateExpression, const void *, NativeObjs);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_EvaluateExpression, uint32_t, Stride);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_EvaluateExpression, uint32_t, NumObjects);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_EvaluateExpression, double *, Results);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_EvaluateExpression, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_EvaluateExpression, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_FilterMatch()
+ * ----------------------------------------------------
+ */
+bool EdsLib_DisplayDB_FilterMatch(const EdsLib_DisplayDB_Filter_t *Filter, const void *PackedData, uint32_t PackedSize)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_FilterMatch, bool);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_FilterMatch, const EdsLib_DisplayDB_Filter_t *, Filter);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_FilterMatch, const void *, PackedData);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_FilterMatch, uint32_t, PackedSize);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_FilterMatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_FilterMatch, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_FlushDecimator()
+ * ----------------------------------------------------
+ */
+EdsLib_DisplayDB_DecimateResult_t EdsLib_DisplayDB_FlushDecimator(EdsLib_DisplayDB_Decimator_t *Decimator,
+                                                                  void *Output, uint32_t *OutputSize)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_FlushDecimator, EdsLib_DisplayDB_DecimateResult_t);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_FlushDecimator, EdsLib_DisplayDB_Decimator_t *, Decimator);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_FlushDecimator, void *, Output);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_FlushDecimator, uint32_t *, OutputSize);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_FlushDecimator, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_FlushDecimator, EdsLib_DisplayDB_DecimateResult_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DisplayDB_GetBaseName()
@@ -73,6 +194,26 @@ const char *EdsLib_DisplayDB_GetBaseName(const EdsLib_DatabaseObject_t *GD, EdsL
     return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_GetBaseName, const char *);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_GetCachedNameTable()
+ * ----------------------------------------------------
+ */
+const EdsLib_DisplayDB_NameTable_t *EdsLib_DisplayDB_GetCachedNameTable(const EdsLib_DatabaseObject_t *GD,
+                                                                        EdsLib_DisplayDB_NameCache_t *Cache,
+                                                                        EdsLib_Id_t EdsId)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_GetCachedNameTable, const EdsLib_DisplayDB_NameTable_t *);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_GetCachedNameTable, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_GetCachedNameTable, EdsLib_DisplayDB_NameCache_t *, Cache);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_GetCachedNameTable, EdsLib_Id_t, EdsId);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_GetCachedNameTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_GetCachedNameTable, const EdsLib_DisplayDB_NameTable_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DisplayDB_GetDisplayHint()
@@ -180,6 +321,76 @@ const char *EdsLib_DisplayDB_GetNameByIndex(const EdsLib_DatabaseObject_t *GD, E
     return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_GetNameByIndex, const char *);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_GetNameCacheSlots()
+ * ----------------------------------------------------
+ */
+uint32_t EdsLib_DisplayDB_GetNameCacheSlots(const EdsLib_DatabaseObject_t *GD)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_GetNameCacheSlots, uint32_t);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_GetNameCacheSlots, const EdsLib_DatabaseObject_t *, GD);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_GetNameCacheSlots, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_GetNameCacheSlots, uint32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_GetNameTableEntry()
+ * ----------------------------------------------------
+ */
+const EdsLib_DisplayDB_NameTableEntry_t *EdsLib_DisplayDB_GetNameTableEntry(const EdsLib_DisplayDB_NameTable_t *NameTable,
+                                                                            uint16_t Index)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_GetNameTableEntry, const EdsLib_DisplayDB_NameTableEntry_t *);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_GetNameTableEntry, const EdsLib_DisplayDB_NameTable_t *, NameTable);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_GetNameTableEntry, uint16_t, Index);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_GetNameTableEntry, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_GetNameTableEntry, const EdsLib_DisplayDB_NameTableEntry_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_GetNameTableSize()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DisplayDB_GetNameTableSize(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, uint16_t *NumEntities,
+                                          uint32_t *StringSpaceSize)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_GetNameTableSize, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_GetNameTableSize, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_GetNameTableSize, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_GetNameTableSize, uint16_t *, NumEntities);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_GetNameTableSize, uint32_t *, StringSpaceSize);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_GetNameTableSize, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_GetNameTableSize, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_GetNameTableTypeName()
+ * ----------------------------------------------------
+ */
+const char *EdsLib_DisplayDB_GetNameTableTypeName(const EdsLib_DisplayDB_NameTable_t *NameTable)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_GetNameTableTypeName, const char *);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_GetNameTableTypeName, const EdsLib_DisplayDB_NameTable_t *, NameTable);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_GetNameTableTypeName, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_GetNameTableTypeName, const char *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DisplayDB_GetNamespace()
@@ -217,6 +428,73 @@ const char *EdsLib_DisplayDB_GetTypeName(const EdsLib_DatabaseObject_t *GD, EdsL
     return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_GetTypeName, const char *);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_InitDecimator()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DisplayDB_InitDecimator(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseId, EdsLib_Id_t EdsId,
+                                       const EdsLib_DisplayDB_DecimateConfig_t *Config,
+                                       EdsLib_DisplayDB_Decimator_t *Decimator)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_InitDecimator, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitDecimator, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitDecimator, EdsLib_Id_t, BaseId);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitDecimator, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitDecimator, const EdsLib_DisplayDB_DecimateConfig_t *, Config);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitDecimator, EdsLib_DisplayDB_Decimator_t *, Decimator);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_InitDecimator, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_InitDecimator, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_InitNameCache()
+ * ----------------------------------------------------
+ */
+void EdsLib_DisplayDB_InitNameCache(EdsLib_DisplayDB_NameCache_t *Cache, EdsLib_DisplayDB_NameTable_t *Slots,
+                                    uint32_t NumSlots, EdsLib_DisplayDB_NameTableEntry_t *EntityPool,
+                                    uint32_t EntityPoolSize, char *StringPool, uint32_t StringPoolSize)
+{
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameCache, EdsLib_DisplayDB_NameCache_t *, Cache);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameCache, EdsLib_DisplayDB_NameTable_t *, Slots);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameCache, uint32_t, NumSlots);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameCache, EdsLib_DisplayDB_NameTableEntry_t *, EntityPool);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameCache, uint32_t, EntityPoolSize);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameCache, char *, StringPool);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameCache, uint32_t, StringPoolSize);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_InitNameCache, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_InitNameTable()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DisplayDB_InitNameTable(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                       EdsLib_DisplayDB_NameTable_t *NameTable,
+                                       EdsLib_DisplayDB_NameTableEntry_t *EntityBuffer, uint16_t MaxEntities,
+                                       char *StringBuffer, uint32_t StringBufferSize)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DisplayDB_InitNameTable, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameTable, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameTable, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameTable, EdsLib_DisplayDB_NameTable_t *, NameTable);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameTable, EdsLib_DisplayDB_NameTableEntry_t *, EntityBuffer);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameTable, uint16_t, MaxEntities);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameTable, char *, StringBuffer);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_InitNameTable, uint32_t, StringBufferSize);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_InitNameTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DisplayDB_InitNameTable, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DisplayDB_Initialize()
@@ -276,6 +554,21 @@ void EdsLib_DisplayDB_IterateEnumValues(const EdsLib_DatabaseObject_t *GD, EdsLi
     UT_GenStub_Execute(EdsLib_DisplayDB_IterateEnumValues, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DisplayDB_IterateNameTable()
+ * ----------------------------------------------------
+ */
+void EdsLib_DisplayDB_IterateNameTable(const EdsLib_DisplayDB_NameTable_t *NameTable, EdsLib_EntityCallback_t Callback,
+                                       void *Arg)
+{
+    UT_GenStub_AddParam(EdsLib_DisplayDB_IterateNameTable, const EdsLib_DisplayDB_NameTable_t *, NameTable);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_IterateNameTable, EdsLib_EntityCallback_t, Callback);
+    UT_GenStub_AddParam(EdsLib_DisplayDB_IterateNameTable, void *, Arg);
+
+    UT_GenStub_Execute(EdsLib_DisplayDB_IterateNameTable, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DisplayDB_LocateSubEntity()
@@ -328,6 +621,61 @@ void EdsLib_Generate_Hexdump(void *output, const uint8_t *DataPtr, uint16_t Disp
     UT_GenStub_Execute(EdsLib_Generate_Hexdump, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_Hexdump_FormatLines()
+ * ----------------------------------------------------
+ */
+uint32_t EdsLib_Hexdump_FormatLines(char *OutputBuffer, uint32_t BufferSize, const uint8_t *DataPtr,
+                                    uint64_t DisplayOffset, uint64_t Count, uint64_t *ConsumedBytes)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_Hexdump_FormatLines, uint32_t);
+
+    UT_GenStub_AddParam(EdsLib_Hexdump_FormatLines, char *, OutputBuffer);
+    UT_GenStub_AddParam(EdsLib_Hexdump_FormatLines, uint32_t, BufferSize);
+    UT_GenStub_AddParam(EdsLib_Hexdump_FormatLines, const uint8_t *, DataPtr);
+    UT_GenStub_AddParam(EdsLib_Hexdump_FormatLines, uint64_t, DisplayOffset);
+    UT_GenStub_AddParam(EdsLib_Hexdump_FormatLines, uint64_t, Count);
+    UT_GenStub_AddParam(EdsLib_Hexdump_FormatLines, uint64_t *, ConsumedBytes);
+
+    UT_GenStub_Execute(EdsLib_Hexdump_FormatLines, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_Hexdump_FormatLines, uint32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_Hexdump_Write()
+ * ----------------------------------------------------
+ */
+void EdsLib_Hexdump_Write(void *output, const uint8_t *DataPtr, uint64_t DisplayOffset, uint64_t Count)
+{
+    UT_GenStub_AddParam(EdsLib_Hexdump_Write, void *, output);
+    UT_GenStub_AddParam(EdsLib_Hexdump_Write, const uint8_t *, DataPtr);
+    UT_GenStub_AddParam(EdsLib_Hexdump_Write, uint64_t, DisplayOffset);
+    UT_GenStub_AddParam(EdsLib_Hexdump_Write, uint64_t, Count);
+
+    UT_GenStub_Execute(EdsLib_Hexdump_Write, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_Hexdump_WriteAnnotated()
+ * ----------------------------------------------------
+ */
+void EdsLib_Hexdump_WriteAnnotated(void *output, const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                   const void *NativeObj, uint64_t DisplayOffset, uint32_t Size)
+{
+    UT_GenStub_AddParam(EdsLib_Hexdump_WriteAnnotated, void *, output);
+    UT_GenStub_AddParam(EdsLib_Hexdump_WriteAnnotated, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_Hexdump_WriteAnnotated, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_Hexdump_WriteAnnotated, const void *, NativeObj);
+    UT_GenStub_AddParam(EdsLib_Hexdump_WriteAnnotated, uint64_t, DisplayOffset);
+    UT_GenStub_AddParam(EdsLib_Hexdump_WriteAnnotated, uint32_t, Size);
+
+    UT_GenStub_Execute(EdsLib_Hexdump_WriteAnnotated, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_Scalar_FromString()
@@ -130,6 +130,13 @@ static inline void lua_setuservalue(lua_State *lua, int n)
     lua_setfenv(lua, n);
 }
 
+/* lua5.1 keeps the globals table at a pseudo-index rather than
+ * in the registry, but the result is the same */
+static inline void lua_pushglobaltable(lua_State *lua)
+{
+    lua_pushvalue(lua, LUA_GLOBALSINDEX);
+}
+
 static inline const char *luaL_tolstring(lua_State *lua, int n, size_t *sz)
 {
     /* this uses the basic tolstring function, which does not
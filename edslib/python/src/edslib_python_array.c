@@ -166,7 +166,7 @@ static int EdsLib_Python_ObjectArray_getbuffer(PyObject *obj, Py_buffer *view, i
     Py_ssize_t ArrayItemSize;
 
     ArrayItemSize = EdsLib_Python_DatabaseEntry_GetMaxSize((PyTypeObject*)self->RefDbEntry);
-    if (view->itemsize <= 0)
+    if (ArrayItemSize < 0)
     {
         return -1;
     }
@@ -208,6 +208,58 @@ static void EdsLib_Python_ObjectArray_releasebuffer(PyObject *obj, Py_buffer *vi
     EdsLib_Python_Buffer_ReleaseContentRef(view->internal);
 }
 
+int EdsLib_Python_ObjectArray_InitElements(EdsLib_Python_ObjectArray_t *self, Py_ssize_t StartIdx, Py_ssize_t EndIdx)
+{
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    EdsLib_Binding_Buffer_Content_t *content;
+    EdsLib_Binding_DescriptorObject_t desc;
+    Py_ssize_t idx;
+
+    /*
+     * Get the type info for the _element_ rather than the array itself.
+     * This should always be present
+     */
+    if (EdsLib_DataTypeDB_GetTypeInfo(self->RefDbEntry->EdsDb->GD, self->RefDbEntry->EdsId, &TypeInfo) != EDSLIB_SUCCESS)
+    {
+        PyErr_Format(PyExc_RuntimeError, "Cannot get type info from EDS DB");
+        return -1;
+    }
+
+    /* don't bother looping through an array of scalars.
+     * (this is to speed up the case of a dynamic array of thousands or millions
+     * of integers - such as ADC codes - and these have no initialization)
+     * */
+    if (TypeInfo.NumSubElements == 0)
+    {
+        return 0;
+    }
+
+    content = EdsLib_Python_Buffer_GetContentRef(self->objbase.StorageBuf, PyBUF_WRITABLE);
+    if (content == NULL)
+    {
+        return -1;
+    }
+
+    memset(&desc, 0, sizeof(desc));
+
+    desc.GD = self->RefDbEntry->EdsDb->GD;
+    desc.EdsId = self->RefDbEntry->EdsId;
+    desc.Offset = self->objbase.Offset + (self->ElementSize * StartIdx);
+    desc.Length = self->ElementSize;
+    EdsLib_Binding_SetDescBuffer(&desc, content);
+
+    for (idx = StartIdx; idx < EndIdx; ++idx)
+    {
+        EdsLib_Binding_InitStaticFields(&desc);
+        desc.Offset += self->ElementSize;
+    }
+
+    EdsLib_Binding_SetDescBuffer(&desc, NULL);
+    EdsLib_Python_Buffer_ReleaseContentRef(content);
+
+    return 0;
+}
+
 static int          EdsLib_Python_ObjectArray_init(PyObject *obj, PyObject *args, PyObject *kwds)
 {
     static const char *in_kwlist[] = { "value", NULL };
@@ -218,7 +270,6 @@ static int          EdsLib_Python_ObjectArray_init(PyObject *obj, PyObject *args
     Py_ssize_t maxsize = -1;
     Py_ssize_t nelem = -1;
     Py_ssize_t elemsz = -1;
-    Py_ssize_t idx;
     int result = -1;
 
     /*
@@ -395,48 +446,10 @@ static int          EdsLib_Python_ObjectArray_init(PyObject *obj, PyObject *args
          */
         if (!EdsLib_Python_Buffer_IsInitialized(self->objbase.StorageBuf))
         {
-            /*
-             * Now get the type info for the _element_ rather than the array itself.
-             * This should always be present
-             */
-            if (EdsLib_DataTypeDB_GetTypeInfo(self->RefDbEntry->EdsDb->GD, self->RefDbEntry->EdsId, &TypeInfo) != EDSLIB_SUCCESS)
+            if (EdsLib_Python_ObjectArray_InitElements(self, 0, self->ElementCount) != 0)
             {
-                PyErr_Format(PyExc_RuntimeError, "Cannot get type info from EDS DB");
                 break;
             }
-
-            /* don't bother looping through an array of scalars.
-             * (this is to speed up the case of a dynamic array of thousands or millions
-             * of integers - such as ADC codes - and these have no initialization)
-             * */
-            if (TypeInfo.NumSubElements > 0)
-            {
-                EdsLib_Binding_Buffer_Content_t *content;
-                EdsLib_Binding_DescriptorObject_t desc;
-
-                content = EdsLib_Python_Buffer_GetContentRef(self->objbase.StorageBuf, PyBUF_WRITABLE);
-                if (content == NULL)
-                {
-                    return -1;
-                }
-
-                memset(&desc, 0, sizeof(desc));
-
-                desc.GD = self->RefDbEntry->EdsDb->GD;
-                desc.EdsId = self->RefDbEntry->EdsId;
-                desc.Offset = self->objbase.Offset;
-                desc.Length = self->ElementSize;
-                EdsLib_Binding_SetDescBuffer(&desc, content);
-
-                for (idx = 0; idx < self->ElementCount; ++idx)
-                {
-                    EdsLib_Binding_InitStaticFields(&desc);
-                    desc.Offset += self->ElementSize;
-                }
-
-                EdsLib_Binding_SetDescBuffer(&desc, NULL);
-                EdsLib_Python_Buffer_ReleaseContentRef(content);
-            }
         }
 
         result = 0;
@@ -233,6 +233,46 @@ EdsLib_Python_Buffer_t* EdsLib_Python_Buffer_New(Py_ssize_t len)
     return self;
 }
 
+bool EdsLib_Python_Buffer_Resize(EdsLib_Python_Buffer_t* buf, Py_ssize_t len)
+{
+    void *mem;
+
+    /*
+     * Only buffers allocated here can be resized.  Buffers wrapping
+     * another Python object or a pointer from C are fixed in size.
+     */
+    if (!buf->is_dynamic || buf->bufobj != NULL)
+    {
+        PyErr_SetString(PyExc_BufferError, "Buffer is not resizable.");
+        return false;
+    }
+
+    /*
+     * The memory may be moved, so this cannot be done while any view
+     * of the current content is exported.
+     */
+    if (buf->edsbuf.ReferenceCount > 0)
+    {
+        PyErr_SetString(PyExc_BufferError, "Buffer is in use and cannot be resized.");
+        return false;
+    }
+
+    mem = PyMem_Realloc(buf->edsbuf.Data, len);
+    if (mem == NULL)
+    {
+        PyErr_NoMemory();
+        return false;
+    }
+
+    if ((size_t)len > buf->edsbuf.MaxContentSize)
+    {
+        memset((uint8_t*)mem + buf->edsbuf.MaxContentSize, 0, len - buf->edsbuf.MaxContentSize);
+    }
+    EdsLib_Binding_InitUnmanagedBuffer(&buf->edsbuf, mem, len);
+
+    return true;
+}
+
 EdsLib_Python_Buffer_t* EdsLib_Python_Buffer_FromPtrAndSize(void *buf, Py_ssize_t len)
 {
     EdsLib_Python_Buffer_t* self;
@@ -128,6 +128,9 @@ static void EdsLib_Python_ConvertPyMembers_Callback(void *Arg, const EdsLib_Enti
             EdsLib_Python_ConvertPythonToEdsObjectImpl(&subpair);
             Py_DECREF(subpair.pyobj);
         }
+
+        /* drop the buffer reference taken by InitSubObject */
+        EdsLib_Binding_SetDescBuffer(&subpair.desc, NULL);
     }
 }
 
@@ -171,6 +174,9 @@ static void EdsLib_Python_ConvertEdsMembers_Callback(void *Arg, const EdsLib_Ent
                 Py_DECREF(subpair.pyobj);
             }
         }
+
+        /* drop the buffer reference taken by InitSubObject */
+        EdsLib_Binding_SetDescBuffer(&subpair.desc, NULL);
     }
 }
 
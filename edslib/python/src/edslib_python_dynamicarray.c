@@ -32,13 +32,51 @@
 **
 **   In contrast to static arrays, these instance types are _not_ directly
 **   defined in EDS.
+**
+**   Arrays that own their storage can grow via append() and extend().  The
+**   storage capacity is doubled as needed, so building an array one element
+**   at a time does not copy the content on every call.
+**
+**   When the elements are numbers and the values come from an object that
+**   implements the buffer protocol (bytes, array.array, numpy, etc) the values
+**   are converted directly from the source memory, without creating a Python
+**   object for each element.
  */
 
 #include "edslib_python_internal.h"
 
+/*
+ * The smallest capacity allocated when an array first needs to grow
+ */
+#define EDSLIB_PYTHON_DYNAMICARRAY_MIN_CAPACITY     16
+
+/*
+ * Holds the values being assigned into an array
+ *
+ * Values come either directly from a buffer view (if the element type is a
+ * number and the buffer format is a native number) or from a sequence.
+ */
+typedef struct
+{
+    Py_ssize_t Count;
+    PyObject *FastSeq;
+    char Format;
+    bool HasView;
+    Py_buffer View;
+} EdsLib_Python_DynamicArray_Source_t;
+
 
 static int          EdsLib_Python_DynamicArray_init(PyObject *obj, PyObject *args, PyObject *kwds);
 static PyObject *   EdsLib_Python_DynamicArray_call(PyObject *obj, PyObject *args, PyObject *kwds);
+static PyObject *   EdsLib_Python_DynamicArray_append(PyObject *obj, PyObject *arg);
+static PyObject *   EdsLib_Python_DynamicArray_extend(PyObject *obj, PyObject *arg);
+
+static PyMethodDef EdsLib_Python_DynamicArray_methods[] =
+{
+        {"append",  EdsLib_Python_DynamicArray_append, METH_O, "Append a value to the end of the array."},
+        {"extend",  EdsLib_Python_DynamicArray_extend, METH_O, "Append all values from a sequence or buffer to the end of the array."},
+        {NULL}  /* Sentinel */
+};
 
 PyTypeObject EdsLib_Python_DynamicArrayType =
 {
@@ -48,22 +86,525 @@ PyTypeObject EdsLib_Python_DynamicArrayType =
     .tp_base = &EdsLib_Python_ObjectArrayType,
     .tp_init = EdsLib_Python_DynamicArray_init,
     .tp_call = EdsLib_Python_DynamicArray_call,
+    .tp_methods = EdsLib_Python_DynamicArray_methods,
     .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
     .tp_doc = PyDoc_STR("EDS Dynamic Array Type")
 };
 
+static void EdsLib_Python_DynamicArray_SetLength(EdsLib_Python_ObjectArray_t *self, Py_ssize_t NewCount)
+{
+    self->ElementCount = NewCount;
+    self->objbase.TotalLength = NewCount * self->ElementSize;
+}
+
+/*
+ * Ensure the storage can hold at least the given number of elements.
+ * This does not change the length of the array.
+ */
+static int EdsLib_Python_DynamicArray_Reserve(EdsLib_Python_ObjectArray_t *self, Py_ssize_t NewCount)
+{
+    EdsLib_Python_Buffer_t *StorageBuf = self->objbase.StorageBuf;
+    Py_ssize_t Capacity;
+    Py_ssize_t NewCapacity;
+
+    Capacity = 0;
+    if (StorageBuf->edsbuf.MaxContentSize > (size_t)self->objbase.Offset)
+    {
+        Capacity = (StorageBuf->edsbuf.MaxContentSize - self->objbase.Offset) / self->ElementSize;
+    }
+
+    if (NewCount <= Capacity)
+    {
+        return 0;
+    }
+
+    if (NewCount > ((PY_SSIZE_T_MAX - self->objbase.Offset) / self->ElementSize))
+    {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    /*
+     * Double the capacity, so that appending one element at a time has
+     * a constant amortized cost.  A larger request is allocated exactly.
+     */
+    NewCapacity = EDSLIB_PYTHON_DYNAMICARRAY_MIN_CAPACITY;
+    if (Capacity <= ((PY_SSIZE_T_MAX - self->objbase.Offset) / self->ElementSize / 2) &&
+            NewCapacity < (Capacity * 2))
+    {
+        NewCapacity = Capacity * 2;
+    }
+    if (NewCapacity < NewCount ||
+            NewCapacity > ((PY_SSIZE_T_MAX - self->objbase.Offset) / self->ElementSize))
+    {
+        NewCapacity = NewCount;
+    }
+
+    if (!EdsLib_Python_Buffer_Resize(StorageBuf, self->objbase.Offset + (NewCapacity * self->ElementSize)))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Get the format of a buffer that can be read directly, or 0 if the
+ * buffer does not contain native numbers.
+ */
+static char EdsLib_Python_DynamicArray_GetBufferFormat(const Py_buffer *view)
+{
+    const char *Format = view->format;
+
+    if (Format == NULL)
+    {
+        return 'B';
+    }
+
+    if (*Format == '@')
+    {
+        ++Format;
+    }
+
+    if (Format[0] == 0 || Format[1] != 0 || strchr("bBhHiIlLqQfd", Format[0]) == NULL)
+    {
+        return 0;
+    }
+
+    return Format[0];
+}
+
+static void EdsLib_Python_DynamicArray_LoadBufferValue(const void *Src, char Format, EdsLib_GenericValueBuffer_t *ValBuf)
+{
+    union
+    {
+        signed char b;
+        unsigned char B;
+        short h;
+        unsigned short H;
+        int i;
+        unsigned int I;
+        long l;
+        unsigned long L;
+        long long q;
+        unsigned long long Q;
+        float f;
+        double d;
+    } Value;
+
+    switch(Format)
+    {
+    case 'b':
+        memcpy(&Value.b, Src, sizeof(Value.b));
+        ValBuf->Value.SignedInteger = Value.b;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_SIGNED_INT;
+        break;
+    case 'B':
+        memcpy(&Value.B, Src, sizeof(Value.B));
+        ValBuf->Value.UnsignedInteger = Value.B;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_UNSIGNED_INT;
+        break;
+    case 'h':
+        memcpy(&Value.h, Src, sizeof(Value.h));
+        ValBuf->Value.SignedInteger = Value.h;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_SIGNED_INT;
+        break;
+    case 'H':
+        memcpy(&Value.H, Src, sizeof(Value.H));
+        ValBuf->Value.UnsignedInteger = Value.H;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_UNSIGNED_INT;
+        break;
+    case 'i':
+        memcpy(&Value.i, Src, sizeof(Value.i));
+        ValBuf->Value.SignedInteger = Value.i;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_SIGNED_INT;
+        break;
+    case 'I':
+        memcpy(&Value.I, Src, sizeof(Value.I));
+        ValBuf->Value.UnsignedInteger = Value.I;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_UNSIGNED_INT;
+        break;
+    case 'l':
+        memcpy(&Value.l, Src, sizeof(Value.l));
+        ValBuf->Value.SignedInteger = Value.l;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_SIGNED_INT;
+        break;
+    case 'L':
+        memcpy(&Value.L, Src, sizeof(Value.L));
+        ValBuf->Value.UnsignedInteger = Value.L;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_UNSIGNED_INT;
+        break;
+    case 'q':
+        memcpy(&Value.q, Src, sizeof(Value.q));
+        ValBuf->Value.SignedInteger = Value.q;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_SIGNED_INT;
+        break;
+    case 'Q':
+        memcpy(&Value.Q, Src, sizeof(Value.Q));
+        ValBuf->Value.UnsignedInteger = Value.Q;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_UNSIGNED_INT;
+        break;
+    case 'f':
+        memcpy(&Value.f, Src, sizeof(Value.f));
+        ValBuf->Value.FloatingPoint = Value.f;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_FLOAT;
+        break;
+    case 'd':
+        memcpy(&Value.d, Src, sizeof(Value.d));
+        ValBuf->Value.FloatingPoint = Value.d;
+        ValBuf->ValueType = EDSLIB_BASICTYPE_FLOAT;
+        break;
+    default:
+        ValBuf->ValueType = EDSLIB_BASICTYPE_NONE;
+        break;
+    }
+}
+
+/*
+ * Prepare to assign values from a Python object into the array
+ *
+ * For number elements, any object that exports a contiguous buffer of native
+ * numbers is used directly.  Everything else must be iterable.
+ */
+static int EdsLib_Python_DynamicArray_OpenSource(EdsLib_Python_ObjectArray_t *self, PyObject *src,
+        EdsLib_Python_DynamicArray_Source_t *Source)
+{
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+
+    memset(Source, 0, sizeof(*Source));
+
+    if (EdsLib_DataTypeDB_GetTypeInfo(self->RefDbEntry->EdsDb->GD, self->RefDbEntry->EdsId, &TypeInfo) != EDSLIB_SUCCESS)
+    {
+        PyErr_Format(PyExc_RuntimeError, "Cannot get type info from EDS DB");
+        return -1;
+    }
+
+    /*
+     * An array cannot read directly from its own storage, as the
+     * exported view would prevent the storage from being resized.
+     */
+    if ((PyObject *)self != src &&
+            TypeInfo.NumSubElements == 0 &&
+            (TypeInfo.ElemType == EDSLIB_BASICTYPE_SIGNED_INT ||
+                    TypeInfo.ElemType == EDSLIB_BASICTYPE_UNSIGNED_INT ||
+                    TypeInfo.ElemType == EDSLIB_BASICTYPE_FLOAT) &&
+            PyObject_CheckBuffer(src))
+    {
+        if (PyObject_GetBuffer(src, &Source->View, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) == 0)
+        {
+            Source->Format = EdsLib_Python_DynamicArray_GetBufferFormat(&Source->View);
+            if (Source->Format != 0 && Source->View.itemsize > 0)
+            {
+                Source->HasView = true;
+                Source->Count = Source->View.len / Source->View.itemsize;
+                return 0;
+            }
+
+            PyBuffer_Release(&Source->View);
+        }
+        else
+        {
+            /* not usable as a buffer, but may still work as a sequence */
+            PyErr_Clear();
+        }
+    }
+
+    Source->FastSeq = PySequence_Fast(src, "argument must be iterable");
+    if (Source->FastSeq == NULL)
+    {
+        return -1;
+    }
+
+    Source->Count = PySequence_Fast_GET_SIZE(Source->FastSeq);
+
+    return 0;
+}
+
+static void EdsLib_Python_DynamicArray_CloseSource(EdsLib_Python_DynamicArray_Source_t *Source)
+{
+    if (Source->HasView)
+    {
+        PyBuffer_Release(&Source->View);
+        Source->HasView = false;
+    }
+    Py_CLEAR(Source->FastSeq);
+}
+
+/*
+ * Assign a number of values from the source, starting at the given element
+ * index.  The elements must already exist in the array.
+ */
+static int EdsLib_Python_DynamicArray_FillFromSource(EdsLib_Python_ObjectArray_t *self,
+        EdsLib_Python_DynamicArray_Source_t *Source, Py_ssize_t StartIdx, Py_ssize_t Count)
+{
+    EdsLib_Binding_Buffer_Content_t *content;
+    EdsLib_Binding_DescriptorObject_t desc;
+    EdsLib_GenericValueBuffer_t ValBuf;
+    const uint8_t *SrcPtr;
+    PyObject **items;
+    Py_ssize_t idx;
+    int result = 0;
+
+    if (Count <= 0)
+    {
+        return 0;
+    }
+
+    content = EdsLib_Python_Buffer_GetContentRef(self->objbase.StorageBuf, PyBUF_WRITABLE);
+    if (content == NULL)
+    {
+        return -1;
+    }
+
+    memset(&desc, 0, sizeof(desc));
+    desc.GD = self->RefDbEntry->EdsDb->GD;
+    desc.EdsId = self->RefDbEntry->EdsId;
+    desc.Offset = self->objbase.Offset + (self->ElementSize * StartIdx);
+    desc.Length = self->ElementSize;
+    EdsLib_DataTypeDB_GetTypeInfo(desc.GD, desc.EdsId, &desc.TypeInfo);
+    EdsLib_Binding_SetDescBuffer(&desc, content);
+
+    if (Source->HasView)
+    {
+        /*
+         * Bulk mode: each value is taken directly from the source memory
+         * and stored through EdsLib, without a Python object per element.
+         * Values outside the range of the element type are converted as
+         * EdsLib does for any other source, i.e. like a C cast.
+         */
+        SrcPtr = Source->View.buf;
+        memset(&ValBuf, 0, sizeof(ValBuf));
+        for (idx = 0; idx < Count; ++idx)
+        {
+            EdsLib_Python_DynamicArray_LoadBufferValue(SrcPtr, Source->Format, &ValBuf);
+            if (EdsLib_Binding_StoreValue(&desc, &ValBuf) != EDSLIB_SUCCESS)
+            {
+                PyErr_Format(PyExc_ValueError, "Cannot store element %zd into %s",
+                        idx, ((PyTypeObject*)self->RefDbEntry)->tp_name);
+                result = -1;
+                break;
+            }
+            SrcPtr += Source->View.itemsize;
+            desc.Offset += self->ElementSize;
+        }
+    }
+    else
+    {
+        items = PySequence_Fast_ITEMS(Source->FastSeq);
+        for (idx = 0; idx < Count; ++idx)
+        {
+            if (items[idx] == Py_None)
+            {
+                /* same as assigning None to an element: leave it unchanged */
+            }
+            else if (desc.TypeInfo.NumSubElements == 0 &&
+                    !PyObject_TypeCheck(items[idx], &EdsLib_Python_ObjectBaseType))
+            {
+                /* scalar elements can be converted without creating an element object */
+                if (!EdsLib_Python_ConvertPythonToEdsScalar(&desc, items[idx]))
+                {
+                    result = -1;
+                    break;
+                }
+            }
+            else if (PySequence_SetItem((PyObject *)self, StartIdx + idx, items[idx]) != 0)
+            {
+                result = -1;
+                break;
+            }
+            desc.Offset += self->ElementSize;
+        }
+    }
+
+    EdsLib_Binding_SetDescBuffer(&desc, NULL);
+    EdsLib_Python_Buffer_ReleaseContentRef(content);
+
+    return result;
+}
+
+/*
+ * Add elements to the end of the array, then assign values from the source.
+ * If anything fails, the array is restored to its original length.
+ */
+static int EdsLib_Python_DynamicArray_AppendFromSource(EdsLib_Python_ObjectArray_t *self,
+        EdsLib_Python_DynamicArray_Source_t *Source)
+{
+    Py_ssize_t PrevCount = self->ElementCount;
+
+    /*
+     * Exported views refer to the current length (and possibly the
+     * current memory), so the same rule as bytearray applies here.
+     */
+    if (self->objbase.StorageBuf->edsbuf.ReferenceCount > 0)
+    {
+        PyErr_SetString(PyExc_BufferError, "Existing exports of data: object cannot be re-sized");
+        return -1;
+    }
+
+    if (Source->Count > (PY_SSIZE_T_MAX - PrevCount))
+    {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    if (EdsLib_Python_DynamicArray_Reserve(self, PrevCount + Source->Count) != 0)
+    {
+        return -1;
+    }
+
+    EdsLib_Python_DynamicArray_SetLength(self, PrevCount + Source->Count);
+
+    if (EdsLib_Python_ObjectArray_InitElements(self, PrevCount, self->ElementCount) != 0 ||
+            EdsLib_Python_DynamicArray_FillFromSource(self, Source, PrevCount, Source->Count) != 0)
+    {
+        EdsLib_Python_DynamicArray_SetLength(self, PrevCount);
+        return -1;
+    }
+
+    return 0;
+}
+
 static int          EdsLib_Python_DynamicArray_init(PyObject *obj, PyObject *args, PyObject *kwds)
 {
-    static const char *kwlist[] = { "dbent", "nelem", "elemsz", NULL };
+    static const char *kwlist[] = { "dbent", "nelem", "elemsz", "value", NULL };
+    EdsLib_Python_ObjectArray_t *self = (EdsLib_Python_ObjectArray_t *)obj;
+    EdsLib_Python_DynamicArray_Source_t Source;
+    PyObject *value = NULL;
+    Py_ssize_t nelem = -1;
+    bool is_empty = false;
     int result = -1;
 
+    memset(&Source, 0, sizeof(Source));
+
     kwds = EdsLib_Python_ObjectBase_InitArgsToKwds(args, kwds, kwlist);
-    if (kwds != NULL)
+    if (kwds == NULL)
     {
-        result = EdsLib_Python_DynamicArrayType.tp_base->tp_init(obj, NULL, kwds);
+        return -1;
+    }
+
+    do
+    {
+        /*
+         * The initial value is applied here, after the storage is set up,
+         * rather than by the base object init.  The base init can only
+         * convert objects that are directly defined in EDS.
+         */
+        value = PyDict_GetItemString(kwds, "value"); /* borrowed ref */
+        if (value != NULL)
+        {
+            Py_INCREF(value);
+            if (PyDict_DelItemString(kwds, "value") != 0)
+            {
+                break;
+            }
+        }
+
+        if (!EdsLib_Python_ObjectBase_GetKwArg(kwds,"|n:DynamicArray_init", "nelem", &nelem))
+        {
+            break;
+        }
+
+        /*
+         * Without a length or a buffer, start with an empty array.
+         * The base init requires a nonzero size, so this allocates
+         * room for one element and then sets the length to zero.
+         */
+        if (nelem <= 0 && PyDict_GetItemString(kwds, "buffer") == NULL &&
+                PyDict_GetItemString(kwds, "maxsize") == NULL)
+        {
+            is_empty = true;
+            if (!EdsLib_Python_ObjectBase_SetKwArg(kwds, "n", "nelem", (Py_ssize_t)1))
+            {
+                break;
+            }
+        }
+
+        if (EdsLib_Python_DynamicArrayType.tp_base->tp_init(obj, NULL, kwds) != 0)
+        {
+            break;
+        }
 
-        Py_DECREF(kwds);
+        if (is_empty)
+        {
+            EdsLib_Python_DynamicArray_SetLength(self, 0);
+        }
+
+        if (value != NULL)
+        {
+            if (EdsLib_Python_DynamicArray_OpenSource(self, value, &Source) != 0)
+            {
+                break;
+            }
+
+            if (is_empty)
+            {
+                /* size the array to the initial value */
+                if (EdsLib_Python_DynamicArray_AppendFromSource(self, &Source) != 0)
+                {
+                    break;
+                }
+            }
+            else if (EdsLib_Python_DynamicArray_FillFromSource(self, &Source, 0,
+                    (Source.Count < self->ElementCount) ? Source.Count : self->ElementCount) != 0)
+            {
+                break;
+            }
+        }
+
+        result = 0;
     }
+    while(0);
+
+    EdsLib_Python_DynamicArray_CloseSource(&Source);
+    Py_XDECREF(value);
+    Py_DECREF(kwds);
+
+    return result;
+}
+
+static PyObject *EdsLib_Python_DynamicArray_append(PyObject *obj, PyObject *arg)
+{
+    EdsLib_Python_ObjectArray_t *self = (EdsLib_Python_ObjectArray_t *)obj;
+    EdsLib_Python_DynamicArray_Source_t Source;
+    PyObject *result = NULL;
+
+    memset(&Source, 0, sizeof(Source));
+
+    /* treat the value as a sequence of one item */
+    Source.FastSeq = PyTuple_Pack(1, arg);
+    if (Source.FastSeq != NULL)
+    {
+        Source.Count = 1;
+        if (EdsLib_Python_DynamicArray_AppendFromSource(self, &Source) == 0)
+        {
+            result = Py_None;
+            Py_INCREF(result);
+        }
+    }
+
+    EdsLib_Python_DynamicArray_CloseSource(&Source);
+
+    return result;
+}
+
+static PyObject *EdsLib_Python_DynamicArray_extend(PyObject *obj, PyObject *arg)
+{
+    EdsLib_Python_ObjectArray_t *self = (EdsLib_Python_ObjectArray_t *)obj;
+    EdsLib_Python_DynamicArray_Source_t Source;
+    PyObject *result = NULL;
+
+    if (EdsLib_Python_DynamicArray_OpenSource(self, arg, &Source) != 0)
+    {
+        return NULL;
+    }
+
+    if (EdsLib_Python_DynamicArray_AppendFromSource(self, &Source) == 0)
+    {
+        result = Py_None;
+        Py_INCREF(result);
+    }
+
+    EdsLib_Python_DynamicArray_CloseSource(&Source);
 
     return result;
 }
@@ -71,15 +612,16 @@ static int          EdsLib_Python_DynamicArray_init(PyObject *obj, PyObject *arg
 static PyObject *EdsLib_Python_DynamicArray_call(PyObject *obj, PyObject *args, PyObject *kwds)
 {
     EdsLib_Python_ObjectArray_t *self = (EdsLib_Python_ObjectArray_t *)obj;
+    EdsLib_Python_DynamicArray_Source_t Source;
     PyObject *inseq = NULL;
     PyObject *outlist = NULL;
     PyObject *result = NULL;
-    PyObject *subarg = NULL;
     PyObject *element = NULL;
     Py_ssize_t idx = 0;
     Py_ssize_t maxlen = -1;
     ternaryfunc callfunc = ((PyTypeObject*)self->RefDbEntry)->tp_call;
 
+    memset(&Source, 0, sizeof(Source));
 
     /*
      * This function is basically just a "call iterator" that calls
@@ -113,32 +655,47 @@ static PyObject *EdsLib_Python_DynamicArray_call(PyObject *obj, PyObject *args,
             break;
         }
 
-        if (inseq == NULL)
+        if (inseq != NULL)
         {
-            maxlen = self->ElementCount;
-            outlist = PyList_New(self->ElementCount);
-            if (outlist == NULL)
+            /*
+             * Setter mode: assign values from the input.
+             * Any input values beyond the length of the array are ignored.
+             */
+            if (!PySequence_Check(inseq) && !PyObject_CheckBuffer(inseq))
             {
+                PyErr_Format(PyExc_TypeError, "%s(): argument type \'%s\' is not a sequence", __func__, Py_TYPE(inseq)->tp_name);
                 break;
             }
-        }
-        else if (!PySequence_Check(inseq))
-        {
-            PyErr_Format(PyExc_TypeError, "%s(): argument type \'%s\' is not a sequence", __func__, Py_TYPE(inseq)->tp_name);
-            break;
-        }
-        else
-        {
-            maxlen = PySequence_Size(inseq);
+
+            if (EdsLib_Python_DynamicArray_OpenSource(self, inseq, &Source) != 0)
+            {
+                break;
+            }
+
+            maxlen = Source.Count;
             if (maxlen > self->ElementCount)
             {
                 maxlen = self->ElementCount;
             }
-            subarg = PyTuple_Pack(1, Py_None);
-            if (subarg == NULL)
+
+            if (EdsLib_Python_DynamicArray_FillFromSource(self, &Source, 0, maxlen) != 0)
             {
                 break;
             }
+
+            result = Py_None;
+            Py_INCREF(result);
+            break;
+        }
+
+        /*
+         * Getter mode: output a list of values
+         */
+        maxlen = self->ElementCount;
+        outlist = PyList_New(self->ElementCount);
+        if (outlist == NULL)
+        {
+            break;
         }
 
         for (idx = 0; idx < maxlen; ++idx)
@@ -151,50 +708,17 @@ static PyObject *EdsLib_Python_DynamicArray_call(PyObject *obj, PyObject *args,
             }
 
             /*
-             * Recycle the existing 1-element tuple
-             * Set item 0 to be the current input value.
-             * This is for efficiency - it is possible because we know that the
-             * base call implementation will not keep a reference to the tuple.
-             */
-            if (subarg != NULL)
-            {
-                PyObject *invalue = PySequence_GetItem(inseq, idx); /* new ref */
-                if (invalue == NULL)
-                {
-                    break;
-                }
-
-                /*
-                 * Need to manually DECREF old item first since
-                 * PyTuple_SET_ITEM (macro form) leaks any existing value
-                 */
-                Py_DECREF(PyTuple_GET_ITEM(subarg, 0));
-                PyTuple_SET_ITEM(subarg, 0, invalue); /* steals ref */
-            }
-
-            /*
-             * Invoke the call routine on the subobject, with the argument from input sequence (if set)
+             * Invoke the call routine on the subobject, and save the result to the outlist.
              */
             {
-                PyObject *outvalue = callfunc(element, subarg, NULL);
+                PyObject *outvalue = callfunc(element, NULL, NULL);
 
                 if (outvalue == NULL)
                 {
                     break;
                 }
 
-                /*
-                 * If in getter mode (outlist is non-null) then save the result
-                 * to the outlist.  Otherwise toss out the result.
-                 */
-                if (outlist != NULL)
-                {
-                    PyList_SET_ITEM(outlist, idx, outvalue); /* steals ref */
-                }
-                else
-                {
-                    Py_DECREF(outvalue);    /* discard ref */
-                }
+                PyList_SET_ITEM(outlist, idx, outvalue); /* steals ref */
             }
         }
 
@@ -204,20 +728,8 @@ static PyObject *EdsLib_Python_DynamicArray_call(PyObject *obj, PyObject *args,
             break;
         }
 
-        /*
-         * Successful....
-         * Figure out what to return to the caller
-         */
-        if (outlist != NULL)
-        {
-            /* getter mode - return the output list */
-            result = outlist;
-        }
-        else
-        {
-            /* setter mode - return None */
-            result = Py_None;
-        }
+        /* return the output list */
+        result = outlist;
         Py_INCREF(result);
     }
     while(0);
@@ -225,8 +737,8 @@ static PyObject *EdsLib_Python_DynamicArray_call(PyObject *obj, PyObject *args,
     /*
      * DECREF any owned objects used during this procedure.
      */
+    EdsLib_Python_DynamicArray_CloseSource(&Source);
     Py_XDECREF(outlist);
-    Py_XDECREF(subarg);
     Py_XDECREF(element);
 
     return result;
@@ -145,6 +145,7 @@ bool EdsLib_Python_ObjectBase_GetKwArg(PyObject *kwds, const char *format, const
 PyObject *EdsLib_Python_ObjectBase_GenericNew(PyTypeObject *objtype, PyObject *kwargs);
 PyObject *EdsLib_Python_ObjectBase_NewSubObject(PyObject *obj, PyTypeObject *subobjtype, Py_ssize_t Offset, Py_ssize_t MaxSize);
 int EdsLib_Python_ObjectBase_InitBufferView(EdsLib_Python_ObjectBase_t *self, Py_buffer *view, int flags);
+int EdsLib_Python_ObjectArray_InitElements(EdsLib_Python_ObjectArray_t *self, Py_ssize_t StartIdx, Py_ssize_t EndIdx);
 
 int EdsLib_Python_SetupObjectDesciptor(EdsLib_Python_ObjectBase_t *self, EdsLib_Binding_DescriptorObject_t *descobj, int flags);
 void EdsLib_Python_ReleaseObjectDesciptor(EdsLib_Binding_DescriptorObject_t *descobj);
@@ -155,6 +156,7 @@ EdsLib_Python_Buffer_t* EdsLib_Python_Buffer_Copy(const void *buf, Py_ssize_t le
 EdsLib_Python_Buffer_t* EdsLib_Python_Buffer_FromObject(PyObject *bufobj, int readonly);
 EdsLib_Python_Buffer_t* EdsLib_Python_Buffer_FromPtrAndSize(void *buf, Py_ssize_t len);
 EdsLib_Python_Buffer_t* EdsLib_Python_Buffer_FromConstPtrAndSize(const void *buf, Py_ssize_t len);
+bool EdsLib_Python_Buffer_Resize(EdsLib_Python_Buffer_t* buf, Py_ssize_t len);
 const void *EdsLib_Python_Buffer_Peek(EdsLib_Python_Buffer_t* buf);
 Py_ssize_t EdsLib_Python_Buffer_GetMaxSize(EdsLib_Python_Buffer_t* buf);
 bool EdsLib_Python_Buffer_IsInitialized(EdsLib_Python_Buffer_t* buf);
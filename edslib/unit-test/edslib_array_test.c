@@ -0,0 +1,343 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_array_test.c
+ * \ingroup  edslib
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Unit testing of the array pack/unpack API.  The array plan and the array
+ * codec must give exactly the same result as packing or unpacking each
+ * object on its own.
+ */
+
+#include <string.h>
+
+#include "utassert.h"
+
+#include "edslib_datatypedb.h"
+#include "edslib_ut_database.h"
+
+#define UT_ARRAY_NUM_OBJECTS        13
+#define UT_ARRAY_MAX_OBJECT_SIZE    32
+
+typedef struct
+{
+    uint16_t TypeIdx;
+    uint32_t NativeSize;
+} UT_ArrayType_t;
+
+/*
+ * Types with every kind of entry: byte aligned only, a fixed value and an
+ * unaligned array, an error control field, and a calibrated length field
+ */
+static const UT_ArrayType_t UT_ARRAY_TYPES[] =
+{
+    { UT_EDS_TYPE_VECTOR, sizeof(UT_Vector_t) },
+    { UT_EDS_TYPE_RECORD, sizeof(UT_Record_t) },
+    { UT_EDS_TYPE_SAMPLE, sizeof(UT_Sample_t) },
+    { UT_EDS_TYPE_LONG, sizeof(UT_Long_t) }
+};
+
+static uint8_t UT_ArrayNative[UT_ARRAY_NUM_OBJECTS * UT_ARRAY_MAX_OBJECT_SIZE];
+static uint8_t UT_ArrayPacked[UT_ARRAY_NUM_OBJECTS * UT_ARRAY_MAX_OBJECT_SIZE];
+static uint8_t UT_ArrayResult[UT_ARRAY_NUM_OBJECTS * UT_ARRAY_MAX_OBJECT_SIZE];
+static uint8_t UT_ArrayExpected[UT_ARRAY_NUM_OBJECTS * UT_ARRAY_MAX_OBJECT_SIZE];
+
+static uint32_t UT_ArrayRandom;
+
+/*
+ * Fill a buffer from a fixed pseudo random sequence, so failures are repeatable
+ */
+static void UT_Array_Fill(uint8_t *Buffer, uint32_t Size)
+{
+    uint32_t Idx;
+
+    for (Idx = 0; Idx < Size; ++Idx)
+    {
+        UT_ArrayRandom = (UT_ArrayRandom * 1103515245) + 12345;
+        Buffer[Idx] = (UT_ArrayRandom >> 16) & 0xFF;
+    }
+}
+
+static uint32_t UT_Array_PackedBytes(uint16_t TypeIdx)
+{
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetTypeInfo(&UT_EDS_DATABASE, UT_EDS_ID(TypeIdx), &TypeInfo), EDSLIB_SUCCESS);
+
+    return (TypeInfo.Size.Bits + 7) / 8;
+}
+
+void EdsLib_Array_Pack_Test(void)
+{
+    const UT_ArrayType_t *Type;
+    EdsLib_Id_t EdsId;
+    uint32_t TypeIdx;
+    uint32_t ObjIdx;
+    uint32_t PackedBytes;
+
+    UT_ArrayRandom = 1;
+    for (TypeIdx = 0; TypeIdx < (sizeof(UT_ARRAY_TYPES) / sizeof(UT_ARRAY_TYPES[0])); ++TypeIdx)
+    {
+        Type = &UT_ARRAY_TYPES[TypeIdx];
+        PackedBytes = UT_Array_PackedBytes(Type->TypeIdx);
+        UT_Array_Fill(UT_ArrayNative, sizeof(UT_ArrayNative));
+        memset(UT_ArrayResult, 0, sizeof(UT_ArrayResult));
+        memset(UT_ArrayExpected, 0, sizeof(UT_ArrayExpected));
+
+        for (ObjIdx = 0; ObjIdx < UT_ARRAY_NUM_OBJECTS; ++ObjIdx)
+        {
+            EdsId = UT_EDS_ID(Type->TypeIdx);
+            UtAssert_INT32_EQ(EdsLib_DataTypeDB_PackCompleteObject(&UT_EDS_DATABASE, &EdsId,
+                    &UT_ArrayExpected[ObjIdx * PackedBytes], &UT_ArrayNative[ObjIdx * Type->NativeSize],
+                    8 * PackedBytes, Type->NativeSize), EDSLIB_SUCCESS);
+        }
+
+        UtAssert_INT32_EQ(EdsLib_DataTypeDB_PackArray(&UT_EDS_DATABASE, UT_EDS_ID(Type->TypeIdx), UT_ArrayResult,
+                UT_ArrayNative, UT_ARRAY_NUM_OBJECTS, 8 * PackedBytes, Type->NativeSize), EDSLIB_SUCCESS);
+        UtAssert_True(memcmp(UT_ArrayResult, UT_ArrayExpected, sizeof(UT_ArrayResult)) == 0,
+                "Type %u packed array matches single objects", (unsigned int)Type->TypeIdx);
+    }
+}
+
+void EdsLib_Array_Unpack_Test(void)
+{
+    const UT_ArrayType_t *Type;
+    EdsLib_Id_t EdsId;
+    uint32_t TypeIdx;
+    uint32_t ObjIdx;
+    uint32_t PackedBytes;
+    int32_t ExpectedStatus;
+    int32_t Status;
+
+    UT_ArrayRandom = 2;
+    for (TypeIdx = 0; TypeIdx < (sizeof(UT_ARRAY_TYPES) / sizeof(UT_ARRAY_TYPES[0])); ++TypeIdx)
+    {
+        Type = &UT_ARRAY_TYPES[TypeIdx];
+        PackedBytes = UT_Array_PackedBytes(Type->TypeIdx);
+
+        /* valid objects first, then random data that fails verification */
+        memset(UT_ArrayNative, 0, sizeof(UT_ArrayNative));
+        UtAssert_INT32_EQ(EdsLib_DataTypeDB_PackArray(&UT_EDS_DATABASE, UT_EDS_ID(Type->TypeIdx), UT_ArrayPacked,
+                UT_ArrayNative, UT_ARRAY_NUM_OBJECTS, 8 * PackedBytes, Type->NativeSize), EDSLIB_SUCCESS);
+        UT_Array_Fill(&UT_ArrayPacked[PackedBytes], (UT_ARRAY_NUM_OBJECTS - 1) * PackedBytes);
+
+        memset(UT_ArrayResult, 0xEE, sizeof(UT_ArrayResult));
+        memset(UT_ArrayExpected, 0xEE, sizeof(UT_ArrayExpected));
+
+        ExpectedStatus = EDSLIB_SUCCESS;
+        for (ObjIdx = 0; ObjIdx < UT_ARRAY_NUM_OBJECTS; ++ObjIdx)
+        {
+            EdsId = UT_EDS_ID(Type->TypeIdx);
+            Status = EdsLib_DataTypeDB_UnpackCompleteObject(&UT_EDS_DATABASE, &EdsId,
+                    &UT_ArrayExpected[ObjIdx * Type->NativeSize], &UT_ArrayPacked[ObjIdx * PackedBytes],
+                    Type->NativeSize, 8 * PackedBytes);
+            if (ObjIdx == 0)
+            {
+                UtAssert_INT32_EQ(Status, EDSLIB_SUCCESS);
+            }
+            if (ExpectedStatus == EDSLIB_SUCCESS)
+            {
+                ExpectedStatus = Status;
+            }
+        }
+
+        Status = EdsLib_DataTypeDB_UnpackArray(&UT_EDS_DATABASE, UT_EDS_ID(Type->TypeIdx), UT_ArrayResult,
+                UT_ArrayPacked, UT_ARRAY_NUM_OBJECTS, Type->NativeSize, 8 * PackedBytes);
+        UtAssert_INT32_EQ(Status, ExpectedStatus);
+        UtAssert_True(memcmp(UT_ArrayResult, UT_ArrayExpected, sizeof(UT_ArrayResult)) == 0,
+                "Type %u unpacked array matches single objects", (unsigned int)Type->TypeIdx);
+    }
+}
+
+/*
+ * Length and fixed value fields are verified on unpack with the same value that pack writes
+ */
+void EdsLib_Array_Verify_Test(void)
+{
+    UT_Record_t Record;
+    UT_Long_t Long;
+    uint8_t Packed[UT_ARRAY_MAX_OBJECT_SIZE];
+    EdsLib_Id_t EdsId;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.Temp = -100;
+    EdsId = UT_EDS_ID(UT_EDS_TYPE_RECORD);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_PackCompleteObject(&UT_EDS_DATABASE, &EdsId, Packed, &Record,
+            8 * sizeof(Packed), sizeof(Record)), EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Packed[0], UT_EDS_RECORD_SYNC);
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_UnpackCompleteObject(&UT_EDS_DATABASE, &EdsId, &Record, Packed,
+            sizeof(Record), 8 * sizeof(Packed)), EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Record.Sync, UT_EDS_RECORD_SYNC);
+    UtAssert_INT32_EQ(Record.Temp, -100);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_UnpackArray(&UT_EDS_DATABASE, EdsId, &Record, Packed, 1,
+            sizeof(Record), 84), EDSLIB_SUCCESS);
+
+    Packed[0] ^= 0x01;
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_UnpackCompleteObject(&UT_EDS_DATABASE, &EdsId, &Record, Packed,
+            sizeof(Record), 8 * sizeof(Packed)), EDSLIB_FIELD_MISMATCH);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_UnpackArray(&UT_EDS_DATABASE, EdsId, &Record, Packed, 1,
+            sizeof(Record), 84), EDSLIB_FIELD_MISMATCH);
+
+    /* the length field holds the calibrated packed size */
+    memset(&Long, 0, sizeof(Long));
+    EdsId = UT_EDS_ID(UT_EDS_TYPE_LONG);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_PackCompleteObject(&UT_EDS_DATABASE, &EdsId, Packed, &Long,
+            8 * sizeof(Packed), sizeof(Long)), EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Packed[2], 8 - UT_EDS_HEADER_LENGTH_BIAS);
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_UnpackCompleteObject(&UT_EDS_DATABASE, &EdsId, &Long, Packed,
+            sizeof(Long), 8 * sizeof(Packed)), EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Long.Hdr.Length, 8 - UT_EDS_HEADER_LENGTH_BIAS);
+
+    Packed[2] = 8;
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_UnpackCompleteObject(&UT_EDS_DATABASE, &EdsId, &Long, Packed,
+            sizeof(Long), 8 * sizeof(Packed)), EDSLIB_FIELD_MISMATCH);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_UnpackArray(&UT_EDS_DATABASE, EdsId, &Long, Packed, 1,
+            sizeof(Long), 64), EDSLIB_FIELD_MISMATCH);
+}
+
+/*
+ * A prepared plan gives the same result as the one-shot calls, including for
+ * objects packed end to end which do not start on a byte boundary
+ */
+void EdsLib_Array_Plan_Test(void)
+{
+    static EdsLib_DataTypeDB_ArrayPlan_t Plan;
+    const UT_ArrayType_t *Type;
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    uint32_t TypeIdx;
+    uint32_t StrideBits;
+
+    UT_ArrayRandom = 3;
+    for (TypeIdx = 0; TypeIdx < 2; ++TypeIdx)
+    {
+        Type = &UT_ARRAY_TYPES[TypeIdx];
+        UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetTypeInfo(&UT_EDS_DATABASE, UT_EDS_ID(Type->TypeIdx), &TypeInfo),
+                EDSLIB_SUCCESS);
+        StrideBits = TypeInfo.Size.Bits + 3;
+
+        UT_Array_Fill(UT_ArrayNative, sizeof(UT_ArrayNative));
+        UT_Array_Fill(UT_ArrayResult, sizeof(UT_ArrayResult));
+        memcpy(UT_ArrayExpected, UT_ArrayResult, sizeof(UT_ArrayExpected));
+
+        UtAssert_INT32_EQ(EdsLib_DataTypeDB_PackArray(&UT_EDS_DATABASE, UT_EDS_ID(Type->TypeIdx), UT_ArrayExpected,
+                UT_ArrayNative, UT_ARRAY_NUM_OBJECTS, StrideBits, Type->NativeSize), EDSLIB_SUCCESS);
+        UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitPackArrayPlan(&UT_EDS_DATABASE, UT_EDS_ID(Type->TypeIdx),
+                StrideBits, Type->NativeSize, &Plan), EDSLIB_SUCCESS);
+        UtAssert_INT32_EQ(EdsLib_DataTypeDB_ExecuteArrayPlan(&Plan, UT_ArrayResult, UT_ArrayNative,
+                UT_ARRAY_NUM_OBJECTS), EDSLIB_SUCCESS);
+        UtAssert_True(memcmp(UT_ArrayResult, UT_ArrayExpected, sizeof(UT_ArrayResult)) == 0,
+                "Type %u pack plan matches pack array", (unsigned int)Type->TypeIdx);
+
+        memcpy(UT_ArrayPacked, UT_ArrayResult, sizeof(UT_ArrayPacked));
+        UT_Array_Fill(UT_ArrayResult, sizeof(UT_ArrayResult));
+        memcpy(UT_ArrayExpected, UT_ArrayResult, sizeof(UT_ArrayExpected));
+
+        UtAssert_INT32_EQ(EdsLib_DataTypeDB_UnpackArray(&UT_EDS_DATABASE, UT_EDS_ID(Type->TypeIdx), UT_ArrayExpected,
+                UT_ArrayPacked, UT_ARRAY_NUM_OBJECTS, Type->NativeSize, StrideBits), EDSLIB_SUCCESS);
+        UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitUnpackArrayPlan(&UT_EDS_DATABASE, UT_EDS_ID(Type->TypeIdx),
+                Type->NativeSize, StrideBits, &Plan), EDSLIB_SUCCESS);
+        UtAssert_INT32_EQ(EdsLib_DataTypeDB_ExecuteArrayPlan(&Plan, UT_ArrayResult, UT_ArrayPacked,
+                UT_ARRAY_NUM_OBJECTS), EDSLIB_SUCCESS);
+        UtAssert_True(memcmp(UT_ArrayResult, UT_ArrayExpected, sizeof(UT_ArrayResult)) == 0,
+                "Type %u unpack plan matches unpack array", (unsigned int)Type->TypeIdx);
+    }
+}
+
+/*
+ * The array codec gives the same result as the one-shot calls before and after
+ * compilation.  With the self check enabled, compiled code is only kept if it
+ * matches the interpreter, and types with special fields are never compiled.
+ */
+void EdsLib_Array_Codec_Test(void)
+{
+    static EdsLib_DataTypeDB_ArrayCodec_t Codec;
+    const UT_ArrayType_t *Type;
+    uint32_t TypeIdx;
+    uint32_t CallIdx;
+    uint32_t PackedBits;
+    int32_t Status;
+
+    UT_ArrayRandom = 4;
+    for (TypeIdx = 0; TypeIdx < 2; ++TypeIdx)
+    {
+        Type = &UT_ARRAY_TYPES[TypeIdx];
+
+        /* leave a gap between the packed objects, which must not be modified */
+        PackedBits = 8 * (UT_Array_PackedBytes(Type->TypeIdx) + 1);
+        EdsLib_DataTypeDB_ArrayCodec_Init(&Codec, UT_EDS_ID(Type->TypeIdx), PackedBits, Type->NativeSize, 2,
+                EDSLIB_ARRAYCODEC_FLAG_SELFCHECK);
+
+        for (CallIdx = 0; CallIdx < 4; ++CallIdx)
+        {
+            UT_Array_Fill(UT_ArrayNative, sizeof(UT_ArrayNative));
+            UT_Array_Fill(UT_ArrayResult, sizeof(UT_ArrayResult));
+            memcpy(UT_ArrayExpected, UT_ArrayResult, sizeof(UT_ArrayExpected));
+
+            UtAssert_INT32_EQ(EdsLib_DataTypeDB_PackArray(&UT_EDS_DATABASE, UT_EDS_ID(Type->TypeIdx),
+                    UT_ArrayExpected, UT_ArrayNative, UT_ARRAY_NUM_OBJECTS, PackedBits, Type->NativeSize),
+                    EDSLIB_SUCCESS);
+            UtAssert_INT32_EQ(EdsLib_DataTypeDB_ArrayCodec_Pack(&UT_EDS_DATABASE, &Codec, UT_ArrayResult,
+                    UT_ArrayNative, UT_ARRAY_NUM_OBJECTS), EDSLIB_SUCCESS);
+            UtAssert_True(memcmp(UT_ArrayResult, UT_ArrayExpected, sizeof(UT_ArrayResult)) == 0,
+                    "Type %u codec pack call %u matches pack array", (unsigned int)Type->TypeIdx,
+                    (unsigned int)CallIdx);
+
+            memcpy(UT_ArrayPacked, UT_ArrayResult, sizeof(UT_ArrayPacked));
+            UT_Array_Fill(UT_ArrayResult, sizeof(UT_ArrayResult));
+            memcpy(UT_ArrayExpected, UT_ArrayResult, sizeof(UT_ArrayExpected));
+
+            Status = EdsLib_DataTypeDB_UnpackArray(&UT_EDS_DATABASE, UT_EDS_ID(Type->TypeIdx), UT_ArrayExpected,
+                    UT_ArrayPacked, UT_ARRAY_NUM_OBJECTS, Type->NativeSize, PackedBits);
+            UtAssert_INT32_EQ(EdsLib_DataTypeDB_ArrayCodec_Unpack(&UT_EDS_DATABASE, &Codec, UT_ArrayResult,
+                    UT_ArrayPacked, UT_ARRAY_NUM_OBJECTS), Status);
+            UtAssert_True(memcmp(UT_ArrayResult, UT_ArrayExpected, sizeof(UT_ArrayResult)) == 0,
+                    "Type %u codec unpack call %u matches unpack array", (unsigned int)Type->TypeIdx,
+                    (unsigned int)CallIdx);
+        }
+
+        if (Type->TypeIdx != UT_EDS_TYPE_VECTOR)
+        {
+            UtAssert_True(Codec.Pack.Code == NULL && Codec.Pack.Status != EDSLIB_SUCCESS,
+                    "Type %u pack is not compiled", (unsigned int)Type->TypeIdx);
+            UtAssert_True(Codec.Unpack.Code == NULL && Codec.Unpack.Status != EDSLIB_SUCCESS,
+                    "Type %u unpack is not compiled", (unsigned int)Type->TypeIdx);
+        }
+        else
+        {
+#if defined(EDSLIB_ENABLE_JIT) && defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+            UtAssert_INT32_EQ(Codec.Pack.Status, EDSLIB_SUCCESS);
+            UtAssert_True(Codec.Pack.Code != NULL, "Type %u pack is compiled", (unsigned int)Type->TypeIdx);
+            UtAssert_INT32_EQ(Codec.Unpack.Status, EDSLIB_SUCCESS);
+            UtAssert_True(Codec.Unpack.Code != NULL, "Type %u unpack is compiled", (unsigned int)Type->TypeIdx);
+#else
+            UtAssert_INT32_EQ(Codec.Pack.Status, EDSLIB_NOT_IMPLEMENTED);
+            UtAssert_INT32_EQ(Codec.Unpack.Status, EDSLIB_NOT_IMPLEMENTED);
+#endif
+        }
+
+        EdsLib_DataTypeDB_ArrayCodec_Release(&Codec);
+        UtAssert_True(Codec.Pack.Code == NULL && Codec.Unpack.Code == NULL, "Codec is released");
+    }
+}
@@ -0,0 +1,319 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_decimate_test.c
+ * \ingroup  edslib
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Unit testing of the message decimator, for each decimation policy
+ */
+
+#include <string.h>
+
+#include "utassert.h"
+
+#include "edslib_datatypedb.h"
+#include "edslib_displaydb.h"
+#include "edslib_ut_database.h"
+
+#define UT_SAMPLE_PACKED_SIZE       7
+#define UT_SAMPLE_CRC_BYTE          5
+
+/*
+ * Pack a sample, with the CRC computed by the library
+ */
+static void UT_Decimate_PackSample(uint8_t *Packed, uint16_t Time, uint8_t Level, int16_t Temp)
+{
+    UT_Sample_t Native;
+    EdsLib_Id_t EdsId;
+
+    memset(&Native, 0, sizeof(Native));
+    Native.Time = Time;
+    Native.Level = Level;
+    Native.Temp = Temp;
+
+    EdsId = UT_EDS_ID(UT_EDS_TYPE_SAMPLE);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_PackCompleteObject(&UT_EDS_DATABASE, &EdsId, Packed, &Native,
+                                                           8 * UT_SAMPLE_PACKED_SIZE, sizeof(Native)), EDSLIB_SUCCESS);
+}
+
+/*
+ * Reference CRC-16/CCITT-FALSE over every byte of the packet except the CRC itself
+ */
+static uint16_t UT_Decimate_ReferenceCrc(const uint8_t *Packed, uint32_t Size)
+{
+    uint32_t ByteIdx;
+    uint16_t Crc;
+    uint8_t Bit;
+
+    Crc = 0xFFFF;
+    for (ByteIdx = 0; ByteIdx < Size; ++ByteIdx)
+    {
+        if (ByteIdx == UT_SAMPLE_CRC_BYTE || ByteIdx == (UT_SAMPLE_CRC_BYTE + 1))
+        {
+            continue;
+        }
+
+        Crc ^= (uint16_t)Packed[ByteIdx] << 8;
+        for (Bit = 0; Bit < 8; ++Bit)
+        {
+            if (Crc & 0x8000)
+            {
+                Crc = (Crc << 1) ^ 0x1021;
+            }
+            else
+            {
+                Crc <<= 1;
+            }
+        }
+    }
+
+    return Crc;
+}
+
+static uint16_t UT_Decimate_PackedCrc(const uint8_t *Packed)
+{
+    return ((uint16_t)Packed[UT_SAMPLE_CRC_BYTE] << 8) | Packed[UT_SAMPLE_CRC_BYTE + 1];
+}
+
+static int16_t UT_Decimate_PackedTemp(const uint8_t *Packed)
+{
+    int16_t Temp;
+
+    Temp = ((int16_t)Packed[3] << 4) | (Packed[4] >> 4);
+    if (Temp & 0x800)
+    {
+        Temp -= 0x1000;
+    }
+
+    return Temp;
+}
+
+void EdsLib_Decimate_KeepEveryN_Test(void)
+{
+    static const uint8_t Expected[] = { EDSLIB_DECIMATE_KEEP, EDSLIB_DECIMATE_DROP, EDSLIB_DECIMATE_DROP,
+            EDSLIB_DECIMATE_KEEP, EDSLIB_DECIMATE_DROP, EDSLIB_DECIMATE_DROP, EDSLIB_DECIMATE_KEEP };
+    EdsLib_DisplayDB_DecimateConfig_t Config;
+    EdsLib_DisplayDB_Decimator_t Decimator;
+    uint8_t Packed[UT_SAMPLE_PACKED_SIZE];
+    uint32_t Idx;
+
+    memset(&Config, 0, sizeof(Config));
+    Config.Policy = EDSLIB_DECIMATE_POLICY_KEEP_EVERY_N;
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_InitDecimator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_SAMPLE),
+            UT_EDS_ID(UT_EDS_TYPE_SAMPLE), &Config, &Decimator), EDSLIB_FAILURE);
+
+    Config.KeepEveryN = 3;
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_InitDecimator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_SAMPLE),
+            UT_EDS_ID(UT_EDS_TYPE_SAMPLE), &Config, &Decimator), EDSLIB_SUCCESS);
+
+    for (Idx = 0; Idx < sizeof(Expected); ++Idx)
+    {
+        UT_Decimate_PackSample(Packed, Idx, 0, 0);
+        UtAssert_UINT32_EQ(EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), NULL, NULL), Expected[Idx]);
+    }
+
+    /* nothing is ever held */
+    Idx = sizeof(Packed);
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_FlushDecimator(&Decimator, Packed, &Idx), EDSLIB_DECIMATE_DROP);
+}
+
+void EdsLib_Decimate_Deadband_Test(void)
+{
+    static const uint8_t Levels[] = { 10, 11, 12, 13, 12, 11, 10, 16 };
+    static const uint8_t Expected[] = { EDSLIB_DECIMATE_KEEP, EDSLIB_DECIMATE_DROP, EDSLIB_DECIMATE_DROP,
+            EDSLIB_DECIMATE_KEEP, EDSLIB_DECIMATE_DROP, EDSLIB_DECIMATE_DROP, EDSLIB_DECIMATE_KEEP,
+            EDSLIB_DECIMATE_KEEP };
+    EdsLib_DisplayDB_DecimateConfig_t Config;
+    EdsLib_DisplayDB_Decimator_t Decimator;
+    uint8_t Packed[UT_SAMPLE_PACKED_SIZE];
+    uint32_t Idx;
+
+    memset(&Config, 0, sizeof(Config));
+    Config.Policy = EDSLIB_DECIMATE_POLICY_DEADBAND;
+    Config.Deadband = 2.0;
+    Config.FieldName = "Missing";
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_InitDecimator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_SAMPLE),
+            UT_EDS_ID(UT_EDS_TYPE_SAMPLE), &Config, &Decimator), EDSLIB_NAME_NOT_FOUND);
+
+    Config.FieldName = "Level";
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_InitDecimator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_SAMPLE),
+            UT_EDS_ID(UT_EDS_TYPE_SAMPLE), &Config, &Decimator), EDSLIB_SUCCESS);
+
+    /* a change of exactly the deadband is not enough */
+    for (Idx = 0; Idx < sizeof(Levels); ++Idx)
+    {
+        UT_Decimate_PackSample(Packed, Idx, Levels[Idx], 0);
+        UtAssert_UINT32_EQ(EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), NULL, NULL), Expected[Idx]);
+    }
+
+    /* the packet must reach the end of the field */
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_Decimate(&Decimator, Packed, 2, NULL, NULL), EDSLIB_DECIMATE_INVALID);
+}
+
+void EdsLib_Decimate_TimeBucket_Test(void)
+{
+    EdsLib_DisplayDB_DecimateConfig_t Config;
+    EdsLib_DisplayDB_Decimator_t Decimator;
+    uint8_t Held[UT_SAMPLE_PACKED_SIZE];
+    uint8_t Packed[UT_SAMPLE_PACKED_SIZE];
+    uint8_t Output[UT_SAMPLE_PACKED_SIZE];
+    uint32_t OutputSize;
+
+    memset(&Config, 0, sizeof(Config));
+    Config.Policy = EDSLIB_DECIMATE_POLICY_TIME_BUCKET;
+    Config.Aggregate = EDSLIB_DECIMATE_AGGREGATE_MEAN;
+    Config.BucketWidth = 10.0;
+    Config.FieldName = "Time";
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_InitDecimator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_SAMPLE),
+            UT_EDS_ID(UT_EDS_TYPE_SAMPLE), &Config, &Decimator), EDSLIB_FAILURE);
+
+    Config.Buffer = Held;
+    Config.BufferSize = sizeof(Held);
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_InitDecimator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_SAMPLE),
+            UT_EDS_ID(UT_EDS_TYPE_SAMPLE), &Config, &Decimator), EDSLIB_SUCCESS);
+
+    /* the time field is not combined, the CRC is recomputed instead */
+    UtAssert_UINT32_EQ(Decimator.NumFields, 2);
+    UtAssert_True(Decimator.ErrorCtlDictPtr != NULL, "Decimator has an error control field");
+
+    /* the reference CRC must agree with the library */
+    UT_Decimate_PackSample(Packed, 0, 10, -5);
+    UtAssert_UINT32_EQ(UT_Decimate_PackedCrc(Packed), UT_Decimate_ReferenceCrc(Packed, sizeof(Packed)));
+
+    OutputSize = sizeof(Output);
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize),
+                       EDSLIB_DECIMATE_DROP);
+    UT_Decimate_PackSample(Packed, 3, 11, -6);
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize),
+                       EDSLIB_DECIMATE_DROP);
+    UT_Decimate_PackSample(Packed, 9, 13, -8);
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize),
+                       EDSLIB_DECIMATE_DROP);
+
+    /* the next bucket emits the means of the first, rounded, with the time of the first packet */
+    UT_Decimate_PackSample(Packed, 12, 20, 100);
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize),
+                       EDSLIB_DECIMATE_EMIT);
+    UtAssert_UINT32_EQ(OutputSize, sizeof(Output));
+    UtAssert_UINT32_EQ(Output[0], 0);
+    UtAssert_UINT32_EQ(Output[1], 0);
+    UtAssert_UINT32_EQ(Output[2], 11);
+    UtAssert_INT32_EQ(UT_Decimate_PackedTemp(Output), -6);
+    UtAssert_UINT32_EQ(UT_Decimate_PackedCrc(Output), UT_Decimate_ReferenceCrc(Output, OutputSize));
+
+    /* the output buffer must hold the packet */
+    UT_Decimate_PackSample(Packed, 25, 20, 100);
+    OutputSize = 4;
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize),
+                       EDSLIB_DECIMATE_INVALID);
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_FlushDecimator(&Decimator, Output, &OutputSize), EDSLIB_DECIMATE_INVALID);
+
+    /* a bucket of one packet is emitted unchanged */
+    OutputSize = sizeof(Output);
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_FlushDecimator(&Decimator, Output, &OutputSize), EDSLIB_DECIMATE_EMIT);
+    UT_Decimate_PackSample(Packed, 12, 20, 100);
+    UtAssert_True(memcmp(Output, Packed, sizeof(Packed)) == 0, "Single packet bucket is unchanged");
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_FlushDecimator(&Decimator, Output, &OutputSize), EDSLIB_DECIMATE_DROP);
+
+    /* minimum and maximum keep the extreme values */
+    Config.Aggregate = EDSLIB_DECIMATE_AGGREGATE_MIN;
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_InitDecimator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_SAMPLE),
+            UT_EDS_ID(UT_EDS_TYPE_SAMPLE), &Config, &Decimator), EDSLIB_SUCCESS);
+    UT_Decimate_PackSample(Packed, 0, 10, -5);
+    EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize);
+    UT_Decimate_PackSample(Packed, 1, 7, 3);
+    EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize);
+    UT_Decimate_PackSample(Packed, 2, 12, -9);
+    EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize);
+    OutputSize = sizeof(Output);
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_FlushDecimator(&Decimator, Output, &OutputSize), EDSLIB_DECIMATE_EMIT);
+    UtAssert_UINT32_EQ(Output[2], 7);
+    UtAssert_INT32_EQ(UT_Decimate_PackedTemp(Output), -9);
+    UtAssert_UINT32_EQ(UT_Decimate_PackedCrc(Output), UT_Decimate_ReferenceCrc(Output, OutputSize));
+
+    Config.Aggregate = EDSLIB_DECIMATE_AGGREGATE_MAX;
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_InitDecimator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_SAMPLE),
+            UT_EDS_ID(UT_EDS_TYPE_SAMPLE), &Config, &Decimator), EDSLIB_SUCCESS);
+    UT_Decimate_PackSample(Packed, 0, 10, -5);
+    EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize);
+    UT_Decimate_PackSample(Packed, 1, 7, 3);
+    EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize);
+    UT_Decimate_PackSample(Packed, 2, 12, -9);
+    EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize);
+    OutputSize = sizeof(Output);
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_FlushDecimator(&Decimator, Output, &OutputSize), EDSLIB_DECIMATE_EMIT);
+    UtAssert_UINT32_EQ(Output[2], 12);
+    UtAssert_INT32_EQ(UT_Decimate_PackedTemp(Output), 3);
+    UtAssert_UINT32_EQ(UT_Decimate_PackedCrc(Output), UT_Decimate_ReferenceCrc(Output, OutputSize));
+}
+
+/*
+ * Packets which are longer than the static size of the type, e.g. with
+ * trailing data, must have the error control computed over all of it.
+ */
+void EdsLib_Decimate_VariableLength_Test(void)
+{
+    EdsLib_DisplayDB_DecimateConfig_t Config;
+    EdsLib_DisplayDB_Decimator_t Decimator;
+    uint8_t Held[UT_SAMPLE_PACKED_SIZE + 4];
+    uint8_t Packed[UT_SAMPLE_PACKED_SIZE + 2];
+    uint8_t Output[UT_SAMPLE_PACKED_SIZE + 4];
+    uint8_t Large[UT_SAMPLE_PACKED_SIZE + 5];
+    uint32_t OutputSize;
+
+    memset(&Config, 0, sizeof(Config));
+    Config.Policy = EDSLIB_DECIMATE_POLICY_TIME_BUCKET;
+    Config.Aggregate = EDSLIB_DECIMATE_AGGREGATE_MEAN;
+    Config.BucketWidth = 10.0;
+    Config.FieldName = "Time";
+    Config.Buffer = Held;
+    Config.BufferSize = sizeof(Held);
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_InitDecimator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_SAMPLE),
+            UT_EDS_ID(UT_EDS_TYPE_SAMPLE), &Config, &Decimator), EDSLIB_SUCCESS);
+
+    OutputSize = sizeof(Output);
+    UT_Decimate_PackSample(Packed, 0, 10, -5);
+    Packed[UT_SAMPLE_PACKED_SIZE] = 0xA5;
+    Packed[UT_SAMPLE_PACKED_SIZE + 1] = 0x5A;
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize),
+                       EDSLIB_DECIMATE_DROP);
+    UT_Decimate_PackSample(Packed, 1, 20, 5);
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_Decimate(&Decimator, Packed, sizeof(Packed), Output, &OutputSize),
+                       EDSLIB_DECIMATE_DROP);
+
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_FlushDecimator(&Decimator, Output, &OutputSize), EDSLIB_DECIMATE_EMIT);
+    UtAssert_UINT32_EQ(OutputSize, sizeof(Packed));
+    UtAssert_UINT32_EQ(Output[2], 15);
+    UtAssert_INT32_EQ(UT_Decimate_PackedTemp(Output), 0);
+    UtAssert_UINT32_EQ(Output[UT_SAMPLE_PACKED_SIZE], 0xA5);
+    UtAssert_UINT32_EQ(Output[UT_SAMPLE_PACKED_SIZE + 1], 0x5A);
+    UtAssert_UINT32_EQ(UT_Decimate_PackedCrc(Output), UT_Decimate_ReferenceCrc(Output, OutputSize));
+    UtAssert_True(UT_Decimate_PackedCrc(Output) != UT_Decimate_ReferenceCrc(Output, UT_SAMPLE_PACKED_SIZE),
+                  "Error control covers the trailing data");
+
+    /* a packet larger than the buffer cannot be held */
+    memset(Large, 0, sizeof(Large));
+    UT_Decimate_PackSample(Large, 30, 0, 0);
+    UtAssert_UINT32_EQ(EdsLib_DisplayDB_Decimate(&Decimator, Large, sizeof(Large), Output, &OutputSize),
+                       EDSLIB_DECIMATE_INVALID);
+}
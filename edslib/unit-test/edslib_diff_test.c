@@ -0,0 +1,187 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_diff_test.c
+ * \ingroup  edslib
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Unit testing of the native object differ
+ */
+
+#include <string.h>
+#include <stddef.h>
+
+#include "utassert.h"
+
+#include "edslib_datatypedb.h"
+#include "edslib_ut_database.h"
+
+/*
+ * Field index of each member of UT_Vector_t, in offset order
+ */
+enum
+{
+    UT_VECTOR_FIELD_FLAGS,
+    UT_VECTOR_FIELD_VALUES0,
+    UT_VECTOR_FIELD_VALUES3 = UT_VECTOR_FIELD_VALUES0 + 3,
+    UT_VECTOR_FIELD_GAIN,
+    UT_VECTOR_FIELD_MAX
+};
+
+static EdsLib_DataTypeDB_Differ_t UT_Differ;
+static EdsLib_DataTypeDB_Differ_t UT_Differ2;
+
+void EdsLib_Diff_Fields_Test(void)
+{
+    static const uint32_t ExpectedOffset[UT_VECTOR_FIELD_MAX] =
+    {
+        offsetof(UT_Vector_t, Flags), offsetof(UT_Vector_t, Values[0]), offsetof(UT_Vector_t, Values[1]),
+        offsetof(UT_Vector_t, Values[2]), offsetof(UT_Vector_t, Values[3]), offsetof(UT_Vector_t, Gain)
+    };
+    EdsLib_DataTypeDB_EntityInfo_t MemberInfo;
+    uint16_t FieldIdx;
+
+    /* every element of an array is a field of its own, in offset order */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitDiffer(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_VECTOR), &UT_Differ),
+            EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(UT_Differ.NumFields, UT_VECTOR_FIELD_MAX);
+    for (FieldIdx = 0; FieldIdx < UT_VECTOR_FIELD_MAX; ++FieldIdx)
+    {
+        UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetDiffFieldInfo(&UT_EDS_DATABASE, &UT_Differ, FieldIdx, &MemberInfo),
+                EDSLIB_SUCCESS);
+        UtAssert_UINT32_EQ(MemberInfo.Offset.Bytes, ExpectedOffset[FieldIdx]);
+    }
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetDiffFieldInfo(&UT_EDS_DATABASE, &UT_Differ, UT_VECTOR_FIELD_MAX,
+            &MemberInfo), EDSLIB_INVALID_INDEX);
+
+    /* the field table is the same every time, so indexes can be stored and compared later */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitDiffer(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_VECTOR), &UT_Differ2),
+            EDSLIB_SUCCESS);
+    UtAssert_True(memcmp(&UT_Differ, &UT_Differ2, sizeof(UT_Differ)) == 0, "Differ is the same when rebuilt");
+
+    /* a scalar type is a single field */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitDiffer(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_FLOAT64_LE), &UT_Differ),
+            EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(UT_Differ.NumFields, 1);
+}
+
+void EdsLib_Diff_Objects_Test(void)
+{
+    EdsLib_DataTypeDB_DiffResult_t Result;
+    UT_Vector_t Obj1;
+    UT_Vector_t Obj2;
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitDiffer(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_VECTOR), &UT_Differ),
+            EDSLIB_SUCCESS);
+
+    memset(&Obj1, 0, sizeof(Obj1));
+    Obj1.Flags = 1;
+    Obj1.Values[0] = 100;
+    Obj1.Values[3] = 400;
+    Obj1.Gain = 2.5;
+    memcpy(&Obj2, &Obj1, sizeof(Obj2));
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_DiffObjects(&UT_Differ, &Obj1, &Obj2, sizeof(Obj1), &Result), EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Result.NumFields, UT_VECTOR_FIELD_MAX);
+    UtAssert_UINT32_EQ(Result.NumChanged, 0);
+    UtAssert_UINT32_EQ(Result.ChangedMask[0], 0);
+
+    /* padding between the fields is not content */
+    memset((uint8_t *)&Obj2 + offsetof(UT_Vector_t, Flags) + 1, 0xAA, 1);
+    memset((uint8_t *)&Obj2 + offsetof(UT_Vector_t, Values[3]) + 2, 0xAA,
+            offsetof(UT_Vector_t, Gain) - offsetof(UT_Vector_t, Values[3]) - 2);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_DiffObjects(&UT_Differ, &Obj1, &Obj2, sizeof(Obj1), &Result), EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Result.NumChanged, 0);
+
+    /* each changed field is reported, including each array element */
+    Obj2.Values[3] = 401;
+    Obj2.Flags = 0;
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_DiffObjects(&UT_Differ, &Obj1, &Obj2, sizeof(Obj1), &Result), EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Result.NumChanged, 2);
+    UtAssert_UINT32_EQ(Result.ChangedMask[0], (UINT32_C(1) << UT_VECTOR_FIELD_FLAGS) |
+            (UINT32_C(1) << UT_VECTOR_FIELD_VALUES3));
+
+    /* the result does not depend on the order of the objects */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_DiffObjects(&UT_Differ, &Obj2, &Obj1, sizeof(Obj1), &Result), EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Result.ChangedMask[0], (UINT32_C(1) << UT_VECTOR_FIELD_FLAGS) |
+            (UINT32_C(1) << UT_VECTOR_FIELD_VALUES3));
+
+    /* fields are compared bitwise */
+    memcpy(&Obj2, &Obj1, sizeof(Obj2));
+    Obj1.Gain = 0.0;
+    Obj2.Gain = -0.0;
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_DiffObjects(&UT_Differ, &Obj1, &Obj2, sizeof(Obj1), &Result), EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Result.ChangedMask[0], UINT32_C(1) << UT_VECTOR_FIELD_GAIN);
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_DiffObjects(&UT_Differ, &Obj1, &Obj2, sizeof(Obj1) - 1, &Result),
+            EDSLIB_BUFFER_SIZE_ERROR);
+}
+
+/*
+ * Every combination of changed fields is reported exactly
+ */
+void EdsLib_Diff_Exhaustive_Test(void)
+{
+    /* the last byte of each field, so a compare of the wrong size would miss the change */
+    static const uint32_t FieldLastByte[] =
+    {
+        offsetof(UT_Limits_t, Percent[0]), offsetof(UT_Limits_t, Percent[1]), offsetof(UT_Limits_t, Mode),
+        offsetof(UT_Limits_t, Offset) + 1, offsetof(UT_Limits_t, Code) + 3, offsetof(UT_Limits_t, Ratio) + 7,
+        offsetof(UT_Limits_t, BigCount) + 7
+    };
+    enum { UT_NUM_FIELDS = sizeof(FieldLastByte) / sizeof(FieldLastByte[0]) };
+    EdsLib_DataTypeDB_DiffResult_t Result;
+    UT_Limits_t Obj1;
+    UT_Limits_t Obj2;
+    uint32_t Changes;
+    uint32_t NumChanged;
+    uint32_t FieldIdx;
+    uint32_t Errors;
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitDiffer(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_LIMITS), &UT_Differ),
+            EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(UT_Differ.NumFields, UT_NUM_FIELDS);
+
+    Errors = 0;
+    memset(&Obj1, 0x11, sizeof(Obj1));
+    for (Changes = 0; Changes < (UINT32_C(1) << UT_NUM_FIELDS); ++Changes)
+    {
+        memcpy(&Obj2, &Obj1, sizeof(Obj2));
+        NumChanged = 0;
+        for (FieldIdx = 0; FieldIdx < UT_NUM_FIELDS; ++FieldIdx)
+        {
+            if (Changes & (UINT32_C(1) << FieldIdx))
+            {
+                ((uint8_t *)&Obj2)[FieldLastByte[FieldIdx]] ^= 0x80;
+                ++NumChanged;
+            }
+        }
+
+        if (EdsLib_DataTypeDB_DiffObjects(&UT_Differ, &Obj1, &Obj2, sizeof(Obj1), &Result) != EDSLIB_SUCCESS ||
+                Result.ChangedMask[0] != Changes || Result.NumChanged != NumChanged)
+        {
+            ++Errors;
+        }
+    }
+
+    UtAssert_UINT32_EQ(Errors, 0);
+}
@@ -0,0 +1,257 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_filter_test.c
+ * \ingroup  edslib
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Unit testing of the packet filter compiler
+ */
+
+#include <string.h>
+#include <stddef.h>
+
+#include "utassert.h"
+
+#include "edslib_datatypedb.h"
+#include "edslib_displaydb.h"
+#include "edslib_ut_database.h"
+
+#define UT_FILTER_NUM_PACKETS   500
+
+static EdsLib_DisplayDB_Filter_t UT_Filter;
+static UT_Long_t UT_Long[UT_FILTER_NUM_PACKETS];
+static uint8_t UT_Packed[UT_FILTER_NUM_PACKETS][8];
+
+static void UT_Filter_Pack(uint16_t TypeIdx, const void *Native, uint32_t NativeSize, uint8_t *Packed)
+{
+    EdsLib_Id_t EdsId = UT_EDS_ID(TypeIdx);
+
+    memset(Packed, 0, 8);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_PackCompleteObject(&UT_EDS_DATABASE, &EdsId, Packed, Native, 64, NativeSize),
+            EDSLIB_SUCCESS);
+}
+
+/*
+ * Fill the packets with a spread of values, including the extremes of each field
+ */
+static void UT_Filter_SetupPackets(void)
+{
+    uint32_t Seed;
+    uint32_t Idx;
+
+    Seed = 1;
+    for (Idx = 0; Idx < UT_FILTER_NUM_PACKETS; ++Idx)
+    {
+        Seed = (Seed * 1103515245) + 12345;
+        memset(&UT_Long[Idx], 0, sizeof(UT_Long[Idx]));
+        UT_Long[Idx].Hdr.Version = (Seed >> 8) & 0x7;
+        UT_Long[Idx].Hdr.Id = UT_EDS_ID_LONG;
+        UT_Long[Idx].Temp = (int16_t)((Seed >> 12) & 0xFFF) - 2048;
+        UT_Long[Idx].Count = (Seed >> 16) & 0xFFFF;
+        if ((Idx % 5) == 0)
+        {
+            UT_Long[Idx].Count = 0x1234;
+        }
+
+        UT_Filter_Pack(UT_EDS_TYPE_LONG, &UT_Long[Idx], sizeof(UT_Long[Idx]), UT_Packed[Idx]);
+    }
+}
+
+/*
+ * Check a predicate on the long type against the same condition in C
+ */
+static void UT_Filter_CheckPredicate(const char *Text, bool (*Reference)(const UT_Long_t *))
+{
+    uint32_t Idx;
+    uint32_t Errors;
+    uint32_t Matches;
+
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), Text, &UT_Filter), EDSLIB_SUCCESS);
+
+    Errors = 0;
+    Matches = 0;
+    for (Idx = 0; Idx < UT_FILTER_NUM_PACKETS; ++Idx)
+    {
+        if (EdsLib_DisplayDB_FilterMatch(&UT_Filter, UT_Packed[Idx], sizeof(UT_Packed[Idx])) !=
+                Reference(&UT_Long[Idx]))
+        {
+            ++Errors;
+        }
+        else if (Reference(&UT_Long[Idx]))
+        {
+            ++Matches;
+        }
+    }
+
+    /* a predicate that selects nothing or everything would not test much */
+    UtAssert_True(Errors == 0 && Matches > 0 && Matches < UT_FILTER_NUM_PACKETS,
+            "Filter \"%s\": %lu errors, %lu matches", Text, (unsigned long)Errors, (unsigned long)Matches);
+}
+
+static bool UT_Filter_NegativeTemp(const UT_Long_t *Long)
+{
+    return (Long->Temp < 0);
+}
+
+static bool UT_Filter_TempAndCount(const UT_Long_t *Long)
+{
+    return (Long->Temp >= -100 && Long->Count != 0x1234);
+}
+
+static bool UT_Filter_MaskOrVersion(const UT_Long_t *Long)
+{
+    return ((Long->Count & 0x8000) == 0 || Long->Hdr.Version == 5);
+}
+
+static bool UT_Filter_CountNotAboveTemp(const UT_Long_t *Long)
+{
+    return !(Long->Count > Long->Temp) || (Long->Temp > 1000 && Long->Count < 0x1000);
+}
+
+static bool UT_Filter_FloatConstant(const UT_Long_t *Long)
+{
+    return (Long->Temp > 2.5 && Long->Temp <= 1e3);
+}
+
+/*
+ * Packets of other types are rejected by the identification checks
+ */
+void EdsLib_Filter_Ident_Test(void)
+{
+    UT_Short_t Short;
+    uint8_t Packed[8];
+
+    UT_Filter_SetupPackets();
+
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), NULL, &UT_Filter), EDSLIB_SUCCESS);
+    UtAssert_True(EdsLib_DisplayDB_FilterMatch(&UT_Filter, UT_Packed[0], sizeof(UT_Packed[0])), "Long is selected");
+
+    memcpy(Packed, UT_Packed[0], sizeof(Packed));
+    Packed[3] = UT_EDS_ID_SHORT;
+    UtAssert_True(!EdsLib_DisplayDB_FilterMatch(&UT_Filter, Packed, sizeof(Packed)), "Short Id is rejected");
+    Packed[3] = 3;
+    UtAssert_True(!EdsLib_DisplayDB_FilterMatch(&UT_Filter, Packed, sizeof(Packed)), "Unknown Id is rejected");
+
+    /* only the Id is read, so the packet must hold the header but not the rest of the type */
+    UtAssert_True(EdsLib_DisplayDB_FilterMatch(&UT_Filter, UT_Packed[0], 4), "Long header only is selected");
+    UtAssert_True(!EdsLib_DisplayDB_FilterMatch(&UT_Filter, UT_Packed[0], 3), "Partial header is rejected");
+    UtAssert_True(!EdsLib_DisplayDB_FilterMatch(&UT_Filter, UT_Packed[0], 0), "Empty packet is rejected");
+
+    memset(&Short, 0, sizeof(Short));
+    Short.Hdr.Id = UT_EDS_ID_SHORT;
+    Short.Value = 0x42;
+    UT_Filter_Pack(UT_EDS_TYPE_SHORT, &Short, sizeof(Short), Packed);
+    UtAssert_True(!EdsLib_DisplayDB_FilterMatch(&UT_Filter, Packed, 5), "Short is rejected by Long filter");
+
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER),
+            UT_EDS_ID(UT_EDS_TYPE_SHORT), "Value == 0x42", &UT_Filter), EDSLIB_SUCCESS);
+    UtAssert_True(EdsLib_DisplayDB_FilterMatch(&UT_Filter, Packed, 5), "Short is selected");
+    UtAssert_True(!EdsLib_DisplayDB_FilterMatch(&UT_Filter, Packed, 4), "Short without Value is rejected");
+    UtAssert_True(!EdsLib_DisplayDB_FilterMatch(&UT_Filter, UT_Packed[0], sizeof(UT_Packed[0])),
+            "Long is rejected by Short filter");
+
+    /* with the same base and type there is nothing to identify */
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_LONG),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), "", &UT_Filter), EDSLIB_SUCCESS);
+    memcpy(Packed, UT_Packed[0], sizeof(Packed));
+    Packed[3] = 3;
+    UtAssert_True(EdsLib_DisplayDB_FilterMatch(&UT_Filter, Packed, sizeof(Packed)), "Id is not checked");
+}
+
+void EdsLib_Filter_Predicate_Test(void)
+{
+    uint32_t Idx;
+
+    UT_Filter_SetupPackets();
+
+    UT_Filter_CheckPredicate("Temp < 0", UT_Filter_NegativeTemp);
+    UT_Filter_CheckPredicate("Temp >= -100 && Count != 0x1234", UT_Filter_TempAndCount);
+    UT_Filter_CheckPredicate("(Count & 0x8000) == 0 || Version == 5", UT_Filter_MaskOrVersion);
+    UT_Filter_CheckPredicate("!(Count > Temp) || (1000 < Temp && Count < 4096)", UT_Filter_CountNotAboveTemp);
+    UT_Filter_CheckPredicate("Temp > 2.5 && Temp <= 1e3", UT_Filter_FloatConstant);
+
+    /* a packet that ends before the last field that is read is never selected */
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), "Temp < 0 || Temp >= 0", &UT_Filter), EDSLIB_SUCCESS);
+    for (Idx = 0; Idx < UT_FILTER_NUM_PACKETS; ++Idx)
+    {
+        if (!EdsLib_DisplayDB_FilterMatch(&UT_Filter, UT_Packed[Idx], 6) ||
+                EdsLib_DisplayDB_FilterMatch(&UT_Filter, UT_Packed[Idx], 5))
+        {
+            break;
+        }
+    }
+    UtAssert_UINT32_EQ(Idx, UT_FILTER_NUM_PACKETS);
+
+    /* constant comparisons are resolved when compiling */
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), "1 > 2 || Count == 0x1234", &UT_Filter), EDSLIB_SUCCESS);
+    UtAssert_True(EdsLib_DisplayDB_FilterMatch(&UT_Filter, UT_Packed[0], sizeof(UT_Packed[0])), "Count 0x1234");
+    UtAssert_True(!EdsLib_DisplayDB_FilterMatch(&UT_Filter, UT_Packed[1], sizeof(UT_Packed[1])),
+            "Count 0x%x", (unsigned int)UT_Long[1].Count);
+}
+
+void EdsLib_Filter_Compile_Test(void)
+{
+    char Text[16 * (EDSLIB_FILTER_MAX_INSNS + 1)];
+    uint32_t Idx;
+
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), "Temp <", &UT_Filter), EDSLIB_FAILURE);
+    UtAssert_UINT32_EQ(UT_Filter.ErrorPos, 6);
+    UtAssert_UINT32_EQ(UT_Filter.NumInsns, 0);
+    UtAssert_True(!EdsLib_DisplayDB_FilterMatch(&UT_Filter, UT_Packed[0], sizeof(UT_Packed[0])),
+            "Failed filter selects nothing");
+
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), "Temp = 3", &UT_Filter), EDSLIB_FAILURE);
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), "(Temp == 1", &UT_Filter), EDSLIB_FAILURE);
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), "Temp == 1 junk", &UT_Filter), EDSLIB_FAILURE);
+    UtAssert_UINT32_EQ(UT_Filter.ErrorPos, 10);
+
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), "Nope == 3", &UT_Filter), EDSLIB_NAME_NOT_FOUND);
+    UtAssert_UINT32_EQ(UT_Filter.ErrorPos, 0);
+
+    /* floating point fields cannot be masked */
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_VECTOR),
+            UT_EDS_ID(UT_EDS_TYPE_VECTOR), "(Gain & 1) == 1", &UT_Filter), EDSLIB_INVALID_SIZE_OR_TYPE);
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_VECTOR),
+            UT_EDS_ID(UT_EDS_TYPE_VECTOR), "Gain < 0.5", &UT_Filter), EDSLIB_SUCCESS);
+
+    /* the type must be derived from the base */
+    UtAssert_True(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_SAMPLE),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), NULL, &UT_Filter) != EDSLIB_SUCCESS, "Long is not derived from Sample");
+
+    strcpy(Text, "Count == 0");
+    for (Idx = 0; Idx < EDSLIB_FILTER_MAX_INSNS; ++Idx)
+    {
+        strcat(Text, " || Count == 1");
+    }
+    UtAssert_INT32_EQ(EdsLib_DisplayDB_CompileFilter(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER),
+            UT_EDS_ID(UT_EDS_TYPE_LONG), Text, &UT_Filter), EDSLIB_INSUFFICIENT_MEMORY);
+}
@@ -0,0 +1,208 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_hash_test.c
+ * \ingroup  edslib
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Unit testing of the content hash
+ */
+
+#include <string.h>
+#include <stddef.h>
+
+#include "utassert.h"
+
+#include "edslib_datatypedb.h"
+#include "edslib_ut_database.h"
+
+static EdsLib_DataTypeDB_ContentHasher_t UT_Hasher;
+
+static EdsLib_DataTypeDB_ContentHash_t UT_Hash_Compute(EdsLib_Id_t EdsId, const void *NativeObj, uint32_t NativeSize)
+{
+    EdsLib_DataTypeDB_ContentHash_t Hash;
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitContentHasher(&UT_EDS_DATABASE, EdsId, &UT_Hasher), EDSLIB_SUCCESS);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_ComputeContentHash(&UT_Hasher, NativeObj, NativeSize, &Hash),
+            EDSLIB_SUCCESS);
+
+    return Hash;
+}
+
+static bool UT_Hash_Equal(const EdsLib_DataTypeDB_ContentHash_t *Hash1, const EdsLib_DataTypeDB_ContentHash_t *Hash2)
+{
+    return (Hash1->Low == Hash2->Low && Hash1->High == Hash2->High);
+}
+
+static void UT_Hash_SetVector(UT_Vector_t *Vector, uint8_t Fill)
+{
+    memset(Vector, Fill, sizeof(*Vector));
+    Vector->Flags = 0x81;
+    Vector->Values[0] = 0x1234;
+    Vector->Values[1] = 0;
+    Vector->Values[2] = 0xFFFF;
+    Vector->Values[3] = 0x8001;
+    Vector->Gain = -2.5;
+}
+
+static void UT_Hash_SetRecord(UT_Record_t *Record, uint8_t Fill)
+{
+    memset(Record, Fill, sizeof(*Record));
+    Record->Sync = UT_EDS_RECORD_SYNC;
+    Record->Temp = -100;
+    Record->Values[0] = 1;
+    Record->Values[1] = 2;
+    Record->Values[2] = 0x8000;
+    Record->Values[3] = 0xFFFF;
+}
+
+/*
+ * The hash only depends on the content, not on the memory it is in or on repeating it
+ */
+void EdsLib_Hash_Stable_Test(void)
+{
+    EdsLib_DataTypeDB_ContentHash_t Hash1;
+    EdsLib_DataTypeDB_ContentHash_t Hash2;
+    UT_Vector_t Vector;
+    UT_Record_t Record;
+
+    UT_Hash_SetVector(&Vector, 0);
+    Hash1 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_VECTOR), &Vector, sizeof(Vector));
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_VECTOR), &Vector, sizeof(Vector));
+    UtAssert_True(UT_Hash_Equal(&Hash1, &Hash2), "Vector hash is the same when repeated");
+
+    /* native padding is not content */
+    UT_Hash_SetVector(&Vector, 0xA5);
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_VECTOR), &Vector, sizeof(Vector));
+    UtAssert_True(UT_Hash_Equal(&Hash1, &Hash2), "Vector hash does not depend on padding");
+
+    /*
+     * The value is part of the interface, e.g. for hashes that are stored or sent to
+     * the ground, so it must be the same on every platform and in every release.
+     * This is the hash of the packed bits 81 1234 0000 FFFF 8001 000000000000 04C0.
+     */
+    UtAssert_True(Hash1.Low == UINT64_C(0xD1D8AB2187F02470) && Hash1.High == UINT64_C(0x1EA595D3232029B3),
+            "Vector hash 0x%016llx%016llx", (unsigned long long)Hash1.High, (unsigned long long)Hash1.Low);
+
+    UT_Hash_SetRecord(&Record, 0);
+    Hash1 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_RECORD), &Record, sizeof(Record));
+    UT_Hash_SetRecord(&Record, 0xFF);
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_RECORD), &Record, sizeof(Record));
+    UtAssert_True(UT_Hash_Equal(&Hash1, &Hash2), "Record hash does not depend on padding");
+
+    /* packed bits 00 F9C 0001 0002 8000 FFFF, where the Sync field is zero filled */
+    UtAssert_True(Hash1.Low == UINT64_C(0xE797EA7E2C7DD1F4) && Hash1.High == UINT64_C(0x5827134246052BDC),
+            "Record hash 0x%016llx%016llx", (unsigned long long)Hash1.High, (unsigned long long)Hash1.Low);
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_ComputeContentHash(&UT_Hasher, &Record, sizeof(Record) - 1, &Hash2),
+            EDSLIB_BUFFER_SIZE_ERROR);
+}
+
+/*
+ * The hash is over the packed encoding, so the same bits in a different native form are the same
+ */
+void EdsLib_Hash_Encoding_Test(void)
+{
+    EdsLib_DataTypeDB_ContentHash_t Hash1;
+    EdsLib_DataTypeDB_ContentHash_t Hash2;
+    uint16_t Value;
+    uint8_t Byte;
+
+    Value = 0x1234;
+    Hash1 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_UINT16_LE), &Value, sizeof(Value));
+    Value = 0x3412;
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_UINT16_BE), &Value, sizeof(Value));
+    UtAssert_True(UT_Hash_Equal(&Hash1, &Hash2), "Same packed bits in both byte orders");
+
+    /* the length of the encoding is part of the hash, so zero fill does not collide */
+    Value = 0;
+    Byte = 0;
+    Hash1 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_UINT16_BE), &Value, sizeof(Value));
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_UINT8), &Byte, sizeof(Byte));
+    UtAssert_True(!UT_Hash_Equal(&Hash1, &Hash2), "8 and 16 zero bits are different");
+}
+
+/*
+ * Every field is content, except the fields that are derived from the EDS and the other fields
+ */
+void EdsLib_Hash_Fields_Test(void)
+{
+    EdsLib_DataTypeDB_ContentHash_t Hash1;
+    EdsLib_DataTypeDB_ContentHash_t Hash2;
+    UT_Vector_t Vector;
+    UT_Record_t Record;
+    UT_Sample_t Sample;
+    UT_Long_t Long;
+    uint16_t Idx;
+
+    UT_Hash_SetVector(&Vector, 0);
+    Hash1 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_VECTOR), &Vector, sizeof(Vector));
+    for (Idx = 0; Idx < 4; ++Idx)
+    {
+        UT_Hash_SetVector(&Vector, 0);
+        Vector.Values[Idx] ^= 0x0100;
+        Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_VECTOR), &Vector, sizeof(Vector));
+        UtAssert_True(!UT_Hash_Equal(&Hash1, &Hash2), "Vector Values[%u] is content", (unsigned int)Idx);
+    }
+    UT_Hash_SetVector(&Vector, 0);
+    Vector.Gain = 2.5;
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_VECTOR), &Vector, sizeof(Vector));
+    UtAssert_True(!UT_Hash_Equal(&Hash1, &Hash2), "Vector Gain is content");
+
+    /* fields that are not byte aligned */
+    UT_Hash_SetRecord(&Record, 0);
+    Hash1 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_RECORD), &Record, sizeof(Record));
+    Record.Temp = 100;
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_RECORD), &Record, sizeof(Record));
+    UtAssert_True(!UT_Hash_Equal(&Hash1, &Hash2), "Record Temp is content");
+    UT_Hash_SetRecord(&Record, 0);
+    Record.Values[3] = 0x7FFF;
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_RECORD), &Record, sizeof(Record));
+    UtAssert_True(!UT_Hash_Equal(&Hash1, &Hash2), "Record Values[3] is content");
+
+    /* fixed value, error control and length entries */
+    UT_Hash_SetRecord(&Record, 0);
+    Record.Sync = 0;
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_RECORD), &Record, sizeof(Record));
+    UtAssert_True(UT_Hash_Equal(&Hash1, &Hash2), "Record Sync is not content");
+
+    memset(&Sample, 0, sizeof(Sample));
+    Sample.Time = 1000;
+    Sample.Level = 50;
+    Sample.Temp = -20;
+    Hash1 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_SAMPLE), &Sample, sizeof(Sample));
+    Sample.Crc = 0xBEEF;
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_SAMPLE), &Sample, sizeof(Sample));
+    UtAssert_True(UT_Hash_Equal(&Hash1, &Hash2), "Sample Crc is not content");
+
+    memset(&Long, 0, sizeof(Long));
+    Long.Hdr.Id = 2;
+    Long.Temp = -5;
+    Long.Count = 7;
+    Hash1 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_LONG), &Long, sizeof(Long));
+    Long.Hdr.Length = 0x55;
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_LONG), &Long, sizeof(Long));
+    UtAssert_True(UT_Hash_Equal(&Hash1, &Hash2), "Long Length is not content");
+    Long.Count = 8;
+    Hash2 = UT_Hash_Compute(UT_EDS_ID(UT_EDS_TYPE_LONG), &Long, sizeof(Long));
+    UtAssert_True(!UT_Hash_Equal(&Hash1, &Hash2), "Long Count is content");
+}
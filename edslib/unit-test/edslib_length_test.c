@@ -0,0 +1,199 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_length_test.c
+ * \ingroup  edslib
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Unit testing of the length field and size recipe API
+ */
+
+#include <string.h>
+
+#include "utassert.h"
+
+#include "edslib_datatypedb.h"
+#include "edslib_ut_database.h"
+
+/*
+ * Pack a derived object of the header type, with the length computed
+ */
+static uint32_t UT_Length_PackObject(uint16_t TypeIdx, void *Native, uint32_t NativeSize, uint8_t *Packed, uint32_t PackedSize)
+{
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    EdsLib_Id_t EdsId;
+
+    EdsId = UT_EDS_ID(TypeIdx);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_PackCompleteObject(&UT_EDS_DATABASE, &EdsId, Packed, Native, 8 * PackedSize,
+                                                           NativeSize), EDSLIB_SUCCESS);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetTypeInfo(&UT_EDS_DATABASE, EdsId, &TypeInfo), EDSLIB_SUCCESS);
+
+    return (TypeInfo.Size.Bits + 7) / 8;
+}
+
+void EdsLib_Length_FieldInfo_Test(void)
+{
+    EdsLib_DataTypeDB_LengthFieldInfo_t LengthInfo;
+
+    /* big endian, calibrated, at an offset within the header */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetLengthFieldInfo(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER), &LengthInfo),
+                      EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(LengthInfo.BitOffset, 8);
+    UtAssert_UINT32_EQ(LengthInfo.BitSize, 16);
+    UtAssert_UINT32_EQ(LengthInfo.MinPackedBytes, 3);
+    UtAssert_BOOL_FALSE(LengthInfo.LittleEndian);
+    UtAssert_True(LengthInfo.Calibrator != NULL, "Header length is calibrated");
+    UtAssert_True(LengthInfo.LengthTypeId == UT_EDS_ID(UT_EDS_TYPE_UINT16_BE), "Header length type");
+
+    /* the length field of the base type is found through a derived type */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetLengthFieldInfo(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_LONG), &LengthInfo),
+                      EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(LengthInfo.BitOffset, 8);
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetLengthFieldInfo(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_LEFRAME), &LengthInfo),
+                      EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(LengthInfo.BitOffset, 8);
+    UtAssert_UINT32_EQ(LengthInfo.BitSize, 16);
+    UtAssert_BOOL_TRUE(LengthInfo.LittleEndian);
+    UtAssert_True(LengthInfo.Calibrator == NULL, "LeFrame length is not calibrated");
+
+    /* a little endian field which is not byte aligned cannot be read directly */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetLengthFieldInfo(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_BADFRAME), &LengthInfo),
+                      EDSLIB_INVALID_SIZE_OR_TYPE);
+}
+
+void EdsLib_Length_Decode_Test(void)
+{
+    EdsLib_DataTypeDB_LengthFieldInfo_t LengthInfo;
+    uint32_t PackedBytes;
+    uint8_t Packed[4];
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetLengthFieldInfo(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER), &LengthInfo),
+                      EDSLIB_SUCCESS);
+
+    /* the bits around the field must not affect the value */
+    Packed[0] = 0xFF;
+    Packed[1] = 0x01;
+    Packed[2] = 0x02;
+    Packed[3] = 0xFF;
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_DecodeLengthField(&LengthInfo, Packed, &PackedBytes), EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(PackedBytes, 0x0102 + UT_EDS_HEADER_LENGTH_BIAS);
+
+    /* a length shorter than the length field itself is not valid */
+    Packed[1] = 0x00;
+    Packed[2] = 0x01;
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_DecodeLengthField(&LengthInfo, Packed, &PackedBytes), EDSLIB_FIELD_MISMATCH);
+    UtAssert_UINT32_EQ(PackedBytes, 0);
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetLengthFieldInfo(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_LEFRAME), &LengthInfo),
+                      EDSLIB_SUCCESS);
+    Packed[0] = 0xFF;
+    Packed[1] = 0x34;
+    Packed[2] = 0x12;
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_DecodeLengthField(&LengthInfo, Packed, &PackedBytes), EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(PackedBytes, 0x1234);
+}
+
+void EdsLib_Length_SizeRecipe_Test(void)
+{
+    EdsLib_DataTypeDB_SizeRecipe_t Recipe;
+    EdsLib_DataTypeDB_PackedSizeInfo_t SizeInfo;
+    UT_Short_t ShortObj;
+    UT_Long_t LongObj;
+    uint8_t Packed[16];
+    uint32_t ShortBytes;
+    uint32_t LongBytes;
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitSizeRecipe(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_HEADER), &Recipe),
+                      EDSLIB_SUCCESS);
+    UtAssert_BOOL_TRUE(Recipe.HasLengthField);
+    UtAssert_UINT32_EQ(Recipe.NumIdentFields, 1);
+    UtAssert_UINT32_EQ(Recipe.IdentFields[0].BitOffset, 24);
+    UtAssert_UINT32_EQ(Recipe.IdentFields[0].BitSize, 8);
+
+    memset(&LongObj, 0, sizeof(LongObj));
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitializeNativeObject(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_LONG), &LongObj),
+                      EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(LongObj.Hdr.Id, UT_EDS_ID_LONG);
+    LongObj.Temp = -5;
+    LongObj.Count = 0x1234;
+
+    memset(Packed, 0, sizeof(Packed));
+    LongBytes = UT_Length_PackObject(UT_EDS_TYPE_LONG, &LongObj, sizeof(LongObj), Packed, sizeof(Packed));
+    UtAssert_UINT32_EQ(LongBytes, 8);
+    UtAssert_UINT32_EQ(Packed[2], LongBytes - UT_EDS_HEADER_LENGTH_BIAS);
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetPackedSizes(&UT_EDS_DATABASE, &Recipe, Packed, sizeof(Packed), &SizeInfo),
+                      EDSLIB_SUCCESS);
+    UtAssert_True(SizeInfo.EdsId == UT_EDS_ID(UT_EDS_TYPE_LONG), "Long object identified");
+    UtAssert_UINT32_EQ(SizeInfo.PackedBytes, LongBytes);
+    UtAssert_UINT32_EQ(SizeInfo.NativeBytes, sizeof(UT_Long_t));
+
+    memset(&ShortObj, 0, sizeof(ShortObj));
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitializeNativeObject(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_SHORT), &ShortObj),
+                      EDSLIB_SUCCESS);
+    ShortObj.Value = 0x5A;
+
+    memset(Packed, 0xFF, sizeof(Packed));
+    ShortBytes = UT_Length_PackObject(UT_EDS_TYPE_SHORT, &ShortObj, sizeof(ShortObj), Packed, sizeof(Packed));
+    UtAssert_UINT32_EQ(ShortBytes, 5);
+
+    /* data following the object is not part of it */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetPackedSizes(&UT_EDS_DATABASE, &Recipe, Packed, sizeof(Packed), &SizeInfo),
+                      EDSLIB_SUCCESS);
+    UtAssert_True(SizeInfo.EdsId == UT_EDS_ID(UT_EDS_TYPE_SHORT), "Short object identified");
+    UtAssert_UINT32_EQ(SizeInfo.PackedBytes, ShortBytes);
+    UtAssert_UINT32_EQ(SizeInfo.NativeBytes, sizeof(UT_Short_t));
+
+    /* the length is known, but not the type */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetPackedSizes(&UT_EDS_DATABASE, &Recipe, Packed, 3, &SizeInfo),
+                      EDSLIB_INCOMPLETE_DB_OBJECT);
+    UtAssert_True(SizeInfo.EdsId == UT_EDS_ID(UT_EDS_TYPE_HEADER), "Base type when Id is missing");
+    UtAssert_UINT32_EQ(SizeInfo.PackedBytes, ShortBytes);
+    UtAssert_UINT32_EQ(SizeInfo.NativeBytes, sizeof(UT_Long_t));
+
+    /* not even the length is known */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetPackedSizes(&UT_EDS_DATABASE, &Recipe, Packed, 2, &SizeInfo),
+                      EDSLIB_BUFFER_SIZE_ERROR);
+
+    /* an Id that matches no derived type leaves the base type */
+    Packed[3] = 0x7F;
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetPackedSizes(&UT_EDS_DATABASE, &Recipe, Packed, sizeof(Packed), &SizeInfo),
+                      EDSLIB_SUCCESS);
+    UtAssert_True(SizeInfo.EdsId == UT_EDS_ID(UT_EDS_TYPE_HEADER), "Base type when Id is unknown");
+    UtAssert_UINT32_EQ(SizeInfo.NativeBytes, sizeof(UT_Header_t));
+
+    /* without identification fields the size is that of the type */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitSizeRecipe(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_LEFRAME), &Recipe),
+                      EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(Recipe.NumIdentFields, 0);
+    Packed[0] = 0xAA;
+    Packed[1] = 0x06;
+    Packed[2] = 0x00;
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetPackedSizes(&UT_EDS_DATABASE, &Recipe, Packed, sizeof(Packed), &SizeInfo),
+                      EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(SizeInfo.PackedBytes, 6);
+    UtAssert_UINT32_EQ(SizeInfo.NativeBytes, sizeof(UT_LeFrame_t));
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitSizeRecipe(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_BADFRAME), &Recipe),
+                      EDSLIB_INVALID_SIZE_OR_TYPE);
+}
@@ -0,0 +1,90 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_runtime_test.c
+ * \ingroup  edslib
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Unit test entry point for the runtime library services, which
+ * use the hand-built database in edslib_ut_database.c
+ */
+
+#include "utassert.h"
+#include "uttest.h"
+
+#include "edslib_init.h"
+
+extern void EdsLib_Length_FieldInfo_Test(void);
+extern void EdsLib_Length_Decode_Test(void);
+extern void EdsLib_Length_SizeRecipe_Test(void);
+extern void EdsLib_Array_Pack_Test(void);
+extern void EdsLib_Array_Unpack_Test(void);
+extern void EdsLib_Array_Verify_Test(void);
+extern void EdsLib_Array_Plan_Test(void);
+extern void EdsLib_Array_Codec_Test(void);
+extern void EdsLib_Validate_Init_Test(void);
+extern void EdsLib_Validate_Range_Test(void);
+extern void EdsLib_Decimate_KeepEveryN_Test(void);
+extern void EdsLib_Decimate_Deadband_Test(void);
+extern void EdsLib_Decimate_TimeBucket_Test(void);
+extern void EdsLib_Decimate_VariableLength_Test(void);
+extern void EdsLib_Diff_Fields_Test(void);
+extern void EdsLib_Diff_Objects_Test(void);
+extern void EdsLib_Diff_Exhaustive_Test(void);
+extern void EdsLib_Hash_Stable_Test(void);
+extern void EdsLib_Hash_Encoding_Test(void);
+extern void EdsLib_Hash_Fields_Test(void);
+extern void EdsLib_Filter_Ident_Test(void);
+extern void EdsLib_Filter_Predicate_Test(void);
+extern void EdsLib_Filter_Compile_Test(void);
+
+static void EdsLib_Runtime_Setup(void)
+{
+    EdsLib_Initialize();
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(EdsLib_Length_FieldInfo_Test, EdsLib_Runtime_Setup, NULL, "EDS Length Field Info");
+    UtTest_Add(EdsLib_Length_Decode_Test, EdsLib_Runtime_Setup, NULL, "EDS Length Field Decode");
+    UtTest_Add(EdsLib_Length_SizeRecipe_Test, EdsLib_Runtime_Setup, NULL, "EDS Size Recipe");
+    UtTest_Add(EdsLib_Array_Pack_Test, EdsLib_Runtime_Setup, NULL, "EDS Array Pack");
+    UtTest_Add(EdsLib_Array_Unpack_Test, EdsLib_Runtime_Setup, NULL, "EDS Array Unpack");
+    UtTest_Add(EdsLib_Array_Verify_Test, EdsLib_Runtime_Setup, NULL, "EDS Array Verify");
+    UtTest_Add(EdsLib_Array_Plan_Test, EdsLib_Runtime_Setup, NULL, "EDS Array Plan");
+    UtTest_Add(EdsLib_Array_Codec_Test, EdsLib_Runtime_Setup, NULL, "EDS Array Codec");
+    UtTest_Add(EdsLib_Validate_Init_Test, EdsLib_Runtime_Setup, NULL, "EDS Validator Init");
+    UtTest_Add(EdsLib_Validate_Range_Test, EdsLib_Runtime_Setup, NULL, "EDS Validator Ranges");
+    UtTest_Add(EdsLib_Decimate_KeepEveryN_Test, EdsLib_Runtime_Setup, NULL, "EDS Decimate Keep Every N");
+    UtTest_Add(EdsLib_Decimate_Deadband_Test, EdsLib_Runtime_Setup, NULL, "EDS Decimate Deadband");
+    UtTest_Add(EdsLib_Decimate_TimeBucket_Test, EdsLib_Runtime_Setup, NULL, "EDS Decimate Time Bucket");
+    UtTest_Add(EdsLib_Decimate_VariableLength_Test, EdsLib_Runtime_Setup, NULL, "EDS Decimate Variable Length");
+    UtTest_Add(EdsLib_Diff_Fields_Test, EdsLib_Runtime_Setup, NULL, "EDS Diff Fields");
+    UtTest_Add(EdsLib_Diff_Objects_Test, EdsLib_Runtime_Setup, NULL, "EDS Diff Objects");
+    UtTest_Add(EdsLib_Diff_Exhaustive_Test, EdsLib_Runtime_Setup, NULL, "EDS Diff Exhaustive");
+    UtTest_Add(EdsLib_Hash_Stable_Test, EdsLib_Runtime_Setup, NULL, "EDS Hash Stable");
+    UtTest_Add(EdsLib_Hash_Encoding_Test, EdsLib_Runtime_Setup, NULL, "EDS Hash Encoding");
+    UtTest_Add(EdsLib_Hash_Fields_Test, EdsLib_Runtime_Setup, NULL, "EDS Hash Fields");
+    UtTest_Add(EdsLib_Filter_Ident_Test, EdsLib_Runtime_Setup, NULL, "EDS Filter Identification");
+    UtTest_Add(EdsLib_Filter_Predicate_Test, EdsLib_Runtime_Setup, NULL, "EDS Filter Predicate");
+    UtTest_Add(EdsLib_Filter_Compile_Test, EdsLib_Runtime_Setup, NULL, "EDS Filter Compile");
+}
@@ -0,0 +1,428 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_ut_database.c
+ * \ingroup  edslib
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Hand-built EDS database for the runtime library unit tests
+ *
+ * This uses the internal database structures directly, in the same
+ * way as the database objects generated by the tool.
+ */
+
+#include <stddef.h>
+
+#include "edslib_database_types.h"
+#include "edslib_ut_database.h"
+
+#define UT_NUMBER(enc, order)   { .Number = { EDSLIB_NUMBERENCODING_##enc, EDSLIB_NUMBERBYTEORDER_##order } }
+#define UT_REF(idx)             { 0, idx }
+#define UT_ENTRY(type, bits, bytes, idx)    \
+    { .EntryType = EDSLIB_ENTRYTYPE_##type, .Offset = { bits, bytes }, .RefObj = UT_REF(idx) }
+
+/*
+ * The length field of the header holds the total size minus 1
+ */
+static intmax_t UT_HeaderLength_Forward(intmax_t x)
+{
+    return x + UT_EDS_HEADER_LENGTH_BIAS;
+}
+
+static intmax_t UT_HeaderLength_Reverse(intmax_t x)
+{
+    return x - UT_EDS_HEADER_LENGTH_BIAS;
+}
+
+/*
+ * UT_EDS_TYPE_HEADER
+ */
+static const EdsLib_FieldDetailEntry_t UT_Header_Entries[] =
+{
+    UT_ENTRY(CONTAINER_ENTRY, 0, offsetof(UT_Header_t, Version), UT_EDS_TYPE_UINT3),
+    { .EntryType = EDSLIB_ENTRYTYPE_CONTAINER_LENGTH_ENTRY, .Offset = { 8, offsetof(UT_Header_t, Length) },
+            .RefObj = UT_REF(UT_EDS_TYPE_UINT16_BE),
+            .HandlerArg.IntegerCalibrator = { UT_HeaderLength_Forward, UT_HeaderLength_Reverse } },
+    UT_ENTRY(CONTAINER_ENTRY, 24, offsetof(UT_Header_t, Id), UT_EDS_TYPE_UINT8)
+};
+
+static const EdsLib_DerivativeEntry_t UT_Header_Derivatives[] =
+{
+    { 3, UT_REF(UT_EDS_TYPE_SHORT) },
+    { 1, UT_REF(UT_EDS_TYPE_LONG) }
+};
+
+/*
+ * Identification walks down from IdentSequenceBase: load the Id field,
+ * then compare it against each value.  The constraint iterator walks
+ * back up from each result via the parent links.
+ */
+static const EdsLib_IdentSequenceEntry_t UT_Header_IdentSequence[] =
+{
+    /* 0 */ { EDSLIB_IDENT_SEQUENCE_INVALID, 0, 0, 0, 0 },
+    /* 1 */ { EDSLIB_IDENT_SEQUENCE_RESULT, 0, 0, 2, 1 },
+    /* 2 */ { EDSLIB_IDENT_SEQUENCE_VALUE_CONDITION, 0, 0, 5, 1 },
+    /* 3 */ { EDSLIB_IDENT_SEQUENCE_RESULT, 0, 0, 4, 0 },
+    /* 4 */ { EDSLIB_IDENT_SEQUENCE_VALUE_CONDITION, 0, 2, 5, 0 },
+    /* 5 */ { EDSLIB_IDENT_SEQUENCE_ENTITY_LOCATION, 0, 0, 0, 0 }
+};
+
+static const EdsLib_ConstraintEntity_t UT_Header_Constraints[] =
+{
+    { { 24, offsetof(UT_Header_t, Id) }, UT_REF(UT_EDS_TYPE_UINT8) }
+};
+
+static const EdsLib_ValueEntry_t UT_Header_Values[] =
+{
+    { .RefValue.Unsigned = UT_EDS_ID_SHORT },
+    { .RefValue.Unsigned = UT_EDS_ID_LONG }
+};
+
+static const EdsLib_ContainerDescriptor_t UT_Header_Container =
+{
+    .MaxSize = { 64, sizeof(UT_Long_t) },
+    .IdentSequenceBase = 5,
+    .DerivativeListSize = 2,
+    .ConstraintEntityListSize = 1,
+    .ValueListSize = 2,
+    .EntryList = UT_Header_Entries,
+    .DerivativeList = UT_Header_Derivatives,
+    .IdentSequenceList = UT_Header_IdentSequence,
+    .ConstraintEntityList = UT_Header_Constraints,
+    .ValueList = UT_Header_Values
+};
+
+/*
+ * UT_EDS_TYPE_SHORT
+ */
+static const EdsLib_FieldDetailEntry_t UT_Short_Entries[] =
+{
+    UT_ENTRY(BASE_TYPE, 0, offsetof(UT_Short_t, Hdr), UT_EDS_TYPE_HEADER),
+    UT_ENTRY(CONTAINER_ENTRY, 32, offsetof(UT_Short_t, Value), UT_EDS_TYPE_UINT8)
+};
+
+static const EdsLib_ContainerDescriptor_t UT_Short_Container =
+{
+    .MaxSize = { 40, sizeof(UT_Short_t) },
+    .EntryList = UT_Short_Entries
+};
+
+/*
+ * UT_EDS_TYPE_LONG
+ */
+static const EdsLib_FieldDetailEntry_t UT_Long_Entries[] =
+{
+    UT_ENTRY(BASE_TYPE, 0, offsetof(UT_Long_t, Hdr), UT_EDS_TYPE_HEADER),
+    UT_ENTRY(CONTAINER_ENTRY, 32, offsetof(UT_Long_t, Temp), UT_EDS_TYPE_INT12),
+    UT_ENTRY(CONTAINER_ENTRY, 48, offsetof(UT_Long_t, Count), UT_EDS_TYPE_UINT16_LE)
+};
+
+static const EdsLib_ContainerDescriptor_t UT_Long_Container =
+{
+    .MaxSize = { 64, sizeof(UT_Long_t) },
+    .EntryList = UT_Long_Entries
+};
+
+/*
+ * UT_EDS_TYPE_LEFRAME
+ */
+static const EdsLib_FieldDetailEntry_t UT_LeFrame_Entries[] =
+{
+    UT_ENTRY(CONTAINER_ENTRY, 0, offsetof(UT_LeFrame_t, Sync), UT_EDS_TYPE_UINT8),
+    UT_ENTRY(CONTAINER_LENGTH_ENTRY, 8, offsetof(UT_LeFrame_t, Length), UT_EDS_TYPE_UINT16_LE),
+    UT_ENTRY(CONTAINER_ENTRY, 24, offsetof(UT_LeFrame_t, Data), UT_EDS_TYPE_UINT8)
+};
+
+static const EdsLib_ContainerDescriptor_t UT_LeFrame_Container =
+{
+    .MaxSize = { 32, sizeof(UT_LeFrame_t) },
+    .EntryList = UT_LeFrame_Entries
+};
+
+/*
+ * UT_EDS_TYPE_BADFRAME - a little endian length which does not start on a byte boundary
+ */
+static const EdsLib_FieldDetailEntry_t UT_BadFrame_Entries[] =
+{
+    UT_ENTRY(CONTAINER_ENTRY, 0, offsetof(UT_BadFrame_t, Flags), UT_EDS_TYPE_UINT3),
+    UT_ENTRY(CONTAINER_LENGTH_ENTRY, 4, offsetof(UT_BadFrame_t, Length), UT_EDS_TYPE_UINT16_LE)
+};
+
+static const EdsLib_ContainerDescriptor_t UT_BadFrame_Container =
+{
+    .MaxSize = { 20, sizeof(UT_BadFrame_t) },
+    .EntryList = UT_BadFrame_Entries
+};
+
+/*
+ * UT_EDS_TYPE_SAMPLE - the CRC does not end the packed data, and bits 36-39 are unused
+ */
+static const EdsLib_FieldDetailEntry_t UT_Sample_Entries[] =
+{
+    UT_ENTRY(CONTAINER_ENTRY, 0, offsetof(UT_Sample_t, Time), UT_EDS_TYPE_UINT16_BE),
+    UT_ENTRY(CONTAINER_ENTRY, 16, offsetof(UT_Sample_t, Level), UT_EDS_TYPE_UINT8),
+    UT_ENTRY(CONTAINER_ENTRY, 24, offsetof(UT_Sample_t, Temp), UT_EDS_TYPE_INT12),
+    { .EntryType = EDSLIB_ENTRYTYPE_CONTAINER_ERROR_CONTROL_ENTRY, .Offset = { 40, offsetof(UT_Sample_t, Crc) },
+            .RefObj = UT_REF(UT_EDS_TYPE_UINT16_BE),
+            .HandlerArg.ErrorControl = EdsLib_ErrorControlType_CRC16_CCITT }
+};
+
+static const EdsLib_ContainerDescriptor_t UT_Sample_Container =
+{
+    .MaxSize = { 56, sizeof(UT_Sample_t) },
+    .EntryList = UT_Sample_Entries
+};
+
+/*
+ * UT_EDS_TYPE_UINT16_ARRAY
+ */
+static const EdsLib_ArrayDescriptor_t UT_UInt16_Array =
+{
+    .ElementRefObj = UT_REF(UT_EDS_TYPE_UINT16_BE)
+};
+
+/*
+ * UT_EDS_TYPE_VECTOR
+ */
+static const EdsLib_FieldDetailEntry_t UT_Vector_Entries[] =
+{
+    UT_ENTRY(CONTAINER_ENTRY, 0, offsetof(UT_Vector_t, Flags), UT_EDS_TYPE_UINT8),
+    UT_ENTRY(CONTAINER_ENTRY, 8, offsetof(UT_Vector_t, Values), UT_EDS_TYPE_UINT16_ARRAY),
+    UT_ENTRY(CONTAINER_ENTRY, 72, offsetof(UT_Vector_t, Gain), UT_EDS_TYPE_FLOAT64_LE)
+};
+
+static const EdsLib_ContainerDescriptor_t UT_Vector_Container =
+{
+    .MaxSize = { 136, sizeof(UT_Vector_t) },
+    .EntryList = UT_Vector_Entries
+};
+
+/*
+ * UT_EDS_TYPE_RECORD - the array starts in the middle of a byte
+ */
+static const EdsLib_FieldDetailEntry_t UT_Record_Entries[] =
+{
+    { .EntryType = EDSLIB_ENTRYTYPE_CONTAINER_FIXED_VALUE_ENTRY, .Offset = { 0, offsetof(UT_Record_t, Sync) },
+            .RefObj = UT_REF(UT_EDS_TYPE_UINT8), .HandlerArg.FixedUnsigned = UT_EDS_RECORD_SYNC },
+    UT_ENTRY(CONTAINER_ENTRY, 8, offsetof(UT_Record_t, Temp), UT_EDS_TYPE_INT12),
+    UT_ENTRY(CONTAINER_ENTRY, 20, offsetof(UT_Record_t, Values), UT_EDS_TYPE_UINT16_ARRAY)
+};
+
+static const EdsLib_ContainerDescriptor_t UT_Record_Container =
+{
+    .MaxSize = { 84, sizeof(UT_Record_t) },
+    .EntryList = UT_Record_Entries
+};
+
+/*
+ * UT_EDS_TYPE_PERCENT_ARRAY
+ */
+static const EdsLib_ArrayDescriptor_t UT_Percent_Array =
+{
+    .ElementRefObj = UT_REF(UT_EDS_TYPE_PERCENT)
+};
+
+/*
+ * UT_EDS_TYPE_LIMITS
+ */
+static const EdsLib_FieldDetailEntry_t UT_Limits_Entries[] =
+{
+    UT_ENTRY(CONTAINER_ENTRY, 0, offsetof(UT_Limits_t, Percent), UT_EDS_TYPE_PERCENT_ARRAY),
+    UT_ENTRY(CONTAINER_ENTRY, 16, offsetof(UT_Limits_t, Mode), UT_EDS_TYPE_MODE),
+    UT_ENTRY(CONTAINER_ENTRY, 24, offsetof(UT_Limits_t, Offset), UT_EDS_TYPE_OFFSET),
+    UT_ENTRY(CONTAINER_ENTRY, 40, offsetof(UT_Limits_t, Code), UT_EDS_TYPE_CODE),
+    UT_ENTRY(CONTAINER_ENTRY, 72, offsetof(UT_Limits_t, Ratio), UT_EDS_TYPE_RATIO),
+    UT_ENTRY(CONTAINER_ENTRY, 136, offsetof(UT_Limits_t, BigCount), UT_EDS_TYPE_BIGCOUNT)
+};
+
+static const EdsLib_ContainerDescriptor_t UT_Limits_Container =
+{
+    .MaxSize = { 200, sizeof(UT_Limits_t) },
+    .EntryList = UT_Limits_Entries
+};
+
+static const EdsLib_DataTypeDB_Entry_t UT_DataTypes[UT_EDS_TYPE_MAX] =
+{
+    [UT_EDS_TYPE_UINT8] = { 0, EDSLIB_BASICTYPE_UNSIGNED_INT, EDSLIB_DATATYPE_FLAG_PACKED_MASK, 0, { 8, sizeof(uint8_t) },
+            UT_NUMBER(UNSIGNED_INTEGER, BIG_ENDIAN) },
+    [UT_EDS_TYPE_UINT16_BE] = { 0, EDSLIB_BASICTYPE_UNSIGNED_INT, EDSLIB_DATATYPE_FLAG_PACKED_BE, 0, { 16, sizeof(uint16_t) },
+            UT_NUMBER(UNSIGNED_INTEGER, BIG_ENDIAN) },
+    [UT_EDS_TYPE_UINT16_LE] = { 0, EDSLIB_BASICTYPE_UNSIGNED_INT, EDSLIB_DATATYPE_FLAG_PACKED_LE, 0, { 16, sizeof(uint16_t) },
+            UT_NUMBER(UNSIGNED_INTEGER, LITTLE_ENDIAN) },
+    [UT_EDS_TYPE_INT12] = { 0, EDSLIB_BASICTYPE_SIGNED_INT, EDSLIB_DATATYPE_FLAG_NONE, 0, { 12, sizeof(int16_t) },
+            UT_NUMBER(TWOS_COMPLEMENT, BIG_ENDIAN) },
+    [UT_EDS_TYPE_FLOAT64_LE] = { 0, EDSLIB_BASICTYPE_FLOAT, EDSLIB_DATATYPE_FLAG_PACKED_LE, 0, { 64, sizeof(double) },
+            UT_NUMBER(IEEE_754, LITTLE_ENDIAN) },
+    [UT_EDS_TYPE_UINT3] = { 0, EDSLIB_BASICTYPE_UNSIGNED_INT, EDSLIB_DATATYPE_FLAG_NONE, 0, { 3, sizeof(uint8_t) },
+            UT_NUMBER(UNSIGNED_INTEGER, BIG_ENDIAN) },
+    [UT_EDS_TYPE_HEADER] = { 0, EDSLIB_BASICTYPE_CONTAINER, EDSLIB_DATATYPE_FLAG_NONE, 3, { 32, sizeof(UT_Header_t) },
+            { .Container = &UT_Header_Container } },
+    [UT_EDS_TYPE_SHORT] = { 0, EDSLIB_BASICTYPE_CONTAINER, EDSLIB_DATATYPE_FLAG_NONE, 2, { 40, sizeof(UT_Short_t) },
+            { .Container = &UT_Short_Container } },
+    [UT_EDS_TYPE_LONG] = { 0, EDSLIB_BASICTYPE_CONTAINER, EDSLIB_DATATYPE_FLAG_NONE, 3, { 64, sizeof(UT_Long_t) },
+            { .Container = &UT_Long_Container } },
+    [UT_EDS_TYPE_LEFRAME] = { 0, EDSLIB_BASICTYPE_CONTAINER, EDSLIB_DATATYPE_FLAG_NONE, 3, { 32, sizeof(UT_LeFrame_t) },
+            { .Container = &UT_LeFrame_Container } },
+    [UT_EDS_TYPE_BADFRAME] = { 0, EDSLIB_BASICTYPE_CONTAINER, EDSLIB_DATATYPE_FLAG_NONE, 2, { 20, sizeof(UT_BadFrame_t) },
+            { .Container = &UT_BadFrame_Container } },
+    [UT_EDS_TYPE_SAMPLE] = { 0, EDSLIB_BASICTYPE_CONTAINER, EDSLIB_DATATYPE_FLAG_NONE, 4, { 56, sizeof(UT_Sample_t) },
+            { .Container = &UT_Sample_Container } },
+    [UT_EDS_TYPE_UINT16_ARRAY] = { 0, EDSLIB_BASICTYPE_ARRAY, EDSLIB_DATATYPE_FLAG_PACKED_BE, 4, { 64, 4 * sizeof(uint16_t) },
+            { .Array = &UT_UInt16_Array } },
+    [UT_EDS_TYPE_VECTOR] = { 0, EDSLIB_BASICTYPE_CONTAINER, EDSLIB_DATATYPE_FLAG_NONE, 3, { 136, sizeof(UT_Vector_t) },
+            { .Container = &UT_Vector_Container } },
+    [UT_EDS_TYPE_RECORD] = { 0, EDSLIB_BASICTYPE_CONTAINER, EDSLIB_DATATYPE_FLAG_NONE, 3, { 84, sizeof(UT_Record_t) },
+            { .Container = &UT_Record_Container } },
+    [UT_EDS_TYPE_PERCENT] = { 0, EDSLIB_BASICTYPE_UNSIGNED_INT, EDSLIB_DATATYPE_FLAG_PACKED_MASK, 0, { 8, sizeof(uint8_t) },
+            UT_NUMBER(UNSIGNED_INTEGER, BIG_ENDIAN) },
+    [UT_EDS_TYPE_PERCENT_ARRAY] = { 0, EDSLIB_BASICTYPE_ARRAY, EDSLIB_DATATYPE_FLAG_PACKED_MASK, 2, { 16, 2 * sizeof(uint8_t) },
+            { .Array = &UT_Percent_Array } },
+    [UT_EDS_TYPE_MODE] = { 0, EDSLIB_BASICTYPE_UNSIGNED_INT, EDSLIB_DATATYPE_FLAG_PACKED_MASK, 0, { 8, sizeof(uint8_t) },
+            UT_NUMBER(UNSIGNED_INTEGER, BIG_ENDIAN) },
+    [UT_EDS_TYPE_OFFSET] = { 0, EDSLIB_BASICTYPE_SIGNED_INT, EDSLIB_DATATYPE_FLAG_PACKED_BE, 0, { 16, sizeof(int16_t) },
+            UT_NUMBER(TWOS_COMPLEMENT, BIG_ENDIAN) },
+    [UT_EDS_TYPE_CODE] = { 0, EDSLIB_BASICTYPE_SIGNED_INT, EDSLIB_DATATYPE_FLAG_PACKED_BE, 0, { 32, sizeof(int32_t) },
+            UT_NUMBER(TWOS_COMPLEMENT, BIG_ENDIAN) },
+    [UT_EDS_TYPE_RATIO] = { 0, EDSLIB_BASICTYPE_FLOAT, EDSLIB_DATATYPE_FLAG_PACKED_LE, 0, { 64, sizeof(double) },
+            UT_NUMBER(IEEE_754, LITTLE_ENDIAN) },
+    [UT_EDS_TYPE_BIGCOUNT] = { 0, EDSLIB_BASICTYPE_UNSIGNED_INT, EDSLIB_DATATYPE_FLAG_PACKED_BE, 0, { 64, sizeof(uint64_t) },
+            UT_NUMBER(UNSIGNED_INTEGER, BIG_ENDIAN) },
+    [UT_EDS_TYPE_LIMITS] = { 0, EDSLIB_BASICTYPE_CONTAINER, EDSLIB_DATATYPE_FLAG_NONE, 6, { 200, sizeof(UT_Limits_t) },
+            { .Container = &UT_Limits_Container } }
+};
+
+static const intmax_t UT_Mode_Values[] = { 1, 2, 5 };
+static const intmax_t UT_Code_Values[] = { -1000, 0, 1000 };
+
+static const EdsLib_ValidRangeDescriptor_t UT_Percent_Range =
+{
+    .Flags = EDSLIB_VALIDRANGE_FLAG_HAS_MIN | EDSLIB_VALIDRANGE_FLAG_HAS_MAX,
+    .Min.Integer = 0,
+    .Max.Integer = 100
+};
+
+static const EdsLib_ValidRangeDescriptor_t UT_Mode_Range =
+{
+    .ValidValueListSize = sizeof(UT_Mode_Values) / sizeof(UT_Mode_Values[0]),
+    .ValidValueList = UT_Mode_Values
+};
+
+static const EdsLib_ValidRangeDescriptor_t UT_Offset_Range =
+{
+    .Flags = EDSLIB_VALIDRANGE_FLAG_HAS_MIN | EDSLIB_VALIDRANGE_FLAG_HAS_MAX | EDSLIB_VALIDRANGE_FLAG_MIN_EXCLUSIVE,
+    .Min.Integer = -50,
+    .Max.Integer = 50
+};
+
+static const EdsLib_ValidRangeDescriptor_t UT_Code_Range =
+{
+    .ValidValueListSize = sizeof(UT_Code_Values) / sizeof(UT_Code_Values[0]),
+    .ValidValueList = UT_Code_Values
+};
+
+static const EdsLib_ValidRangeDescriptor_t UT_Ratio_Range =
+{
+    .Flags = EDSLIB_VALIDRANGE_FLAG_HAS_MIN | EDSLIB_VALIDRANGE_FLAG_HAS_MAX | EDSLIB_VALIDRANGE_FLAG_MAX_EXCLUSIVE,
+    .Min.Float = 0.0,
+    .Max.Float = 1.0
+};
+
+static const EdsLib_ValidRangeDescriptor_t UT_BigCount_Range =
+{
+    .Flags = EDSLIB_VALIDRANGE_FLAG_HAS_MIN | EDSLIB_VALIDRANGE_FLAG_UNSIGNED,
+    .Min.Unsigned = UINT64_C(0x8000000000000000)
+};
+
+static const EdsLib_ValidRangeDescriptor_t * const UT_ValidRanges[UT_EDS_TYPE_MAX] =
+{
+    [UT_EDS_TYPE_PERCENT] = &UT_Percent_Range,
+    [UT_EDS_TYPE_MODE] = &UT_Mode_Range,
+    [UT_EDS_TYPE_OFFSET] = &UT_Offset_Range,
+    [UT_EDS_TYPE_CODE] = &UT_Code_Range,
+    [UT_EDS_TYPE_RATIO] = &UT_Ratio_Range,
+    [UT_EDS_TYPE_BIGCOUNT] = &UT_BigCount_Range
+};
+
+static const char * const UT_Header_Names[] = { "Version", "Length", "Id" };
+static const char * const UT_Short_Names[] = { "Hdr", "Value" };
+static const char * const UT_Long_Names[] = { "Hdr", "Temp", "Count" };
+static const char * const UT_LeFrame_Names[] = { "Sync", "Length", "Data" };
+static const char * const UT_BadFrame_Names[] = { "Flags", "Length" };
+static const char * const UT_Sample_Names[] = { "Time", "Level", "Temp", "Crc" };
+static const char * const UT_Vector_Names[] = { "Flags", "Values", "Gain" };
+static const char * const UT_Record_Names[] = { "Sync", "Temp", "Values" };
+static const char * const UT_Limits_Names[] = { "Percent", "Mode", "Offset", "Code", "Ratio", "BigCount" };
+
+#define UT_DISPLAY_SCALAR(name)                 { EDSLIB_DISPLAYHINT_NONE, 0, { .ArgValue = NULL }, "UT", name }
+#define UT_DISPLAY_CONTAINER(name, table)       \
+    { EDSLIB_DISPLAYHINT_MEMBER_NAMETABLE, sizeof(table) / sizeof(table[0]), { .NameTable = table }, "UT", name }
+
+static const EdsLib_DisplayDB_Entry_t UT_DisplayInfo[UT_EDS_TYPE_MAX] =
+{
+    [UT_EDS_TYPE_UINT8] = UT_DISPLAY_SCALAR("UInt8"),
+    [UT_EDS_TYPE_UINT16_BE] = UT_DISPLAY_SCALAR("UInt16BE"),
+    [UT_EDS_TYPE_UINT16_LE] = UT_DISPLAY_SCALAR("UInt16LE"),
+    [UT_EDS_TYPE_INT12] = UT_DISPLAY_SCALAR("Int12"),
+    [UT_EDS_TYPE_FLOAT64_LE] = UT_DISPLAY_SCALAR("Float64LE"),
+    [UT_EDS_TYPE_UINT3] = UT_DISPLAY_SCALAR("UInt3"),
+    [UT_EDS_TYPE_HEADER] = UT_DISPLAY_CONTAINER("Header", UT_Header_Names),
+    [UT_EDS_TYPE_SHORT] = UT_DISPLAY_CONTAINER("Short", UT_Short_Names),
+    [UT_EDS_TYPE_LONG] = UT_DISPLAY_CONTAINER("Long", UT_Long_Names),
+    [UT_EDS_TYPE_LEFRAME] = UT_DISPLAY_CONTAINER("LeFrame", UT_LeFrame_Names),
+    [UT_EDS_TYPE_BADFRAME] = UT_DISPLAY_CONTAINER("BadFrame", UT_BadFrame_Names),
+    [UT_EDS_TYPE_SAMPLE] = UT_DISPLAY_CONTAINER("Sample", UT_Sample_Names),
+    [UT_EDS_TYPE_UINT16_ARRAY] = UT_DISPLAY_SCALAR("UInt16Array"),
+    [UT_EDS_TYPE_VECTOR] = UT_DISPLAY_CONTAINER("Vector", UT_Vector_Names),
+    [UT_EDS_TYPE_RECORD] = UT_DISPLAY_CONTAINER("Record", UT_Record_Names),
+    [UT_EDS_TYPE_PERCENT] = UT_DISPLAY_SCALAR("Percent"),
+    [UT_EDS_TYPE_PERCENT_ARRAY] = UT_DISPLAY_SCALAR("PercentArray"),
+    [UT_EDS_TYPE_MODE] = UT_DISPLAY_SCALAR("Mode"),
+    [UT_EDS_TYPE_OFFSET] = UT_DISPLAY_SCALAR("Offset"),
+    [UT_EDS_TYPE_CODE] = UT_DISPLAY_SCALAR("Code"),
+    [UT_EDS_TYPE_RATIO] = UT_DISPLAY_SCALAR("Ratio"),
+    [UT_EDS_TYPE_BIGCOUNT] = UT_DISPLAY_SCALAR("BigCount"),
+    [UT_EDS_TYPE_LIMITS] = UT_DISPLAY_CONTAINER("Limits", UT_Limits_Names)
+};
+
+static const struct EdsLib_App_DataTypeDB UT_DataTypeDB =
+{
+    .MissionIdx = 0,
+    .DataTypeTableSize = UT_EDS_TYPE_MAX,
+    .DataTypeTable = UT_DataTypes,
+    .ValidRangeTable = UT_ValidRanges
+};
+
+static const struct EdsLib_App_DisplayDB UT_DisplayDB =
+{
+    .EdsName = "UT",
+    .DisplayInfoTable = UT_DisplayInfo
+};
+
+static EdsLib_DataTypeDB_t UT_DataTypeDB_Table[] = { &UT_DataTypeDB };
+static EdsLib_DisplayDB_t UT_DisplayDB_Table[] = { &UT_DisplayDB };
+
+const EdsLib_DatabaseObject_t UT_EDS_DATABASE =
+{
+    .AppTableSize = 1,
+    .DataTypeDB_Table = UT_DataTypeDB_Table,
+    .DisplayDB_Table = UT_DisplayDB_Table
+};
@@ -0,0 +1,164 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_ut_database.h
+ * \ingroup  edslib
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Hand-built EDS database for the runtime library unit tests
+ *
+ * The database is written directly in C rather than generated from XML, so
+ * it can hold exactly the encodings that the tests need (unaligned fields,
+ * both byte orders, length entries with and without calibration) without
+ * depending on the tool chain.  The native structures below must match the
+ * native offsets and sizes recorded in the database.
+ */
+
+#ifndef _EDSLIB_UT_DATABASE_H_
+#define _EDSLIB_UT_DATABASE_H_
+
+#include <stdint.h>
+
+#include "edslib_id.h"
+#include "edslib_datatypedb.h"
+
+/*
+ * Index of each data type within the single application of the database
+ */
+enum
+{
+    UT_EDS_TYPE_RESERVED = 0,
+    UT_EDS_TYPE_UINT8,          /**< 8 bit unsigned */
+    UT_EDS_TYPE_UINT16_BE,      /**< 16 bit unsigned, big endian */
+    UT_EDS_TYPE_UINT16_LE,      /**< 16 bit unsigned, little endian */
+    UT_EDS_TYPE_INT12,          /**< 12 bit twos complement, big endian */
+    UT_EDS_TYPE_FLOAT64_LE,     /**< IEEE-754 double, little endian */
+    UT_EDS_TYPE_UINT3,          /**< 3 bit unsigned */
+    UT_EDS_TYPE_HEADER,         /**< Base container with a length entry and an identification field */
+    UT_EDS_TYPE_SHORT,          /**< Derived from UT_EDS_TYPE_HEADER, where Id is 1 */
+    UT_EDS_TYPE_LONG,           /**< Derived from UT_EDS_TYPE_HEADER, where Id is 2 */
+    UT_EDS_TYPE_LEFRAME,        /**< Container with an uncalibrated little endian length entry */
+    UT_EDS_TYPE_BADFRAME,       /**< Container with a length entry that cannot be decoded directly */
+    UT_EDS_TYPE_SAMPLE,         /**< Container with a time field, numeric fields and a CRC */
+    UT_EDS_TYPE_UINT16_ARRAY,   /**< Array of 4 UT_EDS_TYPE_UINT16_BE */
+    UT_EDS_TYPE_VECTOR,         /**< Container of byte aligned fields only, which can be compiled */
+    UT_EDS_TYPE_RECORD,         /**< Container with a fixed value entry and an unaligned array */
+    UT_EDS_TYPE_PERCENT,        /**< 8 bit unsigned, valid from 0 to 100 */
+    UT_EDS_TYPE_PERCENT_ARRAY,  /**< Array of 2 UT_EDS_TYPE_PERCENT */
+    UT_EDS_TYPE_MODE,           /**< 8 bit enumeration with the values 1, 2 and 5 */
+    UT_EDS_TYPE_OFFSET,         /**< 16 bit signed, valid from -50 (exclusive) to 50 */
+    UT_EDS_TYPE_CODE,           /**< 32 bit signed enumeration with the values -1000, 0 and 1000 */
+    UT_EDS_TYPE_RATIO,          /**< IEEE-754 double, valid from 0.0 to 1.0 (exclusive) */
+    UT_EDS_TYPE_BIGCOUNT,       /**< 64 bit unsigned, valid from 2^63 */
+    UT_EDS_TYPE_LIMITS,         /**< Container of fields which all have a valid range */
+    UT_EDS_TYPE_MAX
+};
+
+#define UT_EDS_ID(idx)          EDSLIB_MAKE_ID(0, idx)
+
+/*
+ * Value of the Id field which selects each derived type
+ */
+#define UT_EDS_ID_SHORT         1
+#define UT_EDS_ID_LONG          2
+
+/*
+ * Value of the fixed Sync field of UT_EDS_TYPE_RECORD
+ */
+#define UT_EDS_RECORD_SYNC      0x5A
+
+/*
+ * The length field of UT_EDS_TYPE_HEADER holds the total size in bytes, minus 1
+ */
+#define UT_EDS_HEADER_LENGTH_BIAS   1
+
+/*
+ * Native structures of the container types
+ */
+typedef struct
+{
+    uint8_t Version;
+    uint16_t Length;
+    uint8_t Id;
+} UT_Header_t;
+
+typedef struct
+{
+    UT_Header_t Hdr;
+    uint8_t Value;
+} UT_Short_t;
+
+typedef struct
+{
+    UT_Header_t Hdr;
+    int16_t Temp;
+    uint16_t Count;
+} UT_Long_t;
+
+typedef struct
+{
+    uint8_t Sync;
+    uint16_t Length;
+    uint8_t Data;
+} UT_LeFrame_t;
+
+typedef struct
+{
+    uint8_t Flags;
+    uint16_t Length;
+} UT_BadFrame_t;
+
+typedef struct
+{
+    uint16_t Time;
+    uint8_t Level;
+    int16_t Temp;
+    uint16_t Crc;
+} UT_Sample_t;
+
+typedef struct
+{
+    uint8_t Flags;
+    uint16_t Values[4];
+    double Gain;
+} UT_Vector_t;
+
+typedef struct
+{
+    uint8_t Sync;
+    int16_t Temp;
+    uint16_t Values[4];
+} UT_Record_t;
+
+typedef struct
+{
+    uint8_t Percent[2];
+    uint8_t Mode;
+    int16_t Offset;
+    int32_t Code;
+    double Ratio;
+    uint64_t BigCount;
+} UT_Limits_t;
+
+extern const EdsLib_DatabaseObject_t UT_EDS_DATABASE;
+
+#endif  /* _EDSLIB_UT_DATABASE_H_ */
@@ -0,0 +1,203 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_validate_test.c
+ * \ingroup  edslib
+ * \author   joseph.p.hickey@nasa.gov
+ *
+ * Unit testing of the valid range validator
+ */
+
+#include <string.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "utassert.h"
+
+#include "edslib_datatypedb.h"
+#include "edslib_ut_database.h"
+
+/*
+ * Check index of each field of UT_Limits_t, in offset order
+ */
+enum
+{
+    UT_LIMITS_CHECK_PERCENT0,
+    UT_LIMITS_CHECK_PERCENT1,
+    UT_LIMITS_CHECK_MODE,
+    UT_LIMITS_CHECK_OFFSET,
+    UT_LIMITS_CHECK_CODE,
+    UT_LIMITS_CHECK_RATIO,
+    UT_LIMITS_CHECK_BIGCOUNT,
+    UT_LIMITS_CHECK_MAX
+};
+
+static EdsLib_DataTypeDB_Validator_t UT_Validator;
+
+static void UT_Validate_SetValid(UT_Limits_t *Limits)
+{
+    memset(Limits, 0, sizeof(*Limits));
+    Limits->Percent[0] = 0;
+    Limits->Percent[1] = 100;
+    Limits->Mode = 5;
+    Limits->Offset = -49;
+    Limits->Code = -1000;
+    Limits->Ratio = 0.0;
+    Limits->BigCount = UINT64_C(0x8000000000000000);
+}
+
+/*
+ * Validate the object, and check that exactly the given check failed
+ */
+static void UT_Validate_ExpectViolation(const UT_Limits_t *Limits, uint16_t CheckIdx, const char *Desc)
+{
+    EdsLib_DataTypeDB_ValidationResult_t Result;
+    int32_t Status;
+
+    Status = EdsLib_DataTypeDB_ValidateObject(&UT_Validator, Limits, sizeof(*Limits), &Result);
+    UtAssert_True(Status == EDSLIB_VALUE_OUT_OF_RANGE && Result.NumViolations == 1 &&
+            Result.ViolationMask[0] == (UINT32_C(1) << CheckIdx), "%s is out of range", Desc);
+}
+
+static void UT_Validate_ExpectValid(const UT_Limits_t *Limits, const char *Desc)
+{
+    EdsLib_DataTypeDB_ValidationResult_t Result;
+    int32_t Status;
+
+    Status = EdsLib_DataTypeDB_ValidateObject(&UT_Validator, Limits, sizeof(*Limits), &Result);
+    UtAssert_True(Status == EDSLIB_SUCCESS && Result.NumViolations == 0 && Result.ViolationMask[0] == 0,
+            "%s is valid", Desc);
+}
+
+void EdsLib_Validate_Init_Test(void)
+{
+    static const uint32_t ExpectedOffset[UT_LIMITS_CHECK_MAX] =
+    {
+        offsetof(UT_Limits_t, Percent), offsetof(UT_Limits_t, Percent) + 1, offsetof(UT_Limits_t, Mode),
+        offsetof(UT_Limits_t, Offset), offsetof(UT_Limits_t, Code), offsetof(UT_Limits_t, Ratio),
+        offsetof(UT_Limits_t, BigCount)
+    };
+    EdsLib_DataTypeDB_EntityInfo_t MemberInfo;
+    EdsLib_DataTypeDB_ValidationResult_t Result;
+    UT_Limits_t Limits;
+    uint16_t CheckIdx;
+
+    /* every element of an array has its own check */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitValidator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_LIMITS), &UT_Validator),
+            EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(UT_Validator.NumChecks, UT_LIMITS_CHECK_MAX);
+
+    for (CheckIdx = 0; CheckIdx < UT_LIMITS_CHECK_MAX; ++CheckIdx)
+    {
+        UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetValidatorCheckInfo(&UT_EDS_DATABASE, &UT_Validator, CheckIdx,
+                &MemberInfo), EDSLIB_SUCCESS);
+        UtAssert_UINT32_EQ(MemberInfo.Offset.Bytes, ExpectedOffset[CheckIdx]);
+    }
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_GetValidatorCheckInfo(&UT_EDS_DATABASE, &UT_Validator, UT_LIMITS_CHECK_MAX,
+            &MemberInfo), EDSLIB_INVALID_INDEX);
+
+    UT_Validate_SetValid(&Limits);
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_ValidateObject(&UT_Validator, &Limits, sizeof(Limits) - 1, &Result),
+            EDSLIB_BUFFER_SIZE_ERROR);
+
+    /* a type with no valid ranges has no checks, and every object is valid */
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitValidator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_VECTOR), &UT_Validator),
+            EDSLIB_SUCCESS);
+    UtAssert_UINT32_EQ(UT_Validator.NumChecks, 0);
+    memset(&Limits, 0xFF, sizeof(Limits));
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_ValidateObject(&UT_Validator, &Limits, sizeof(UT_Vector_t), &Result),
+            EDSLIB_SUCCESS);
+}
+
+/*
+ * Each limit, inclusive or exclusive, is checked on both sides
+ */
+void EdsLib_Validate_Range_Test(void)
+{
+    EdsLib_DataTypeDB_ValidationResult_t Result;
+    UT_Limits_t Limits;
+
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_InitValidator(&UT_EDS_DATABASE, UT_EDS_ID(UT_EDS_TYPE_LIMITS), &UT_Validator),
+            EDSLIB_SUCCESS);
+
+    UT_Validate_SetValid(&Limits);
+    UT_Validate_ExpectValid(&Limits, "Lower limits");
+
+    Limits.Percent[0] = 100;
+    Limits.Percent[1] = 0;
+    Limits.Mode = 1;
+    Limits.Offset = 50;
+    Limits.Code = 1000;
+    Limits.Ratio = nextafter(1.0, 0.0);
+    Limits.BigCount = UINT64_MAX;
+    UT_Validate_ExpectValid(&Limits, "Upper limits");
+
+    UT_Validate_SetValid(&Limits);
+    Limits.Percent[1] = 101;
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_PERCENT1, "Percent[1] 101");
+
+    /* enumerations with a mask and with a list */
+    UT_Validate_SetValid(&Limits);
+    Limits.Mode = 3;
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_MODE, "Mode 3");
+    Limits.Mode = 0;
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_MODE, "Mode 0");
+    Limits.Mode = 69;
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_MODE, "Mode 69");
+
+    UT_Validate_SetValid(&Limits);
+    Limits.Code = 999;
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_CODE, "Code 999");
+    Limits.Code = -1001;
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_CODE, "Code -1001");
+
+    /* exclusive minimum of a signed field */
+    UT_Validate_SetValid(&Limits);
+    Limits.Offset = -50;
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_OFFSET, "Offset -50");
+    Limits.Offset = 51;
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_OFFSET, "Offset 51");
+
+    /* exclusive maximum of a float field, and NaN is never valid */
+    UT_Validate_SetValid(&Limits);
+    Limits.Ratio = 1.0;
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_RATIO, "Ratio 1.0");
+    Limits.Ratio = -0.001;
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_RATIO, "Ratio -0.001");
+    Limits.Ratio = NAN;
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_RATIO, "Ratio NaN");
+
+    /* an unsigned limit beyond the range of intmax_t */
+    UT_Validate_SetValid(&Limits);
+    Limits.BigCount = UINT64_C(0x7FFFFFFFFFFFFFFF);
+    UT_Validate_ExpectViolation(&Limits, UT_LIMITS_CHECK_BIGCOUNT, "BigCount 2^63-1");
+
+    /* all violations are reported, not just the first */
+    Limits.Percent[0] = 200;
+    Limits.Mode = 4;
+    UtAssert_INT32_EQ(EdsLib_DataTypeDB_ValidateObject(&UT_Validator, &Limits, sizeof(Limits), &Result),
+            EDSLIB_VALUE_OUT_OF_RANGE);
+    UtAssert_UINT32_EQ(Result.NumChecks, UT_LIMITS_CHECK_MAX);
+    UtAssert_UINT32_EQ(Result.NumViolations, 3);
+    UtAssert_UINT32_EQ(Result.ViolationMask[0], (UINT32_C(1) << UT_LIMITS_CHECK_PERCENT0) |
+            (UINT32_C(1) << UT_LIMITS_CHECK_MODE) | (UINT32_C(1) << UT_LIMITS_CHECK_BIGCOUNT));
+}
@@ -639,70 +639,133 @@ end
 -- order to figure out the size of the container, then all contained objects must
 -- be resolved first.  Any circular dependency would be an error.
 
--- To make this work, this loop makes complete passes through the entire tree,
--- and attempts to calculate the size of all data type(s) which do not already have
--- a "resolved_size" attribute.  If the size cannot be calculated because one of the
--- dependent entities is still unknown, it is skipped.
+-- To make this work, every node that needs resolution is put on a work queue in
+-- tree order and attempted once.  If the size cannot be calculated because one of the
+-- dependent entities is still unknown, the resolve function returns that dependency,
+-- and the node is "parked" on it.  When the dependency is later resolved, everything
+-- parked on it goes back on the work queue.  This way a node is only retried when
+-- something it depends on has actually changed, rather than on every pass through
+-- the entire tree, which is very slow for deeply nested types.
 --
--- Two counters are maintained for each pass:
---   unresolved => count of objects which the resolved_size could NOT be computed
+-- If a node fails without identifying a dependency that will eventually be resolved
+-- here (e.g. an error string) then it cannot be parked.  These are put on a retry list
+-- which is attempted again at the start of every round.
+--
+-- A "round" ends when the work queue is empty.  At this point the maximum size of
+-- types with derivatives is computed, which may wake up more nodes for the next round.
+--
+-- Two counters are maintained for each round:
+--   unresolved => count of objects which are still waiting at the end of the round
 --   resolved => count of objects which the resolved_size was successfully computed
 --
+local work_queue = {}
+local retry_list = {}
+local waiting_table = {}
+local waiting_count = 0
+local attempt_count = 0
+local round_count = 0
+local start_time = os.clock()
+
+-- Put all nodes which are parked on the given dependency back on the work queue
+local function wake_waiting_nodes(dep)
+  local wait_list = waiting_table[dep]
+  if (wait_list) then
+    waiting_table[dep] = nil
+    waiting_count = waiting_count - #wait_list
+    for i,node in ipairs(wait_list) do
+      work_queue[1 + #work_queue] = node
+    end
+  end
+end
+
+-- Check if the failed dependency returned by a resolve function is something
+-- that will be resolved by this script, and therefore will wake up its waiters
+local function is_wakeable_dependency(dep)
+  return type(dep) == "userdata" and
+    (SEDS_SIZE_RESOLVE_TABLE[dep.entity_type] ~= nil or derived_node_table[dep] ~= nil)
+end
+
+for node in SEDS.root:iterate_subtree() do
+  if (type(SEDS_SIZE_RESOLVE_TABLE[node.entity_type]) == "function") then
+    work_queue[1 + #work_queue] = node
+  end
+end
+
 while (SEDS.get_error_count() == 0) do
   local unresolved_count = 0
   local resolved_count = 0
+  local queue_pos = 1
+
+  round_count = round_count + 1
+
+  for i,node in ipairs(retry_list) do
+    work_queue[1 + #work_queue] = node
+  end
+  retry_list = {}
 
-  -- Make a pass through the tree, grabbing anything that needs resolution
-  for node in SEDS.root:iterate_subtree() do
+  -- Work through the queue; note that more entries may be added while doing so
+  while (queue_pos <= #work_queue) do
+    local node = work_queue[queue_pos]
     local resolve = SEDS_SIZE_RESOLVE_TABLE[node.entity_type]
-    if(type(resolve) == "function" and not resolve_table[node]) then
-
-      local status = resolve(node)
-
-      -- The resolve function has four possible outcomes:
-      -- For nodes which are deemed "OK" this returns boolean true.
-      --
-      --    a) The item size is successfully determined.
-      --       -> The return value is boolean "true"
-      --          The "resolved_size" attribute will be populated
-      --    b) The item size cannot be determined, but can be safely ignored.
-      --        (for instance, if the value is abstract and not actually used in direct form)
-      --       -> The return value is boolean "true"
-      --          The "resolved_size" attribute will NOT be populated
-      --    c) The item size cannot be determined due to a document error or missing info
-      --       -> The return value is NOT boolean "true"
-      --          Internally calls an appropriate error reporting function
-      --    d) The item size cannot be determined because a dependent type size is not known
-      --       -> The return value should be the failed dependency node or an error string
-      --
-      -- Also note case (d) is a transient problem, and requires making multiple passes
-      -- through this loop until it goes away.  Cases a,b,c are considered "final"
-
-
-      if (status == true) then    -- boolean true only, not another "logically true" value
-        resolved_count = resolved_count + 1
-        resolve_table[node] = true
-        if (node.resolved_size) then
-          node.resolved_size:flavor(node.entity_type)
-          if (not checksum_table[node.resolved_size.checksum]) then
-            checksum_table[node.resolved_size.checksum] = node
-          end
+    local status = resolve(node)
+
+    queue_pos = queue_pos + 1
+    attempt_count = attempt_count + 1
+
+    -- The resolve function has four possible outcomes:
+    -- For nodes which are deemed "OK" this returns boolean true.
+    --
+    --    a) The item size is successfully determined.
+    --       -> The return value is boolean "true"
+    --          The "resolved_size" attribute will be populated
+    --    b) The item size cannot be determined, but can be safely ignored.
+    --        (for instance, if the value is abstract and not actually used in direct form)
+    --       -> The return value is boolean "true"
+    --          The "resolved_size" attribute will NOT be populated
+    --    c) The item size cannot be determined due to a document error or missing info
+    --       -> The return value is NOT boolean "true"
+    --          Internally calls an appropriate error reporting function
+    --    d) The item size cannot be determined because a dependent type size is not known
+    --       -> The return value should be the failed dependency node or an error string
+    --
+    -- Also note case (d) is a transient problem, and the node is parked until the
+    -- dependency is resolved.  Cases a,b,c are considered "final"
+
+
+    if (status == true) then    -- boolean true only, not another "logically true" value
+      resolved_count = resolved_count + 1
+      resolve_table[node] = true
+      if (node.resolved_size) then
+        node.resolved_size:flavor(node.entity_type)
+        if (not checksum_table[node.resolved_size.checksum]) then
+          checksum_table[node.resolved_size.checksum] = node
         end
+      end
+      wake_waiting_nodes(node)
+    elseif (resolve_error) then
+      local message
+      if (type(status) == "userdata") then
+        message = "failed dependency:" .. tostring(status)
       else
-        unresolved_count = unresolved_count + 1
-        if (resolve_error) then
-          local message
-          if (type(status) == "userdata") then
-            message = "failed dependency:" .. tostring(status)
-          else
-            message = status
-          end
-          node:error(tostring(node), message)
-        end
+        message = status
+      end
+      node:error(tostring(node), message)
+    elseif (is_wakeable_dependency(status)) then
+      local wait_list = waiting_table[status]
+      if (not wait_list) then
+        wait_list = {}
+        waiting_table[status] = wait_list
       end
+      wait_list[1 + #wait_list] = node
+      waiting_count = waiting_count + 1
+    else
+      retry_list[1 + #retry_list] = node
     end
   end
 
+  work_queue = {}
+  unresolved_count = waiting_count + #retry_list
+
   -- Make a pass through the "derived" table, to calculate
   -- the _maximum_ size of these objects (which is helpful for sizing buffers)
   -- This also recognizes a special case of container inheritance where an empty base
@@ -730,6 +793,7 @@ while (SEDS.get_error_count() == 0) do
         node.is_union = is_union
         node.max_size = pending_max_size
         derived_node_table[node] = nil
+        wake_waiting_nodes(node)
       elseif (resolve_error) then
         node:error("Maximum derivative size not resolved")
       else
@@ -740,14 +804,14 @@ while (SEDS.get_error_count() == 0) do
 
   -- If the "unresolved" count ends up zero, then everything is satisfied - job done
   -- Otherwise, as long as the "resolved" count is non zero, then this indicates
-  -- progress and the next pass may resolve more items.
+  -- progress and the next round may resolve more items.
   -- The other possibility, a resolved count of zero and a nonzero unresolved count,
-  -- constitutes an error.  Since no changes were made to the tree, subsequent passes
+  -- constitutes an error.  Since no changes were made to the tree, subsequent rounds
   -- will be no different.  The most likely cause of this would be a circular dependency.
 
-  -- In this case, one more pass will be made, this time triggering an error message
-  -- on every unresolved size, so the user can investigate the issue.  This final pass
-  -- is purely for the purposes of error collection.
+  -- In this case, one more pass will be made over every unresolved node, in tree order,
+  -- this time triggering an error message on every unresolved size, so the user can
+  -- investigate the issue.  This final pass is purely for the purposes of error collection.
 
   -- This approach avoids the "trap" of trying to recursively follow a circular dependency
   -- which of course would ultimately crash the process.
@@ -757,6 +821,20 @@ while (SEDS.get_error_count() == 0) do
 
   resolve_error = (resolved_count == 0)
 
+  if (resolve_error) then
+    retry_list = {}
+    waiting_table = {}
+    waiting_count = 0
+    for node in SEDS.root:iterate_subtree() do
+      if (SEDS_SIZE_RESOLVE_TABLE[node.entity_type] and not resolve_table[node]) then
+        work_queue[1 + #work_queue] = node
+      end
+    end
+  end
+
 end
 
+SEDS.debug("resolve sizes", string.format("%d attempts in %d rounds, %.3f sec",
+  attempt_count, round_count, os.clock() - start_time))
+
 SEDS.info ("SEDS resolve sizes END")
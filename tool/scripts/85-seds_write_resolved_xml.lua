@@ -26,6 +26,9 @@
 -- that have the preprocessor attributes filled in with real values
 -- used in the mission.  These files may be passed to other tools which
 -- may not understand the ${} replacement syntax
+--
+-- SEDS_PARALLEL_SAFE: this script only reads the DOM and writes its own
+-- output files, so it may be executed in a separate worker process.
 -- -------------------------------------------------------------------------
 
 -- -------------------------------------------------------------------------
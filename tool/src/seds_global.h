@@ -134,6 +134,13 @@ typedef struct
      */
     seds_integer_t verbosity;
 
+    /**
+     * Maximum number of worker processes used to run parallel-safe scripts.
+     * A value of 1 runs all scripts sequentially in the main process.
+     * This may be set using the "-j" command line option.
+     */
+    seds_integer_t max_jobs;
+
     /*
      * The following fields do not hold any values themselves,
      * but rather the address serves as a unique key into the Lua
@@ -142,6 +149,7 @@ typedef struct
     const char GLOBAL_SYMBOL_TABLE_KEY;         /**< Key for Lua table containing SEDS defines */
     const char POSTPROCCESING_SCRIPT_TABLE_KEY; /**< Key for Lua table containing postprocessing scripts */
     const char CURRENT_SCRIPT_KEY;              /**< Key for currently-running script */
+    const char PARALLEL_SAFE_SCRIPT_TABLE_KEY;  /**< Key for Lua table containing names of parallel-safe scripts */
 
 } seds_toplevel_t;
 
@@ -56,6 +56,11 @@
 
 static const char SEDS_CDECL_OUTPUT_DEFAULT_LINE_ENDING[]  = "\n";
 
+/**
+ * If set, the name of every completed output file is appended to this file
+ */
+static FILE *seds_output_manifest_fp = NULL;
+
 /**
  * Output file record which maps to a Lua userdata filehandle object
  */
@@ -532,10 +537,25 @@ void seds_output_file_close(seds_output_file_t *pfile)
             /* result file was different, so rename the new one overwriting the old one */
             rename(namebuf,pfile->output_file_name);
         }
+
+        if (seds_output_manifest_fp != NULL)
+        {
+            fprintf(seds_output_manifest_fp, "%s\n", pfile->output_file_name);
+        }
     }
 }
 
 
+/*
+ * ------------------------------------------------------
+ * External API function - see full details in prototype.
+ * ------------------------------------------------------
+ */
+void seds_outputfile_set_manifest(FILE *manifest_fp)
+{
+    seds_output_manifest_fp = manifest_fp;
+}
+
 /* ------------------------------------------------------------------- */
 /**
  * Open an output file.
@@ -31,6 +31,8 @@
 #ifndef _SEDS_OUTPUTFILE_H_
 #define _SEDS_OUTPUTFILE_H_
 
+#include <stdio.h>
+
 #include "seds_global.h"
 
 /*******************************************************************************/
@@ -47,5 +49,16 @@
  */
 void seds_outputfile_register_globals(lua_State *lua);
 
+/**
+ * Record the name of every output file that is completed
+ *
+ * After this is called, the full name of each output file is written to the
+ * given file as a separate line when the output file is closed.  This is used
+ * to collect the set of files generated by a worker process.
+ *
+ * @param manifest_fp the file to write names to, or NULL to stop recording
+ */
+void seds_outputfile_set_manifest(FILE *manifest_fp);
+
 #endif  /* _SEDS_OUTPUTFILE_H_ */
 
@@ -44,11 +44,16 @@
 #include "edslib_init.h"
 #include "edslib_datatypedb.h"
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <getopt.h>
 #include <ctype.h>
 #include <string.h>
 #include <strings.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 
 
 
@@ -58,6 +63,15 @@
  */
 static const char SEDS_RUNTIME_SCRIPT_FILE[] = "seds_runtime.lua";
 
+/**
+ * Marker that a script may place in its leading comment block to declare
+ * that it is safe to execute in a separate worker process.
+ *
+ * Such a script must only read the DOM and write its own output files.  Any
+ * changes it makes to the DOM or Lua globals are not visible to other scripts.
+ */
+static const char SEDS_PARALLEL_SAFE_MARKER[] = "SEDS_PARALLEL_SAFE";
+
 /**
  * Main global state object
  *
@@ -161,6 +175,51 @@ static void seds_parse_commandline_symbol(lua_State *lua, const char *sym)
     }
 }
 
+/**
+ * Check if a Lua script declares itself as parallel-safe
+ *
+ * Only the leading comment block of the file is examined; the marker
+ * string must appear in a comment before the first line of code.
+ */
+static seds_boolean_t seds_check_parallel_safe(const char *filename)
+{
+    FILE *fp;
+    char linebuf[256];
+    const char *p;
+    seds_boolean_t result;
+
+    result = false;
+    fp = fopen(filename, "r");
+    if (fp == NULL)
+    {
+        return false;
+    }
+
+    while (!result && fgets(linebuf, sizeof(linebuf), fp) != NULL)
+    {
+        p = linebuf;
+        while (isspace((unsigned char)*p))
+        {
+            ++p;
+        }
+        if (*p == 0)
+        {
+            /* blank line */
+            continue;
+        }
+        if (strncmp(p, "--", 2) != 0)
+        {
+            /* end of the leading comment block */
+            break;
+        }
+        result = (strstr(p, SEDS_PARALLEL_SAFE_MARKER) != NULL);
+    }
+
+    fclose(fp);
+
+    return result;
+}
+
 /**
  * Helper function to read all files supplied on the command line.
  *
@@ -240,6 +299,13 @@ static void seds_parse_commandline_files(lua_State *lua, int argc, char **argv)
                 if (luaL_loadfile(lua, argv[arg]) == LUA_OK)
                 {
                     lua_rawset(lua, -3);
+                    if (seds_check_parallel_safe(argv[arg]))
+                    {
+                        lua_rawgetp(lua, LUA_REGISTRYINDEX, &sedstool.PARALLEL_SAFE_SCRIPT_TABLE_KEY);
+                        lua_pushboolean(lua, 1);
+                        lua_setfield(lua, -2, filename);
+                        lua_pop(lua, 1);
+                    }
                 }
                 else
                 {
@@ -299,6 +365,9 @@ static void seds_gencdecl_initialize_post_processing(lua_State *lua)
 
     lua_newtable(lua);
     lua_rawsetp(lua, LUA_REGISTRYINDEX, &sedstool.POSTPROCCESING_SCRIPT_TABLE_KEY);
+
+    lua_newtable(lua);
+    lua_rawsetp(lua, LUA_REGISTRYINDEX, &sedstool.PARALLEL_SAFE_SCRIPT_TABLE_KEY);
 }
 
 /**
@@ -323,6 +392,288 @@ static int seds_error_handler(lua_State *lua)
     return 1;
 }
 
+/**
+ * State of a worker process executing a single parallel-safe script
+ */
+typedef struct
+{
+    pid_t pid;
+    int wait_status;
+    FILE *stdout_fp;        /**< Captured stdout of the worker */
+    FILE *stderr_fp;        /**< Captured stderr of the worker */
+    FILE *manifest_fp;      /**< Names of output files written by the worker */
+    FILE *count_fp;         /**< Message counts of the worker */
+} seds_script_worker_t;
+
+/**
+ * Helper function to execute a single processing script in the current process
+ *
+ * The Lua stack should be set up as in seds_call_user_scripts(), and the
+ * script is identified by its position in the sorted list.
+ *
+ * @returns the status code from lua_pcall()
+ */
+static int seds_run_script(lua_State *lua, lua_Integer script_idx)
+{
+    int status;
+
+    lua_rawgeti(lua, 2, script_idx);
+    lua_pushvalue(lua, -1);
+    lua_rawsetp(lua, LUA_REGISTRYINDEX, &sedstool.CURRENT_SCRIPT_KEY);
+    lua_rawget(lua, 3);
+    status = lua_pcall(lua, 0, 0, 1);
+    lua_settop(lua, 3);
+
+    return status;
+}
+
+/**
+ * Check if the script at the given position in the sorted list is parallel-safe
+ */
+static seds_boolean_t seds_script_is_parallel_safe(lua_State *lua, lua_Integer script_idx)
+{
+    seds_boolean_t result;
+
+    lua_rawgetp(lua, LUA_REGISTRYINDEX, &sedstool.PARALLEL_SAFE_SCRIPT_TABLE_KEY);
+    lua_rawgeti(lua, 2, script_idx);
+    lua_rawget(lua, -2);
+    result = lua_toboolean(lua, -1);
+    lua_pop(lua, 2);
+
+    return result;
+}
+
+/**
+ * Entry point of a worker process
+ *
+ * Executes the script with all output redirected to temporary files, then
+ * records the number of messages generated and exits.  This never returns.
+ */
+static void seds_script_worker_main(lua_State *lua, seds_script_worker_t *worker, lua_Integer script_idx)
+{
+    seds_integer_t counts[SEDS_USER_MESSAGE_MAX];
+    int msgtype;
+    int status;
+
+    for (msgtype = 0; msgtype < SEDS_USER_MESSAGE_MAX; ++msgtype)
+    {
+        counts[msgtype] = seds_user_message_get_count(msgtype);
+    }
+
+    dup2(fileno(worker->stdout_fp), STDOUT_FILENO);
+    dup2(fileno(worker->stderr_fp), STDERR_FILENO);
+    seds_outputfile_set_manifest(worker->manifest_fp);
+
+    status = seds_run_script(lua, script_idx);
+
+    /*
+     * Finalize any output files the script left open, as these would
+     * normally be closed by the garbage collector in the parent.
+     */
+    lua_gc(lua, LUA_GCCOLLECT, 0);
+
+    for (msgtype = 0; msgtype < SEDS_USER_MESSAGE_MAX; ++msgtype)
+    {
+        counts[msgtype] = seds_user_message_get_count(msgtype) - counts[msgtype];
+    }
+
+    fwrite(counts, sizeof(counts), 1, worker->count_fp);
+    fflush(worker->count_fp);
+    fflush(worker->manifest_fp);
+    fflush(stdout);
+    fflush(stderr);
+
+    /*
+     * Use _exit() here, as the Lua state and any other resources are
+     * copies belonging to the parent, and must not be cleaned up.
+     */
+    _exit((status == LUA_OK) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/**
+ * Copy the captured output of a worker process to the given stream
+ */
+static void seds_script_worker_replay(FILE *capture_fp, FILE *dest_fp)
+{
+    char buffer[512];
+    size_t len;
+
+    rewind(capture_fp);
+    while ((len = fread(buffer, 1, sizeof(buffer), capture_fp)) > 0)
+    {
+        fwrite(buffer, 1, len, dest_fp);
+    }
+    fflush(dest_fp);
+}
+
+/**
+ * Collect the results of a finished worker process
+ *
+ * This replays the captured output of the worker, accounts for its messages,
+ * and checks that no output file was also written by an earlier script in the
+ * same group.  The table of output file names is at the top of the Lua stack.
+ *
+ * @returns true if the script completed successfully
+ */
+static seds_boolean_t seds_script_worker_collect(lua_State *lua, seds_script_worker_t *worker, lua_Integer script_idx)
+{
+    seds_integer_t counts[SEDS_USER_MESSAGE_MAX];
+    char linebuf[512];
+    int msgtype;
+    int manifest_pos;
+    seds_boolean_t result;
+
+    manifest_pos = lua_gettop(lua);
+    lua_rawgeti(lua, 2, script_idx);
+
+    /*
+     * Replay everything the worker displayed, in script order.  Each stream is
+     * replayed to where it was originally directed, but the interleaving of
+     * stdout and stderr within a single script is not preserved.
+     */
+    seds_script_worker_replay(worker->stdout_fp, stdout);
+    seds_script_worker_replay(worker->stderr_fp, stderr);
+
+    rewind(worker->count_fp);
+    if (fread(counts, sizeof(counts), 1, worker->count_fp) == 1)
+    {
+        for (msgtype = 0; msgtype < SEDS_USER_MESSAGE_MAX; ++msgtype)
+        {
+            seds_user_message_add_count(msgtype, counts[msgtype]);
+        }
+    }
+
+    rewind(worker->manifest_fp);
+    while (fgets(linebuf, sizeof(linebuf), worker->manifest_fp) != NULL)
+    {
+        linebuf[strcspn(linebuf, "\n")] = 0;
+        lua_getfield(lua, manifest_pos, linebuf);
+        if (!lua_isnil(lua, -1))
+        {
+            seds_user_message_printf(SEDS_USER_MESSAGE_ERROR, lua_tostring(lua, manifest_pos + 1), 0,
+                    "output file %s also written by %s", linebuf, lua_tostring(lua, -1));
+        }
+        lua_pop(lua, 1);
+        lua_pushvalue(lua, manifest_pos + 1);
+        lua_setfield(lua, manifest_pos, linebuf);
+    }
+
+    result = (WIFEXITED(worker->wait_status) && WEXITSTATUS(worker->wait_status) == EXIT_SUCCESS);
+    if (!result)
+    {
+        if (WIFSIGNALED(worker->wait_status))
+        {
+            /*
+             * The worker aborted, which normally is due to a fatal message.  The message itself
+             * was already replayed above, but it was never counted, so account for it here.
+             */
+            seds_user_message_add_count(SEDS_USER_MESSAGE_FATAL, 1);
+        }
+        seds_user_message_printf(SEDS_USER_MESSAGE_ERROR, lua_tostring(lua, manifest_pos + 1), 0,
+                "worker process did not complete successfully");
+    }
+
+    lua_settop(lua, manifest_pos);
+
+    return result;
+}
+
+/**
+ * Helper function to execute a group of consecutive parallel-safe scripts
+ *
+ * Each script is executed in its own forked worker process, with up to
+ * sedstool.max_jobs workers active at once.  The workers receive a
+ * copy-on-write image of the DOM, which was fully resolved by the
+ * preceding (sequential) scripts.
+ *
+ * Workers may finish in any order, but their output and messages are only
+ * collected once the whole group is done, and always in script order, so
+ * the result does not depend on scheduling.
+ *
+ * @returns true if all scripts completed successfully
+ */
+static seds_boolean_t seds_run_parallel_scripts(lua_State *lua, lua_Integer first_idx, lua_Integer end_idx)
+{
+    seds_script_worker_t *workers;
+    seds_script_worker_t *worker;
+    lua_Integer next_idx;
+    lua_Integer idx;
+    seds_integer_t running;
+    seds_boolean_t result;
+    pid_t pid;
+    int wait_status;
+
+    workers = calloc(end_idx - first_idx, sizeof(*workers));
+    SEDS_ASSERT(workers != NULL, "worker allocation failed");
+
+    /* anything still buffered would otherwise be duplicated in every worker */
+    fflush(stdout);
+    fflush(stderr);
+
+    next_idx = first_idx;
+    running = 0;
+    while (next_idx < end_idx || running > 0)
+    {
+        while (next_idx < end_idx && running < sedstool.max_jobs)
+        {
+            worker = &workers[next_idx - first_idx];
+            worker->stdout_fp = tmpfile();
+            worker->stderr_fp = tmpfile();
+            worker->manifest_fp = tmpfile();
+            worker->count_fp = tmpfile();
+            SEDS_ASSERT_ERRNO(worker->stdout_fp != NULL && worker->stderr_fp != NULL &&
+                    worker->manifest_fp != NULL && worker->count_fp != NULL, tmpfile);
+
+            worker->pid = fork();
+            SEDS_ASSERT_ERRNO(worker->pid >= 0, fork);
+
+            if (worker->pid == 0)
+            {
+                seds_script_worker_main(lua, worker, next_idx);
+            }
+
+            ++running;
+            ++next_idx;
+        }
+
+        pid = wait(&wait_status);
+        if (pid < 0)
+        {
+            SEDS_ASSERT_ERRNO(errno == EINTR, wait);
+            continue;
+        }
+
+        for (idx = first_idx; idx < next_idx; ++idx)
+        {
+            worker = &workers[idx - first_idx];
+            if (worker->pid == pid)
+            {
+                worker->wait_status = wait_status;
+                worker->pid = 0;
+                --running;
+                break;
+            }
+        }
+    }
+
+    result = true;
+    lua_newtable(lua);
+    for (idx = first_idx; idx < end_idx; ++idx)
+    {
+        worker = &workers[idx - first_idx];
+        result = seds_script_worker_collect(lua, worker, idx) && result;
+        fclose(worker->stdout_fp);
+        fclose(worker->stderr_fp);
+        fclose(worker->manifest_fp);
+        fclose(worker->count_fp);
+    }
+    lua_settop(lua, 3);
+
+    free(workers);
+
+    return result;
+}
+
 /**
  * Helper function to call the processing scripts
  *
@@ -332,10 +683,19 @@ static int seds_error_handler(lua_State *lua)
  * Scripts should be executed in alphanumeric order, but the Lua "next" function
  * does not adhere to any order, so we must sort it on the fly.
  *
+ * A run of consecutive scripts that are all declared parallel-safe is executed
+ * concurrently in worker processes, if more than one job is allowed.  All other
+ * scripts are executed sequentially in this process, which also acts as a barrier
+ * between groups of parallel scripts.
+ *
  * The Lua stack should be empty at the start of this function
  */
 static void seds_call_user_scripts(lua_State *lua)
 {
+    lua_Integer num_scripts;
+    lua_Integer script_idx;
+    lua_Integer end_idx;
+
     lua_pushcfunction(lua, seds_error_handler);
     lua_newtable(lua);
     lua_rawgetp(lua, LUA_REGISTRYINDEX, &sedstool.POSTPROCCESING_SCRIPT_TABLE_KEY);
@@ -357,18 +717,35 @@ static void seds_call_user_scripts(lua_State *lua)
     /*
      * MAIN PROCESSING LOOP
      */
-    lua_pushnil(lua);
-    while (lua_next(lua, 2) != 0)
+    num_scripts = lua_rawlen(lua, 2);
+    script_idx = 1;
+    while (script_idx <= num_scripts)
     {
-        lua_pushvalue(lua, 5);
-        lua_rawsetp(lua, LUA_REGISTRYINDEX, &sedstool.CURRENT_SCRIPT_KEY);
-        lua_pushvalue(lua, 5);
-        lua_rawget(lua, 3);
-        if (lua_pcall(lua, 0, 0, 1) != LUA_OK)
+        end_idx = script_idx;
+        if (sedstool.max_jobs > 1)
         {
-            break;
+            while (end_idx <= num_scripts && seds_script_is_parallel_safe(lua, end_idx))
+            {
+                ++end_idx;
+            }
+        }
+
+        if ((end_idx - script_idx) > 1)
+        {
+            if (!seds_run_parallel_scripts(lua, script_idx, end_idx))
+            {
+                break;
+            }
+            script_idx = end_idx;
+        }
+        else
+        {
+            if (seds_run_script(lua, script_idx) != LUA_OK)
+            {
+                break;
+            }
+            ++script_idx;
         }
-        lua_pop(lua, 1);
     }
 
     lua_pushnil(lua);
@@ -384,12 +761,16 @@ static void seds_call_user_scripts(lua_State *lua)
 static void seds_usage_summary(void)
 {
     printf("\nUSAGE:\n\n");
-    printf("sedstool [-D <VAR>=<VALUE>] [-v] [-s <source_path>] file [...]\n\n");
+    printf("sedstool [-D <VAR>=<VALUE>] [-v] [-j <jobs>] [-s <source_path>] file [...]\n\n");
     printf("   -D <VAR>=<VALUE>:\n");
     printf("      adds VAR to the symbol table, similar to the \'Define\' element\n");
     printf("      in a design parameter XML file.  May be used multiple times.\n\n");
     printf("   -v:\n");
     printf("      Increase the verbosity level.  Specify twice for full debug output.\n\n");
+    printf("   -j <jobs>:\n");
+    printf("      maximum number of worker processes used to execute scripts that are\n");
+    printf("      declared as parallel-safe.  Defaults to the number of online CPUs.\n");
+    printf("      Use -j 1 to execute all scripts sequentially.\n\n");
     printf("   -s <source_path>:\n");
     printf("      specify the source path to search for supplemental Lua scripts.  This\n");
     printf("      defaults to the same location the source code was built from, but may\n");
@@ -415,6 +796,11 @@ int main(int argc, char *argv[])
     EdsLib_Initialize();
 
     memset(&sedstool,0,sizeof(sedstool));
+    sedstool.max_jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    if (sedstool.max_jobs < 1)
+    {
+        sedstool.max_jobs = 1;
+    }
 
     /*
      * Create a new Lua state and load the standard libraries
@@ -434,7 +820,7 @@ int main(int argc, char *argv[])
 
     seds_setup_base_environment(lua);
 
-    while ((arg = getopt (argc, argv, "vD:s:")) != -1)
+    while ((arg = getopt (argc, argv, "vD:s:j:")) != -1)
     {
         switch (arg)
         {
@@ -453,6 +839,14 @@ int main(int argc, char *argv[])
             sedstool.user_runtime_path = optarg;
             break;
 
+        case 'j':
+            sedstool.max_jobs = strtol(optarg, NULL, 0);
+            if (sedstool.max_jobs < 1)
+            {
+                sedstool.max_jobs = 1;
+            }
+            break;
+
         default:
             if (isprint (arg))
             {
@@ -216,6 +216,19 @@ seds_integer_t seds_user_message_get_count(seds_user_message_t msgtype)
     return result;
 }
 
+/*
+ * ------------------------------------------------------
+ * External API function - see full details in prototype.
+ * ------------------------------------------------------
+ */
+void seds_user_message_add_count(seds_user_message_t msgtype, seds_integer_t count)
+{
+    if (msgtype < SEDS_USER_MESSAGE_MAX)
+    {
+        seds_global_message_counts[msgtype] += count;
+    }
+}
+
 /*
  * ------------------------------------------------------
  * External API function - see full details in prototype.
@@ -130,6 +130,17 @@ void seds_user_message_errno(seds_user_message_t msgtype, const char *file, unsi
  */
 seds_integer_t seds_user_message_get_count(seds_user_message_t msgtype);
 
+/**
+ * Add to the number of times a message of the given type was generated
+ *
+ * This is used to account for messages that were generated and
+ * displayed by a worker process.
+ *
+ * @param msgtype the message type
+ * @param count the number of additional messages
+ */
+void seds_user_message_add_count(seds_user_message_t msgtype, seds_integer_t count);
+
 /**
  * Registers all user message output functions in the Lua state
  *